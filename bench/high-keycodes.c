@@ -0,0 +1,105 @@
+/*
+ * Copyright © 2026 agent <agent@local>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "config.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "xkbcommon/xkbcommon.h"
+#include "test/test.h"
+#include "bench.h"
+#include "utils.h"
+
+/* Number of keys with a high keycode (> XKB_KEYCODE_MAX_CONTIGUOUS) */
+#define NUM_KEYS 2048
+#define BENCHMARK_ITERATIONS 5000
+
+/*
+ * Create a keymap with sparse keycodes spread over the whole keycode range,
+ * such as the ones of a virtual keyboard or a remote desktop client.
+ */
+static char *
+make_keymap(xkb_keycode_t *keycodes)
+{
+    const xkb_keycode_t min = 0x1000;
+    const xkb_keycode_t stride = (XKB_KEYCODE_MAX - min) / NUM_KEYS;
+    for (xkb_keycode_t k = 0; k < NUM_KEYS; k++)
+        keycodes[k] = min + k * stride + (xkb_keycode_t) (random() % stride);
+
+    const size_t size = NUM_KEYS * 64 + 256;
+    char * const buf = malloc(size);
+    assert(buf);
+    size_t len = 0;
+    len += snprintf(buf + len, size - len,
+                    "xkb_keymap {\n  xkb_keycodes {\n");
+    for (size_t k = 0; k < NUM_KEYS; k++)
+        len += snprintf(buf + len, size - len, "    <K%zu> = %"PRIu32";\n",
+                        k, keycodes[k]);
+    len += snprintf(buf + len, size - len, "  };\n  xkb_symbols {\n");
+    for (size_t k = 0; k < NUM_KEYS; k++)
+        len += snprintf(buf + len, size - len, "    key <K%zu> {[U%zx]};\n",
+                        k, 0x1000 + k);
+    len += snprintf(buf + len, size - len, "  };\n};");
+    assert(len < size);
+    return buf;
+}
+
+int
+main(void)
+{
+    struct xkb_context *ctx = test_get_context(CONTEXT_NO_FLAG);
+    assert(ctx);
+
+    srandom((unsigned) time(NULL));
+
+    xkb_keycode_t keycodes[NUM_KEYS];
+    char * const keymap_str = make_keymap(keycodes);
+    struct xkb_keymap * const keymap =
+        test_compile_string(ctx, XKB_KEYMAP_FORMAT_TEXT_V1, keymap_str);
+    assert(keymap);
+    free(keymap_str);
+
+    struct xkb_state * const state = xkb_state_new(keymap);
+    assert(state);
+
+    /* Look up the keys in random order, interleaved with misses */
+    xkb_keycode_t queries[2 * NUM_KEYS];
+    for (size_t k = 0; k < NUM_KEYS; k++) {
+        queries[2 * k] = keycodes[k];
+        queries[2 * k + 1] = keycodes[k] + 1;
+    }
+    for (size_t k = ARRAY_SIZE(queries) - 1; k > 0; k--) {
+        const size_t j = (size_t) random() % (k + 1);
+        const xkb_keycode_t tmp = queries[k];
+        queries[k] = queries[j];
+        queries[j] = tmp;
+    }
+
+    struct bench bench;
+    volatile unsigned long acc_keysym = 0;
+
+    fprintf(stderr, "Benchmarking %d high keycodes lookups...\n",
+            BENCHMARK_ITERATIONS * (int) ARRAY_SIZE(queries));
+    bench_start(&bench);
+    for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
+        for (size_t k = 0; k < ARRAY_SIZE(queries); k++)
+            acc_keysym += xkb_state_key_get_one_sym(state, queries[k]);
+    }
+    bench_stop(&bench);
+
+    char *elapsed = bench_elapsed_str(&bench);
+    fprintf(stderr, "ran %d iterations in %ss\n",
+            BENCHMARK_ITERATIONS, elapsed);
+    free(elapsed);
+
+    xkb_state_unref(state);
+    xkb_keymap_unref(keymap);
+    xkb_context_unref(ctx);
+
+    return 0;
+}
@@ -76,6 +76,63 @@ bench_modern_api(struct xkb_machine *sm,
     }
 }
 
+/*
+ * Look up the keysyms of all the keys in random order, after evicting the
+ * keymap from the CPU caches. This measures the memory layout of the keymap
+ * rather than the lookup code.
+ */
+#define COLD_CACHE_ROUNDS 500
+#define COLD_CACHE_THRASH_SIZE (64u << 20)
+
+NOINLINE static long long
+bench_cold_cache_lookups(struct xkb_state *state, size_t *lookups)
+{
+    struct xkb_keymap * const keymap = xkb_state_get_keymap(state);
+    const xkb_layout_index_t num_layouts = xkb_keymap_num_layouts(keymap);
+    xkb_keycode_t keycodes[256];
+    size_t count = 0;
+    for (xkb_keycode_t kc = xkb_keymap_min_keycode(keymap);
+         kc <= xkb_keymap_max_keycode(keymap) && count < ARRAY_SIZE(keycodes);
+         kc++) {
+        if (xkb_keymap_num_layouts_for_key(keymap, kc) > 0)
+            keycodes[count++] = kc;
+    }
+
+    unsigned char * const thrash = calloc(COLD_CACHE_THRASH_SIZE, 1);
+    assert(thrash);
+    volatile unsigned long acc_keysym = 0;
+    long long nanoseconds = 0;
+    struct bench bench;
+    struct bench_time elapsed;
+
+    for (size_t r = 0; r < COLD_CACHE_ROUNDS; r++) {
+        /* Shuffle the keys and pick a layout */
+        for (size_t k = count; k > 1; k--) {
+            const size_t j = (size_t) random() % k;
+            const xkb_keycode_t tmp = keycodes[k - 1];
+            keycodes[k - 1] = keycodes[j];
+            keycodes[j] = tmp;
+        }
+        xkb_state_update_mask(state, 0, 0, 0, 0, 0,
+                              (xkb_layout_index_t) random() % num_layouts);
+
+        /* Evict the caches */
+        for (size_t k = 0; k < COLD_CACHE_THRASH_SIZE; k += 64)
+            thrash[k]++;
+
+        bench_start2(&bench);
+        for (size_t k = 0; k < count; k++)
+            acc_keysym += xkb_state_key_get_one_sym(state, keycodes[k]);
+        bench_stop2(&bench);
+        bench_elapsed(&bench, &elapsed);
+        nanoseconds += bench_time_elapsed_nanoseconds(&elapsed);
+    }
+
+    free(thrash);
+    *lookups = COLD_CACHE_ROUNDS * count;
+    return nanoseconds;
+}
+
 int
 main(void)
 {
@@ -163,6 +220,19 @@ main(void)
             average, BENCHMARK_ITERATIONS, elapsed_str);
     free(elapsed_str);
 
+    /*
+     * Cold cache lookups
+     */
+
+    state = xkb_state_new(keymap);
+    assert(state);
+    size_t lookups = 0;
+    const long long cold_nanoseconds = bench_cold_cache_lookups(state, &lookups);
+    xkb_state_unref(state);
+
+    fprintf(stdout, "Cold cache lookups: average=%lldns; %zu lookups\n",
+            cold_nanoseconds / (long long) lookups, lookups);
+
     xkb_keymap_unref(keymap);
     xkb_context_unref(ctx);
 
@@ -0,0 +1,87 @@
+/*
+ * Copyright © 2026 agent <agent@local>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "xkbcommon/xkbcommon.h"
+#include "src/utf8-decoding.h"
+
+#include "../test/test.h"
+#include "bench.h"
+
+#define BENCHMARK_ITERATIONS 20000
+
+/* Pasted text in various scripts, exercising both the keysym table and the
+ * direct Unicode encoding fallback. */
+static const char *corpus[] = {
+    "The quick brown fox jumps over the lazy dog.",
+    "Voix ambiguë d’un cœur qui, au zéphyr, préfère les jattes de kiwis.",
+    "Zwölf Boxkämpfer jagen Viktor quer über den großen Sylter Deich.",
+    "Pójdźże, kiń tę chmurność w głąb flaszy!",
+    "Příliš žluťoučký kůň úpěl ďábelské ódy.",
+    "Τάχιστη αλώπηξ βαφής ψημένη γη, δρασκελίζει υπέρ νωθρού κυνός.",
+    "Съешь же ещё этих мягких французских булок, да выпей чаю.",
+    "Чуєш їх, доцю, га? Кумедна ж ти, прощайся без ґольфів!",
+    "עטלף אבק נס דרך מזגן שהתפוצץ כי חם.",
+    "نص حكيم له سر قاطع وذو شأن عظيم مكتوب على ثوب أخضر ومغلف بجلد أزرق.",
+    "いろはにほへと ちりぬるを わかよたれそ つねならむ",
+    "イロハニホヘト チリヌルヲ ワカヨタレソ ツネナラム",
+    "เป็นมนุษย์สุดประเสริฐเลิศคุณค่า",
+    "키스의 고유조건은 입술끼리 만나야 하고 특별한 기술은 필요치 않다.",
+    "ᠮᠣᠩᠭᠣᠯ ᠪᠢᠴᠢᠭ ∀x∈ℝ: x² ≥ 0 → √x ∊ ℝ₊ €100 № 5 ☺",
+    "Ả Ạ Ắ Ằ Ẳ Ẵ Ặ Ấ Ầ Ẩ Ẫ Ậ Ẻ Ẽ Ẹ Ế Ề Ể Ễ Ệ Ỉ Ị Ỏ Ọ Ố Ồ Ổ Ỗ Ộ Ớ Ờ Ở Ỡ Ợ",
+    "Հայերեն ქართული ಕನ್ನಡ 中文 日本語 😀",
+};
+
+int
+main(void)
+{
+    /* Decode the corpus once, so that we only measure the conversion */
+    size_t capacity = 0;
+    for (size_t k = 0; k < ARRAY_SIZE(corpus); k++)
+        capacity += strlen(corpus[k]);
+    uint32_t *codepoints = calloc(capacity, sizeof(*codepoints));
+    assert(codepoints);
+
+    size_t count = 0;
+    for (size_t k = 0; k < ARRAY_SIZE(corpus); k++) {
+        const char *s = corpus[k];
+        size_t remaining = strlen(s);
+        while (remaining > 0) {
+            size_t length = 0;
+            const uint32_t cp = utf8_next_code_point(s, remaining, &length);
+            assert(cp != INVALID_UTF8_CODE_POINT && length > 0);
+            codepoints[count++] = cp;
+            s += length;
+            remaining -= length;
+        }
+    }
+
+    struct bench bench;
+    uint64_t checksum = 0;
+
+    fprintf(stderr, "Benchmarking xkb_utf32_to_keysym...\n");
+    bench_start(&bench);
+    for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
+        for (size_t c = 0; c < count; c++)
+            checksum += xkb_utf32_to_keysym(codepoints[c]);
+    }
+    bench_stop(&bench);
+
+    char *elapsed = bench_elapsed_str(&bench);
+    fprintf(stderr,
+            "Converted %d times %zu code points in %ss (checksum: 0x%"PRIx64")\n",
+            BENCHMARK_ITERATIONS, count, elapsed, checksum);
+    free(elapsed);
+
+    free(codepoints);
+
+    return 0;
+}
@@ -1,20 +1,46 @@
 /*
  * A target program for fuzzing the XKB keymap text format.
  *
- * Currently, just parses an input file, and hopefully doesn't crash or hang.
+ * Parses an input file with both the bison parser and the recursive descent
+ * parser, and hopefully doesn't crash or hang. Aborts if the parsers
+ * disagree on the result, so that the fuzzer reports the input as a crash.
  */
 #include "config.h"
 
 #include <assert.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "xkbcommon/xkbcommon.h"
+#include "context.h"
+
+static char *
+compile(struct xkb_context *ctx, enum xkb_parser parser, const char *path)
+{
+    FILE *file;
+    struct xkb_keymap *keymap;
+    char *dump;
+
+    xkb_context_set_parser(ctx, parser);
+    file = fopen(path, "rb");
+    assert(file);
+    keymap = xkb_keymap_new_from_file(ctx, file,
+                                      XKB_KEYMAP_FORMAT_TEXT_V1,
+                                      XKB_KEYMAP_COMPILE_NO_FLAGS);
+    fclose(file);
+    if (!keymap)
+        return NULL;
+    dump = xkb_keymap_get_as_string(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT);
+    assert(dump);
+    xkb_keymap_unref(keymap);
+    return dump;
+}
 
 int
 main(int argc, char *argv[])
 {
     struct xkb_context *ctx;
-    FILE *file;
-    struct xkb_keymap *keymap;
+    char *bison = NULL, *descent = NULL;
 
     if (argc != 2) {
         fprintf(stderr, "usage: %s <file>\n", argv[0]);
@@ -30,15 +56,16 @@ main(int argc, char *argv[])
     while (__AFL_LOOP(1000))
 #endif
     {
-        file = fopen(argv[1], "rb");
-        assert(file);
-        keymap = xkb_keymap_new_from_file(ctx, file,
-                                          XKB_KEYMAP_FORMAT_TEXT_V1,
-                                          XKB_KEYMAP_COMPILE_NO_FLAGS);
-        xkb_keymap_unref(keymap);
-        fclose(file);
+        free(bison);
+        free(descent);
+        bison = compile(ctx, XKB_PARSER_BISON, argv[1]);
+        descent = compile(ctx, XKB_PARSER_DESCENT, argv[1]);
+        if (!bison != !descent || (bison && strcmp(bison, descent) != 0))
+            abort();
     }
 
-    puts(keymap ? "OK" : "FAIL");
+    puts(bison ? "OK" : "FAIL");
+    free(bison);
+    free(descent);
     xkb_context_unref(ctx);
 }
@@ -612,6 +612,129 @@ xkb_compose_state_get_utf8(struct xkb_compose_state *state,
 XKB_EXPORT xkb_keysym_t
 xkb_compose_state_get_one_sym(struct xkb_compose_state *state);
 
+/**
+ * @struct xkb_text_planner
+ * Opaque text planner object.
+ *
+ * A text planner computes the key strokes required to type a text with a
+ * given keymap, e.g. to implement a virtual keyboard or to automate text
+ * input. It is the inverse of the usual key processing: keysym lookup in
+ * `xkb_state` followed by the optional Compose processing in
+ * `xkb_compose_state`.
+ *
+ * The planner:
+ *
+ * - types each character directly if possible, pressing the required
+ *   modifiers and switching the layout if needed;
+ * - otherwise falls back to the shortest Compose sequence, if a Compose
+ *   table was provided;
+ * - minimizes the modifier and layout changes over the whole text, e.g.
+ *   typing `"ABC"` holds the Shift modifier only once.
+ *
+ * Modifiers are set using keys that set them with no other modifier active,
+ * e.g. `Shift_L`. Layouts are switched using keys with a `LockGroup()`
+ * action, e.g. `ISO_Next_Group`.
+ *
+ * A planner is not thread-safe: it reuses its internal buffers between
+ * calls, so that planning does not allocate memory in the common case.
+ *
+ * @since 1.14.0
+ */
+struct xkb_text_planner;
+
+/**
+ * @enum xkb_text_planner_flags
+ * Flags for `xkb_text_planner_new()`.
+ *
+ * @since 1.14.0
+ */
+enum xkb_text_planner_flags {
+    /** Do not apply any flags. */
+    XKB_TEXT_PLANNER_NO_FLAGS = 0
+};
+
+/**
+ * A key stroke planned by `xkb_text_planner_plan()`.
+ *
+ * @since 1.14.0
+ */
+struct xkb_key_stroke {
+    /** The keycode of the key */
+    xkb_keycode_t keycode;
+    /** Whether the key is pressed or released */
+    enum xkb_key_direction direction;
+};
+
+/**
+ * Create a new text planner.
+ *
+ * @param keymap
+ *     The keymap used to type the text. The planner takes a reference on it.
+ * @param table
+ *     An optional Compose table used to type the characters that have no
+ *     direct key, or `NULL`. The planner takes a reference on it.
+ * @param flags
+ *     Optional flags for the planner, or 0.
+ *
+ * @returns A new text planner, or `NULL` on failure.
+ *
+ * @sa `xkb_text_planner_destroy()`
+ * @memberof xkb_text_planner
+ * @since 1.14.0
+ */
+XKB_EXPORT struct xkb_text_planner *
+xkb_text_planner_new(struct xkb_keymap *keymap,
+                     struct xkb_compose_table *table,
+                     enum xkb_text_planner_flags flags);
+
+/**
+ * Free a text planner.
+ *
+ * @memberof xkb_text_planner
+ * @since 1.14.0
+ */
+XKB_EXPORT void
+xkb_text_planner_destroy(struct xkb_text_planner *planner);
+
+/**
+ * Plan the key strokes required to type a text.
+ *
+ * The plan starts from the layout and the locked modifiers of @p state,
+ * which is not modified. The state is expected to have no key pressed and
+ * no latched modifier or layout; locked modifiers such as Caps Lock are
+ * taken into account but never changed. All the modifiers pressed by the
+ * plan are released at its end, but the layout switches are not reverted.
+ *
+ * When a Compose table is used, the Compose state is expected to be idle
+ * at the start of the plan.
+ *
+ * @param[in]  planner The text planner.
+ * @param[in]  state   The keyboard state to start from. It must use the same
+ * keymap as the planner.
+ * @param[in]  text    The UTF-8 encoded text to type.
+ * @param[in]  length  The length of @p text, in bytes.
+ * @param[out] strokes A buffer to write the key strokes into.
+ * @param[in]  size    The number of key strokes that @p strokes can hold.
+ *
+ * @returns
+ *   The number of key strokes required to type the text, or -1 if the text
+ *   is not valid UTF-8, contains a character that cannot be typed, or on
+ *   allocation failure.
+ * @returns
+ *   Only the first @p size key strokes are written. You may check if
+ *   truncation has occurred by comparing the return value with @p size,
+ *   similarly to the `snprintf(3)` function. You may safely pass `NULL`
+ *   and 0 to @p strokes and @p size to find the required size.
+ *
+ * @memberof xkb_text_planner
+ * @since 1.14.0
+ */
+XKB_EXPORT int
+xkb_text_planner_plan(struct xkb_text_planner *planner,
+                      struct xkb_state *state,
+                      const char *text, size_t length,
+                      struct xkb_key_stroke *strokes, size_t size);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -152,6 +152,14 @@ enum xkb_error_code {
      * @since 1.14.0
      */
     XKB_ERROR_ALLOCATION_FAILURE = 550,
+    /**
+     * Cannot write the keymap serialization
+     *
+     * The sink of a streaming keymap serialization reported a write failure.
+     *
+     * @since 1.14.0
+     */
+    XKB_ERROR_KEYMAP_SERIALIZATION_WRITE_FAILURE = 727,
     /**
      * Unsupported keymap serialization flags
      *
@@ -71,8 +71,12 @@ extern "C" {
  *    `xcb_xkb_select_events_aux()` request.
  * 7. When `NewKeyboardNotify` or `MapNotify` are received, recreate the
  *    `xkb_keymap` and `xkb_state` as described above.
- * 8. When `StateNotify` is received, update the `xkb_state` accordingly
- *    using the `xkb_state::xkb_state_update_mask()` function.
+ * 8. When `StateNotify` or `ControlsNotify` are received, update the
+ *    `xkb_state` accordingly using the
+ *    `xkb_state::xkb_x11_state_update_from_state_notify()` and
+ *    `xkb_state::xkb_x11_state_update_from_controls_notify()` functions, or
+ *    `xkb_state::xkb_x11_state_update_from_events()` to coalesce a batch of
+ *    queued events.
  *
  * @note It is also possible to use the `KeyPress`/`KeyRelease` @p state
  * field to find the effective modifier and layout state, instead of
@@ -194,6 +198,128 @@ xkb_x11_keymap_new_from_device(struct xkb_context *context,
                                int32_t device_id,
                                enum xkb_keymap_compile_flags flags);
 
+struct xcb_xkb_map_notify_event_t;
+struct xcb_xkb_state_notify_event_t;
+struct xcb_xkb_controls_notify_event_t;
+
+/**
+ * Update a keymap after an `XkbMapNotify` event.
+ *
+ * Instead of fetching the whole keymap again, only the keys in the ranges
+ * reported by the event are requested; the rest of the keymap is copied from
+ * the previous keymap.
+ *
+ * Changes of the key types, of the virtual modifiers or of the keycodes range
+ * affect the whole keymap: in this case, the keymap is fetched again as with
+ * `xkb_keymap::xkb_x11_keymap_new_from_device()`.
+ *
+ * @param keymap
+ *     The current keymap of the device, created with
+ *     `xkb_keymap::xkb_x11_keymap_new_from_device()` or a previous call to this
+ *     function. It is not modified.
+ * @param connection
+ *     An XCB connection to the X server.
+ * @param event
+ *     The `XkbMapNotify` event of the device.
+ *
+ * @returns The updated keymap, or `NULL` on failure. If the event reports no
+ * relevant change, e.g. only key behaviors, a new reference to `keymap` is
+ * returned.
+ *
+ * @memberof xkb_keymap
+ * @since 1.14.0
+ */
+XKB_EXPORT struct xkb_keymap *
+xkb_x11_keymap_new_from_map_notify(struct xkb_keymap *keymap,
+                                   xcb_connection_t *connection,
+                                   const struct xcb_xkb_map_notify_event_t *event);
+
+/**
+ * @struct xkb_x11_keymap_request
+ * Opaque pending keymap fetch from an X11 keyboard device.
+ *
+ * This enables fetching a keymap without blocking, e.g. from the event loop of
+ * the client:
+ *
+ * 1. Send the requests with `xkb_x11_keymap_request_new()`.
+ * 2. Whenever the X connection is readable, call
+ *    `xkb_x11_keymap_request_poll()` until it does not return 0 anymore.
+ * 3. Get the keymap with `xkb_x11_keymap_request_finish()`.
+ *
+ * @since 1.14.0
+ */
+struct xkb_x11_keymap_request;
+
+/**
+ * Send the requests to fetch the keymap of an X11 keyboard device.
+ *
+ * This is the asynchronous counterpart of
+ * `xkb_keymap::xkb_x11_keymap_new_from_device()`: the requests are sent and
+ * flushed, but the function does not wait for their replies.
+ *
+ * @param context
+ *     The context in which to create the keymap.
+ * @param connection
+ *     An XCB connection to the X server. It must outlive the request.
+ * @param device_id
+ *     An XInput device ID (in the range 0-127) with input class KEY.
+ * @param flags
+ *     Optional flags for the keymap, or 0.
+ *
+ * @returns A pending keymap request, or `NULL` on failure. It must be
+ * consumed with either `xkb_x11_keymap_request_finish()` or
+ * `xkb_x11_keymap_request_destroy()`.
+ *
+ * @since 1.14.0
+ */
+XKB_EXPORT struct xkb_x11_keymap_request *
+xkb_x11_keymap_request_new(struct xkb_context *context,
+                           xcb_connection_t *connection,
+                           int32_t device_id,
+                           enum xkb_keymap_compile_flags flags);
+
+/**
+ * Process the replies available for a pending keymap request.
+ *
+ * Reading the replies may queue X events, which the client should then
+ * process with `xcb_poll_for_queued_event()` as usual.
+ *
+ * @returns 1 if all the replies have been received, so that
+ * `xkb_x11_keymap_request_finish()` will not block; 0 if some replies are
+ * still pending; -1 if the request failed.
+ *
+ * This function does not block.
+ *
+ * @since 1.14.0
+ */
+XKB_EXPORT int
+xkb_x11_keymap_request_poll(struct xkb_x11_keymap_request *request);
+
+/**
+ * Complete a pending keymap request and release it.
+ *
+ * This function blocks until the missing replies are received, if any.
+ *
+ * @returns The keymap retrieved from the X server, or `NULL` on failure.
+ *
+ * @since 1.14.0
+ */
+XKB_EXPORT struct xkb_keymap *
+xkb_x11_keymap_request_finish(struct xkb_x11_keymap_request *request);
+
+/**
+ * Cancel a pending keymap request and release it.
+ *
+ * The pending replies are discarded without blocking.
+ *
+ * @param request The request to cancel. If it is `NULL`, this function
+ * does nothing.
+ *
+ * @since 1.14.0
+ */
+XKB_EXPORT void
+xkb_x11_keymap_request_destroy(struct xkb_x11_keymap_request *request);
+
 /**
  * Create a new keyboard state object from an X11 keyboard device.
  *
@@ -217,6 +343,86 @@ xkb_x11_state_new_from_device(struct xkb_keymap *keymap,
                               xcb_connection_t *connection,
                               int32_t device_id);
 
+/**
+ * Update a keyboard state from an `XkbStateNotify` event.
+ *
+ * The event carries the whole state of the device, so no request to the X
+ * server is needed.
+ *
+ * @param state
+ *     The state to update, created with
+ *     `xkb_state::xkb_x11_state_new_from_device()`.
+ * @param event
+ *     The `XkbStateNotify` event of the device of the state.
+ *
+ * @returns A mask of state components that have changed as a result of the
+ * update. If nothing in the state has changed, returns 0.
+ *
+ * @memberof xkb_state
+ * @since 1.14.0
+ */
+XKB_EXPORT enum xkb_state_component
+xkb_x11_state_update_from_state_notify(
+    struct xkb_state *state,
+    const struct xcb_xkb_state_notify_event_t *event);
+
+/**
+ * Update the enabled keyboard controls of a state from an `XkbControlsNotify`
+ * event.
+ *
+ * @param state
+ *     The state to update, created with
+ *     `xkb_state::xkb_x11_state_new_from_device()`.
+ * @param event
+ *     The `XkbControlsNotify` event of the device of the state.
+ *
+ * @returns A mask of state components that have changed as a result of the
+ * update. If nothing in the state has changed, returns 0.
+ *
+ * @memberof xkb_state
+ * @since 1.14.0
+ */
+XKB_EXPORT enum xkb_state_component
+xkb_x11_state_update_from_controls_notify(
+    struct xkb_state *state,
+    const struct xcb_xkb_controls_notify_event_t *event);
+
+/**
+ * Update a keyboard state from a batch of events.
+ *
+ * This coalesces the `XkbStateNotify` and `XkbControlsNotify` events of the
+ * device into a single update: since these events carry the whole state,
+ * only the last ones are applied. Other events are ignored.
+ *
+ * This is useful to process a burst of events, e.g. those returned by
+ * `xcb_poll_for_queued_event()`.
+ *
+ * @param state
+ *     The state to update, created with
+ *     `xkb_state::xkb_x11_state_new_from_device()`.
+ * @param device_id
+ *     The device ID of the state.
+ * @param base_event
+ *     The first event code of the XKB extension, as returned by
+ *     `xkb_x11_setup_xkb_extension()`.
+ * @param events
+ *     The events, in the order they were received.
+ * @param count
+ *     The number of events.
+ *
+ * @returns A mask of state components that have changed as a result of the
+ * update. If nothing in the state has changed, returns 0.
+ *
+ * @memberof xkb_state
+ * @since 1.14.0
+ */
+XKB_EXPORT enum xkb_state_component
+xkb_x11_state_update_from_events(struct xkb_state *state,
+                                 int32_t device_id,
+                                 uint8_t base_event,
+                                 const xcb_generic_event_t * const *events,
+                                 size_t count);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -755,6 +755,38 @@ xkb_components_names_from_rules(struct xkb_context *context,
 XKB_EXPORT int
 xkb_keysym_get_name(xkb_keysym_t keysym, char *buffer, size_t size);
 
+/**
+ * Get the names of an array of keysyms.
+ *
+ * This is the bulk version of `xkb_keysym_get_name()`.
+ *
+ * Keysyms with an explicit name are set to a static string, so that only
+ * the names of unnamed keysyms, e.g. `U1F600` or `0x12345678`, are written
+ * to @p arena.
+ *
+ * @param[in]  keysyms    The keysyms.
+ * @param[in]  count      The number of keysyms in @p keysyms.
+ * @param[out] names      An array of at least @p count strings to write the
+ * names into.  The strings are either static or point into @p arena.  An
+ * entry is set to `NULL` if the corresponding keysym is invalid or if its
+ * name does not fit in @p arena.
+ * @param[out] arena      A buffer to write the names of unnamed keysyms into.
+ * @param[in]  arena_size Capacity of @p arena.
+ *
+ * @returns The number of bytes of @p arena required to write all the names,
+ * including their `NULL` bytes, or -1 if it would exceed `INT_MAX`.
+ *
+ * You may check if some names did not fit in @p arena by comparing the return
+ * value with @p arena_size.  You may safely pass `NULL` and 0 to @p arena and
+ * @p arena_size to find the required size.
+ *
+ * @sa `xkb_keysym_get_name()`
+ * @since 1.14.0
+ */
+XKB_EXPORT int
+xkb_keysyms_get_names(const xkb_keysym_t *keysyms, size_t count,
+                      const char **names, char *arena, size_t arena_size);
+
 /**
  * @enum xkb_keysym_flags
  * Flags for xkb_keysym_from_name().
@@ -796,6 +828,30 @@ enum xkb_keysym_flags {
 XKB_EXPORT xkb_keysym_t
 xkb_keysym_from_name(const char *name, enum xkb_keysym_flags flags);
 
+/**
+ * Get the keysyms of an array of names.
+ *
+ * This is the bulk version of `xkb_keysym_from_name()`.
+ *
+ * @param[in]  names   The keysym names.  `NULL` entries are allowed.
+ * @param[in]  count   The number of names in @p names.
+ * @param[in]  flags   A set of flags controlling how the search is done.
+ * See `xkb_keysym_from_name()`.
+ * @param[out] keysyms An array of at least @p count keysyms to write the
+ * results into.  Names that cannot be resolved, as well as `NULL` entries,
+ * are set to `XKB_KEY_NoSymbol`.
+ *
+ * @returns The number of names resolved to a keysym other than
+ * `XKB_KEY_NoSymbol`, or -1 if @p flags is invalid or @p count exceeds
+ * `INT_MAX`.
+ *
+ * @sa `xkb_keysym_from_name()`
+ * @since 1.14.0
+ */
+XKB_EXPORT int
+xkb_keysyms_from_names(const char * const *names, size_t count,
+                       enum xkb_keysym_flags flags, xkb_keysym_t *keysyms);
+
 /**
  * Get the keysym corresponding to a *single* Unicode/UTF-8 encoded codepoint.
  *
@@ -837,6 +893,39 @@ xkb_utf8_to_keysym(const char *buffer, size_t size);
 XKB_EXPORT int
 xkb_keysym_to_utf8(xkb_keysym_t keysym, char *buffer, size_t size);
 
+/**
+ * Get the Unicode/UTF-8 representation of an array of keysyms.
+ *
+ * The UTF-8 representations of the keysyms are concatenated into @p buffer.
+ * Keysyms without a Unicode representation are skipped.
+ *
+ * @param[in]  keysyms The keysyms to convert.
+ * @param[in]  count   The number of keysyms in @p keysyms.
+ * @param[out] buffer  A buffer to write the UTF-8 string into.
+ * @param[in]  size    Capacity of @p buffer.
+ *
+ * @warning If the buffer passed is too small, the string is truncated
+ * (though still `NULL`-terminated), but never in the middle of a UTF-8
+ * sequence.
+ *
+ * @returns The number of bytes required for the string, excluding the
+ * `NULL` byte, or -1 if it would exceed `INT_MAX`.  If there is nothing to
+ * write, returns 0.
+ *
+ * You may check if truncation has occurred by comparing the return value
+ * with the size of @p buffer, similarly to the `snprintf(3)` function.
+ * You may safely pass `NULL` and 0 to @p buffer and @p size to find the
+ * required size (without the `NULL`-byte).
+ *
+ * This function does not perform any @ref keysym-transformations.
+ *
+ * @sa `xkb_keysym_to_utf8()`
+ * @since 1.14.0
+ */
+XKB_EXPORT int
+xkb_keysyms_to_utf8(const xkb_keysym_t *keysyms, size_t count,
+                    char *buffer, size_t size);
+
 /**
  * Get the Unicode/UTF-32 representation of a keysym.
  *
@@ -971,7 +1060,37 @@ enum xkb_context_flags {
      *
      * @since 1.5.0
      */
-    XKB_CONTEXT_NO_SECURE_GETENV = (1 << 2)
+    XKB_CONTEXT_NO_SECURE_GETENV = (1 << 2),
+    /**
+     * Cache the lookups of the files in the include paths, including the
+     * failed ones, so that e.g. the components of `include "pc+us(intl)"`
+     * statements are searched only once in each include path.
+     *
+     * The locations of the sections of the included files are cached as
+     * well, so that including e.g. `us(intl)` again only parses the `intl`
+     * section. These entries are checked against the files modification
+     * time and size.
+     *
+     * The cache is invalidated when the include paths are modified, but
+     * not when the *content* of the include paths is: use
+     * `xkb_context_include_cache_invalidate()` in this case.
+     *
+     * @since 1.14.0
+     */
+    XKB_CONTEXT_CACHE_INCLUDE_LOOKUPS = (1 << 3),
+    /**
+     * Same as `::XKB_CONTEXT_CACHE_INCLUDE_LOOKUPS`, but additionally list
+     * the directories of each file type (e.g. `symbols`) in the include paths
+     * on their first use, so that looking up a file only opens it if it
+     * exists.
+     *
+     * If supported by the platform (Linux inotify), the listed directories
+     * are watched and the cache is invalidated automatically when their
+     * content changes.
+     *
+     * @since 1.14.0
+     */
+    XKB_CONTEXT_SNAPSHOT_INCLUDE_PATHS = (1 << 4)
 };
 
 /**
@@ -1158,6 +1277,44 @@ xkb_context_num_include_paths(struct xkb_context *context);
 XKB_EXPORT const char *
 xkb_context_include_path_get(struct xkb_context *context, unsigned int index);
 
+/**
+ * Invalidate the cache of the lookups of the files in the include paths.
+ *
+ * Use it after adding or removing files in the include paths of a context
+ * created with `::XKB_CONTEXT_CACHE_INCLUDE_LOOKUPS` or
+ * `::XKB_CONTEXT_SNAPSHOT_INCLUDE_PATHS`. Modifying the include paths
+ * themselves invalidates the cache automatically.
+ *
+ * @param[in] context The context.
+ *
+ * @since 1.14.0
+ *
+ * @memberof xkb_context
+ */
+XKB_EXPORT void
+xkb_context_include_cache_invalidate(struct xkb_context *context);
+
+/**
+ * Get the statistics of the cache of the lookups of the files in the include
+ * paths.
+ *
+ * Each lookup of a file in an include path counts either as a hit, if it was
+ * resolved by the cache, or as a miss, if it required to query the file
+ * system. The counters are not reset by
+ * `xkb_context_include_cache_invalidate()`.
+ *
+ * @param[in]  context The context.
+ * @param[out] hits    The number of hits. May be `NULL`.
+ * @param[out] misses  The number of misses. May be `NULL`.
+ *
+ * @since 1.14.0
+ *
+ * @memberof xkb_context
+ */
+XKB_EXPORT void
+xkb_context_include_cache_get_stats(struct xkb_context *context,
+                                    size_t *hits, size_t *misses);
+
 /** @} */
 
 /**
@@ -1671,6 +1828,20 @@ enum xkb_keymap_serialize_flags {
      * @since 1.14.0
      */
     XKB_KEYMAP_SERIALIZE_EXPLICIT_KEY_VALUES = (1 << 5),
+    /**
+     * Produce a compact serialization, intended for wire transfer, e.g. to
+     * Wayland clients.
+     *
+     * The output is semantically equivalent to the default one, but:
+     * - optional whitespace is removed;
+     * - keysyms use the shortest of their name and their hexadecimal value;
+     * - key groups and default type fields are implicit whenever possible.
+     *
+     * This flag takes precedence over `::XKB_KEYMAP_SERIALIZE_PRETTY`.
+     *
+     * @since 1.14.0
+     */
+    XKB_KEYMAP_SERIALIZE_COMPACT = (1 << 6),
 };
 
 /**
@@ -1837,6 +2008,105 @@ xkb_keymap_serialize(const struct xkb_keymap *keymap,
                      const struct xkb_keymap_serialize_config *config,
                      struct xkb_keymap_serialize_result *result);
 
+/**
+ * Write callback for `xkb_keymap::xkb_keymap_serialize_to_callback()`.
+ *
+ * @param user_data The user data passed to
+ * `xkb_keymap::xkb_keymap_serialize_to_callback()`.
+ * @param data      The next chunk of the serialization. It is *not*
+ * `NULL`-terminated and is only valid for the duration of the call.
+ * @param length    The length of @p data, in bytes.
+ *
+ * @returns `true` if the whole chunk was written, `false` otherwise. On
+ * failure the serialization is aborted.
+ *
+ * @since 1.14.0
+ */
+typedef bool
+(*xkb_keymap_serialize_write_fn)(void *user_data,
+                                 const char *data, size_t length);
+
+/**
+ * Serialize a compiled keymap by streaming it to a callback.
+ *
+ * Same as `xkb_keymap::xkb_keymap_serialize()`, but instead of allocating the
+ * whole serialization, the library uses a small bounded buffer that is passed
+ * in chunks to @p write. This enables e.g. to write the keymap directly to the
+ * file shared with Wayland clients, without holding an intermediate copy.
+ *
+ * The concatenation of the chunks is identical to the string obtained with
+ * `xkb_keymap::xkb_keymap_serialize()`, without its terminating `NUL` byte.
+ *
+ * @param[in]     keymap    The keymap to serialize.
+ * @param[in]     config    Configuration guiding the serialization.
+ * @param[in]     write     The callback receiving the chunks.
+ * @param[in]     user_data Data passed as is to @p write.
+ * @param[in,out] result    Result of the serialization.
+ *
+ * @pre The same as for `xkb_keymap::xkb_keymap_serialize()`.
+ *
+ * @post [`result->serialized`][serialized] is set to `NULL`.
+ *
+ * @post If the return value is `::XKB_SUCCESS`,
+ * [`result->length`][length] is set to the total count of bytes written,
+ * which does *not* include a terminating `NUL` byte. Since the Wayland
+ * <code>[xkb_v1]</code> format requires it, compositors must append it
+ * themselves, e.g. by truncating a memfd to `result->length + 1`.
+ *
+ * @returns `::XKB_SUCCESS` on success;
+ * `::XKB_ERROR_KEYMAP_SERIALIZATION_WRITE_FAILURE` if @p write is `NULL` or
+ * reported a failure; otherwise another [error code](@ref xkb_error_code).
+ * Note that on failure some chunks may already have been written.
+ *
+ * @sa `xkb_keymap::xkb_keymap_serialize_to_fd()`
+ * @sa `xkb_keymap::xkb_keymap_serialize_to_file()`
+ * @since 1.14.0
+ * @memberof xkb_keymap
+ *
+ * [length]: @ref xkb_keymap_serialize_result::length
+ * [serialized]: @ref xkb_keymap_serialize_result::serialized
+ * [xkb_v1]: https://wayland.freedesktop.org/docs/html/apa.html#protocol-spec-wl_keyboard-enum-keymap_format
+ */
+XKB_EXPORT enum xkb_error_code
+xkb_keymap_serialize_to_callback(
+    const struct xkb_keymap *keymap,
+    const struct xkb_keymap_serialize_config *config,
+    xkb_keymap_serialize_write_fn write, void *user_data,
+    struct xkb_keymap_serialize_result *result
+);
+
+/**
+ * Serialize a compiled keymap by streaming it to a file descriptor.
+ *
+ * Same as `xkb_keymap::xkb_keymap_serialize_to_callback()`, writing the
+ * chunks at the current offset of @p fd. Interrupted writes are retried.
+ *
+ * @since 1.14.0
+ * @memberof xkb_keymap
+ */
+XKB_EXPORT enum xkb_error_code
+xkb_keymap_serialize_to_fd(const struct xkb_keymap *keymap,
+                           const struct xkb_keymap_serialize_config *config,
+                           int fd, struct xkb_keymap_serialize_result *result);
+
+/**
+ * Serialize a compiled keymap by streaming it to a file.
+ *
+ * Same as `xkb_keymap::xkb_keymap_serialize_to_callback()`, writing the
+ * chunks with `fwrite()`. The file is not flushed.
+ *
+ * @returns The same as `xkb_keymap::xkb_keymap_serialize_to_callback()`,
+ * using `::XKB_ERROR_KEYMAP_SERIALIZATION_WRITE_FAILURE` if @p file is `NULL`.
+ *
+ * @since 1.14.0
+ * @memberof xkb_keymap
+ */
+XKB_EXPORT enum xkb_error_code
+xkb_keymap_serialize_to_file(const struct xkb_keymap *keymap,
+                             const struct xkb_keymap_serialize_config *config,
+                             FILE *file,
+                             struct xkb_keymap_serialize_result *result);
+
 /**
  * Get the compiled keymap as a string.
  *
@@ -1886,6 +2156,85 @@ xkb_keymap_get_as_string2(struct xkb_keymap *keymap,
                           enum xkb_keymap_format format,
                           enum xkb_keymap_serialize_flags flags);
 
+/**
+ * Get the compiled keymap as a string cached by the keymap.
+ *
+ * The first call for a given pair of @p format and @p flags serializes the
+ * keymap as `xkb_keymap::xkb_keymap_get_as_string2()` does, then caches the
+ * result in the keymap; further calls return the same string. Since keymaps
+ * are immutable, this enables sending the same keymap to many clients without
+ * serializing it repeatedly.
+ *
+ * Thread safety: the *first* call for a given pair of @p format and @p flags
+ * serializes the keymap using the scratch buffers of the keymap context, so
+ * it must not run concurrently with other calls using the same context. Once
+ * the serialization is cached, e.g. by a first call when the keymap is
+ * created, further calls only read the cache and may be made concurrently
+ * from several threads sharing the keymap.
+ *
+ * @param[in]  keymap The keymap to get as a string.
+ * @param[in]  format The keymap format to use for the string, as in
+ * `xkb_keymap::xkb_keymap_get_as_string2()`.
+ * @param[in]  flags  Optional flags to control the serialization, or 0.
+ * @param[out] length If not `NULL`, set to the length of the string,
+ * *including* its terminating `NUL` byte.
+ *
+ * @returns The keymap as a `NULL`-terminated string, or `NULL` if unsuccessful.
+ *
+ * The returned string is owned by the keymap and must *not* be freed nor
+ * modified. It is valid as long as the caller holds a reference to the keymap.
+ *
+ * @sa `xkb_keymap::xkb_keymap_get_as_string2()`
+ * @sa `xkb_keymap::xkb_keymap_get_as_sealed_fd()`
+ * @since 1.14.0
+ * @memberof xkb_keymap
+ */
+XKB_EXPORT const char *
+xkb_keymap_get_as_shared_string(struct xkb_keymap *keymap,
+                                enum xkb_keymap_format format,
+                                enum xkb_keymap_serialize_flags flags,
+                                size_t *length);
+
+/**
+ * Get the compiled keymap as a read-only sealed file descriptor.
+ *
+ * The file descriptor is a [memfd] containing the string returned by
+ * `xkb_keymap::xkb_keymap_get_as_shared_string()`, *including* its
+ * terminating `NUL` byte, as expected by the Wayland <code>[xkb_v1]</code>
+ * format. It is sealed against any write and resize, so that it can be sent
+ * as is to untrusted clients, who may only map it with `MAP_PRIVATE`.
+ *
+ * The file descriptor is created on the first call and then cached in the
+ * keymap, as for `xkb_keymap::xkb_keymap_get_as_shared_string()`, with the
+ * same thread safety rules.
+ *
+ * @param[in]  keymap The keymap to get as a file descriptor.
+ * @param[in]  format The keymap format to use, as in
+ * `xkb_keymap::xkb_keymap_get_as_string2()`.
+ * @param[in]  flags  Optional flags to control the serialization, or 0.
+ * @param[out] size   If not `NULL`, set to the size of the file.
+ *
+ * @returns A file descriptor, or -1 if unsuccessful or unsupported on the
+ * platform.
+ *
+ * The returned file descriptor is owned by the keymap and must *not* be
+ * closed. It is valid as long as the caller holds a reference to the keymap.
+ * Note that the file offset is shared, so use `mmap()` or `pread()` rather
+ * than `read()`.
+ *
+ * @sa `xkb_keymap::xkb_keymap_get_as_shared_string()`
+ * @since 1.14.0
+ * @memberof xkb_keymap
+ *
+ * [memfd]: https://man7.org/linux/man-pages/man2/memfd_create.2.html
+ * [xkb_v1]: https://wayland.freedesktop.org/docs/html/apa.html#protocol-spec-wl_keyboard-enum-keymap_format
+ */
+XKB_EXPORT int
+xkb_keymap_get_as_sealed_fd(struct xkb_keymap *keymap,
+                            enum xkb_keymap_format format,
+                            enum xkb_keymap_serialize_flags flags,
+                            size_t *size);
+
 /** @} */
 
 /**
@@ -2081,6 +2430,30 @@ xkb_keymap_key_get_name(struct xkb_keymap *keymap, xkb_keycode_t key);
 XKB_EXPORT xkb_keycode_t
 xkb_keymap_key_by_name(struct xkb_keymap *keymap, const char *name);
 
+/**
+ * Find the keycodes of the keys with the given names.
+ *
+ * This is the bulk version of `xkb_keymap_key_by_name()`.
+ *
+ * @param[in]  keymap   The keymap.
+ * @param[in]  names    The key names, either canonical names or aliases.
+ * `NULL` entries are allowed.
+ * @param[in]  count    The number of names in @p names.
+ * @param[out] keycodes An array of at least @p count keycodes to write the
+ * results into.  Names without a corresponding key, as well as `NULL`
+ * entries, are set to `::XKB_KEYCODE_INVALID`.
+ *
+ * @returns The number of names with a corresponding key, or -1 if @p count
+ * exceeds `INT_MAX`.
+ *
+ * @sa `xkb_keymap_key_by_name()`
+ * @memberof xkb_keymap
+ * @since 1.14.0
+ */
+XKB_EXPORT int
+xkb_keymap_keys_by_names(struct xkb_keymap *keymap, const char * const *names,
+                         size_t count, xkb_keycode_t *keycodes);
+
 /**
  * Get the number of modifiers in the keymap.
  *
@@ -2334,6 +2707,69 @@ xkb_keymap_key_get_syms_by_level(struct xkb_keymap *keymap,
                                  xkb_level_index_t level,
                                  const xkb_keysym_t **syms_out);
 
+/**
+ * A position of a keysym in a keymap.
+ *
+ * @sa `xkb_keymap_keysym_get_positions()`
+ * @since 1.14.0
+ */
+struct xkb_keysym_position {
+    /** The keycode of the key */
+    xkb_keycode_t keycode;
+    /** The layout of the key */
+    xkb_layout_index_t layout;
+    /** The shift level in the layout */
+    xkb_level_index_t level;
+    /** The number of modifier masks in @ref masks */
+    uint32_t num_masks;
+    /**
+     * The modifier masks that produce the shift level, as returned by
+     * `xkb_keymap_key_get_mods_for_level()`
+     */
+    const xkb_mod_mask_t *masks;
+    /**
+     * @private
+     *
+     * Reserved for future extensions, so that adding fields does not change
+     * the size of the structure, i.e. the stride of the arrays returned by
+     * `xkb_keymap_keysym_get_positions()`.
+     *
+     * Set to `0` by the library.
+     */
+    uint64_t reserved[2];
+};
+
+/**
+ * Get all the positions in a keymap where a keysym can be typed.
+ *
+ * This API is useful for inverse key transformation, e.g. to type a text
+ * using a virtual keyboard. It is the inverse of
+ * `xkb_keymap_key_get_syms_by_level()`.
+ *
+ * Only the shift levels with exactly one keysym and which can be reached with
+ * at least one modifier mask are considered.
+ *
+ * The keymap creates a lookup table on first use, so that subsequent calls
+ * do not have to scan the whole keymap.
+ *
+ * @param[in]  keymap        The keymap.
+ * @param[in]  keysym        The keysym to look up.
+ * @param[out] positions_out An immutable array of positions, sorted by layout,
+ * shift level and keycode. It is owned by the keymap and valid as long as the
+ * keymap is.  It is set to `NULL` if there is no position.
+ *
+ * @returns The number of positions in @p positions_out, or -1 if the lookup
+ * table could not be created.
+ *
+ * @sa `xkb_keymap_key_get_syms_by_level()`
+ * @sa `xkb_keymap_key_get_mods_for_level()`
+ * @memberof xkb_keymap
+ * @since 1.14.0
+ */
+XKB_EXPORT int
+xkb_keymap_keysym_get_positions(struct xkb_keymap *keymap, xkb_keysym_t keysym,
+                                const struct xkb_keysym_position **positions_out);
+
 /**
  * Determine whether a key should repeat or not.
  *
@@ -8,6 +8,7 @@
 
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 /**
  * @file
@@ -158,7 +159,45 @@ enum rxkb_context_flags {
      *
      * @since 1.5.0
      */
-    RXKB_CONTEXT_NO_SECURE_GETENV = (1 << 2)
+    RXKB_CONTEXT_NO_SECURE_GETENV = (1 << 2),
+    /**
+     * Resolve the descriptive fields of the registry items lazily.
+     *
+     * Only the names and the popularity of the items are materialized when
+     * parsing. The descriptions, briefs, vendors and the ISO 639 and ISO 3166
+     * code lists are resolved on their first access, e.g. with
+     * `rxkb_layout_get_description()`, from the XML files retained as
+     * read-only memory mappings. Each file is released once all of its items
+     * have been resolved or destroyed.
+     *
+     * This reduces significantly the memory usage of clients that only use the
+     * names of the items. The XML files must not be modified in place while
+     * they are retained; note that replacing them, as package managers do, is
+     * safe.
+     *
+     * Items kept with e.g. `rxkb_layout_ref()` may outlive the context: the
+     * items still referenced when the context is destroyed are resolved at
+     * that time, so that their fields remain available afterwards. Iterating
+     * from such items, e.g. with `rxkb_layout_next()`, is not supported.
+     *
+     * @since 1.14.0
+     */
+    RXKB_CONTEXT_LAZY_DESCRIPTIONS = (1 << 3),
+    /**
+     * Load the XML files of the include paths concurrently, using a small
+     * pool of threads. This includes the XML files of the extensions
+     * directories, which are include paths as well.
+     *
+     * The files are merged in the include path order, so the result is
+     * identical to a sequential parsing. The log function is still only
+     * called from the thread calling `rxkb_context_parse()`.
+     *
+     * This flag has no effect if libxkbregistry was built without thread
+     * support.
+     *
+     * @since 1.14.0
+     */
+    RXKB_CONTEXT_PARALLEL_PARSING = (1 << 4)
 };
 
 /**
@@ -447,6 +486,46 @@ rxkb_model_get_vendor(struct rxkb_model *m);
 RXKB_EXPORT enum rxkb_popularity
 rxkb_model_get_popularity(struct rxkb_model *m);
 
+/**
+ * Find a model by its name.
+ *
+ * The lookup uses an index built by `rxkb_context_parse()`, so that it runs in
+ * constant time on average.
+ *
+ * The refcount of the returned model is not increased. Use `rxkb_model_ref()`
+ * if you need to keep this struct outside the immediate scope.
+ *
+ * @param ctx  The context, parsed successfully.
+ * @param name The name of the model.
+ *
+ * @returns The model or `NULL` if not found.
+ *
+ * @since 1.14.0
+ */
+RXKB_EXPORT struct rxkb_model *
+rxkb_model_find(struct rxkb_context *ctx, const char *name);
+
+/**
+ * Find the models whose name starts with the given prefix, e.g. to filter a
+ * list in a user interface.
+ *
+ * The refcount of the returned models is not increased.
+ *
+ * @param ctx    The context, parsed successfully.
+ * @param prefix The prefix of the name. An empty string matches all models.
+ * @param models The array to store the matching models into, sorted by name.
+ * It may be `NULL` if `count` is 0.
+ * @param count  The capacity of `models`.
+ *
+ * @returns The total number of matching models. If it is greater than `count`,
+ * only the first `count` models are stored.
+ *
+ * @since 1.14.0
+ */
+RXKB_EXPORT size_t
+rxkb_model_find_prefix(struct rxkb_context *ctx, const char *prefix,
+                       struct rxkb_model **models, size_t count);
+
 /**
  * Return the first layout for this context. Use this to start iterating over
  * the layouts, followed by calls to `rxkb_layout_next()`.
@@ -531,6 +610,49 @@ rxkb_layout_get_description(struct rxkb_layout *l);
 RXKB_EXPORT enum rxkb_popularity
 rxkb_layout_get_popularity(struct rxkb_layout *l);
 
+/**
+ * Find a layout by its name and variant.
+ *
+ * The lookup uses an index built by `rxkb_context_parse()`, so that it runs in
+ * constant time on average.
+ *
+ * The refcount of the returned layout is not increased. Use `rxkb_layout_ref()`
+ * if you need to keep this struct outside the immediate scope.
+ *
+ * @param ctx     The context, parsed successfully.
+ * @param name    The name of the layout.
+ * @param variant The name of the variant, or `NULL` for the base layout.
+ *
+ * @returns The layout or `NULL` if not found.
+ *
+ * @since 1.14.0
+ */
+RXKB_EXPORT struct rxkb_layout *
+rxkb_layout_find(struct rxkb_context *ctx, const char *name,
+                 const char *variant);
+
+/**
+ * Find the layouts whose name starts with the given prefix, including their
+ * variants, e.g. to filter a list in a user interface.
+ *
+ * The refcount of the returned layouts is not increased.
+ *
+ * @param ctx     The context, parsed successfully.
+ * @param prefix  The prefix of the name. An empty string matches all layouts.
+ * @param layouts The array to store the matching layouts into, sorted by name
+ * and then by variant, each base layout preceding its variants. It may be
+ * `NULL` if `count` is 0.
+ * @param count   The capacity of `layouts`.
+ *
+ * @returns The total number of matching layouts. If it is greater than
+ * `count`, only the first `count` layouts are stored.
+ *
+ * @since 1.14.0
+ */
+RXKB_EXPORT size_t
+rxkb_layout_find_prefix(struct rxkb_context *ctx, const char *prefix,
+                        struct rxkb_layout **layouts, size_t count);
+
 /**
  * Return the first option group for this context. Use this to start iterating
  * over the option groups, followed by calls to `rxkb_option_group_next()`.
@@ -604,6 +726,48 @@ rxkb_option_group_allows_multiple(struct rxkb_option_group *g);
 RXKB_EXPORT enum rxkb_popularity
 rxkb_option_group_get_popularity(struct rxkb_option_group *g);
 
+/**
+ * Find an option group by its name.
+ *
+ * The lookup uses an index built by `rxkb_context_parse()`, so that it runs in
+ * constant time on average.
+ *
+ * The refcount of the returned option group is not increased. Use
+ * `rxkb_option_group_ref()` if you need to keep this struct outside the
+ * immediate scope.
+ *
+ * @param ctx  The context, parsed successfully.
+ * @param name The name of the option group.
+ *
+ * @returns The option group or `NULL` if not found.
+ *
+ * @since 1.14.0
+ */
+RXKB_EXPORT struct rxkb_option_group *
+rxkb_option_group_find(struct rxkb_context *ctx, const char *name);
+
+/**
+ * Find the option groups whose name starts with the given prefix, e.g. to
+ * filter a list in a user interface.
+ *
+ * The refcount of the returned option groups is not increased.
+ *
+ * @param ctx    The context, parsed successfully.
+ * @param prefix The prefix of the name. An empty string matches all option
+ * groups.
+ * @param groups The array to store the matching option groups into, sorted by
+ * name. It may be `NULL` if `count` is 0.
+ * @param count  The capacity of `groups`.
+ *
+ * @returns The total number of matching option groups. If it is greater than
+ * `count`, only the first `count` option groups are stored.
+ *
+ * @since 1.14.0
+ */
+RXKB_EXPORT size_t
+rxkb_option_group_find_prefix(struct rxkb_context *ctx, const char *prefix,
+                              struct rxkb_option_group **groups, size_t count);
+
 /**
  * Return the first option for this option group. Use this to start iterating
  * over the options, followed by calls to `rxkb_option_next()`. Options are not
@@ -683,6 +847,48 @@ rxkb_option_get_popularity(struct rxkb_option *o);
 RXKB_EXPORT bool
 rxkb_option_is_layout_specific(struct rxkb_option *o);
 
+/**
+ * Find an option by its name, in any option group.
+ *
+ * The lookup uses an index built by `rxkb_context_parse()`, so that it runs in
+ * constant time on average. If several groups define the same option, the
+ * first one in iteration order is returned.
+ *
+ * The refcount of the returned option is not increased. Use `rxkb_option_ref()`
+ * if you need to keep this struct outside the immediate scope.
+ *
+ * @param ctx  The context, parsed successfully.
+ * @param name The name of the option, e.g. `grp:alt_shift_toggle`.
+ *
+ * @returns The option or `NULL` if not found.
+ *
+ * @since 1.14.0
+ */
+RXKB_EXPORT struct rxkb_option *
+rxkb_option_find(struct rxkb_context *ctx, const char *name);
+
+/**
+ * Find the options whose name starts with the given prefix, in any option
+ * group, e.g. to filter a list in a user interface.
+ *
+ * The refcount of the returned options is not increased.
+ *
+ * @param ctx     The context, parsed successfully.
+ * @param prefix  The prefix of the name, e.g. `grp:`. An empty string matches
+ * all options.
+ * @param options The array to store the matching options into, sorted by
+ * name. It may be `NULL` if `count` is 0.
+ * @param count   The capacity of `options`.
+ *
+ * @returns The total number of matching options. If it is greater than
+ * `count`, only the first `count` options are stored.
+ *
+ * @since 1.14.0
+ */
+RXKB_EXPORT size_t
+rxkb_option_find_prefix(struct rxkb_context *ctx, const char *prefix,
+                        struct rxkb_option **options, size_t count);
+
 /**
  * Increase the refcount of the argument by one.
  *
@@ -167,6 +167,56 @@ print_entries(
 )
 print("};\n")
 
+# Case-insensitive lookup: one key per case-insensitive name, mapped to the
+# index of its “best” match in name_to_keysym, i.e. the *last* entry of its
+# group of case-insensitive duplicates (see: entries_isorted).
+icase_names: list[str] = []
+icase_indexes: list[int] = []
+for name, group in itertools.groupby(
+    enumerate(entries_isorted), key=lambda e: e[1].name.casefold()
+):
+    if not name.isascii():
+        raise ValueError(f"Case-insensitive lookup requires ASCII names: {name}")
+    icase_names.append(name)
+    icase_indexes.append(tuple(group)[-1][0])
+
+icase_template = r"""
+static const uint16_t keysym_name_icase_G[] = {
+    $G
+};
+
+/* Same as keysym_name_perfect_hash(), but using ASCII lower case letters */
+static inline size_t
+keysym_name_icase_perfect_hash(const char *key)
+{
+    const char *T1 = "$S1";
+    const char *T2 = "$S2";
+    size_t h1 = 0;
+    size_t h2 = 0;
+    for (size_t i = 0; key[i] != '\0'; i++) {
+        const char c = to_lower(key[i]);
+        h1 += (size_t) (T1[i % $NS] * c);
+        h2 += (size_t) (T2[i % $NS] * c);
+    }
+    return (keysym_name_icase_G[h1 % $NG] + keysym_name_icase_G[h2 % $NG]) % $NG;
+}
+"""
+print(
+    perfect_hash.generate_code(
+        keys=icase_names,
+        template=icase_template,
+    )
+)
+
+print(
+    "/* Case-insensitive name hash -> index of the best match in name_to_keysym */"
+)
+print("static const uint16_t name_to_keysym_icase[] = {")
+for name, index in zip(icase_names, icase_indexes):
+    assert index <= UINT16_MAX
+    print(f"    {index}, /* {entries_isorted[index].name} */")
+print("};\n")
+
 
 def make_deprecated_entry(
     value,
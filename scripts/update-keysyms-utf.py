@@ -0,0 +1,218 @@
+#!/usr/bin/env python3
+
+"""
+Generate the keysym <-> Unicode lookup tables from the keysym to Unicode table
+in keysym-utf.c
+
+The keysym -> Unicode table is a two-level table of indexes into `keysymtab`:
+
+    keysymtab_offsets1[keysymtab_offsets2[ks >> shift] + (ks & mask)]
+
+The keysym range is split into blocks of (1 << shift) entries. Identical
+blocks are shared and consecutive blocks may overlap in `keysymtab_offsets1`.
+The block size is chosen to minimize the total size of the tables.
+"""
+
+import argparse
+import re
+import sys
+from dataclasses import dataclass
+from pathlib import Path
+
+# Root of the project
+SCRIPT = Path(__file__)
+ROOT = SCRIPT.parent.parent
+
+# libxkbcommon keysym <-> Unicode header
+KEYSYMS_UTF_HEADER = ROOT / "src" / "keysym-utf.h"
+
+CODEPAIR_PATTERN = re.compile(
+    r"^\s*\{\s*0x(?P<keysym>[0-9a-fA-F]+),\s*(?P<deprecated>false|true),"
+    r"\s*0x(?P<ucs>[0-9a-fA-F]+)\s*\},\s*/\*\s*(?P<comment>.*?)\s*\*/\s*$"
+)
+
+UINT16_MAX = (1 << 16) - 1
+
+
+@dataclass
+class CodePair:
+    keysym: int
+    deprecated: bool
+    ucs: int
+    comment: str
+
+
+def parse_codepairs(path: Path) -> list[CodePair]:
+    pairs: list[CodePair] = []
+    in_table = False
+    with path.open("rt", encoding="utf-8") as fd:
+        for line in fd:
+            if line.startswith("static const struct codepair keysymtab[]"):
+                in_table = True
+                continue
+            if not in_table:
+                continue
+            if line.startswith("};"):
+                break
+            if m := CODEPAIR_PATTERN.match(line):
+                pairs.append(
+                    CodePair(
+                        keysym=int(m.group("keysym"), 16),
+                        deprecated=m.group("deprecated") == "true",
+                        ucs=int(m.group("ucs"), 16),
+                        comment=m.group("comment"),
+                    )
+                )
+            elif line.strip() and not re.match(r"^\s*/\*.*\*/\s*$", line):
+                raise ValueError(f"Unexpected line in keysymtab: {line!r}")
+    if not pairs:
+        raise ValueError(f"No keysymtab entry found in: {path}")
+    return pairs
+
+
+def overlap(data: list[int], block: list[int]) -> int:
+    """Largest suffix of data that is a prefix of block"""
+    for n in range(min(len(data), len(block)), 0, -1):
+        if data[-n:] == block[:n]:
+            return n
+    return 0
+
+
+def find(data: list[int], block: list[int]) -> int:
+    for start in range(0, len(data) - len(block) + 1):
+        if data[start : start + len(block)] == block:
+            return start
+    return -1
+
+
+def compute_paged_table(
+    values: list[int], shift: int
+) -> tuple[list[int], list[int]]:
+    block_size = 1 << shift
+    values = values + [0] * (-len(values) % block_size)
+    data: list[int] = []
+    offsets: list[int] = []
+    for k in range(0, len(values), block_size):
+        block = values[k : k + block_size]
+        if (start := find(data, block)) < 0:
+            n = overlap(data, block)
+            start = len(data) - n
+            data.extend(block[n:])
+        offsets.append(start)
+    return data, offsets
+
+
+def c_int_type(values: list[int]) -> str:
+    return "uint8_t" if max(values) <= 0xff else "uint16_t"
+
+
+def c_int_type_size(values: list[int]) -> int:
+    return 1 if max(values) <= 0xff else 2
+
+
+def print_array(c_type: str, name: str, values: list[int], per_line: int) -> None:
+    print(f"static const {c_type} {name}[{len(values)}] = {{")
+    for k in range(0, len(values), per_line):
+        chunk = values[k : k + per_line]
+        print("    " + " ".join(f"0x{v:04x}," for v in chunk))
+    print("};")
+
+
+# Parse commands
+parser = argparse.ArgumentParser(
+    description="Generate the Unicode code point to keysym lookup table"
+)
+parser.add_argument(
+    "keysym_utf",
+    type=Path,
+    nargs="?",
+    default=ROOT / "src" / "keysym-utf.c",
+    help="Path to keysym-utf.c",
+)
+args = parser.parse_args()
+
+pairs = parse_codepairs(args.keysym_utf)
+
+# keysymtab is sorted by keysym: for each code point keep the first
+# non-deprecated keysym, so that the lookup is deterministic.
+by_ucs: dict[int, CodePair] = {}
+for pair in pairs:
+    if pair.deprecated or pair.keysym == 0:
+        continue
+    if pair.keysym > UINT16_MAX or pair.ucs > UINT16_MAX:
+        raise ValueError(f"Entry does not fit in 16 bits: {pair}")
+    by_ucs.setdefault(pair.ucs, pair)
+
+entries = sorted(by_ucs.values(), key=lambda p: p.ucs)
+
+print(
+    f"""
+/**
+ * This file comes from libxkbcommon and was generated by {SCRIPT.name}
+ * You can always fetch the latest version from:
+ * https://raw.github.com/xkbcommon/libxkbcommon/master/{KEYSYMS_UTF_HEADER.relative_to(ROOT)}
+ */
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * Unicode code point -> keysym mapping, sorted by code point.
+ *
+ * Derived from `keysymtab` in keysym-utf.c: deprecated keysyms are omitted
+ * and, when several keysyms map to the same code point, the lowest one wins.
+ */
+struct ucs_keysym_pair {{
+    uint16_t ucs;
+    uint16_t keysym;
+}};
+
+static const struct ucs_keysym_pair ucs_keysymtab[] = {{""".strip()
+)
+for pair in entries:
+    print(f"    {{ 0x{pair.ucs:04x}, 0x{pair.keysym:04x} }}, /* {pair.comment} */")
+print("};")
+
+# keysym -> index in keysymtab. The first entry of keysymtab is a sentinel
+# with no Unicode representation, so that index 0 means “no conversion”.
+if pairs[0].keysym != 0 or pairs[0].ucs != 0:
+    raise ValueError("The first entry of keysymtab must be the null sentinel")
+if any(p1.keysym >= p2.keysym for p1, p2 in zip(pairs, pairs[1:])):
+    raise ValueError("keysymtab must be sorted by keysym without duplicates")
+keysym_max = pairs[-1].keysym
+indexes = [0] * (keysym_max + 1)
+for k, pair in enumerate(pairs):
+    indexes[pair.keysym] = k
+
+
+def table_size(shift: int) -> int:
+    data, offsets = compute_paged_table(indexes, shift)
+    return len(data) * c_int_type_size(data) + len(offsets) * c_int_type_size(
+        offsets
+    )
+
+
+shift = min(range(2, 10), key=table_size)
+data, offsets = compute_paged_table(indexes, shift)
+
+print(
+    f"""
+/*
+ * Keysym -> index in `keysymtab`, for keysyms in the range
+ * [0, KEYSYMTAB_MAX_KEYSYM]. Index 0 is the sentinel entry with no Unicode
+ * representation.
+ */
+#define KEYSYMTAB_MAX_KEYSYM 0x{keysym_max:04x}
+"""
+)
+print_array(c_int_type(data), "keysymtab_offsets1", data, 8)
+print()
+print_array(c_int_type(offsets), "keysymtab_offsets2", offsets, 8)
+print(
+    f"""
+static inline {c_int_type(data)}
+get_keysymtab_index(uint32_t ks)
+{{
+    return keysymtab_offsets1[keysymtab_offsets2[ks >> {shift}] + (ks & 0x{(1 << shift) - 1:x})];
+}}""".rstrip()
+)
@@ -89,9 +89,9 @@ lex(struct scanner *s, union lvalue *val)
 {
 skip_more_whitespace_and_comments:
     /* Skip spaces. */
-    while (is_space(scanner_peek(s)))
-        if (scanner_next(s) == '\n')
-            return TOK_END_OF_LINE;
+    scanner_skip_chars(s, SCANNER_CHARS_SPACE_NO_EOL);
+    if (scanner_chr(s, '\n'))
+        return TOK_END_OF_LINE;
 
     /* Skip comments. */
     if (scanner_chr(s, '#')) {
@@ -108,8 +108,10 @@ skip_more_whitespace_and_comments:
 
     /* LHS Keysym. */
     if (scanner_chr(s, '<')) {
-        while (scanner_peek(s) != '>' && !scanner_eol(s) && !scanner_eof(s))
-            scanner_buf_append(s, scanner_next(s));
+        const size_t count = scanner_span(s->s + s->pos, s->len - s->pos,
+                                          SCANNER_CHARS_ANGLE_LITERAL);
+        scanner_buf_appendn(s, s->s + s->pos, count);
+        s->pos += count;
         if (!scanner_chr(s, '>')) {
             scanner_err(s, XKB_ERROR_INVALID_COMPOSE_SYNTAX,
                         "unterminated keysym literal");
@@ -175,7 +177,12 @@ skip_more_whitespace_and_comments:
                     /* Ignore. */
                 }
             } else {
-                scanner_buf_append(s, scanner_next(s));
+                /* Copy the run of regular characters at once */
+                const size_t count = scanner_span(s->s + s->pos,
+                                                  s->len - s->pos,
+                                                  SCANNER_CHARS_STRING);
+                scanner_buf_appendn(s, s->s + s->pos, count);
+                s->pos += count;
             }
         }
         if (!scanner_chr(s, '\"')) {
@@ -201,8 +208,10 @@ skip_more_whitespace_and_comments:
     /* Identifier or include. */
     if (is_alpha(scanner_peek(s)) || scanner_peek(s) == '_') {
         s->buf_pos = 0;
-        while (is_alnum(scanner_peek(s)) || scanner_peek(s) == '_')
-            scanner_buf_append(s, scanner_next(s));
+        const size_t count = scanner_span(s->s + s->pos, s->len - s->pos,
+                                          SCANNER_CHARS_IDENT);
+        scanner_buf_appendn(s, s->s + s->pos, count);
+        s->pos += count;
         if (!scanner_buf_append(s, '\0')) {
             scanner_err(s, XKB_ERROR_INVALID_COMPOSE_SYNTAX,
                         "identifier is too long");
@@ -228,9 +237,9 @@ static enum rules_token
 lex_include_string(struct scanner *s, struct xkb_compose_table *table,
                    union lvalue *val_out)
 {
-    while (is_space(scanner_peek(s)))
-        if (scanner_next(s) == '\n')
-            return TOK_END_OF_LINE;
+    scanner_skip_chars(s, SCANNER_CHARS_SPACE_NO_EOL);
+    if (scanner_chr(s, '\n'))
+        return TOK_END_OF_LINE;
 
     s->token_pos = s->pos;
     s->buf_pos = 0;
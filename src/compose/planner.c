@@ -0,0 +1,795 @@
+/*
+ * Copyright © 2026 agent <agent@local>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "config.h"
+
+#include <assert.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "xkbcommon/xkbcommon.h"
+#include "xkbcommon/xkbcommon-compose.h"
+#include "context.h"
+#include "darray.h"
+#include "keymap.h"
+#include "keysym.h"
+#include "utf8-decoding.h"
+#include "utils.h"
+#include "utils-numbers.h"
+
+/*
+ * The planner works in two passes:
+ *
+ * 1. Split the text into *steps*, i.e. keysyms to type directly. A character
+ *    is a single step if it has a direct key, else it expands to the steps
+ *    of its shortest Compose sequence. Each step has a list of *candidates*:
+ *    the distinct (layout, held modifiers) pairs that produce its keysym.
+ * 2. Select one candidate per step with a shortest path search over the
+ *    steps, where the cost of a transition is the count of modifier and
+ *    layout key strokes required between two candidates.
+ *
+ * Modifier keys and layout switches are detected once at creation, by
+ * simulating key presses with a private keyboard state.
+ */
+
+#define COST_INFINITE UINT32_MAX
+
+/** Key press that switches the layout, possibly with some modifiers */
+struct layout_switch {
+    xkb_layout_index_t from;
+    xkb_layout_index_t to;
+    xkb_keycode_t keycode;
+    /** Modifiers to hold while pressing the key */
+    xkb_mod_mask_t mods;
+    /** Modifiers of the key type */
+    xkb_mod_mask_t type_mods;
+};
+
+/** Shortest Compose sequence of a code point. Empty slots have a null count. */
+struct compose_entry {
+    uint32_t cp;
+    darray_size_t first;
+    darray_size_t count;
+};
+
+/** A way to type the keysym of a step */
+struct plan_candidate {
+    xkb_layout_index_t layout;
+    /** Modifiers to hold */
+    xkb_mod_mask_t mods;
+    xkb_keycode_t keycode;
+    /** Cost of the best plan up to this candidate */
+    uint32_t cost;
+    /** Best candidate of the previous step */
+    darray_size_t prev;
+};
+
+struct plan_step {
+    darray_size_t first;
+    darray_size_t count;
+};
+
+struct xkb_text_planner {
+    struct xkb_keymap *keymap;
+    struct xkb_compose_table *table;
+    xkb_layout_index_t num_layouts;
+
+    /** Keys that set a single modifier: [layout * XKB_MAX_MODS + index] */
+    xkb_keycode_t *mod_keys;
+    /** Modifiers that have a key, per layout */
+    xkb_mod_mask_t *mod_keys_masks;
+
+    darray(struct layout_switch) switches;
+    /**
+     * Shortest layout switch paths for `switches_locked_mods`:
+     * cost and first switch, indexed by [from * num_layouts + to].
+     */
+    uint32_t *switch_costs;
+    darray_size_t *switch_next;
+    xkb_mod_mask_t switches_locked_mods;
+    bool switches_valid;
+
+    /** Compose sequences keysyms */
+    darray(xkb_keysym_t) compose_keysyms;
+    /** Code point -> shortest Compose sequence (power of 2 hash table) */
+    struct compose_entry *compose_entries;
+    uint32_t compose_size;
+
+    /* Scratch buffers, reused between plans */
+    darray(struct plan_step) steps;
+    darray(struct plan_candidate) candidates;
+};
+
+/* Same as state.c: the level defaults to 0 if there is no matching entry */
+static inline xkb_level_index_t
+type_get_level(const struct xkb_key_type *type, xkb_mod_mask_t mods)
+{
+    mods &= type->mods.mask;
+    for (darray_size_t i = 0; i < type->num_entries; i++)
+        if (entry_is_active(&type->entries[i]) &&
+            type->entries[i].mods.mask == mods)
+            return type->entries[i].level;
+    return 0;
+}
+
+/* Next subset of `mask` in increasing order; 0 when done */
+static inline xkb_mod_mask_t
+next_subset(xkb_mod_mask_t subset, xkb_mod_mask_t mask)
+{
+    return (subset - mask) & mask;
+}
+
+static void
+init_mod_keys(struct xkb_text_planner *planner, struct xkb_state *state)
+{
+    const struct xkb_keymap * const keymap = planner->keymap;
+
+    for (xkb_layout_index_t layout = 0; layout < planner->num_layouts; layout++) {
+        xkb_keycode_t * const keys = &planner->mod_keys[layout * XKB_MAX_MODS];
+        for (xkb_mod_index_t mod = 0; mod < XKB_MAX_MODS; mod++)
+            keys[mod] = XKB_KEYCODE_INVALID;
+
+        const struct xkb_key *key;
+        xkb_keys_foreach(key, keymap) {
+            xkb_state_update_mask(state, 0, 0, 0, 0, 0, layout);
+            xkb_state_update_key(state, key->keycode, XKB_KEY_DOWN);
+            const xkb_mod_mask_t mods =
+                xkb_state_serialize_mods(state, XKB_STATE_MODS_DEPRESSED);
+            xkb_state_update_key(state, key->keycode, XKB_KEY_UP);
+            /* Keep the first key that sets exactly one modifier */
+            if (mods == 0 || (mods & (mods - 1)) != 0)
+                continue;
+            const xkb_mod_index_t mod = ctz32(mods);
+            if (keys[mod] == XKB_KEYCODE_INVALID) {
+                keys[mod] = key->keycode;
+                planner->mod_keys_masks[layout] |= mods;
+            }
+        }
+    }
+}
+
+static void
+press_mods(struct xkb_state *state, const xkb_keycode_t *keys,
+           xkb_mod_mask_t mods, enum xkb_key_direction direction)
+{
+    for (xkb_mod_index_t mod = 0; mod < XKB_MAX_MODS; mod++) {
+        if (mods & (UINT32_C(1) << mod))
+            xkb_state_update_key(state, keys[mod], direction);
+    }
+}
+
+static void
+init_layout_switches(struct xkb_text_planner *planner, struct xkb_state *state)
+{
+    const struct xkb_keymap * const keymap = planner->keymap;
+
+    const struct xkb_key *key;
+    xkb_keys_foreach(key, keymap) {
+        for (xkb_layout_index_t group = 0; group < key->num_groups; group++) {
+            const struct xkb_key_type * const type = key->groups[group].type;
+            const xkb_level_index_t num_levels = XkbKeyNumLevels(key, group);
+            for (xkb_level_index_t level = 0; level < num_levels; level++) {
+                const union xkb_action *actions = NULL;
+                const xkb_action_count_t count =
+                    xkb_keymap_key_get_actions_by_level(keymap, key, group,
+                                                        level, &actions);
+                bool lock = false;
+                for (xkb_action_count_t a = 0; a < count; a++)
+                    lock |= (actions[a].type == ACTION_TYPE_GROUP_LOCK);
+                if (!lock)
+                    continue;
+
+                /* Simulate the key press from each layout reaching the group */
+                for (xkb_layout_index_t from = 0; from < planner->num_layouts;
+                     from++) {
+                    if (xkb_keymap_key_effective_layout(key, from) != group)
+                        continue;
+                    const xkb_keycode_t * const keys =
+                        &planner->mod_keys[from * XKB_MAX_MODS];
+                    const xkb_mod_mask_t available =
+                        type->mods.mask & planner->mod_keys_masks[from];
+                    xkb_mod_mask_t mods = 0;
+                    do {
+                        if (type_get_level(type, mods) != level)
+                            continue;
+                        xkb_state_update_mask(state, 0, 0, 0, 0, 0, from);
+                        press_mods(state, keys, mods, XKB_KEY_DOWN);
+                        const bool mods_ok = mods ==
+                            xkb_state_serialize_mods(state,
+                                                     XKB_STATE_MODS_DEPRESSED);
+                        xkb_state_update_key(state, key->keycode, XKB_KEY_DOWN);
+                        xkb_state_update_key(state, key->keycode, XKB_KEY_UP);
+                        press_mods(state, keys, mods, XKB_KEY_UP);
+                        const xkb_layout_index_t to =
+                            xkb_state_serialize_layout(state,
+                                                       XKB_STATE_LAYOUT_EFFECTIVE);
+                        if (!mods_ok || to == from)
+                            continue;
+                        const struct layout_switch s = {
+                            .from = from,
+                            .to = to,
+                            .keycode = key->keycode,
+                            .mods = mods,
+                            .type_mods = type->mods.mask,
+                        };
+                        darray_append(planner->switches, s);
+                    } while ((mods = next_subset(mods, available)) != 0);
+                }
+            }
+        }
+    }
+}
+
+/* Shortest layout switch paths (Floyd–Warshall), for the given locked mods */
+static void
+update_layout_switches(struct xkb_text_planner *planner,
+                       xkb_mod_mask_t locked_mods)
+{
+    if (planner->switches_valid && planner->switches_locked_mods == locked_mods)
+        return;
+
+    const xkb_layout_index_t n = planner->num_layouts;
+    uint32_t * const costs = planner->switch_costs;
+    darray_size_t * const next = planner->switch_next;
+
+    for (xkb_layout_index_t k = 0; k < n * n; k++)
+        costs[k] = COST_INFINITE;
+    for (xkb_layout_index_t k = 0; k < n; k++)
+        costs[k * n + k] = 0;
+
+    for (darray_size_t e = 0; e < darray_size(planner->switches); e++) {
+        const struct layout_switch * const s = &darray_item(planner->switches, e);
+        /* Locked modifiers must not change the level of the key */
+        if (locked_mods & s->type_mods & ~s->mods)
+            continue;
+        const uint32_t cost = 2 + 2 * popcount32(s->mods & ~locked_mods);
+        if (cost < costs[s->from * n + s->to]) {
+            costs[s->from * n + s->to] = cost;
+            next[s->from * n + s->to] = e;
+        }
+    }
+
+    for (xkb_layout_index_t k = 0; k < n; k++) {
+        for (xkb_layout_index_t i = 0; i < n; i++) {
+            if (costs[i * n + k] == COST_INFINITE)
+                continue;
+            for (xkb_layout_index_t j = 0; j < n; j++) {
+                if (costs[k * n + j] == COST_INFINITE)
+                    continue;
+                const uint32_t cost = costs[i * n + k] + costs[k * n + j];
+                if (cost < costs[i * n + j]) {
+                    costs[i * n + j] = cost;
+                    next[i * n + j] = next[i * n + k];
+                }
+            }
+        }
+    }
+
+    planner->switches_locked_mods = locked_mods;
+    planner->switches_valid = true;
+}
+
+static inline uint32_t
+compose_slot(const struct xkb_text_planner *planner, uint32_t cp)
+{
+    const uint32_t mask = planner->compose_size - 1;
+    /* Fibonacci hashing */
+    uint32_t slot = (cp * UINT32_C(2654435761)) & mask;
+    while (planner->compose_entries[slot].count != 0 &&
+           planner->compose_entries[slot].cp != cp)
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+static int
+compose_entry_compare(const void *a, const void *b)
+{
+    const struct compose_entry * const e1 = a;
+    const struct compose_entry * const e2 = b;
+    if (e1->cp != e2->cp)
+        return (e1->cp < e2->cp) ? -1 : 1;
+    if (e1->count != e2->count)
+        return (e1->count < e2->count) ? -1 : 1;
+    if (e1->first != e2->first)
+        return (e1->first < e2->first) ? -1 : 1;
+    return 0;
+}
+
+/* Get the single code point a Compose entry produces, or 0 */
+static uint32_t
+compose_entry_code_point(struct xkb_compose_table_entry *entry)
+{
+    const char * const utf8 = xkb_compose_table_entry_utf8(entry);
+    if (utf8[0] == '\0')
+        return xkb_keysym_to_utf32(xkb_compose_table_entry_keysym(entry));
+
+    const size_t length = strlen(utf8);
+    size_t cp_length = 0;
+    const uint32_t cp = utf8_next_code_point(utf8, length, &cp_length);
+    if (cp == INVALID_UTF8_CODE_POINT || cp_length != length)
+        return 0;
+    return cp;
+}
+
+static bool
+init_compose(struct xkb_text_planner *planner)
+{
+    darray(struct compose_entry) found = darray_new();
+
+    struct xkb_compose_table_iterator * const iter =
+        xkb_compose_table_iterator_new(planner->table);
+    if (!iter)
+        return false;
+
+    struct xkb_compose_table_entry *entry;
+    while ((entry = xkb_compose_table_iterator_next(iter))) {
+        const uint32_t cp = compose_entry_code_point(entry);
+        if (cp == 0)
+            continue;
+
+        size_t length = 0;
+        const xkb_keysym_t * const sequence =
+            xkb_compose_table_entry_sequence(entry, &length);
+
+        /* Skip the sequences that cannot be typed with the keymap */
+        bool typeable = true;
+        for (size_t k = 0; k < length && typeable; k++) {
+            const struct xkb_keysym_position *positions = NULL;
+            typeable = xkb_keymap_keysym_get_positions(planner->keymap,
+                                                       sequence[k],
+                                                       &positions) > 0;
+        }
+        if (!typeable)
+            continue;
+
+        const struct compose_entry e = {
+            .cp = cp,
+            .first = darray_size(planner->compose_keysyms),
+            .count = (darray_size_t) length,
+        };
+        darray_append_items(planner->compose_keysyms, sequence,
+                            (darray_size_t) length);
+        darray_append(found, e);
+    }
+    xkb_compose_table_iterator_free(iter);
+
+    /* Keep the shortest sequence, then the first in lexicographic order */
+    if (!darray_empty(found))
+        qsort(darray_items(found), darray_size(found),
+              sizeof(darray_item(found, 0)), compose_entry_compare);
+
+    darray_size_t count = 0;
+    for (darray_size_t k = 0; k < darray_size(found); k++) {
+        if (k == 0 || darray_item(found, k).cp != darray_item(found, k - 1).cp)
+            count++;
+    }
+
+    /* Load factor ≤ 1/2 */
+    planner->compose_size = next_pow2(MAX(2 * count, 16u));
+    planner->compose_entries = calloc(planner->compose_size,
+                                      sizeof(*planner->compose_entries));
+    if (!planner->compose_entries) {
+        darray_free(found);
+        return false;
+    }
+
+    for (darray_size_t k = 0; k < darray_size(found); k++) {
+        const struct compose_entry * const e = &darray_item(found, k);
+        const uint32_t slot = compose_slot(planner, e->cp);
+        if (planner->compose_entries[slot].count == 0)
+            planner->compose_entries[slot] = *e;
+    }
+
+    darray_free(found);
+    return true;
+}
+
+struct xkb_text_planner *
+xkb_text_planner_new(struct xkb_keymap *keymap,
+                     struct xkb_compose_table *table,
+                     enum xkb_text_planner_flags flags)
+{
+    static const enum xkb_text_planner_flags XKB_TEXT_PLANNER_FLAGS =
+        XKB_TEXT_PLANNER_NO_FLAGS;
+
+    if (flags & ~XKB_TEXT_PLANNER_FLAGS) {
+        log_err_func(keymap->ctx, XKB_LOG_MESSAGE_NO_ID,
+                     "Unsupported text planner flags: %#x\n",
+                     (flags & ~XKB_TEXT_PLANNER_FLAGS));
+        return NULL;
+    }
+
+    struct xkb_text_planner * const planner = calloc(1, sizeof(*planner));
+    if (!planner)
+        return NULL;
+
+    planner->keymap = xkb_keymap_ref(keymap);
+    planner->table = (table) ? xkb_compose_table_ref(table) : NULL;
+    /* Ensure there is at least one layout, so that the tables are not empty */
+    planner->num_layouts = MAX(xkb_keymap_num_layouts(keymap), 1u);
+
+    const xkb_layout_index_t n = planner->num_layouts;
+    planner->mod_keys = calloc((size_t) n * XKB_MAX_MODS,
+                               sizeof(*planner->mod_keys));
+    planner->mod_keys_masks = calloc(n, sizeof(*planner->mod_keys_masks));
+    planner->switch_costs = calloc((size_t) n * n,
+                                   sizeof(*planner->switch_costs));
+    planner->switch_next = calloc((size_t) n * n,
+                                  sizeof(*planner->switch_next));
+    struct xkb_state * const state = xkb_state_new(keymap);
+    if (!planner->mod_keys || !planner->mod_keys_masks ||
+        !planner->switch_costs || !planner->switch_next || !state)
+        goto error;
+
+    init_mod_keys(planner, state);
+    init_layout_switches(planner, state);
+    xkb_state_unref(state);
+
+    if (planner->table && !init_compose(planner)) {
+        log_err(keymap->ctx, XKB_ERROR_ALLOCATION_FAILURE_,
+                "Could not allocate the text planner Compose lookup table\n");
+        xkb_text_planner_destroy(planner);
+        return NULL;
+    }
+
+    return planner;
+
+error:
+    log_err(keymap->ctx, XKB_ERROR_ALLOCATION_FAILURE_,
+            "Could not allocate the text planner\n");
+    xkb_state_unref(state);
+    xkb_text_planner_destroy(planner);
+    return NULL;
+}
+
+void
+xkb_text_planner_destroy(struct xkb_text_planner *planner)
+{
+    if (!planner)
+        return;
+    free(planner->mod_keys);
+    free(planner->mod_keys_masks);
+    darray_free(planner->switches);
+    free(planner->switch_costs);
+    free(planner->switch_next);
+    darray_free(planner->compose_keysyms);
+    free(planner->compose_entries);
+    darray_free(planner->steps);
+    darray_free(planner->candidates);
+    xkb_compose_table_unref(planner->table);
+    xkb_keymap_unref(planner->keymap);
+    free(planner);
+}
+
+/* Add a candidate to the current step, unless its layout and mods are known */
+static void
+add_candidate(struct xkb_text_planner *planner, darray_size_t first,
+              xkb_layout_index_t layout, xkb_mod_mask_t mods,
+              xkb_keycode_t keycode)
+{
+    for (darray_size_t c = first; c < darray_size(planner->candidates); c++) {
+        const struct plan_candidate * const candidate =
+            &darray_item(planner->candidates, c);
+        if (candidate->layout == layout && candidate->mods == mods)
+            return;
+    }
+    const struct plan_candidate candidate = {
+        .layout = layout,
+        .mods = mods,
+        .keycode = keycode,
+        .cost = COST_INFINITE,
+        .prev = 0,
+    };
+    darray_append(planner->candidates, candidate);
+}
+
+/*
+ * Add the candidates to type a keysym to the current step.
+ *
+ * Returns false if the keysym index could not be created.
+ */
+static bool
+add_keysym_candidates(struct xkb_text_planner *planner, darray_size_t first,
+                      xkb_keysym_t keysym, xkb_layout_index_t start_layout,
+                      xkb_mod_mask_t locked_mods)
+{
+    struct xkb_keymap * const keymap = planner->keymap;
+    const xkb_mod_mask_t caps = UINT32_C(1) << XKB_MOD_INDEX_CAPS;
+
+    const struct xkb_keysym_position *positions = NULL;
+    const int count = xkb_keymap_keysym_get_positions(keymap, keysym,
+                                                      &positions);
+    if (count < 0)
+        return false;
+
+    for (int p = 0; p < count; p++) {
+        const struct xkb_keysym_position * const position = &positions[p];
+        const struct xkb_key * const key = XkbKey(keymap, position->keycode);
+        const struct xkb_key_type * const type =
+            key->groups[position->layout].type;
+        const struct xkb_level * const level =
+            &key->groups[position->layout].levels[position->level];
+
+        for (xkb_layout_index_t layout = 0; layout < planner->num_layouts;
+             layout++) {
+            if (xkb_keymap_key_effective_layout(key, layout) != position->layout ||
+                planner->switch_costs[start_layout * planner->num_layouts +
+                                      layout] == COST_INFINITE)
+                continue;
+            const xkb_mod_mask_t available =
+                type->mods.mask & planner->mod_keys_masks[layout] & ~locked_mods;
+            xkb_mod_mask_t mods = 0;
+            do {
+                const xkb_mod_mask_t active = mods | locked_mods;
+                if (type_get_level(type, active) != position->level)
+                    continue;
+                /* Caps Lock transformation, if Lock is not consumed */
+                if ((active & caps) && !(type->mods.mask & caps) &&
+                    level->upper != keysym)
+                    continue;
+                add_candidate(planner, first, layout, mods, position->keycode);
+            } while ((mods = next_subset(mods, available)) != 0);
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Append a step with the candidates to type a code point directly.
+ *
+ * Returns false if the keysym index could not be created.
+ */
+static bool
+add_code_point_step(struct xkb_text_planner *planner, uint32_t cp,
+                    xkb_layout_index_t start_layout, xkb_mod_mask_t locked_mods)
+{
+    const darray_size_t first = darray_size(planner->candidates);
+
+    const xkb_keysym_t keysym = xkb_utf32_to_keysym(cp);
+    if (keysym != XKB_KEY_NoSymbol &&
+        !add_keysym_candidates(planner, first, keysym, start_layout,
+                               locked_mods))
+        return false;
+    /* The keymap may use the Unicode keysym rather than the legacy one */
+    if (cp >= 0x100 && keysym != XKB_KEYSYM_UNICODE_OFFSET + cp &&
+        !add_keysym_candidates(planner, first, XKB_KEYSYM_UNICODE_OFFSET + cp,
+                               start_layout, locked_mods))
+        return false;
+    /* Line feed is usually typed with Return */
+    if (cp == '\n' &&
+        !add_keysym_candidates(planner, first, XKB_KEY_Return, start_layout,
+                               locked_mods))
+        return false;
+
+    const struct plan_step step = {
+        .first = first,
+        .count = darray_size(planner->candidates) - first,
+    };
+    darray_append(planner->steps, step);
+    return true;
+}
+
+static inline uint32_t
+transition_cost(const struct xkb_text_planner *planner,
+                const struct plan_candidate *from,
+                const struct plan_candidate *to)
+{
+    if (from->layout == to->layout)
+        return popcount32(from->mods ^ to->mods);
+    const uint32_t cost =
+        planner->switch_costs[from->layout * planner->num_layouts + to->layout];
+    if (cost == COST_INFINITE)
+        return COST_INFINITE;
+    /* Release all the modifiers before switching the layout */
+    return popcount32(from->mods) + cost + popcount32(to->mods);
+}
+
+struct plan_output {
+    struct xkb_key_stroke *strokes;
+    size_t size;
+    size_t count;
+};
+
+static inline void
+emit(struct plan_output *output, xkb_keycode_t keycode,
+     enum xkb_key_direction direction)
+{
+    if (output->count < output->size) {
+        output->strokes[output->count] = (struct xkb_key_stroke) {
+            .keycode = keycode,
+            .direction = direction,
+        };
+    }
+    output->count++;
+}
+
+/* Press modifiers in increasing order and release them in decreasing order */
+static void
+emit_mods(struct plan_output *output, const xkb_keycode_t *keys,
+          xkb_mod_mask_t mods, enum xkb_key_direction direction)
+{
+    while (mods) {
+        const xkb_mod_index_t mod = (direction == XKB_KEY_DOWN)
+            ? ctz32(mods)
+            : msb_pos(mods) - 1;
+        emit(output, keys[mod], direction);
+        mods &= ~(UINT32_C(1) << mod);
+    }
+}
+
+int
+xkb_text_planner_plan(struct xkb_text_planner *planner,
+                      struct xkb_state *state,
+                      const char *text, size_t length,
+                      struct xkb_key_stroke *strokes, size_t size)
+{
+    struct xkb_keymap * const keymap = planner->keymap;
+
+    if (xkb_state_get_keymap(state) != keymap) {
+        log_err_func1(keymap->ctx, XKB_LOG_MESSAGE_NO_ID,
+                      "the state does not use the planner keymap\n");
+        return -1;
+    }
+
+    const xkb_mod_mask_t locked_mods =
+        xkb_state_serialize_mods(state, XKB_STATE_MODS_LOCKED);
+    xkb_layout_index_t layout =
+        xkb_state_serialize_layout(state, XKB_STATE_LAYOUT_EFFECTIVE);
+    if (layout >= planner->num_layouts)
+        layout = 0;
+
+    update_layout_switches(planner, locked_mods);
+
+    darray_resize(planner->steps, 0);
+    darray_resize(planner->candidates, 0);
+
+    /* Initial step: the current layout, with no modifier held */
+    const struct plan_candidate initial = {
+        .layout = layout,
+        .mods = 0,
+        .keycode = XKB_KEYCODE_INVALID,
+        .cost = 0,
+        .prev = 0,
+    };
+    darray_append(planner->candidates, initial);
+    const struct plan_step initial_step = { .first = 0, .count = 1 };
+    darray_append(planner->steps, initial_step);
+
+    /* Split the text into steps */
+    while (length > 0) {
+        size_t cp_length = 0;
+        const uint32_t cp = utf8_next_code_point(text, length, &cp_length);
+        if (cp == INVALID_UTF8_CODE_POINT || cp_length == 0)
+            return -1;
+        text += cp_length;
+        length -= cp_length;
+
+        if (!add_code_point_step(planner, cp, layout, locked_mods))
+            return -1;
+        if (darray_item(planner->steps, darray_size(planner->steps) - 1).count)
+            continue;
+
+        /* No direct key: fallback to Compose */
+        darray_remove_last(planner->steps);
+        if (!planner->table)
+            return -1;
+        const uint32_t slot = compose_slot(planner, cp);
+        const struct compose_entry * const entry =
+            &planner->compose_entries[slot];
+        if (entry->count == 0)
+            return -1;
+        for (darray_size_t k = 0; k < entry->count; k++) {
+            const darray_size_t first = darray_size(planner->candidates);
+            const xkb_keysym_t keysym =
+                darray_item(planner->compose_keysyms, entry->first + k);
+            if (!add_keysym_candidates(planner, first, keysym, layout,
+                                       locked_mods))
+                return -1;
+            const struct plan_step step = {
+                .first = first,
+                .count = darray_size(planner->candidates) - first,
+            };
+            if (step.count == 0)
+                return -1;
+            darray_append(planner->steps, step);
+        }
+    }
+
+    /* Find the cheapest candidate of each step */
+    for (darray_size_t s = 1; s < darray_size(planner->steps); s++) {
+        const struct plan_step * const prev_step =
+            &darray_item(planner->steps, s - 1);
+        const struct plan_step * const step = &darray_item(planner->steps, s);
+        for (darray_size_t c = step->first; c < step->first + step->count; c++) {
+            struct plan_candidate * const candidate =
+                &darray_item(planner->candidates, c);
+            for (darray_size_t p = prev_step->first;
+                 p < prev_step->first + prev_step->count; p++) {
+                const struct plan_candidate * const prev =
+                    &darray_item(planner->candidates, p);
+                if (prev->cost == COST_INFINITE)
+                    continue;
+                const uint32_t cost = transition_cost(planner, prev, candidate);
+                if (cost == COST_INFINITE)
+                    continue;
+                if (prev->cost + cost < candidate->cost) {
+                    candidate->cost = prev->cost + cost;
+                    candidate->prev = p;
+                }
+            }
+        }
+    }
+
+    /* Release all the modifiers at the end */
+    const struct plan_step * const last_step =
+        &darray_item(planner->steps, darray_size(planner->steps) - 1);
+    uint32_t best_cost = COST_INFINITE;
+    darray_size_t best = 0;
+    for (darray_size_t c = last_step->first;
+         c < last_step->first + last_step->count; c++) {
+        const struct plan_candidate * const candidate =
+            &darray_item(planner->candidates, c);
+        if (candidate->cost == COST_INFINITE)
+            continue;
+        const uint32_t cost = candidate->cost + popcount32(candidate->mods);
+        if (cost < best_cost) {
+            best_cost = cost;
+            best = c;
+        }
+    }
+    if (best_cost == COST_INFINITE)
+        return -1;
+
+    /* Backtrack the selected candidates, reusing the steps for storage */
+    for (darray_size_t s = darray_size(planner->steps); s-- > 0;) {
+        darray_item(planner->steps, s).first = best;
+        best = darray_item(planner->candidates, best).prev;
+    }
+
+    /* Emit the key strokes */
+    struct plan_output output = { .strokes = strokes, .size = size, .count = 0 };
+    xkb_mod_mask_t held = 0;
+    for (darray_size_t s = 1; s < darray_size(planner->steps); s++) {
+        const struct plan_candidate * const candidate =
+            &darray_item(planner->candidates,
+                         darray_item(planner->steps, s).first);
+        const xkb_keycode_t *keys = &planner->mod_keys[layout * XKB_MAX_MODS];
+
+        if (candidate->layout != layout) {
+            emit_mods(&output, keys, held, XKB_KEY_UP);
+            held = 0;
+            const xkb_layout_index_t n = planner->num_layouts;
+            while (layout != candidate->layout) {
+                const struct layout_switch * const sw =
+                    &darray_item(planner->switches,
+                                 planner->switch_next[layout * n +
+                                                      candidate->layout]);
+                const xkb_mod_mask_t mods = sw->mods & ~locked_mods;
+                keys = &planner->mod_keys[layout * XKB_MAX_MODS];
+                emit_mods(&output, keys, mods, XKB_KEY_DOWN);
+                emit(&output, sw->keycode, XKB_KEY_DOWN);
+                emit(&output, sw->keycode, XKB_KEY_UP);
+                emit_mods(&output, keys, mods, XKB_KEY_UP);
+                layout = sw->to;
+            }
+            keys = &planner->mod_keys[layout * XKB_MAX_MODS];
+        }
+
+        emit_mods(&output, keys, held & ~candidate->mods, XKB_KEY_UP);
+        emit_mods(&output, keys, candidate->mods & ~held, XKB_KEY_DOWN);
+        held = candidate->mods;
+        emit(&output, candidate->keycode, XKB_KEY_DOWN);
+        emit(&output, candidate->keycode, XKB_KEY_UP);
+    }
+    emit_mods(&output, &planner->mod_keys[layout * XKB_MAX_MODS], held,
+              XKB_KEY_UP);
+
+    if (output.count > INT_MAX)
+        return -1;
+    return (int) output.count;
+}
@@ -8,9 +8,25 @@
 
 #include "config.h"
 
+#include <errno.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 
+#if HAVE_UNISTD_H && HAVE_DIRENT_H
+    #include <dirent.h>
+    #include <unistd.h>
+    #define HAVE_INCLUDE_SNAPSHOT 1
+    #if HAVE_INOTIFY
+        #include <sys/inotify.h>
+    #endif
+#else
+    #define HAVE_INCLUDE_SNAPSHOT 0
+#endif
+
 #include "xkbcommon/xkbcommon.h"
 #include "atom.h"
 #include "darray.h"
@@ -52,6 +68,335 @@ xkb_context_init_includes(struct xkb_context *ctx)
     return true;
 }
 
+void
+xkb_context_include_cache_clear(struct xkb_context *ctx)
+{
+    struct include_cache * const cache = &ctx->include_cache;
+    struct include_cache_entry *entry;
+    struct include_snapshot *snapshot;
+
+    darray_foreach(entry, cache->entries) {
+        free(entry->name);
+        free(entry->states);
+    }
+    darray_free(cache->entries);
+    free(cache->index);
+    cache->index = NULL;
+    cache->index_size = 0;
+    cache->num_paths = 0;
+
+    darray_foreach(snapshot, cache->snapshots) {
+        for (darray_size_t i = 0; i < snapshot->num_listings; i++) {
+            char **name;
+            darray_foreach(name, snapshot->listings[i].names)
+                free(*name);
+            darray_free(snapshot->listings[i].names);
+        }
+        free(snapshot->listings);
+        free(snapshot->type_dir);
+    }
+    darray_free(cache->snapshots);
+
+    struct section_index *index;
+    darray_foreach(index, cache->section_indexes) {
+        struct section_offset *section;
+        darray_foreach(section, index->sections)
+            free(section->name);
+        darray_free(index->sections);
+    }
+    darray_free(cache->section_indexes);
+
+#if HAVE_INOTIFY
+    if (cache->inotify_fd >= 0)
+        close(cache->inotify_fd);
+#endif
+    cache->inotify_fd = -1;
+}
+
+#if HAVE_INCLUDE_SNAPSHOT
+static int
+compare_names(const void *a, const void *b)
+{
+    return strcmp(*(char * const *) a, *(char * const *) b);
+}
+
+static bool
+include_snapshot_list(struct include_snapshot_listing *listing,
+                      const char *path)
+{
+    DIR * const dir = opendir(path);
+    if (!dir) {
+        /* Missing directory: nothing to find. Otherwise use the FS. */
+        listing->listed = (errno == ENOENT || errno == ENOTDIR);
+        return true;
+    }
+
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+            continue;
+        char * const name = strdup(entry->d_name);
+        if (!name) {
+            closedir(dir);
+            return false;
+        }
+        darray_append(listing->names, name);
+    }
+    closedir(dir);
+
+    if (!darray_empty(listing->names))
+        qsort(darray_items(listing->names), darray_size(listing->names),
+              sizeof(*darray_items(listing->names)), &compare_names);
+    listing->listed = true;
+    return true;
+}
+
+/* Lookup the first path component of a file name in a listing */
+static bool
+include_snapshot_listing_has(const struct include_snapshot_listing *listing,
+                             const char *name, size_t len)
+{
+    darray_size_t lower = 0;
+    darray_size_t upper = darray_size(listing->names);
+    while (lower < upper) {
+        const darray_size_t mid = lower + (upper - lower) / 2;
+        const char * const entry = darray_item(listing->names, mid);
+        int cmp = strncmp(name, entry, len);
+        if (cmp == 0)
+            cmp = (entry[len] == '\0') ? 0 : -1;
+        if (cmp == 0)
+            return true;
+        else if (cmp < 0)
+            upper = mid;
+        else
+            lower = mid + 1;
+    }
+    return false;
+}
+
+/* Get the snapshot of a type directory, taking it if necessary */
+static const struct include_snapshot *
+include_snapshot_get(struct xkb_context *ctx, const char *type_dir)
+{
+    struct include_cache * const cache = &ctx->include_cache;
+    struct include_snapshot *snapshot;
+
+    darray_foreach(snapshot, cache->snapshots) {
+        if (strcmp(snapshot->type_dir, type_dir) == 0)
+            return snapshot;
+    }
+
+    struct include_snapshot new = {
+        .type_dir = strdup(type_dir),
+        .listings = calloc(cache->num_paths, sizeof(*new.listings)),
+        .num_listings = cache->num_paths
+    };
+    if (!new.type_dir || !new.listings)
+        goto error;
+
+#if HAVE_INOTIFY
+    if (cache->inotify_fd < 0)
+        cache->inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    const uint32_t mask = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO
+                        | IN_DELETE_SELF | IN_MOVE_SELF;
+#endif
+
+    char path[PATH_MAX];
+    for (darray_size_t i = 0; i < new.num_listings; i++) {
+        const char * const root = darray_item(ctx->includes, i);
+        if (!snprintf_safe(path, sizeof(path), "%s/%s", root, type_dir))
+            continue;
+        if (!include_snapshot_list(&new.listings[i], path))
+            goto error;
+#if HAVE_INOTIFY
+        if (cache->inotify_fd >= 0) {
+            /* Watch the include path for the creation of the directory */
+            if (inotify_add_watch(cache->inotify_fd, root, mask) < 0 ||
+                (inotify_add_watch(cache->inotify_fd, path, mask) < 0 &&
+                 errno != ENOENT)) {
+                log_dbg(ctx, XKB_LOG_MESSAGE_NO_ID,
+                        "Cannot watch include path: %s (%s)\n",
+                        path, strerror(errno));
+            }
+        }
+#endif
+    }
+
+    darray_append(cache->snapshots, new);
+    return &darray_item(cache->snapshots, darray_size(cache->snapshots) - 1);
+
+error:
+    if (new.listings) {
+        for (darray_size_t i = 0; i < new.num_listings; i++) {
+            char **name;
+            darray_foreach(name, new.listings[i].names)
+                free(*name);
+            darray_free(new.listings[i].names);
+        }
+    }
+    free(new.listings);
+    free(new.type_dir);
+    return NULL;
+}
+
+/* Initialize the lookup states of a file from the snapshot */
+static void
+include_snapshot_init_states(struct xkb_context *ctx, const char *type_dir,
+                             const char *name, size_t name_len,
+                             uint8_t *states)
+{
+    /* Only the first path component can be checked */
+    const char * const slash = memchr(name, '/', name_len);
+    const size_t len = (slash) ? (size_t) (slash - name) : name_len;
+    if (len == 0)
+        return;
+
+    const struct include_snapshot * const snapshot =
+        include_snapshot_get(ctx, type_dir);
+    if (!snapshot)
+        return;
+
+    for (darray_size_t i = 0; i < snapshot->num_listings; i++) {
+        const struct include_snapshot_listing * const listing =
+            &snapshot->listings[i];
+        if (!listing->listed)
+            continue;
+        if (!include_snapshot_listing_has(listing, name, len))
+            states[i] = INCLUDE_CACHE_MISSING;
+        else if (!slash)
+            states[i] = INCLUDE_CACHE_FOUND;
+    }
+}
+
+#if HAVE_INOTIFY
+/* Drain the pending inotify events, if any */
+static bool
+include_snapshot_changed(int fd)
+{
+    union {
+        struct inotify_event event;
+        char buf[4096];
+    } events;
+    bool changed = false;
+    while (read(fd, &events, sizeof(events)) > 0)
+        changed = true;
+    return changed;
+}
+#endif
+#endif
+
+/* FNV-1a (http://www.isthe.com/chongo/tech/comp/fnv/). */
+static inline uint32_t
+include_cache_hash(const char *string, size_t len)
+{
+    uint32_t hash = UINT32_C(2166136261);
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (uint8_t) string[i];
+        hash *= 0x01000193;
+    }
+    return hash;
+}
+
+static void
+include_cache_index_insert(struct include_cache *cache, const char *name,
+                           darray_size_t entry)
+{
+    const uint32_t hash = include_cache_hash(name, strlen(name));
+    for (darray_size_t i = 0; i < cache->index_size; i++) {
+        const darray_size_t pos = (hash + i) & (cache->index_size - 1);
+        if (cache->index[pos] == 0) {
+            cache->index[pos] = entry + 1;
+            return;
+        }
+    }
+}
+
+static bool
+include_cache_index_grow(struct include_cache *cache)
+{
+    const darray_size_t size = (cache->index_size) ? 2 * cache->index_size : 64;
+    darray_size_t * const index = calloc(size, sizeof(*index));
+    if (!index)
+        return false;
+
+    free(cache->index);
+    cache->index = index;
+    cache->index_size = size;
+    for (darray_size_t k = 0; k < darray_size(cache->entries); k++)
+        include_cache_index_insert(cache, darray_item(cache->entries, k).name, k);
+
+    return true;
+}
+
+/**
+ * Get the cached lookup states of a file in each include path.
+ *
+ * The states are indexed by the include path index and may be updated by the
+ * caller. Returns NULL if the cache is disabled or on allocation failure.
+ */
+uint8_t *
+xkb_context_include_cache_get(struct xkb_context *ctx, const char *type_dir,
+                              const char *name, size_t name_len)
+{
+    if (!ctx->use_include_cache)
+        return NULL;
+
+    struct include_cache * const cache = &ctx->include_cache;
+#if HAVE_INOTIFY
+    if (cache->inotify_fd >= 0 && include_snapshot_changed(cache->inotify_fd))
+        xkb_context_include_cache_clear(ctx);
+#endif
+    const darray_size_t num_paths = xkb_context_num_include_paths(ctx);
+    if (num_paths != cache->num_paths) {
+        xkb_context_include_cache_clear(ctx);
+        cache->num_paths = num_paths;
+    }
+    if (num_paths == 0)
+        return NULL;
+
+    char key[PATH_MAX];
+    if (!snprintf_safe(key, sizeof(key), "%s/%.*s",
+                       type_dir, (unsigned int) name_len, name))
+        return NULL;
+
+    const uint32_t hash = include_cache_hash(key, strlen(key));
+    for (darray_size_t i = 0; i < cache->index_size; i++) {
+        const darray_size_t pos = (hash + i) & (cache->index_size - 1);
+        const darray_size_t k = cache->index[pos];
+        if (k == 0)
+            break;
+        struct include_cache_entry * const entry =
+            &darray_item(cache->entries, k - 1);
+        if (strcmp(entry->name, key) == 0)
+            return entry->states;
+    }
+
+    /* New entry; keep the load factor under 1/2 */
+    if (2 * (darray_size(cache->entries) + 1) > cache->index_size &&
+        !include_cache_index_grow(cache))
+        return NULL;
+
+    struct include_cache_entry entry = {
+        .name = strdup(key),
+        .states = calloc(num_paths, sizeof(*entry.states))
+    };
+    if (!entry.name || !entry.states) {
+        free(entry.name);
+        free(entry.states);
+        return NULL;
+    }
+#if HAVE_INCLUDE_SNAPSHOT
+    if (ctx->use_include_snapshot)
+        include_snapshot_init_states(ctx, type_dir, name, name_len,
+                                     entry.states);
+#endif
+    darray_append(cache->entries, entry);
+    include_cache_index_insert(cache, entry.name,
+                               darray_size(cache->entries) - 1);
+
+    return entry.states;
+}
+
 darray_size_t
 xkb_context_num_failed_include_paths(struct xkb_context *ctx)
 {
@@ -70,6 +415,12 @@ xkb_context_failed_include_path_get(struct xkb_context *ctx,
     return darray_item(ctx->failed_includes, idx);
 }
 
+void
+xkb_context_set_parser(struct xkb_context *ctx, enum xkb_parser parser)
+{
+    ctx->parser = parser;
+}
+
 darray_size_t
 xkb_atom_table_size(struct xkb_context *ctx)
 {
@@ -58,6 +58,7 @@ context_include_path_append(struct xkb_context *ctx, const char *path)
     }
 
     darray_append(ctx->includes, tmp);
+    xkb_context_include_cache_clear(ctx);
     /* Use “info” log level to facilitate bug reporting. */
     log_info(ctx, XKB_LOG_MESSAGE_NO_ID, "Include path added: %s\n", tmp);
 
@@ -355,6 +356,8 @@ xkb_context_include_path_clear(struct xkb_context *ctx)
         free(*path);
     darray_free(ctx->failed_includes);
 
+    xkb_context_include_cache_clear(ctx);
+
     /* It does not make sense to keep the pending defaults */
     ctx->pending_default_includes = false;
 }
@@ -369,6 +372,22 @@ xkb_context_include_path_reset_defaults(struct xkb_context *ctx)
     return xkb_context_include_path_append_default(ctx);
 }
 
+void
+xkb_context_include_cache_invalidate(struct xkb_context *ctx)
+{
+    xkb_context_include_cache_clear(ctx);
+}
+
+void
+xkb_context_include_cache_get_stats(struct xkb_context *ctx,
+                                    size_t *hits, size_t *misses)
+{
+    if (hits)
+        *hits = ctx->include_cache.hits;
+    if (misses)
+        *misses = ctx->include_cache.misses;
+}
+
 /**
  * Returns the number of entries in the context's include path.
  */
@@ -504,7 +523,9 @@ xkb_context_new(enum xkb_context_flags flags)
     static const enum xkb_context_flags XKB_CONTEXT_FLAGS
         = XKB_CONTEXT_NO_DEFAULT_INCLUDES
         | XKB_CONTEXT_NO_ENVIRONMENT_NAMES
-        | XKB_CONTEXT_NO_SECURE_GETENV;
+        | XKB_CONTEXT_NO_SECURE_GETENV
+        | XKB_CONTEXT_CACHE_INCLUDE_LOOKUPS
+        | XKB_CONTEXT_SNAPSHOT_INCLUDE_PATHS;
 
     if (flags & ~XKB_CONTEXT_FLAGS) {
         log_err(ctx, XKB_LOG_MESSAGE_NO_ID,
@@ -516,6 +537,12 @@ xkb_context_new(enum xkb_context_flags flags)
 
     ctx->use_environment_names = !(flags & XKB_CONTEXT_NO_ENVIRONMENT_NAMES);
     ctx->use_secure_getenv = !(flags & XKB_CONTEXT_NO_SECURE_GETENV);
+    ctx->use_include_cache = !!(flags & (XKB_CONTEXT_CACHE_INCLUDE_LOOKUPS |
+                                         XKB_CONTEXT_SNAPSHOT_INCLUDE_PATHS));
+    ctx->use_include_snapshot = !!(flags & XKB_CONTEXT_SNAPSHOT_INCLUDE_PATHS);
+    ctx->include_cache.inotify_fd = -1;
+    ctx->parser = (ENABLE_DESCENT_PARSER) ? XKB_PARSER_DESCENT
+                                          : XKB_PARSER_BISON;
 
     /*
      * Default includes paths are delayed and added only if necessary.
@@ -10,6 +10,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include "xkbcommon/xkbcommon.h"
 #include "atom.h"
@@ -18,6 +19,88 @@
 #include "rmlvo.h"
 #include "utils.h"
 
+/** Lookup state of a file in an include path */
+enum include_cache_state {
+    INCLUDE_CACHE_UNKNOWN = 0,
+    INCLUDE_CACHE_FOUND,
+    INCLUDE_CACHE_MISSING
+};
+
+struct include_cache_entry {
+    /** “<type directory>/<file name>” */
+    char *name;
+    /** One `enum include_cache_state` per include path */
+    uint8_t *states;
+};
+
+/** Listing of a type directory (e.g. “symbols”) in an include path */
+struct include_snapshot_listing {
+    /** Whether the listing is available, else the lookups use the FS */
+    bool listed;
+    /** Sorted entries names */
+    darray_string names;
+};
+
+/** Snapshot of a type directory in each include path */
+struct include_snapshot {
+    char *type_dir;
+    struct include_snapshot_listing *listings;
+    darray_size_t num_listings;
+};
+
+/** Location of a section of an XKB file */
+struct section_offset {
+    /** Section name, or NULL if unnamed */
+    char *name;
+    /** Offset of the name literal, past the opening quote */
+    size_t name_offset;
+    /** Offset of the first token of the section */
+    size_t offset;
+};
+typedef darray(struct section_offset) darray_section_offset;
+
+/** Sections of an XKB file, identified by its inode and modification time */
+struct section_index {
+    uint64_t dev;
+    uint64_t ino;
+    uint64_t size;
+    int64_t mtime;
+    /** Whether the sections could be located, else the file is fully parsed */
+    bool indexed;
+    darray_section_offset sections;
+};
+
+/**
+ * Cache of the lookups of the files in the include paths.
+ *
+ * Linear probing hash table of the file names, indexing an array of entries.
+ */
+struct include_cache {
+    darray(struct include_cache_entry) entries;
+    /** Entry index + 1, or 0 for an empty slot */
+    darray_size_t *index;
+    /** Power of 2 */
+    darray_size_t index_size;
+    /** Number of include paths when the entries were created */
+    darray_size_t num_paths;
+    /** Snapshots used to initialize the entries, if enabled */
+    darray(struct include_snapshot) snapshots;
+    /** inotify instance watching the snapshots directories, or -1 */
+    int inotify_fd;
+    /** Sections of the parsed files */
+    darray(struct section_index) section_indexes;
+    size_t hits;
+    size_t misses;
+};
+
+/** Implementations of the parser of the XKB text format */
+enum xkb_parser {
+    /** Parser generated by bison from `parser.y` */
+    XKB_PARSER_BISON = 0,
+    /** Hand-written recursive descent parser */
+    XKB_PARSER_DESCENT,
+};
+
 struct xkb_context {
     int refcnt;
 
@@ -35,6 +118,8 @@ struct xkb_context {
 
     struct atom_table *atom_table;
 
+    struct include_cache include_cache;
+
     /* Used and allocated by xkbcommon-x11, free()d with the context. */
     void *x11_atom_cache;
 
@@ -42,9 +127,13 @@ struct xkb_context {
     char text_buffer[2048];
     size_t text_next;
 
+    enum xkb_parser parser;
+
     bool use_environment_names : 1;
     bool use_secure_getenv : 1;
     bool pending_default_includes : 1;
+    bool use_include_cache : 1;
+    bool use_include_snapshot : 1;
 };
 
 char *
@@ -72,6 +161,17 @@ xkb_context_include_path_get_versioned_extensions_path(struct xkb_context *ctx);
 const char *
 xkb_context_include_path_get_system_path(struct xkb_context *ctx);
 
+void
+xkb_context_include_cache_clear(struct xkb_context *ctx);
+
+uint8_t *
+xkb_context_include_cache_get(struct xkb_context *ctx, const char *type_dir,
+                              const char *name, size_t name_len);
+
+/** Select the parser of the XKB text format; intended for testing */
+XKB_EXPORT_PRIVATE void
+xkb_context_set_parser(struct xkb_context *ctx, enum xkb_parser parser);
+
 XKB_EXPORT_PRIVATE darray_size_t
 xkb_atom_table_size(struct xkb_context *ctx);
 
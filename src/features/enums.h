@@ -92,6 +92,8 @@ enum xkb_enumerations_values {
         | XKB_CONTEXT_NO_DEFAULT_INCLUDES
         | XKB_CONTEXT_NO_ENVIRONMENT_NAMES
         | XKB_CONTEXT_NO_SECURE_GETENV
+        | XKB_CONTEXT_CACHE_INCLUDE_LOOKUPS
+        | XKB_CONTEXT_SNAPSHOT_INCLUDE_PATHS
     ,
     XKB_KEYMAP_COMPILE_FLAGS_VALUES
         = XKB_KEYMAP_COMPILE_NO_FLAGS
@@ -109,6 +111,7 @@ enum xkb_enumerations_values {
         | XKB_KEYMAP_SERIALIZE_EXPLICIT_DEFAULT_VALUES
         | XKB_KEYMAP_SERIALIZE_EXPLICIT_VMODS
         | XKB_KEYMAP_SERIALIZE_EXPLICIT_KEY_VALUES
+        | XKB_KEYMAP_SERIALIZE_COMPACT
     ,
     XKB_KEYMAP_KEY_ITERATOR_FLAGS_VALUES
         = XKB_KEYMAP_KEY_ITERATOR_NO_FLAGS
@@ -225,6 +228,8 @@ static const uint32_t xkb_context_flags_values[] = {
     XKB_CONTEXT_NO_DEFAULT_INCLUDES,
     XKB_CONTEXT_NO_ENVIRONMENT_NAMES,
     XKB_CONTEXT_NO_SECURE_GETENV,
+    XKB_CONTEXT_CACHE_INCLUDE_LOOKUPS,
+    XKB_CONTEXT_SNAPSHOT_INCLUDE_PATHS,
 };
 #endif
 
@@ -259,6 +264,7 @@ static const uint32_t xkb_keymap_serialize_flags_values[] = {
     XKB_KEYMAP_SERIALIZE_EXPLICIT_DEFAULT_VALUES,
     XKB_KEYMAP_SERIALIZE_EXPLICIT_VMODS,
     XKB_KEYMAP_SERIALIZE_EXPLICIT_KEY_VALUES,
+    XKB_KEYMAP_SERIALIZE_COMPACT,
 };
 #endif
 
@@ -415,6 +421,7 @@ static const uint32_t xkb_error_code_values[] = {
     XKB_ERROR_UNEXPECTED_STATE_MODE,
     XKB_ERROR_ABI_INVALID_STRUCT_SIZE,
     XKB_ERROR_ALLOCATION_FAILURE,
+    XKB_ERROR_KEYMAP_SERIALIZATION_WRITE_FAILURE,
     XKB_ERROR_UNSUPPORTED_KEYMAP_SERIALIZATION_FLAGS,
     XKB_ERROR_ABI_FORWARD_COMPAT,
     XKB_ERROR_ABI_BACKWARD_COMPAT,
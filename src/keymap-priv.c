@@ -9,7 +9,9 @@
 #include "config.h"
 
 #include <assert.h>
+#include <stdalign.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "xkbcommon/xkbcommon.h"
@@ -17,6 +19,7 @@
 #include "features/enums.h"
 #include "keymap.h"
 #include "messages-codes.h"
+#include "utils-numbers.h"
 
 static void
 update_builtin_keymap_fields(struct xkb_keymap *keymap)
@@ -287,3 +290,136 @@ err:
     *actions = NULL;
     return 0;
 }
+
+/* All the chunks of the frozen storage share the same alignment */
+union frozen_chunk {
+    struct xkb_key_type_entry entry;
+    struct xkb_group group;
+    struct xkb_level level;
+    xkb_keysym_t keysym;
+    union xkb_action action;
+};
+
+#define FROZEN_ALIGNMENT alignof(union frozen_chunk)
+
+/*
+ * Bump allocator over the frozen storage. If there is no storage yet, it
+ * only computes the required size.
+ */
+struct frozen_arena {
+    char *base;
+    size_t size;
+};
+
+static inline void *
+frozen_arena_alloc(struct frozen_arena *arena, size_t count, size_t size)
+{
+    void * const ptr = (arena->base) ? arena->base + arena->size : NULL;
+    arena->size += (count * size + FROZEN_ALIGNMENT - 1) &
+                   ~(FROZEN_ALIGNMENT - 1);
+    return ptr;
+}
+
+/* Relocate an array into the arena, freeing the original */
+#define frozen_arena_move(arena, array, count) do {                         \
+    if ((count) > 0) {                                                      \
+        void * const _ptr =                                                 \
+            frozen_arena_alloc((arena), (count), sizeof(*(array)));         \
+        if (_ptr) {                                                         \
+            memcpy(_ptr, (array), (count) * sizeof(*(array)));              \
+            free((void *) (array));                                         \
+            (array) = _ptr;                                                 \
+        }                                                                   \
+    }                                                                       \
+} while (0)
+
+static void
+freeze_keymap_into(struct xkb_keymap *keymap, struct frozen_arena *arena)
+{
+    for (darray_size_t t = 0; t < keymap->num_types; t++) {
+        struct xkb_key_type * const type = &keymap->types[t];
+        frozen_arena_move(arena, type->entries, (size_t) type->num_entries);
+    }
+
+    /* Store each key contiguously: groups, levels, then keysyms and actions */
+    struct xkb_key *key;
+    xkb_keys_foreach(key, keymap) {
+        frozen_arena_move(arena, key->groups, (size_t) key->num_groups);
+        for (xkb_layout_index_t g = 0; g < key->num_groups; g++) {
+            struct xkb_group * const group = &key->groups[g];
+            const xkb_level_index_t num_levels = XkbKeyNumLevels(key, g);
+            frozen_arena_move(arena, group->levels, (size_t) num_levels);
+        }
+        for (xkb_layout_index_t g = 0; g < key->num_groups; g++) {
+            const xkb_level_index_t num_levels = XkbKeyNumLevels(key, g);
+            for (xkb_level_index_t l = 0; l < num_levels; l++) {
+                struct xkb_level * const leveli = &key->groups[g].levels[l];
+                if (leveli->num_syms > 1) {
+                    /* Upper case keysyms are stored after the original ones */
+                    const size_t count = (size_t) leveli->num_syms *
+                                         (leveli->has_upper ? 2 : 1);
+                    frozen_arena_move(arena, leveli->s.syms, count);
+                }
+                if (leveli->num_actions > 1) {
+                    frozen_arena_move(arena, leveli->a.actions,
+                                      (size_t) leveli->num_actions);
+                }
+            }
+        }
+    }
+}
+
+static void
+index_high_keys(struct xkb_keymap *keymap)
+{
+    if (keymap->high_keys || keymap->num_keys <= keymap->num_keys_low)
+        return;
+
+    /* Load factor ≤ 1/2 */
+    const xkb_keycode_t count = keymap->num_keys - keymap->num_keys_low;
+    const uint32_t size = next_pow2(MAX(2 * count, 16u));
+    struct xkb_high_key * const high_keys = calloc(size, sizeof(*high_keys));
+    /* On allocation failure, simply keep using the binary search */
+    if (!high_keys)
+        return;
+
+    const uint32_t shift = 32 - ctz32(size);
+    for (uint32_t slot = 0; slot < size; slot++)
+        high_keys[slot].keycode = XKB_KEYCODE_INVALID;
+    for (xkb_keycode_t k = keymap->num_keys_low; k < keymap->num_keys; k++) {
+        const xkb_keycode_t kc = keymap->keys[k].keycode;
+        uint32_t slot = high_keycode_hash(kc, shift);
+        while (high_keys[slot].keycode != XKB_KEYCODE_INVALID)
+            slot = (slot + 1) & (size - 1);
+        high_keys[slot].keycode = kc;
+        high_keys[slot].index = k;
+    }
+
+    keymap->high_keys_shift = shift;
+    keymap->high_keys = high_keys;
+}
+
+void
+xkb_keymap_freeze(struct xkb_keymap *keymap)
+{
+    index_high_keys(keymap);
+
+    if (keymap->frozen)
+        return;
+
+    struct frozen_arena arena = { .base = NULL, .size = 0 };
+    freeze_keymap_into(keymap, &arena);
+    if (arena.size == 0)
+        return;
+
+    /* On allocation failure, simply keep the scattered storage */
+    arena.base = malloc(arena.size);
+    if (!arena.base)
+        return;
+
+    const size_t size = arena.size;
+    arena.size = 0;
+    freeze_keymap_into(keymap, &arena);
+    assert(arena.size == size);
+    keymap->frozen = arena.base;
+}
@@ -14,7 +14,17 @@
 #include "config.h"
 
 #include <assert.h>
+#include <errno.h>
+#include <limits.h>
 #include <stdint.h>
+#if HAVE_MEMFD_CREATE
+# include <fcntl.h>
+# include <sys/mman.h>
+/* Never hand out an unsealed memfd */
+# ifdef F_ADD_SEALS
+#  define HAVE_SEALED_MEMFD 1
+# endif
+#endif
 
 #include "utils-numbers.h"
 #include "xkbcommon/xkbcommon.h"
@@ -25,6 +35,7 @@
 #include "keymap-priv.h"
 #include "messages-codes.h"
 #include "text.h"
+#include "utils.h"
 
 struct xkb_keymap *
 xkb_keymap_ref(struct xkb_keymap *keymap)
@@ -50,6 +61,9 @@ clear_interpret(struct xkb_sym_interpret *interp)
         free(interp->a.actions);
 }
 
+static void
+keysym_index_free(struct xkb_keysym_index *index);
+
 void
 xkb_keymap_unref(struct xkb_keymap *keymap)
 {
@@ -57,10 +71,11 @@ xkb_keymap_unref(struct xkb_keymap *keymap)
     if (!keymap || --keymap->refcnt > 0)
         return;
 
+    /* The groups, levels and type entries of a frozen keymap are in one block */
     if (keymap->keys) {
         struct xkb_key *key;
         xkb_keys_foreach(key, keymap) {
-            if (key->groups) {
+            if (key->groups && !keymap->frozen) {
                 for (xkb_layout_index_t i = 0; i < key->num_groups; i++) {
                     if (key->groups[i].levels) {
                         for (xkb_level_index_t j = 0;
@@ -78,13 +93,16 @@ xkb_keymap_unref(struct xkb_keymap *keymap)
         }
         free(keymap->keys);
     }
+    free(keymap->high_keys);
     if (keymap->types) {
         for (darray_size_t i = 0; i < keymap->num_types; i++) {
-            free(keymap->types[i].entries);
+            if (!keymap->frozen)
+                free(keymap->types[i].entries);
             free(keymap->types[i].level_names);
         }
         free(keymap->types);
     }
+    free(keymap->frozen);
     for (darray_size_t k = 0; k < keymap->num_sym_interprets; k++) {
         clear_interpret(&keymap->sym_interprets[k]);
     }
@@ -96,6 +114,19 @@ xkb_keymap_unref(struct xkb_keymap *keymap)
     free(keymap->symbols_section_name);
     free(keymap->types_section_name);
     free(keymap->compat_section_name);
+    struct xkb_keymap_serialization *serialization =
+        xkb_atomic_load(&keymap->serializations);
+    while (serialization) {
+        struct xkb_keymap_serialization * const next = serialization->next;
+        const int fd = xkb_atomic_load(&serialization->fd);
+        if (fd >= 0)
+            close(fd);
+        free(serialization->serialized);
+        free(serialization);
+        serialization = next;
+    }
+    free(xkb_atomic_load(&keymap->key_name_index));
+    keysym_index_free(xkb_atomic_load(&keymap->keysym_index));
     xkb_context_unref(keymap->ctx);
     free(keymap);
 }
@@ -272,14 +303,19 @@ check_keymap_serialize_abi(
     return error;
 }
 
-enum xkb_error_code
-xkb_keymap_serialize(const struct xkb_keymap *keymap,
-                     const struct xkb_keymap_serialize_config *config,
-                     struct xkb_keymap_serialize_result *result)
+/**
+ * Serialize a keymap, either to a newly allocated string if `write` is NULL,
+ * or else by streaming to `write`.
+ */
+static enum xkb_error_code
+keymap_serialize(const struct xkb_keymap *keymap, const char *func,
+                 const struct xkb_keymap_serialize_config *config,
+                 xkb_keymap_serialize_write_fn write, void *user_data,
+                 struct xkb_keymap_serialize_result *result)
 {
     /* Check ABI compatibility */
     enum xkb_error_code error =
-        check_keymap_serialize_abi(keymap->ctx, __func__, config, result);
+        check_keymap_serialize_abi(keymap->ctx, func, config, result);
     if (error)
         return error;
 
@@ -289,21 +325,27 @@ xkb_keymap_serialize(const struct xkb_keymap *keymap,
         = (enum xkb_keymap_serialize_flags) XKB_KEYMAP_SERIALIZE_FLAGS_VALUES;
 
     if (new_config.flags & ~XKB_KEYMAP_SERIALIZE_FLAGS) {
-        log_err_func(keymap->ctx,
-                     XKB_ERROR_UNSUPPORTED_KEYMAP_SERIALIZATION_FLAGS_,
-                     "unrecognized serialization flags: %#x\n",
-                     (new_config.flags & ~XKB_KEYMAP_SERIALIZE_FLAGS));
+        log_err(keymap->ctx,
+                XKB_ERROR_UNSUPPORTED_KEYMAP_SERIALIZATION_FLAGS_,
+                "%s: unrecognized serialization flags: %#x\n",
+                func, (new_config.flags & ~XKB_KEYMAP_SERIALIZE_FLAGS));
         return XKB_ERROR_UNSUPPORTED_KEYMAP_SERIALIZATION_FLAGS;
     }
 
     if (new_config.format == XKB_KEYMAP_USE_ORIGINAL_FORMAT)
         new_config.format = keymap->format;
 
+    /* Compact output has precedence over pretty-printing */
+    if (new_config.flags & XKB_KEYMAP_SERIALIZE_COMPACT)
+        new_config.flags &= ~XKB_KEYMAP_SERIALIZE_PRETTY;
+
     const struct xkb_keymap_format_ops * const ops =
         get_keymap_format_ops(new_config.format);
-    if (!ops || !ops->keymap_serialize) {
-        log_err_func(keymap->ctx, XKB_ERROR_UNSUPPORTED_KEYMAP_FORMAT_,
-                     "unsupported keymap format: %d\n", new_config.format);
+    if (!ops || (write ? !ops->keymap_serialize_stream
+                       : !ops->keymap_serialize)) {
+        log_err(keymap->ctx, XKB_ERROR_UNSUPPORTED_KEYMAP_FORMAT_,
+                "%s: unsupported keymap format: %d\n",
+                func, new_config.format);
         return XKB_ERROR_UNSUPPORTED_KEYMAP_FORMAT;
     }
 
@@ -314,10 +356,10 @@ xkb_keymap_serialize(const struct xkb_keymap *keymap,
     }
 
     if (new_config.layouts & ~all_layouts) {
-        log_err_func(keymap->ctx, XKB_ERROR_UNSUPPORTED_LAYOUT_INDEX_,
-                     "unsupported layout mask: "
-                     "expected subset of 0x%08"PRIx32", got: 0x%08"PRIx32"\n",
-                     all_layouts, new_config.layouts);
+        log_err(keymap->ctx, XKB_ERROR_UNSUPPORTED_LAYOUT_INDEX_,
+                "%s: unsupported layout mask: "
+                "expected subset of 0x%08"PRIx32", got: 0x%08"PRIx32"\n",
+                func, all_layouts, new_config.layouts);
         return XKB_ERROR_UNSUPPORTED_LAYOUT_INDEX;
     }
 
@@ -359,7 +401,80 @@ xkb_keymap_serialize(const struct xkb_keymap *keymap,
                              XKB_KEYMAP_SERIALIZE_EXPLICIT_VMODS);
     }
 
-    return ops->keymap_serialize(keymap, &new_config, result);
+    return (write)
+        ? ops->keymap_serialize_stream(keymap, &new_config,
+                                       write, user_data, result)
+        : ops->keymap_serialize(keymap, &new_config, result);
+}
+
+enum xkb_error_code
+xkb_keymap_serialize(const struct xkb_keymap *keymap,
+                     const struct xkb_keymap_serialize_config *config,
+                     struct xkb_keymap_serialize_result *result)
+{
+    return keymap_serialize(keymap, __func__, config, NULL, NULL, result);
+}
+
+enum xkb_error_code
+xkb_keymap_serialize_to_callback(
+    const struct xkb_keymap *keymap,
+    const struct xkb_keymap_serialize_config *config,
+    xkb_keymap_serialize_write_fn write, void *user_data,
+    struct xkb_keymap_serialize_result *result)
+{
+    if (!write) {
+        log_err_func1(keymap->ctx, XKB_LOG_MESSAGE_NO_ID,
+                      "no write callback specified\n");
+        return XKB_ERROR_KEYMAP_SERIALIZATION_WRITE_FAILURE;
+    }
+    return keymap_serialize(keymap, __func__, config, write, user_data, result);
+}
+
+static bool
+write_to_fd(void *user_data, const char *data, size_t length)
+{
+    const int fd = *(const int *) user_data;
+    while (length > 0) {
+        const ssize_t written = write(fd, data, length);
+        if (written < 0) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        data += written;
+        length -= (size_t) written;
+    }
+    return true;
+}
+
+enum xkb_error_code
+xkb_keymap_serialize_to_fd(const struct xkb_keymap *keymap,
+                           const struct xkb_keymap_serialize_config *config,
+                           int fd, struct xkb_keymap_serialize_result *result)
+{
+    return keymap_serialize(keymap, __func__, config,
+                            write_to_fd, &fd, result);
+}
+
+static bool
+write_to_file(void *user_data, const char *data, size_t length)
+{
+    return fwrite(data, 1, length, user_data) == length;
+}
+
+enum xkb_error_code
+xkb_keymap_serialize_to_file(const struct xkb_keymap *keymap,
+                             const struct xkb_keymap_serialize_config *config,
+                             FILE *file,
+                             struct xkb_keymap_serialize_result *result)
+{
+    if (!file) {
+        log_err_func1(keymap->ctx, XKB_LOG_MESSAGE_NO_ID,
+                      "no file specified\n");
+        return XKB_ERROR_KEYMAP_SERIALIZATION_WRITE_FAILURE;
+    }
+    return keymap_serialize(keymap, __func__, config,
+                            write_to_file, file, result);
 }
 
 char *
@@ -389,6 +504,170 @@ xkb_keymap_get_as_string(struct xkb_keymap *keymap,
                                      XKB_KEYMAP_SERIALIZE_NO_FLAGS);
 }
 
+static struct xkb_keymap_serialization *
+find_serialization(struct xkb_keymap_serialization *head,
+                   const struct xkb_keymap_serialization *end,
+                   enum xkb_keymap_format format,
+                   enum xkb_keymap_serialize_flags flags)
+{
+    for (; head != end; head = head->next) {
+        if (head->format == format && head->flags == flags)
+            return head;
+    }
+    return NULL;
+}
+
+/**
+ * Get the cached serialization for the given format and flags, serializing
+ * and publishing it on the first use.
+ *
+ * Entries are only ever prepended to the list and are never modified once
+ * published (but for their file descriptor), so readers need no lock. Note
+ * that the serialization itself is not thread-safe, since it uses the context
+ * scratch buffers.
+ */
+static struct xkb_keymap_serialization *
+get_cached_serialization(struct xkb_keymap *keymap, const char *func,
+                         enum xkb_keymap_format format,
+                         enum xkb_keymap_serialize_flags flags)
+{
+    if (format == XKB_KEYMAP_USE_ORIGINAL_FORMAT)
+        format = keymap->format;
+
+    struct xkb_keymap_serialization *head =
+        xkb_atomic_load(&keymap->serializations);
+    struct xkb_keymap_serialization *entry =
+        find_serialization(head, NULL, format, flags);
+    if (entry)
+        return entry;
+
+    const struct xkb_keymap_serialize_config config = {
+        .size = sizeof(config),
+        .flags = flags,
+        .format = format,
+        .layouts = 0,
+    };
+    struct xkb_keymap_serialize_result result = { .size = sizeof(result) };
+    if (keymap_serialize(keymap, func, &config, NULL, NULL, &result))
+        return NULL;
+
+    entry = calloc(1, sizeof(*entry));
+    if (!entry) {
+        log_err(keymap->ctx, XKB_ERROR_ALLOCATION_FAILURE_,
+                "%s: could not allocate serialization cache entry\n", func);
+        free(result.serialized);
+        return NULL;
+    }
+    entry->format = format;
+    entry->flags = flags;
+    entry->serialized = result.serialized;
+    entry->length = result.length;
+    xkb_atomic_store(&entry->fd, -1);
+
+    /* Publish, unless a concurrent call was faster */
+    entry->next = head;
+    while (!xkb_atomic_compare_exchange(&keymap->serializations,
+                                        &entry->next, entry)) {
+        struct xkb_keymap_serialization * const other =
+            find_serialization(entry->next, head, format, flags);
+        if (other) {
+            free(entry->serialized);
+            free(entry);
+            return other;
+        }
+        head = entry->next;
+    }
+    return entry;
+}
+
+const char *
+xkb_keymap_get_as_shared_string(struct xkb_keymap *keymap,
+                                enum xkb_keymap_format format,
+                                enum xkb_keymap_serialize_flags flags,
+                                size_t *length)
+{
+    const struct xkb_keymap_serialization * const entry =
+        get_cached_serialization(keymap, __func__, format, flags);
+    if (!entry)
+        return NULL;
+    if (length)
+        *length = entry->length;
+    return entry->serialized;
+}
+
+#ifdef HAVE_SEALED_MEMFD
+/** Create a sealed memfd with the content of a serialization */
+static int
+create_sealed_fd(struct xkb_context *ctx, const char *func,
+                 const struct xkb_keymap_serialization *entry)
+{
+    const int fd = memfd_create("xkb-keymap", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (fd < 0) {
+        log_err(ctx, XKB_LOG_MESSAGE_NO_ID,
+                "%s: memfd_create() failed: %s\n", func, strerror(errno));
+        return -1;
+    }
+
+    int fd_copy = fd;
+    if (!write_to_fd(&fd_copy, entry->serialized, entry->length)) {
+        log_err(ctx, XKB_ERROR_KEYMAP_SERIALIZATION_WRITE_FAILURE_,
+                "%s: could not write the keymap to a memfd: %s\n",
+                func, strerror(errno));
+        close(fd);
+        return -1;
+    }
+
+    if (fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW |
+                               F_SEAL_WRITE | F_SEAL_SEAL) < 0) {
+        log_err(ctx, XKB_LOG_MESSAGE_NO_ID,
+                "%s: could not seal the keymap memfd: %s\n",
+                func, strerror(errno));
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+#endif
+
+int
+xkb_keymap_get_as_sealed_fd(struct xkb_keymap *keymap,
+                            enum xkb_keymap_format format,
+                            enum xkb_keymap_serialize_flags flags,
+                            size_t *size)
+{
+#ifdef HAVE_SEALED_MEMFD
+    struct xkb_keymap_serialization * const entry =
+        get_cached_serialization(keymap, __func__, format, flags);
+    if (!entry)
+        return -1;
+
+    int fd = xkb_atomic_load(&entry->fd);
+    if (fd < 0) {
+        const int new_fd = create_sealed_fd(keymap->ctx, __func__, entry);
+        if (new_fd < 0)
+            return -1;
+        /* Publish, unless a concurrent call was faster */
+        if (xkb_atomic_compare_exchange(&entry->fd, &fd, new_fd))
+            fd = new_fd;
+        else
+            close(new_fd);
+    }
+
+    if (size)
+        *size = entry->length;
+    return fd;
+#else
+    (void) format;
+    (void) flags;
+    (void) size;
+    log_err_func1(keymap->ctx, XKB_LOG_MESSAGE_NO_ID,
+                  "sealed file descriptors are not supported "
+                  "on this platform\n");
+    return -1;
+#endif
+}
+
 /**
  * Returns the total number of modifiers active in the keymap.
  */
@@ -559,27 +838,11 @@ xkb_keymap_led_get_index(struct xkb_keymap *keymap, const char *name)
     return XKB_LED_INVALID;
 }
 
-size_t
-xkb_keymap_key_get_mods_for_level(struct xkb_keymap *keymap,
-                                  xkb_keycode_t kc,
-                                  xkb_layout_index_t layout,
-                                  xkb_level_index_t level,
-                                  xkb_mod_mask_t *masks_out,
-                                  size_t masks_size)
+static size_t
+type_get_mods_for_level(const struct xkb_key_type *type,
+                        xkb_level_index_t level,
+                        xkb_mod_mask_t *masks_out, size_t masks_size)
 {
-    const struct xkb_key *key = XkbKey(keymap, kc);
-    if (!key)
-        return 0;
-
-    layout = xkb_keymap_key_effective_layout(key, layout);
-    if (layout == XKB_LAYOUT_INVALID)
-        return 0;
-
-    if (level >= XkbKeyNumLevels(key, layout))
-        return 0;
-
-    const struct xkb_key_type *type = key->groups[layout].type;
-
     size_t count = 0;
 
     /*
@@ -617,6 +880,29 @@ xkb_keymap_key_get_mods_for_level(struct xkb_keymap *keymap,
     return count;
 }
 
+size_t
+xkb_keymap_key_get_mods_for_level(struct xkb_keymap *keymap,
+                                  xkb_keycode_t kc,
+                                  xkb_layout_index_t layout,
+                                  xkb_level_index_t level,
+                                  xkb_mod_mask_t *masks_out,
+                                  size_t masks_size)
+{
+    const struct xkb_key *key = XkbKey(keymap, kc);
+    if (!key)
+        return 0;
+
+    layout = xkb_keymap_key_effective_layout(key, layout);
+    if (layout == XKB_LAYOUT_INVALID)
+        return 0;
+
+    if (level >= XkbKeyNumLevels(key, layout))
+        return 0;
+
+    return type_get_mods_for_level(key->groups[layout].type, level,
+                                   masks_out, masks_size);
+}
+
 struct xkb_level *
 xkb_keymap_key_get_level(struct xkb_keymap *keymap, const struct xkb_key *key,
                          xkb_layout_index_t layout, xkb_level_index_t level)
@@ -796,21 +1082,135 @@ xkb_keymap_key_get_name(struct xkb_keymap *keymap, xkb_keycode_t kc)
     return xkb_atom_text(keymap->ctx, key->name);
 }
 
-xkb_keycode_t
-xkb_keymap_key_by_name(struct xkb_keymap *keymap, const char *name)
+/**
+ * Open addressing hash table with linear probing, mapping key names and
+ * aliases atoms to their keycode. Empty slots have a null name.
+ *
+ * It is immutable once published, so readers need no lock.
+ */
+struct xkb_key_name_index {
+    /** Power of 2 */
+    uint32_t size;
+    struct {
+        xkb_atom_t name;
+        xkb_keycode_t keycode;
+    } entries[];
+};
+
+static inline uint32_t
+hash_key_name(xkb_atom_t name)
 {
-    struct xkb_key *key;
-    xkb_atom_t atom;
+    /* Fibonacci hashing: atoms are mostly contiguous small integers */
+    return name * UINT32_C(2654435761);
+}
+
+/* Get the slot of an atom: either its entry or the empty slot to insert it */
+static inline uint32_t
+key_name_index_slot(const struct xkb_key_name_index *index, xkb_atom_t name)
+{
+    const uint32_t mask = index->size - 1;
+    uint32_t slot = hash_key_name(name) & mask;
+    while (index->entries[slot].name != XKB_ATOM_NONE &&
+           index->entries[slot].name != name)
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+static xkb_keycode_t
+key_name_index_lookup(const struct xkb_key_name_index *index, xkb_atom_t name)
+{
+    const uint32_t slot = key_name_index_slot(index, name);
+    return (index->entries[slot].name == XKB_ATOM_NONE)
+        ? XKB_KEYCODE_INVALID
+        : index->entries[slot].keycode;
+}
+
+static struct xkb_key_name_index *
+key_name_index_new(const struct xkb_keymap *keymap)
+{
+    /* Load factor ≤ 1/2 */
+    const unsigned int count = keymap->num_keys + keymap->num_key_aliases;
+    const uint32_t size = next_pow2(MAX(2 * count, 16u));
+    struct xkb_key_name_index * const index =
+        calloc(1, sizeof(*index) + size * sizeof(index->entries[0]));
+    if (!index)
+        return NULL;
+    index->size = size;
+
+    /* Canonical names: the first key wins */
+    const struct xkb_key *key;
+    xkb_keys_foreach(key, keymap) {
+        if (key->name == XKB_ATOM_NONE)
+            continue;
+        const uint32_t slot = key_name_index_slot(index, key->name);
+        if (index->entries[slot].name == XKB_ATOM_NONE) {
+            index->entries[slot].name = key->name;
+            index->entries[slot].keycode = key->keycode;
+        }
+    }
 
-    atom = xkb_atom_lookup(keymap->ctx, name);
-    if (atom) {
-        for (darray_size_t i = 0; i < keymap->num_key_aliases; i++)
-            if (keymap->key_aliases[i].alias == atom)
-                atom = keymap->key_aliases[i].real;
+    /*
+     * Aliases take precedence over canonical names. The scan in `key_by_name()`
+     * replaces the name with the target of each matching alias, in order: so
+     * the first matching alias wins and an alias target may itself be an alias
+     * defined afterwards. Processing the aliases in *reverse* order, resolving
+     * each target with the current table, gives the same results.
+     */
+    for (darray_size_t i = keymap->num_key_aliases; i-- > 0;) {
+        const xkb_atom_t alias = keymap->key_aliases[i].alias;
+        if (alias == XKB_ATOM_NONE)
+            continue;
+        const xkb_keycode_t target =
+            key_name_index_lookup(index, keymap->key_aliases[i].real);
+        const uint32_t slot = key_name_index_slot(index, alias);
+        index->entries[slot].name = alias;
+        index->entries[slot].keycode = target;
     }
+
+    return index;
+}
+
+/* Get the key name lookup table, creating it on first use */
+static const struct xkb_key_name_index *
+get_key_name_index(struct xkb_keymap *keymap)
+{
+    struct xkb_key_name_index *index = xkb_atomic_load(&keymap->key_name_index);
+    if (index)
+        return index;
+
+    index = key_name_index_new(keymap);
+    if (!index) {
+        log_err(keymap->ctx, XKB_ERROR_ALLOCATION_FAILURE_,
+                "Could not allocate the key name lookup table\n");
+        return NULL;
+    }
+
+    /* Publish, unless a concurrent call was faster */
+    struct xkb_key_name_index *expected = NULL;
+    if (!xkb_atomic_compare_exchange(&keymap->key_name_index, &expected, index)) {
+        free(index);
+        return expected;
+    }
+    return index;
+}
+
+static xkb_keycode_t
+key_by_name(struct xkb_keymap *keymap, const struct xkb_key_name_index *index,
+            const char *name)
+{
+    xkb_atom_t atom = xkb_atom_lookup(keymap->ctx, name);
     if (!atom)
         return XKB_KEYCODE_INVALID;
 
+    if (index)
+        return key_name_index_lookup(index, atom);
+
+    /* Fallback if the lookup table could not be allocated */
+    for (darray_size_t i = 0; i < keymap->num_key_aliases; i++)
+        if (keymap->key_aliases[i].alias == atom)
+            atom = keymap->key_aliases[i].real;
+
+    const struct xkb_key *key;
     xkb_keys_foreach(key, keymap) {
         if (key->name == atom)
             return key->keycode;
@@ -819,6 +1219,234 @@ xkb_keymap_key_by_name(struct xkb_keymap *keymap, const char *name)
     return XKB_KEYCODE_INVALID;
 }
 
+xkb_keycode_t
+xkb_keymap_key_by_name(struct xkb_keymap *keymap, const char *name)
+{
+    return key_by_name(keymap, get_key_name_index(keymap), name);
+}
+
+int
+xkb_keymap_keys_by_names(struct xkb_keymap *keymap, const char * const *names,
+                         size_t count, xkb_keycode_t *keycodes)
+{
+    if (count > INT_MAX)
+        return -1;
+
+    const struct xkb_key_name_index * const index = get_key_name_index(keymap);
+    int found = 0;
+    for (size_t k = 0; k < count; k++) {
+        keycodes[k] = (names[k])
+            ? key_by_name(keymap, index, names[k])
+            : XKB_KEYCODE_INVALID;
+        if (keycodes[k] != XKB_KEYCODE_INVALID)
+            found++;
+    }
+    return found;
+}
+
+/**
+ * Keysym -> positions lookup table: open addressing hash table with linear
+ * probing. Each entry references a range of `positions`, sorted by layout,
+ * level and keycode. Empty slots have a null count.
+ *
+ * It is immutable once published, so readers need no lock.
+ */
+struct xkb_keysym_index {
+    struct xkb_keysym_position *positions;
+    xkb_mod_mask_t *masks;
+    /** Power of 2 */
+    uint32_t size;
+    struct {
+        xkb_keysym_t keysym;
+        darray_size_t first;
+        darray_size_t count;
+    } entries[];
+};
+
+/** Keysym position gathered while creating the index */
+struct keysym_position_entry {
+    xkb_keysym_t keysym;
+    xkb_keycode_t keycode;
+    xkb_layout_index_t layout;
+    xkb_level_index_t level;
+    darray_size_t first_mask;
+    darray_size_t num_masks;
+};
+
+static int
+keysym_position_entry_compare(const void *a, const void *b)
+{
+    const struct keysym_position_entry * const e1 = a;
+    const struct keysym_position_entry * const e2 = b;
+    if (e1->keysym != e2->keysym)
+        return (e1->keysym < e2->keysym) ? -1 : 1;
+    if (e1->layout != e2->layout)
+        return (e1->layout < e2->layout) ? -1 : 1;
+    if (e1->level != e2->level)
+        return (e1->level < e2->level) ? -1 : 1;
+    if (e1->keycode != e2->keycode)
+        return (e1->keycode < e2->keycode) ? -1 : 1;
+    return 0;
+}
+
+static inline uint32_t
+keysym_index_slot(const struct xkb_keysym_index *index, xkb_keysym_t keysym)
+{
+    const uint32_t mask = index->size - 1;
+    /* Fibonacci hashing */
+    uint32_t slot = (keysym * UINT32_C(2654435761)) & mask;
+    while (index->entries[slot].count != 0 &&
+           index->entries[slot].keysym != keysym)
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+static void
+keysym_index_free(struct xkb_keysym_index *index)
+{
+    if (!index)
+        return;
+    free(index->positions);
+    free(index->masks);
+    free(index);
+}
+
+static struct xkb_keysym_index *
+keysym_index_new(const struct xkb_keymap *keymap)
+{
+    darray(struct keysym_position_entry) entries = darray_new();
+    darray(xkb_mod_mask_t) masks = darray_new();
+    struct xkb_keysym_index *index = NULL;
+    struct xkb_keysym_position *positions = NULL;
+
+    /* Gather the positions of the levels with exactly one keysym */
+    const struct xkb_key *key;
+    xkb_keys_foreach(key, keymap) {
+        for (xkb_layout_index_t layout = 0; layout < key->num_groups; layout++) {
+            const struct xkb_key_type * const type = key->groups[layout].type;
+            const xkb_level_index_t num_levels = XkbKeyNumLevels(key, layout);
+            for (xkb_level_index_t level = 0; level < num_levels; level++) {
+                const struct xkb_level * const leveli =
+                    &key->groups[layout].levels[level];
+                if (leveli->num_syms != 1 || leveli->s.sym == XKB_KEY_NoSymbol)
+                    continue;
+                const darray_size_t first_mask = darray_size(masks);
+                darray_resize(masks, first_mask + type->num_entries + 1);
+                const size_t num_masks = type_get_mods_for_level(
+                    type, level, &darray_item(masks, first_mask),
+                    type->num_entries + 1
+                );
+                darray_resize(masks, first_mask + (darray_size_t) num_masks);
+                /* Skip unreachable levels */
+                if (!num_masks)
+                    continue;
+                const struct keysym_position_entry entry = {
+                    .keysym = leveli->s.sym,
+                    .keycode = key->keycode,
+                    .layout = layout,
+                    .level = level,
+                    .first_mask = first_mask,
+                    .num_masks = (darray_size_t) num_masks,
+                };
+                darray_append(entries, entry);
+            }
+        }
+    }
+
+    if (!darray_empty(entries))
+        qsort(darray_items(entries), darray_size(entries),
+              sizeof(darray_item(entries, 0)), keysym_position_entry_compare);
+
+    darray_size_t num_keysyms = 0;
+    for (darray_size_t k = 0; k < darray_size(entries); k++) {
+        if (k == 0 || darray_item(entries, k).keysym !=
+                      darray_item(entries, k - 1).keysym)
+            num_keysyms++;
+    }
+
+    /* Load factor ≤ 1/2 */
+    const uint32_t size = next_pow2(MAX(2 * num_keysyms, 16u));
+    index = calloc(1, sizeof(*index) + size * sizeof(index->entries[0]));
+    positions = calloc(MAX(darray_size(entries), 1), sizeof(*positions));
+    if (!index || !positions)
+        goto error;
+    index->size = size;
+    darray_steal(masks, &index->masks, NULL);
+    index->positions = positions;
+
+    for (darray_size_t k = 0; k < darray_size(entries); k++) {
+        const struct keysym_position_entry * const entry =
+            &darray_item(entries, k);
+        positions[k] = (struct xkb_keysym_position) {
+            .keycode = entry->keycode,
+            .layout = entry->layout,
+            .level = entry->level,
+            .num_masks = (uint32_t) entry->num_masks,
+            .masks = index->masks + entry->first_mask,
+        };
+        const uint32_t slot = keysym_index_slot(index, entry->keysym);
+        if (index->entries[slot].count == 0) {
+            index->entries[slot].keysym = entry->keysym;
+            index->entries[slot].first = k;
+        }
+        index->entries[slot].count++;
+    }
+
+    darray_free(entries);
+    return index;
+
+error:
+    darray_free(entries);
+    darray_free(masks);
+    free(index);
+    free(positions);
+    return NULL;
+}
+
+/* Get the keysym lookup table, creating it on first use */
+static const struct xkb_keysym_index *
+get_keysym_index(struct xkb_keymap *keymap)
+{
+    struct xkb_keysym_index *index = xkb_atomic_load(&keymap->keysym_index);
+    if (index)
+        return index;
+
+    index = keysym_index_new(keymap);
+    if (!index) {
+        log_err(keymap->ctx, XKB_ERROR_ALLOCATION_FAILURE_,
+                "Could not allocate the keysym lookup table\n");
+        return NULL;
+    }
+
+    /* Publish, unless a concurrent call was faster */
+    struct xkb_keysym_index *expected = NULL;
+    if (!xkb_atomic_compare_exchange(&keymap->keysym_index, &expected, index)) {
+        keysym_index_free(index);
+        return expected;
+    }
+    return index;
+}
+
+int
+xkb_keymap_keysym_get_positions(struct xkb_keymap *keymap, xkb_keysym_t keysym,
+                                const struct xkb_keysym_position **positions_out)
+{
+    *positions_out = NULL;
+
+    const struct xkb_keysym_index * const index = get_keysym_index(keymap);
+    if (!index)
+        return -1;
+
+    if (keysym == XKB_KEY_NoSymbol)
+        return 0;
+
+    const uint32_t slot = keysym_index_slot(index, keysym);
+    const darray_size_t count = index->entries[slot].count;
+    if (count)
+        *positions_out = &index->positions[index->entries[slot].first];
+    return (int) count;
+}
+
 /**
  * Simple boolean specifying whether or not the key should repeat.
  */
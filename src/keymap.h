@@ -683,6 +683,35 @@ typedef struct {
     } u;
 } ModMapEntry;
 
+/**
+ * Cached serialization of a keymap.
+ *
+ * Entries are immutable once published, except for the lazily created file
+ * descriptor.
+ */
+struct xkb_keymap_serialization {
+    struct xkb_keymap_serialization *next;
+    enum xkb_keymap_format format;
+    enum xkb_keymap_serialize_flags flags;
+    /** Length of the serialization, including the terminating NULL byte */
+    size_t length;
+    char *serialized;
+    /** Sealed memfd with the serialization, or -1 if not created yet */
+    XKB_ATOMIC(int) fd;
+};
+
+/** Key name and alias -> keycode lookup table, see: `xkb_keymap_key_by_name()` */
+struct xkb_key_name_index;
+/** Keysym -> positions lookup table, see: `xkb_keymap_keysym_get_positions()` */
+struct xkb_keysym_index;
+
+/** Slot of the high keycodes lookup table. Empty slots have an invalid keycode. */
+struct xkb_high_key {
+    xkb_keycode_t keycode;
+    /** Index in `xkb_keymap::keys` */
+    xkb_keycode_t index;
+};
+
 /** Common keyboard description structure */
 struct xkb_keymap {
     struct xkb_context *ctx;
@@ -705,10 +734,18 @@ struct xkb_keymap {
      *     Fast O(1) access.
      *   High keycodes (> XKB_KEYCODE_MAX_CONTIGUOUS)
      *     Stored noncontiguously at indexes [num_keys_low..num_keys).
-     *     Slow access via a binary search.
+     *     O(1) access via the `high_keys` hash table once the keymap is
+     *     complete, else via a binary search.
      */
     xkb_keycode_t num_keys_low;
     struct xkb_key *keys ATTR_COUNTED_BY(num_keys);
+    /**
+     * High keycode -> key index hash table, with linear probing.
+     * Its size is `1 << (32 - high_keys_shift)`.
+     * See: `xkb_keymap_freeze()`
+     */
+    uint32_t high_keys_shift;
+    struct xkb_high_key *high_keys;
 
     union {
         /**
@@ -794,6 +831,21 @@ struct xkb_keymap {
     char *symbols_section_name;
     char *types_section_name;
     char *compat_section_name;
+
+    /**
+     * Contiguous storage of the key types entries and of the keys groups,
+     * levels, keysyms and actions, once the keymap is frozen.
+     * See: `xkb_keymap_freeze()`
+     */
+    char *frozen;
+
+    /** Cached serializations, see: `xkb_keymap_get_as_shared_string()` */
+    XKB_ATOMIC(struct xkb_keymap_serialization *) serializations;
+
+    /** Lazily created key name lookup table */
+    XKB_ATOMIC(struct xkb_key_name_index *) key_name_index;
+    /** Lazily created keysym lookup table */
+    XKB_ATOMIC(struct xkb_keysym_index *) keysym_index;
 };
 
 enum {
@@ -875,6 +927,16 @@ XkbKeyByName(const struct xkb_keymap *keymap, xkb_atom_t name, bool use_aliases)
     return NULL;
 }
 
+/*
+ * Fibonacci hashing: use the high bits of the product, so that keycodes
+ * differing only by their high bits do not collide.
+ */
+static inline uint32_t
+high_keycode_hash(xkb_keycode_t kc, uint32_t shift)
+{
+    return (kc * UINT32_C(2654435761)) >> shift;
+}
+
 static inline const struct xkb_key *
 XkbKey(const struct xkb_keymap *keymap, xkb_keycode_t kc)
 {
@@ -884,6 +946,16 @@ XkbKey(const struct xkb_keymap *keymap, xkb_keycode_t kc)
     } else if (kc < keymap->num_keys_low) {
         /* Low keycodes */
         return &keymap->keys[kc];
+    } else if (keymap->high_keys) {
+        /* High keycodes: use the hash table */
+        const uint32_t mask = UINT32_MAX >> keymap->high_keys_shift;
+        uint32_t slot = high_keycode_hash(kc, keymap->high_keys_shift);
+        while (keymap->high_keys[slot].keycode != kc) {
+            if (keymap->high_keys[slot].keycode == XKB_KEYCODE_INVALID)
+                return NULL;
+            slot = (slot + 1) & mask;
+        }
+        return &keymap->keys[keymap->high_keys[slot].index];
     } else {
         /* High keycodes: use binary search */
         xkb_keycode_t lower = keymap->num_keys_low;
@@ -927,6 +999,19 @@ xkb_keymap_new(struct xkb_context *ctx, const char* func,
                enum xkb_keymap_format format,
                enum xkb_keymap_compile_flags flags);
 
+/**
+ * Relocate the key types entries and the keys groups, levels, keysyms and
+ * actions into a single allocation, in key order, so that the lookups for a
+ * key touch few cache lines. Also create the high keycodes lookup table.
+ *
+ * Must be called once the keymap is complete; it must not be modified
+ * afterwards. Each step is optional: on allocation failure, the keymap keeps
+ * its separate allocations, respectively the binary search of high keycodes,
+ * and remains fully functional.
+ */
+void
+xkb_keymap_freeze(struct xkb_keymap *keymap);
+
 void
 XkbEscapeMapName(char *name);
 
@@ -987,6 +1072,12 @@ struct xkb_keymap_format_ops {
         const struct xkb_keymap_serialize_config *config,
         struct xkb_keymap_serialize_result *result
     );
+    enum xkb_error_code (*keymap_serialize_stream)(
+        const struct xkb_keymap *keymap,
+        const struct xkb_keymap_serialize_config *config,
+        xkb_keymap_serialize_write_fn write, void *user_data,
+        struct xkb_keymap_serialize_result *result
+    );
 };
 
 extern const struct xkb_keymap_format_ops text_v1_keymap_format_ops;
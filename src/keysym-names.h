@@ -8139,6 +8139,2587 @@ static const struct name_keysym keysym_to_name[] = {
     { 0x1008ffb8, 28756 }, /* XF86FullScreen */
 };
 
+
+static const uint16_t keysym_name_icase_G[] = {
+    0, 0, 0, 0, 0, 0, 1201, 0, 0, 0, 0, 0, 2265, 0, 0, 0,
+    0, 0, 0, 0, 3977, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4011, 0, 0, 0, 0, 0,
+    0, 2449, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2037, 0, 0, 603, 3292, 0, 0, 0, 0,
+    0, 0, 649, 0, 0, 0, 0, 0, 0, 1987, 0, 3280, 3017, 0, 0, 0, 1852, 0, 0,
+    0, 0, 1852, 0, 1211, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 186, 0, 0, 0, 0, 0,
+    2707, 0, 0, 248, 0, 0, 68, 0, 0, 1388, 0, 0, 0, 0, 0, 2794, 0, 1459, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 470, 0, 0, 1725, 0, 979, 0, 0,
+    0, 0, 1958, 214, 0, 0, 0, 0, 3733, 0, 0, 2153, 1060, 2464, 0, 0, 0,
+    3245, 0, 93, 0, 0, 0, 0, 0, 2259, 3890, 3064, 0, 0, 0, 2440, 2067, 0,
+    157, 0, 0, 0, 1499, 1012, 0, 0, 0, 0, 0, 3048, 0, 0, 0, 167, 475, 174,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2495, 2224, 4034,
+    209, 0, 0, 0, 0, 0, 0, 0, 0, 1030, 0, 369, 1902, 0, 0, 0, 0, 0, 0, 691,
+    1823, 2031, 2772, 0, 0, 0, 0, 0, 0, 0, 3671, 0, 1950, 0, 3905, 0, 0, 0,
+    0, 3458, 0, 0, 0, 640, 0, 0, 0, 0, 0, 2400, 0, 0, 983, 0, 2390, 0, 0,
+    0, 0, 1, 746, 0, 2168, 0, 1833, 0, 0, 711, 3496, 0, 0, 2412, 102, 0,
+    3079, 0, 0, 0, 0, 0, 0, 1395, 0, 0, 2544, 0, 186, 0, 0, 3533, 2218, 0,
+    662, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3150, 2583, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3831, 0, 1749, 0, 0, 0, 0, 2431, 888, 2669, 0, 614, 212,
+    862, 3482, 0, 2818, 0, 0, 150, 208, 0, 2623, 0, 0, 166, 0, 0, 0, 3228,
+    0, 2262, 1249, 178, 1487, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2096, 0, 0, 955,
+    0, 1295, 0, 535, 2958, 1580, 1770, 1601, 3313, 1205, 3067, 3705, 0,
+    1220, 0, 2944, 0, 0, 0, 0, 0, 0, 0, 0, 2529, 1572, 0, 0, 0, 0, 0, 4095,
+    0, 1809, 4, 0, 315, 0, 1410, 0, 0, 2948, 0, 19, 0, 0, 2765, 0, 0, 2234,
+    0, 0, 0, 635, 0, 2894, 0, 0, 0, 0, 4077, 1803, 0, 4048, 0, 2052, 1312,
+    0, 49, 0, 716, 114, 1231, 1487, 0, 149, 833, 1602, 336, 0, 3752, 3482,
+    0, 2537, 0, 2654, 0, 0, 2246, 0, 0, 2911, 0, 0, 122, 524, 0, 0, 2413,
+    0, 0, 1516, 925, 229, 3324, 0, 0, 1190, 0, 0, 0, 2674, 3277, 2404, 0,
+    0, 0, 0, 66, 1238, 2675, 455, 910, 0, 1040, 0, 0, 0, 0, 0, 0, 0, 0,
+    1596, 0, 3943, 2197, 3295, 0, 710, 0, 3600, 0, 0, 752, 637, 0, 1605,
+    3587, 1631, 0, 4022, 0, 0, 0, 2219, 0, 0, 0, 0, 0, 0, 300, 0, 0, 0,
+    3833, 374, 451, 0, 2645, 57, 1869, 2655, 2853, 0, 570, 247, 2664, 0, 0,
+    0, 79, 1746, 1932, 0, 1313, 2261, 2102, 393, 0, 681, 0, 1900, 0, 1102,
+    0, 0, 646, 3410, 0, 619, 0, 0, 0, 0, 1181, 1012, 0, 3640, 0, 53, 508,
+    0, 1845, 2407, 0, 0, 0, 22, 0, 0, 0, 0, 0, 2659, 3723, 0, 0, 340, 0,
+    1873, 2165, 1073, 0, 0, 1105, 0, 0, 2825, 3854, 0, 1714, 2834, 0, 0, 0,
+    3981, 0, 648, 0, 2696, 0, 3581, 995, 1317, 1471, 0, 1877, 1183, 0, 0,
+    0, 472, 672, 0, 2182, 62, 2329, 294, 1638, 0, 0, 1921, 347, 2289, 3840,
+    0, 1681, 0, 0, 0, 0, 0, 1176, 19, 0, 3318, 0, 0, 146, 804, 2939, 0, 0,
+    0, 0, 0, 0, 2668, 639, 0, 0, 0, 1630, 0, 2283, 0, 2470, 0, 2549, 470,
+    0, 0, 0, 0, 1703, 0, 0, 1903, 1213, 0, 332, 0, 0, 705, 0, 0, 1847, 0,
+    0, 1695, 2008, 0, 0, 288, 1660, 0, 1617, 0, 0, 0, 0, 921, 0, 3550, 0,
+    1982, 0, 758, 0, 3002, 0, 2468, 2661, 3452, 0, 1613, 684, 0, 0, 0,
+    3207, 2713, 0, 0, 3132, 0, 382, 3880, 0, 3077, 2514, 1199, 0, 3485,
+    3626, 3208, 250, 0, 3207, 0, 0, 486, 1210, 0, 0, 0, 0, 0, 0, 3071, 0,
+    3351, 3068, 3896, 834, 773, 0, 1968, 0, 0, 2196, 0, 0, 0, 0, 0, 1384,
+    0, 0, 0, 0, 1669, 173, 3042, 562, 0, 0, 0, 1599, 0, 3788, 3894, 0, 261,
+    0, 1616, 0, 0, 2704, 381, 2553, 903, 0, 0, 0, 1224, 0, 0, 0, 0, 2171,
+    0, 2167, 0, 3275, 0, 0, 2491, 2874, 0, 0, 540, 0, 3375, 2202, 0, 0, 0,
+    0, 0, 0, 377, 2916, 0, 0, 3468, 0, 0, 996, 3684, 0, 2246, 3763, 1865,
+    2034, 0, 0, 2383, 1309, 0, 3106, 1908, 774, 554, 370, 616, 3919, 0, 0,
+    181, 0, 0, 1371, 0, 0, 1622, 1158, 0, 0, 2810, 0, 0, 980, 0, 1471,
+    2268, 0, 0, 99, 1721, 0, 0, 0, 0, 0, 1045, 0, 596, 0, 0, 53, 0, 110, 0,
+    0, 251, 2017, 1790, 2546, 0, 0, 1362, 0, 2565, 1744, 0, 0, 0, 0, 0, 0,
+    1225, 0, 2757, 0, 0, 156, 589, 1347, 3878, 847, 0, 0, 1799, 1045, 0, 0,
+    0, 2222, 2782, 3732, 0, 0, 470, 0, 3245, 2392, 0, 0, 406, 427, 986, 0,
+    0, 3288, 0, 480, 0, 0, 3370, 0, 0, 2673, 0, 0, 0, 3210, 0, 3602, 562,
+    0, 1828, 3668, 20, 0, 1618, 0, 500, 75, 3456, 0, 0, 3423, 0, 0, 0, 0,
+    0, 3395, 3362, 3169, 0, 3291, 727, 676, 3657, 0, 106, 0, 0, 172, 0,
+    3320, 907, 1200, 4050, 0, 0, 0, 3475, 2007, 0, 1967, 1925, 0, 0, 1282,
+    0, 3990, 0, 0, 0, 0, 1922, 1178, 1971, 2857, 3304, 4025, 547, 1631,
+    1446, 3793, 597, 697, 3656, 1355, 1545, 3451, 0, 680, 3658, 2028, 0,
+    3507, 0, 531, 0, 0, 1069, 0, 0, 0, 0, 1013, 2288, 0, 0, 2980, 0, 0,
+    3305, 2210, 2054, 3155, 1606, 0, 3462, 0, 1476, 0, 2852, 0, 1506, 2485,
+    0, 0, 0, 3138, 0, 512, 0, 1238, 1527, 0, 2092, 1189, 0, 0, 0, 0, 0,
+    1607, 3871, 2064, 2532, 674, 3882, 0, 1098, 0, 1425, 2488, 0, 2484, 0,
+    2162, 2651, 1957, 0, 3001, 0, 0, 0, 0, 0, 0, 2799, 3091, 3399, 0, 0,
+    2554, 3594, 0, 0, 2880, 0, 2345, 1668, 492, 581, 0, 757, 1140, 2553,
+    4021, 3954, 1994, 0, 0, 0, 2470, 43, 0, 2938, 0, 0, 0, 1504, 0, 3336,
+    0, 0, 3186, 0, 2181, 0, 0, 0, 577, 0, 3492, 2070, 0, 3872, 424, 2982,
+    3732, 534, 0, 2441, 2728, 0, 119, 0, 0, 0, 1640, 711, 0, 0, 0, 21, 32,
+    1928, 3755, 0, 0, 829, 0, 0, 0, 1757, 355, 0, 0, 0, 0, 1371, 0, 1787,
+    2389, 666, 0, 0, 269, 0, 154, 0, 778, 0, 0, 198, 0, 0, 0, 0, 1745, 133,
+    1971, 179, 0, 0, 0, 3681, 0, 0, 0, 1600, 2738, 2057, 1756, 3336, 0,
+    3828, 1166, 0, 1307, 1547, 0, 1855, 781, 1078, 1556, 2124, 0, 1780, 0,
+    560, 0, 3533, 0, 337, 3509, 0, 2553, 0, 1843, 92, 0, 0, 0, 0, 1235, 0,
+    0, 0, 3449, 0, 0, 0, 0, 2083, 334, 0, 0, 0, 0, 0, 2446, 0, 0, 2340, 0,
+    0, 1320, 2162, 1799, 1353, 623, 162, 0, 0, 1116, 3976, 3453, 779, 986,
+    133, 0, 3398, 0, 1331, 3950, 0, 0, 0, 803, 0, 3626, 2627, 0, 0, 0,
+    3215, 1798, 0, 2205, 0, 0, 2826, 0, 0, 585, 3812, 0, 56, 2084, 940,
+    913, 0, 0, 948, 2673, 0, 0, 1581, 0, 0, 3690, 0, 2819, 786, 2244, 1229,
+    648, 245, 0, 2122, 2564, 0, 0, 0, 0, 262, 0, 2295, 813, 0, 0, 3569,
+    712, 2248, 1339, 0, 1547, 0, 2723, 0, 4054, 0, 1090, 0, 0, 0, 0, 2217,
+    1408, 0, 0, 0, 0, 425, 0, 0, 0, 3411, 0, 0, 0, 322, 0, 2721, 0, 0, 0,
+    0, 4051, 359, 3802, 0, 2921, 1380, 0, 0, 0, 0, 206, 492, 2767, 0, 0,
+    2203, 0, 0, 0, 782, 2348, 0, 972, 0, 0, 0, 1667, 0, 2748, 0, 0, 659, 0,
+    0, 2161, 623, 4041, 0, 0, 135, 2410, 80, 0, 1290, 2032, 2405, 3969, 0,
+    0, 1311, 0, 48, 0, 106, 0, 0, 2620, 1854, 1809, 2273, 2029, 3066, 0,
+    1892, 0, 3663, 0, 3730, 1025, 1763, 1928, 453, 591, 2443, 2134, 1967,
+    1919, 0, 0, 1544, 1958, 0, 0, 0, 1703, 0, 1327, 3069, 3239, 2968, 0, 0,
+    526, 3575, 226, 2087, 0, 594, 0, 1891, 0, 3613, 2064, 0, 0, 515, 1401,
+    2154, 0, 1221, 0, 0, 0, 0, 2551, 2977, 496, 699, 0, 0, 181, 0, 722, 0,
+    3477, 1660, 3042, 0, 1924, 0, 0, 0, 3389, 0, 2728, 290, 0, 0, 0, 1680,
+    0, 0, 0, 646, 577, 0, 0, 449, 1036, 701, 2532, 1445, 1244, 556, 0, 0,
+    3972, 0, 0, 0, 0, 0, 0, 3210, 1565, 1594, 2279, 0, 4000, 1867, 1737,
+    1957, 0, 1439, 787, 0, 0, 0, 1470, 0, 1687, 0, 0, 2164, 0, 117, 2200,
+    1570, 978, 2325, 3046, 0, 0, 0, 719, 0, 285, 1839, 1572, 3222, 0, 120,
+    0, 0, 2807, 0, 3171, 729, 2650, 0, 3373, 348, 391, 0, 0, 2540, 0, 0,
+    1064, 1871, 740, 0, 0, 0, 1657, 2462, 0, 0, 0, 1126, 0, 114, 2852, 0,
+    0, 0, 0, 3318, 0, 0, 244, 0, 0, 3416, 0, 292, 1573, 0, 3092, 3437, 0,
+    0, 0, 1659, 0, 1518, 0, 110, 1041, 0, 0, 0, 1258, 1531, 911, 0, 1483,
+    0, 0, 3459, 908, 2657, 0, 0, 0, 0, 0, 0, 721, 1869, 0, 2227, 0, 1589,
+    2906, 0, 1372, 1521, 0, 1771, 0, 0, 0, 2395, 0, 3185, 1747, 15, 2240,
+    0, 4055, 3494, 464, 3456, 3308, 3419, 2114, 2780, 0, 0, 2541, 4008, 0,
+    0, 3813, 0, 0, 1755, 0, 0, 948, 0, 2504, 0, 11, 2190, 0, 1535, 0, 0, 0,
+    0, 573, 0, 0, 2587, 0, 0, 0, 0, 2354, 421, 1207, 0, 3675, 433, 0, 3492,
+    0, 3468, 1454, 3420, 933, 4013, 1315, 1093, 0, 709, 1741, 0, 2754, 44,
+    1057, 872, 0, 3840, 0, 0, 3970, 0, 0, 0, 0, 0, 3501, 1974, 58, 1723,
+    3605, 0, 0, 0, 0, 0, 0, 3208, 0, 0, 2408, 1511, 1273, 0, 2073, 0, 0,
+    1398, 0, 0, 0, 0, 0, 2228, 2241, 0, 1868, 1931, 1566, 0, 2584, 3663,
+    2214, 4074, 3704, 332, 0, 790, 0, 0, 0, 3644, 0, 110, 0, 346, 0, 1975,
+    2804, 0, 0, 3617, 326, 3810, 1731, 3445, 0, 0, 888, 0, 528, 775, 559,
+    2973, 714, 1765, 0, 3037, 799, 0, 3226, 0, 1602, 3683, 1888, 0, 3348,
+    0, 845, 0, 712, 2057, 0, 880, 3600, 3735, 0, 3157, 2292, 1409, 2952,
+    2213, 3938, 0, 0, 0, 456, 1855, 1100, 0, 2236, 2857, 0, 1730, 0, 395,
+    858, 3846, 111, 2226, 650, 139, 0, 0, 1954, 4045, 27, 0, 0, 1350, 1711,
+    0, 2172, 901, 2594, 938, 4063, 3788, 1174, 13, 4063, 2928, 0, 0, 0,
+    2012, 3572, 0, 0, 0, 1370, 431, 0, 3797, 0, 129, 0, 0, 2009, 0, 928,
+    2544, 2545, 154, 0, 2298, 0, 2531, 3093, 0, 0, 0, 3140, 0, 853, 2949,
+    210, 0, 4088, 2678, 0, 0, 0, 231, 0, 0, 0, 62, 3716, 0, 849, 0, 3964,
+    0, 3384, 296, 2545, 2527, 0, 1932, 199, 3403, 26, 0, 0, 247, 1649,
+    2693, 0, 2559, 967, 0, 2940, 25, 0, 3370, 705, 1253, 0, 119, 1282, 920,
+    0, 1930, 3063, 3522, 0, 0, 3797, 2071, 970, 3614, 191, 0, 1876, 1752,
+    3396, 3598, 1437, 2116, 0, 0, 4042, 0, 0, 0, 0, 0, 0, 3802, 518, 1426,
+    0, 399, 1238, 3463, 0, 0, 0, 143, 833, 1119, 0, 3436, 0, 442, 0, 0, 0,
+    1367, 2884, 0, 85, 2230, 0, 1589, 2012, 1349, 354, 1107, 0, 0, 0, 0,
+    2622, 387, 1005, 1245, 2226, 0, 1841, 1292, 1631, 746, 0, 0, 2586, 762,
+    0, 256, 0, 0, 0, 0, 0, 226, 0, 3792, 3239, 0, 1445, 2485, 0, 0, 2673,
+    3507, 1455, 0, 3610, 0, 0, 2955, 1177, 0, 3360, 0, 736, 2454, 2406, 0,
+    183, 0, 1862, 0, 253, 414, 2836, 1697, 746, 777, 0, 0, 0, 558, 3609,
+    2514, 0, 1004, 60, 0, 2269, 12, 0, 0, 0, 789, 3522, 3495, 387, 0, 0, 0,
+    0, 1359, 0, 0, 0, 1619, 3124, 0, 1661, 0, 3072, 1042, 2022, 444, 0,
+    3793, 1224, 2247, 413, 934, 0, 3744, 1952, 0, 655, 804, 0, 0, 2570,
+    3386, 407, 2165, 3081, 3634, 0, 0, 362, 2586, 3773, 0, 3287, 967, 0, 0,
+    3279, 2940, 211, 207, 2185, 0, 170, 0, 1040, 3761, 0, 4074, 0, 0, 3595,
+    1554, 963, 0, 2274, 0, 1331, 3444, 3726, 3631, 0, 0, 0, 0, 233, 442,
+    3024, 0, 2012, 0, 446, 0, 0, 636, 136, 0, 2374, 0, 1239, 2178, 0, 133,
+    3655, 3614, 1305, 2269, 0, 450, 608, 0, 0, 0, 0, 947, 3356, 1514, 0,
+    2149, 0, 218, 610, 58, 2475, 2744, 206, 0, 0, 0, 0, 1860, 738, 0, 0,
+    886, 351, 943, 0, 0, 450, 0, 1543, 0, 748, 130, 0, 2406, 498, 1771,
+    1367, 2370, 413, 0, 2984, 2133, 2481, 0, 0, 2360, 849, 3565, 2955, 0,
+    1948, 2232, 0, 3998, 441, 3213, 632, 3767, 0, 2785, 770, 863, 0, 0,
+    1262, 3607, 2275, 953, 0, 0, 0, 0, 0, 0, 0, 2242, 1863, 0, 0, 700, 0,
+    0, 0, 3978, 0, 0, 0, 1318, 1030, 0, 0, 0, 2258, 1026, 415, 606, 524, 0,
+    6, 2884, 3814, 0, 1249, 403, 3434, 0, 0, 1463, 0, 2151, 445, 73, 0,
+    3321, 1747, 0, 0, 3598, 1843, 3540, 37, 1494, 0, 0, 52, 0, 2432, 3018,
+    0, 2785, 0, 355, 551, 0, 0, 2904, 1217, 340, 3359, 1028, 2118, 0, 644,
+    0, 0, 2046, 3871, 417, 0, 0, 0, 0, 2246, 0, 3079, 455, 0, 3495, 3391,
+    3292, 0, 2003, 1456, 0, 0, 0, 78, 2646, 152, 725, 431, 2233, 1050, 0,
+    0, 361, 1020, 404, 0, 2075, 2394, 0, 3887, 1792, 1941, 748, 1739, 580,
+    963, 2105, 366, 696, 0, 1256, 0, 905, 760, 1309, 0, 2106, 788, 1010,
+    2921, 641, 0, 966, 1113, 0, 958, 721, 2564, 2934, 219, 2153, 930, 339,
+    0, 1053, 0, 449, 0, 0, 205, 0, 0, 0, 0, 3919, 0, 0, 1784, 363, 0, 1102,
+    1515, 0, 2035, 0, 287, 2493, 3081, 0, 0, 2018, 0, 2828, 1950, 3507,
+    2047, 741, 1281, 2261, 2013, 1285, 1328, 0, 2910, 133, 0, 0, 1726, 236,
+    0, 0, 1817, 251, 0, 0, 3470, 1764, 0, 1059, 0, 2719, 1569, 450, 0, 0,
+    2098, 3373, 0, 0, 2076, 0, 0, 224, 0, 0, 161, 0, 2016, 2234, 745, 3345,
+    0, 860, 3162, 3981, 879, 0, 2714, 0, 1735, 1460, 0, 77, 1611, 1649, 0,
+    2719, 0, 0, 421, 0, 1251, 2112, 3314, 2116, 0, 457, 0, 0, 0, 2496, 0,
+    2120, 2047, 0, 1383, 0, 1108, 1056, 0, 646, 851, 0, 0, 0, 1693, 0, 365,
+    2257, 1123, 1512, 0, 0, 306, 4102, 1725, 0, 2224, 1302, 3738, 865, 0,
+    2140, 0, 3758, 1240, 145, 445, 0, 2252, 2722, 0, 1452, 0, 962, 1642, 0,
+    0, 0, 3368, 0, 719, 3351, 1219, 0, 2690, 0, 479, 756, 433, 0, 453,
+    2077, 0, 0, 2159, 0, 0, 3950, 3358, 0, 2145, 2463, 3554, 0, 0, 313, 0,
+    3558, 3841, 1436, 0, 680, 0, 1873, 1341, 2504, 437, 0, 429, 0, 0, 2085,
+    0, 0, 2042, 0, 722, 1775, 1372, 348, 1109, 0, 0, 0, 0, 3316, 0, 3005,
+    0, 2067, 2258, 1568, 0, 0, 0, 0, 219, 887, 3885, 625, 1935, 397, 0,
+    409, 1389, 0, 405, 0, 0, 0, 3094, 1502, 1306, 0, 3121, 124, 2408, 0,
+    2896, 0, 8, 2163, 2800, 0, 1391, 0, 763, 0, 0, 3020, 1241, 3004, 0, 0,
+    1825, 3086, 3290, 850, 0, 870, 2770, 487, 0, 0, 1641, 217, 0, 0, 2282,
+    2160, 0, 2561, 3853, 0, 0, 0, 2110, 3814, 0, 0, 0, 900, 1175, 2518,
+    1015, 2900, 0, 1459, 3712, 169, 1125, 3804, 0, 0, 0, 0, 0, 847, 0, 385,
+    0, 2695, 1453, 0, 2540, 2330, 3439, 0, 687, 3515, 0, 906, 1849, 521,
+    546, 4098, 2549, 0, 0, 0, 0, 0, 0, 75, 0, 363, 648, 3749, 0, 2033,
+    3227, 0, 756, 2050, 0, 2976, 188, 2143, 0, 1536, 693, 0, 0, 0, 0, 1939,
+    0, 0, 2099, 0, 0, 0, 0, 0, 214, 1173, 248, 374, 906, 3887, 465, 0,
+    2488, 10, 3177, 1201, 1180, 626, 1896, 3373, 0, 518, 0, 3785, 3177,
+    137, 1236, 0, 4029, 2472, 856, 859, 0, 2365, 0, 0, 0, 1096, 0, 0, 1794,
+    0, 2943, 2020, 573, 2999, 485, 2780, 842, 4057, 0, 0, 0, 549, 0, 0,
+    604, 113, 0, 825, 0, 0, 1003, 1568, 1657, 1313, 780, 0, 1985, 1011, 0,
+    3051, 2195, 1324, 765, 1938, 0, 0, 3127, 0, 0, 0, 481, 1111, 0, 2363,
+    1885, 3364, 1366, 2755, 4109, 797, 0, 0, 3836, 3791, 1894, 0, 977, 697,
+    0, 1409, 1778, 1031, 872, 67, 2544, 1461, 2969, 0, 641, 3085, 1061,
+    534, 0, 280, 200, 0, 0, 0, 95, 29, 0, 0, 0, 851, 2683, 0, 0, 1721, 0,
+    761, 1243, 0, 0, 3182, 2338, 0, 0, 3740, 2688, 183, 1406, 0, 1615,
+    2722, 928, 1472, 1298, 3126, 0, 3719, 424, 0, 1530, 3578, 0, 0, 0, 509,
+    0, 3297, 692, 2910, 463, 3674, 0, 253, 1304, 40, 3026, 0, 0, 1294, 541,
+    0, 0, 1620, 0, 0, 2103, 0, 925, 3730, 168, 0, 0, 0, 0, 643, 3802, 0,
+    617, 0, 869, 3468, 1468, 0, 1495, 138, 2089, 0, 0, 475, 0, 823, 503, 0,
+    0, 1492, 1742, 0, 0, 0, 3853, 1274, 0, 0, 473, 849, 0, 0, 1571, 646,
+    296, 459, 0, 608, 1377, 993, 0, 0, 193, 0, 782, 3213, 2084, 2959, 0,
+    3325, 0, 1238, 152, 0, 0, 1585, 893, 0, 1286, 0, 1794, 1340, 767, 1502,
+    0, 0, 3583, 0, 3476, 0, 2619, 524, 0, 0, 252, 2988, 0, 4058, 3993, 79,
+    1425, 2288, 3150, 1329, 1992, 1582, 3726, 741, 0, 3382, 3642, 0, 0, 0,
+    0, 455, 0, 376, 0, 0, 2235, 0, 3099, 0, 0, 1400, 3937, 205, 2957, 0,
+    2215, 160, 0, 0, 2729, 1567, 1039, 0, 1602, 0, 0, 0, 3297, 0, 0, 2381,
+    0, 0, 0, 565, 713, 2412, 794, 3449, 328, 0, 0, 0, 0, 3202, 930, 4048,
+    0, 3021, 573, 0, 0, 1877, 824, 3281, 0, 768, 3709, 3281, 1035, 0, 4060,
+    2460, 1845, 0, 0, 0, 96, 0, 951, 858, 2238, 0, 1979, 228, 642, 499,
+    1469, 0, 0, 0, 1092, 0, 2193, 3153, 2624, 3617, 0, 359, 0, 2052, 0,
+    1553, 1625, 3808, 0, 3170, 2785, 131, 0, 1182, 435, 1301, 1769, 0, 0,
+    0, 141, 473, 0, 0, 392, 0, 2478, 1926, 876, 0, 0, 2119, 2096, 2332,
+    3677, 233, 0, 0, 0, 0, 3522, 313, 0, 0, 0, 971, 1429, 1002, 2610, 0, 0,
+    963, 3266, 1950, 0, 805, 1821, 0, 0, 3891, 0, 336, 2475, 1479, 1740,
+    1507, 0, 0, 0, 0, 3806, 0, 20, 1984, 0, 0, 0, 3300, 0, 3022, 2255, 0,
+    769, 3487, 0, 2209, 0, 0, 3241, 2121, 0, 1712, 0, 765, 1071, 0, 1007,
+    1724, 0, 904, 0, 0, 201, 1191, 851, 0, 1487, 946, 833, 1708, 2585,
+    3884, 2515, 1198, 950, 2113, 533, 0, 544, 3006, 3064, 3569, 0, 0, 4012,
+    3001, 0, 3893, 3135, 0, 1498, 2321, 715, 400, 1728, 278, 3359, 0, 0,
+    1533, 0, 0, 1052, 71, 2102, 0, 0, 3716, 1348, 162, 0, 278, 3274, 1407,
+    1856, 2956, 2602, 0, 1326, 0, 937, 2245, 733, 2459, 2109, 675, 0, 2616,
+    2761, 2012, 1915, 159, 195, 0, 2130, 0, 0, 1833, 4074, 717, 0, 3438,
+    1378, 185, 0, 1386, 0, 512, 0, 0, 0, 0, 1698, 3318, 0, 2433, 440, 1560,
+    0, 0, 1184, 1319, 819, 1843, 30, 1396, 0, 1214, 0, 2489, 324, 1420,
+    826, 233, 791, 1006, 0, 3897, 3990, 2928, 2070, 1552, 1296, 219, 0,
+    1902, 3921, 412, 1280, 1395, 3773, 0, 2910, 416, 1964, 169, 2466, 1188,
+    0, 1444, 0, 0, 2414, 1053, 0, 411, 3330, 2489, 1520, 702, 1684, 2744,
+    0, 0, 0, 2829, 0, 985, 3210, 0, 30, 2183, 0, 1834, 0, 0, 1722, 1081, 0,
+    1528, 356, 1231, 1697, 0, 0, 2497, 2242, 0, 2270, 342, 1103, 0, 0, 0,
+    0, 0, 0, 2371, 349, 0, 0, 3192, 1647, 1715, 1834, 0, 2383, 0, 972,
+    2166, 565, 2382, 3205, 0, 42, 448, 1767, 0, 1616, 0, 0, 2393, 0, 0,
+    1266, 3629, 269, 0, 0, 2768, 2574, 0, 829, 0, 1017, 3061, 0, 0, 0, 835,
+    0, 3099, 2728, 1329, 1546, 979, 3416, 23, 1959, 0, 138, 0, 2062, 2377,
+    2332, 1592, 2795, 878, 0, 0, 0, 3413, 1295, 0, 2349, 988, 0, 3652, 0,
+    0, 954, 2569, 3356, 3664, 0, 2054, 0, 0, 82, 749, 364, 3996, 3428,
+    1304, 1118, 0, 0, 2170, 0, 1774, 903, 3473, 1302, 976, 0, 707, 1603,
+    1996, 1303, 4013, 0, 2223, 2016, 0, 0, 2809, 677, 1977, 724, 0, 2311,
+    679, 0, 1267, 0, 4014, 0, 1013, 3501, 2709, 182, 2429, 0, 1734, 2895,
+    3613, 1690, 1963, 2194, 895, 2894, 544, 1251, 1423, 0, 1811, 1203, 275,
+    2251, 0, 2268, 1131, 0, 0, 101, 0, 1911, 3871, 0, 0, 44, 1483, 428,
+    578, 0, 0, 2188, 3151, 3442, 3409, 2669, 422, 755, 0, 3012, 0, 0, 3719,
+    2017, 0, 0, 3626, 2604, 0, 0, 0, 0, 0, 2419, 1951, 368, 0, 132, 0,
+    1316, 3668, 1408, 982, 945, 1401, 1120, 1962, 2577, 3281, 3351, 1881,
+    0, 0, 1280, 1250, 2127, 0, 3175, 840, 0, 0, 627, 0, 0, 0, 2165, 1118,
+    0, 531, 1549, 0, 1640, 0, 0, 0, 1786, 2130, 1573, 3201, 3210, 522, 0,
+    0, 0, 0, 0, 3069, 3864, 454, 0, 317, 3411, 1147, 0, 0, 0, 1918, 1055,
+    591, 487, 0, 233, 2000, 1823, 1108, 3732, 1140, 276, 0, 4049, 0, 2292,
+    2225, 2291, 1332, 784, 2508, 966, 1860, 3582, 0, 0, 0, 1944, 0, 0,
+    1807, 0, 1949, 1036, 1672, 715, 338, 0, 809, 3631, 2965, 557, 550, 0,
+    0, 4106, 2596, 3851, 189, 3169, 1269, 3962, 1341, 0, 3704, 3306, 716,
+    2570, 0, 0, 0, 2730, 1789, 234, 0, 2312, 1708, 2179, 2194, 1259, 1683,
+    1460, 1722, 0, 0, 766, 0, 0, 3704, 1845, 0, 0, 0, 3130, 279, 2141, 0,
+    0, 0, 2922, 0, 316, 1204, 3791, 599, 474, 0, 0, 0, 0, 1182, 110, 189,
+    0, 0, 1650, 0, 1611, 1926, 1862, 0, 0, 4046, 0, 644, 616, 186, 0, 0,
+    1792, 434, 3770, 167, 0, 180, 0, 98, 0, 3771, 2024, 3440, 1084, 1458,
+    0, 0, 2011, 3043, 148, 0, 1023, 0, 1406, 1578, 0, 0, 1592, 2482, 0,
+    1122, 0, 2235, 0, 0, 0, 1258, 571, 0, 2043, 2224, 3635, 1371, 0, 1811,
+    2720, 1435, 0, 694, 0, 1936, 0, 244, 0, 0, 1574, 0, 2655, 1949, 2984,
+    1351, 1759, 1793, 0, 3366, 4041, 0, 0, 0, 206, 2934, 0, 2017, 1428,
+    466, 0, 873, 0, 1237, 1403, 1867, 0, 834, 0, 3374, 3934, 1585, 157,
+    2656, 870, 3072, 0, 1427, 1869, 0, 992, 4039, 3979, 0, 3383, 3163,
+    1256, 2484, 1697, 0, 3963, 1487, 2219, 1589, 2745, 2254, 0, 0, 0, 2359,
+    0, 0, 2039, 1667, 969, 1856, 97, 2685, 51, 0, 3108, 934, 0, 2570, 835,
+    0, 1114, 788, 1562, 2850, 2841, 3665, 0, 781, 0, 535, 724, 1000, 0, 0,
+    2318, 450, 2368, 2188, 0, 3488, 0, 0, 0, 3974, 0, 2131, 896, 1437,
+    3950, 0, 1508, 1076, 1444, 1357, 337, 1428, 871, 2431, 0, 2513, 0,
+    1385, 0, 3209, 0, 2058, 0, 1766, 1192, 1543, 3467, 2495, 4039, 800, 0,
+    2219, 0, 205, 807, 0, 0, 1591, 1838, 2085, 1875, 478, 3666, 3095, 567,
+    771, 918, 0, 0, 112, 372, 45, 609, 4103, 783, 0, 194, 879, 3676, 3834,
+    2947, 0, 0, 3249, 3242, 1981, 2200, 736, 2027, 1473, 0, 0, 1625, 3892,
+    65, 209, 0, 3943, 1745, 451, 2708, 3542, 735, 0, 3499, 2899, 3584,
+    1163, 567, 1495, 546, 646, 1610, 0, 215, 0, 2517, 3589, 3143, 2499, 0,
+    1447, 1455, 0, 0, 158, 0, 0, 659, 3919, 1791, 839, 1343, 682, 1054,
+    948, 0, 0, 568, 1189, 0, 2213, 273, 2335, 3601, 66, 816, 1854, 3150, 0,
+    2223, 530, 399, 2000, 0, 0
+};
+
+/* Same as keysym_name_perfect_hash(), but using ASCII lower case letters */
+static inline size_t
+keysym_name_icase_perfect_hash(const char *key)
+{
+    const char *T1 = "fYMj6TNGPVtzuHdm875aCGp8CD8qc8Kl";
+    const char *T2 = "IgeYtFWJ87g4nix0AnVOMg6x1aYcT2uB";
+    size_t h1 = 0;
+    size_t h2 = 0;
+    for (size_t i = 0; key[i] != '\0'; i++) {
+        const char c = to_lower(key[i]);
+        h1 += (size_t) (T1[i % 32] * c);
+        h2 += (size_t) (T2[i % 32] * c);
+    }
+    return (keysym_name_icase_G[h1 % 4112] + keysym_name_icase_G[h2 % 4112]) % 4112;
+}
+
+/* Case-insensitive name hash -> index of the best match in name_to_keysym */
+static const uint16_t name_to_keysym_icase[] = {
+    0, /* 0 */
+    1, /* 1 */
+    2, /* 2 */
+    3, /* 3 */
+    4, /* 3270_AltCursor */
+    5, /* 3270_Attn */
+    6, /* 3270_BackTab */
+    7, /* 3270_ChangeScreen */
+    8, /* 3270_Copy */
+    9, /* 3270_CursorBlink */
+    10, /* 3270_CursorSelect */
+    11, /* 3270_DeleteWord */
+    12, /* 3270_Duplicate */
+    13, /* 3270_Enter */
+    14, /* 3270_EraseEOF */
+    15, /* 3270_EraseInput */
+    16, /* 3270_ExSelect */
+    17, /* 3270_FieldMark */
+    18, /* 3270_Ident */
+    19, /* 3270_Jump */
+    20, /* 3270_KeyClick */
+    21, /* 3270_Left2 */
+    22, /* 3270_PA1 */
+    23, /* 3270_PA2 */
+    24, /* 3270_PA3 */
+    25, /* 3270_Play */
+    26, /* 3270_PrintScreen */
+    27, /* 3270_Quit */
+    28, /* 3270_Record */
+    29, /* 3270_Reset */
+    30, /* 3270_Right2 */
+    31, /* 3270_Rule */
+    32, /* 3270_Setup */
+    33, /* 3270_Test */
+    34, /* 4 */
+    35, /* 5 */
+    36, /* 6 */
+    37, /* 7 */
+    38, /* 8 */
+    39, /* 9 */
+    41, /* a */
+    43, /* aacute */
+    45, /* abelowdot */
+    46, /* abovedot */
+    48, /* abreve */
+    50, /* abreveacute */
+    52, /* abrevebelowdot */
+    54, /* abrevegrave */
+    56, /* abrevehook */
+    58, /* abrevetilde */
+    59, /* AccessX_Enable */
+    60, /* AccessX_Feedback_Enable */
+    62, /* acircumflex */
+    64, /* acircumflexacute */
+    66, /* acircumflexbelowdot */
+    68, /* acircumflexgrave */
+    70, /* acircumflexhook */
+    72, /* acircumflextilde */
+    73, /* acute */
+    75, /* adiaeresis */
+    77, /* ae */
+    79, /* agrave */
+    81, /* ahook */
+    82, /* Alt_L */
+    83, /* Alt_R */
+    85, /* amacron */
+    86, /* ampersand */
+    88, /* aogonek */
+    89, /* apostrophe */
+    90, /* approxeq */
+    91, /* approximate */
+    92, /* Arabic_0 */
+    93, /* Arabic_1 */
+    94, /* Arabic_2 */
+    95, /* Arabic_3 */
+    96, /* Arabic_4 */
+    97, /* Arabic_5 */
+    98, /* Arabic_6 */
+    99, /* Arabic_7 */
+    100, /* Arabic_8 */
+    101, /* Arabic_9 */
+    102, /* Arabic_ain */
+    103, /* Arabic_alef */
+    104, /* Arabic_alefmaksura */
+    105, /* Arabic_beh */
+    106, /* Arabic_comma */
+    107, /* Arabic_dad */
+    108, /* Arabic_dal */
+    109, /* Arabic_damma */
+    110, /* Arabic_dammatan */
+    111, /* Arabic_ddal */
+    112, /* Arabic_farsi_yeh */
+    113, /* Arabic_fatha */
+    114, /* Arabic_fathatan */
+    115, /* Arabic_feh */
+    116, /* Arabic_fullstop */
+    117, /* Arabic_gaf */
+    118, /* Arabic_ghain */
+    119, /* Arabic_ha */
+    120, /* Arabic_hah */
+    121, /* Arabic_hamza */
+    122, /* Arabic_hamza_above */
+    123, /* Arabic_hamza_below */
+    124, /* Arabic_hamzaonalef */
+    125, /* Arabic_hamzaonwaw */
+    126, /* Arabic_hamzaonyeh */
+    127, /* Arabic_hamzaunderalef */
+    128, /* Arabic_heh */
+    129, /* Arabic_heh_doachashmee */
+    130, /* Arabic_heh_goal */
+    131, /* Arabic_jeem */
+    132, /* Arabic_jeh */
+    133, /* Arabic_kaf */
+    134, /* Arabic_kasra */
+    135, /* Arabic_kasratan */
+    136, /* Arabic_keheh */
+    137, /* Arabic_khah */
+    138, /* Arabic_lam */
+    139, /* Arabic_madda_above */
+    140, /* Arabic_maddaonalef */
+    141, /* Arabic_meem */
+    142, /* Arabic_noon */
+    143, /* Arabic_noon_ghunna */
+    144, /* Arabic_peh */
+    145, /* Arabic_percent */
+    146, /* Arabic_qaf */
+    147, /* Arabic_question_mark */
+    148, /* Arabic_ra */
+    149, /* Arabic_rreh */
+    150, /* Arabic_sad */
+    151, /* Arabic_seen */
+    152, /* Arabic_semicolon */
+    153, /* Arabic_shadda */
+    154, /* Arabic_sheen */
+    155, /* Arabic_sukun */
+    156, /* Arabic_superscript_alef */
+    157, /* Arabic_switch */
+    158, /* Arabic_tah */
+    159, /* Arabic_tatweel */
+    160, /* Arabic_tcheh */
+    161, /* Arabic_teh */
+    162, /* Arabic_tehmarbuta */
+    163, /* Arabic_thal */
+    164, /* Arabic_theh */
+    165, /* Arabic_tteh */
+    166, /* Arabic_veh */
+    167, /* Arabic_waw */
+    168, /* Arabic_yeh */
+    169, /* Arabic_yeh_baree */
+    170, /* Arabic_zah */
+    171, /* Arabic_zain */
+    173, /* aring */
+    174, /* Armenian_accent */
+    175, /* Armenian_amanak */
+    176, /* Armenian_apostrophe */
+    178, /* Armenian_at */
+    180, /* Armenian_ayb */
+    182, /* Armenian_ben */
+    183, /* Armenian_but */
+    185, /* Armenian_cha */
+    187, /* Armenian_da */
+    189, /* Armenian_dza */
+    191, /* Armenian_e */
+    192, /* Armenian_exclam */
+    194, /* Armenian_fe */
+    195, /* Armenian_full_stop */
+    197, /* Armenian_ghat */
+    199, /* Armenian_gim */
+    201, /* Armenian_hi */
+    203, /* Armenian_ho */
+    204, /* Armenian_hyphen */
+    206, /* Armenian_ini */
+    208, /* Armenian_je */
+    210, /* Armenian_ke */
+    212, /* Armenian_ken */
+    214, /* Armenian_khe */
+    215, /* Armenian_ligature_ew */
+    217, /* Armenian_lyun */
+    219, /* Armenian_men */
+    221, /* Armenian_nu */
+    223, /* Armenian_o */
+    224, /* Armenian_paruyk */
+    226, /* Armenian_pe */
+    228, /* Armenian_pyur */
+    229, /* Armenian_question */
+    231, /* Armenian_ra */
+    233, /* Armenian_re */
+    235, /* Armenian_se */
+    236, /* Armenian_separation_mark */
+    238, /* Armenian_sha */
+    239, /* Armenian_shesht */
+    241, /* Armenian_tche */
+    243, /* Armenian_to */
+    245, /* Armenian_tsa */
+    247, /* Armenian_tso */
+    249, /* Armenian_tyun */
+    250, /* Armenian_verjaket */
+    252, /* Armenian_vev */
+    254, /* Armenian_vo */
+    256, /* Armenian_vyun */
+    258, /* Armenian_yech */
+    259, /* Armenian_yentamna */
+    261, /* Armenian_za */
+    263, /* Armenian_zhe */
+    264, /* asciicircum */
+    265, /* asciitilde */
+    266, /* asterisk */
+    267, /* at */
+    269, /* atilde */
+    270, /* AudibleBell_Enable */
+    272, /* b */
+    274, /* babovedot */
+    275, /* backslash */
+    276, /* BackSpace */
+    277, /* BackTab */
+    278, /* ballotcross */
+    279, /* bar */
+    280, /* because */
+    281, /* Begin */
+    282, /* blank */
+    283, /* block */
+    284, /* botintegral */
+    285, /* botleftparens */
+    286, /* botleftsqbracket */
+    287, /* botleftsummation */
+    288, /* botrightparens */
+    289, /* botrightsqbracket */
+    290, /* botrightsummation */
+    291, /* bott */
+    292, /* botvertsummationconnector */
+    293, /* BounceKeys_Enable */
+    294, /* braceleft */
+    295, /* braceright */
+    296, /* bracketleft */
+    297, /* bracketright */
+    298, /* braille_blank */
+    299, /* braille_dot_1 */
+    300, /* braille_dot_10 */
+    301, /* braille_dot_2 */
+    302, /* braille_dot_3 */
+    303, /* braille_dot_4 */
+    304, /* braille_dot_5 */
+    305, /* braille_dot_6 */
+    306, /* braille_dot_7 */
+    307, /* braille_dot_8 */
+    308, /* braille_dot_9 */
+    309, /* braille_dots_1 */
+    310, /* braille_dots_12 */
+    311, /* braille_dots_123 */
+    312, /* braille_dots_1234 */
+    313, /* braille_dots_12345 */
+    314, /* braille_dots_123456 */
+    315, /* braille_dots_1234567 */
+    316, /* braille_dots_12345678 */
+    317, /* braille_dots_1234568 */
+    318, /* braille_dots_123457 */
+    319, /* braille_dots_1234578 */
+    320, /* braille_dots_123458 */
+    321, /* braille_dots_12346 */
+    322, /* braille_dots_123467 */
+    323, /* braille_dots_1234678 */
+    324, /* braille_dots_123468 */
+    325, /* braille_dots_12347 */
+    326, /* braille_dots_123478 */
+    327, /* braille_dots_12348 */
+    328, /* braille_dots_1235 */
+    329, /* braille_dots_12356 */
+    330, /* braille_dots_123567 */
+    331, /* braille_dots_1235678 */
+    332, /* braille_dots_123568 */
+    333, /* braille_dots_12357 */
+    334, /* braille_dots_123578 */
+    335, /* braille_dots_12358 */
+    336, /* braille_dots_1236 */
+    337, /* braille_dots_12367 */
+    338, /* braille_dots_123678 */
+    339, /* braille_dots_12368 */
+    340, /* braille_dots_1237 */
+    341, /* braille_dots_12378 */
+    342, /* braille_dots_1238 */
+    343, /* braille_dots_124 */
+    344, /* braille_dots_1245 */
+    345, /* braille_dots_12456 */
+    346, /* braille_dots_124567 */
+    347, /* braille_dots_1245678 */
+    348, /* braille_dots_124568 */
+    349, /* braille_dots_12457 */
+    350, /* braille_dots_124578 */
+    351, /* braille_dots_12458 */
+    352, /* braille_dots_1246 */
+    353, /* braille_dots_12467 */
+    354, /* braille_dots_124678 */
+    355, /* braille_dots_12468 */
+    356, /* braille_dots_1247 */
+    357, /* braille_dots_12478 */
+    358, /* braille_dots_1248 */
+    359, /* braille_dots_125 */
+    360, /* braille_dots_1256 */
+    361, /* braille_dots_12567 */
+    362, /* braille_dots_125678 */
+    363, /* braille_dots_12568 */
+    364, /* braille_dots_1257 */
+    365, /* braille_dots_12578 */
+    366, /* braille_dots_1258 */
+    367, /* braille_dots_126 */
+    368, /* braille_dots_1267 */
+    369, /* braille_dots_12678 */
+    370, /* braille_dots_1268 */
+    371, /* braille_dots_127 */
+    372, /* braille_dots_1278 */
+    373, /* braille_dots_128 */
+    374, /* braille_dots_13 */
+    375, /* braille_dots_134 */
+    376, /* braille_dots_1345 */
+    377, /* braille_dots_13456 */
+    378, /* braille_dots_134567 */
+    379, /* braille_dots_1345678 */
+    380, /* braille_dots_134568 */
+    381, /* braille_dots_13457 */
+    382, /* braille_dots_134578 */
+    383, /* braille_dots_13458 */
+    384, /* braille_dots_1346 */
+    385, /* braille_dots_13467 */
+    386, /* braille_dots_134678 */
+    387, /* braille_dots_13468 */
+    388, /* braille_dots_1347 */
+    389, /* braille_dots_13478 */
+    390, /* braille_dots_1348 */
+    391, /* braille_dots_135 */
+    392, /* braille_dots_1356 */
+    393, /* braille_dots_13567 */
+    394, /* braille_dots_135678 */
+    395, /* braille_dots_13568 */
+    396, /* braille_dots_1357 */
+    397, /* braille_dots_13578 */
+    398, /* braille_dots_1358 */
+    399, /* braille_dots_136 */
+    400, /* braille_dots_1367 */
+    401, /* braille_dots_13678 */
+    402, /* braille_dots_1368 */
+    403, /* braille_dots_137 */
+    404, /* braille_dots_1378 */
+    405, /* braille_dots_138 */
+    406, /* braille_dots_14 */
+    407, /* braille_dots_145 */
+    408, /* braille_dots_1456 */
+    409, /* braille_dots_14567 */
+    410, /* braille_dots_145678 */
+    411, /* braille_dots_14568 */
+    412, /* braille_dots_1457 */
+    413, /* braille_dots_14578 */
+    414, /* braille_dots_1458 */
+    415, /* braille_dots_146 */
+    416, /* braille_dots_1467 */
+    417, /* braille_dots_14678 */
+    418, /* braille_dots_1468 */
+    419, /* braille_dots_147 */
+    420, /* braille_dots_1478 */
+    421, /* braille_dots_148 */
+    422, /* braille_dots_15 */
+    423, /* braille_dots_156 */
+    424, /* braille_dots_1567 */
+    425, /* braille_dots_15678 */
+    426, /* braille_dots_1568 */
+    427, /* braille_dots_157 */
+    428, /* braille_dots_1578 */
+    429, /* braille_dots_158 */
+    430, /* braille_dots_16 */
+    431, /* braille_dots_167 */
+    432, /* braille_dots_1678 */
+    433, /* braille_dots_168 */
+    434, /* braille_dots_17 */
+    435, /* braille_dots_178 */
+    436, /* braille_dots_18 */
+    437, /* braille_dots_2 */
+    438, /* braille_dots_23 */
+    439, /* braille_dots_234 */
+    440, /* braille_dots_2345 */
+    441, /* braille_dots_23456 */
+    442, /* braille_dots_234567 */
+    443, /* braille_dots_2345678 */
+    444, /* braille_dots_234568 */
+    445, /* braille_dots_23457 */
+    446, /* braille_dots_234578 */
+    447, /* braille_dots_23458 */
+    448, /* braille_dots_2346 */
+    449, /* braille_dots_23467 */
+    450, /* braille_dots_234678 */
+    451, /* braille_dots_23468 */
+    452, /* braille_dots_2347 */
+    453, /* braille_dots_23478 */
+    454, /* braille_dots_2348 */
+    455, /* braille_dots_235 */
+    456, /* braille_dots_2356 */
+    457, /* braille_dots_23567 */
+    458, /* braille_dots_235678 */
+    459, /* braille_dots_23568 */
+    460, /* braille_dots_2357 */
+    461, /* braille_dots_23578 */
+    462, /* braille_dots_2358 */
+    463, /* braille_dots_236 */
+    464, /* braille_dots_2367 */
+    465, /* braille_dots_23678 */
+    466, /* braille_dots_2368 */
+    467, /* braille_dots_237 */
+    468, /* braille_dots_2378 */
+    469, /* braille_dots_238 */
+    470, /* braille_dots_24 */
+    471, /* braille_dots_245 */
+    472, /* braille_dots_2456 */
+    473, /* braille_dots_24567 */
+    474, /* braille_dots_245678 */
+    475, /* braille_dots_24568 */
+    476, /* braille_dots_2457 */
+    477, /* braille_dots_24578 */
+    478, /* braille_dots_2458 */
+    479, /* braille_dots_246 */
+    480, /* braille_dots_2467 */
+    481, /* braille_dots_24678 */
+    482, /* braille_dots_2468 */
+    483, /* braille_dots_247 */
+    484, /* braille_dots_2478 */
+    485, /* braille_dots_248 */
+    486, /* braille_dots_25 */
+    487, /* braille_dots_256 */
+    488, /* braille_dots_2567 */
+    489, /* braille_dots_25678 */
+    490, /* braille_dots_2568 */
+    491, /* braille_dots_257 */
+    492, /* braille_dots_2578 */
+    493, /* braille_dots_258 */
+    494, /* braille_dots_26 */
+    495, /* braille_dots_267 */
+    496, /* braille_dots_2678 */
+    497, /* braille_dots_268 */
+    498, /* braille_dots_27 */
+    499, /* braille_dots_278 */
+    500, /* braille_dots_28 */
+    501, /* braille_dots_3 */
+    502, /* braille_dots_34 */
+    503, /* braille_dots_345 */
+    504, /* braille_dots_3456 */
+    505, /* braille_dots_34567 */
+    506, /* braille_dots_345678 */
+    507, /* braille_dots_34568 */
+    508, /* braille_dots_3457 */
+    509, /* braille_dots_34578 */
+    510, /* braille_dots_3458 */
+    511, /* braille_dots_346 */
+    512, /* braille_dots_3467 */
+    513, /* braille_dots_34678 */
+    514, /* braille_dots_3468 */
+    515, /* braille_dots_347 */
+    516, /* braille_dots_3478 */
+    517, /* braille_dots_348 */
+    518, /* braille_dots_35 */
+    519, /* braille_dots_356 */
+    520, /* braille_dots_3567 */
+    521, /* braille_dots_35678 */
+    522, /* braille_dots_3568 */
+    523, /* braille_dots_357 */
+    524, /* braille_dots_3578 */
+    525, /* braille_dots_358 */
+    526, /* braille_dots_36 */
+    527, /* braille_dots_367 */
+    528, /* braille_dots_3678 */
+    529, /* braille_dots_368 */
+    530, /* braille_dots_37 */
+    531, /* braille_dots_378 */
+    532, /* braille_dots_38 */
+    533, /* braille_dots_4 */
+    534, /* braille_dots_45 */
+    535, /* braille_dots_456 */
+    536, /* braille_dots_4567 */
+    537, /* braille_dots_45678 */
+    538, /* braille_dots_4568 */
+    539, /* braille_dots_457 */
+    540, /* braille_dots_4578 */
+    541, /* braille_dots_458 */
+    542, /* braille_dots_46 */
+    543, /* braille_dots_467 */
+    544, /* braille_dots_4678 */
+    545, /* braille_dots_468 */
+    546, /* braille_dots_47 */
+    547, /* braille_dots_478 */
+    548, /* braille_dots_48 */
+    549, /* braille_dots_5 */
+    550, /* braille_dots_56 */
+    551, /* braille_dots_567 */
+    552, /* braille_dots_5678 */
+    553, /* braille_dots_568 */
+    554, /* braille_dots_57 */
+    555, /* braille_dots_578 */
+    556, /* braille_dots_58 */
+    557, /* braille_dots_6 */
+    558, /* braille_dots_67 */
+    559, /* braille_dots_678 */
+    560, /* braille_dots_68 */
+    561, /* braille_dots_7 */
+    562, /* braille_dots_78 */
+    563, /* braille_dots_8 */
+    564, /* Break */
+    565, /* breve */
+    566, /* brokenbar */
+    568, /* Byelorussian_shortu */
+    570, /* c */
+    573, /* c_h */
+    575, /* cabovedot */
+    577, /* cacute */
+    578, /* Cancel */
+    579, /* Caps_Lock */
+    580, /* careof */
+    581, /* caret */
+    582, /* caron */
+    584, /* ccaron */
+    586, /* ccedilla */
+    588, /* ccircumflex */
+    589, /* cedilla */
+    590, /* cent */
+    593, /* ch */
+    594, /* checkerboard */
+    595, /* checkmark */
+    596, /* circle */
+    597, /* Clear */
+    598, /* ClearLine */
+    599, /* club */
+    600, /* Codeinput */
+    601, /* colon */
+    602, /* ColonSign */
+    603, /* combining_acute */
+    604, /* combining_belowdot */
+    605, /* combining_grave */
+    606, /* combining_hook */
+    607, /* combining_tilde */
+    608, /* comma */
+    609, /* containsas */
+    610, /* Control_L */
+    611, /* Control_R */
+    612, /* copyright */
+    613, /* cr */
+    614, /* crossinglines */
+    615, /* CruzeiroSign */
+    616, /* cuberoot */
+    617, /* currency */
+    618, /* cursor */
+    620, /* Cyrillic_a */
+    622, /* Cyrillic_be */
+    624, /* Cyrillic_che */
+    626, /* Cyrillic_che_descender */
+    628, /* Cyrillic_che_vertstroke */
+    630, /* Cyrillic_de */
+    632, /* Cyrillic_dzhe */
+    634, /* Cyrillic_e */
+    636, /* Cyrillic_ef */
+    638, /* Cyrillic_el */
+    640, /* Cyrillic_em */
+    642, /* Cyrillic_en */
+    644, /* Cyrillic_en_descender */
+    646, /* Cyrillic_er */
+    648, /* Cyrillic_es */
+    650, /* Cyrillic_ghe */
+    652, /* Cyrillic_ghe_bar */
+    654, /* Cyrillic_ha */
+    656, /* Cyrillic_ha_descender */
+    658, /* Cyrillic_hardsign */
+    660, /* Cyrillic_i */
+    662, /* Cyrillic_i_macron */
+    664, /* Cyrillic_ie */
+    666, /* Cyrillic_io */
+    668, /* Cyrillic_je */
+    670, /* Cyrillic_ka */
+    672, /* Cyrillic_ka_descender */
+    674, /* Cyrillic_ka_vertstroke */
+    676, /* Cyrillic_lje */
+    678, /* Cyrillic_nje */
+    680, /* Cyrillic_o */
+    682, /* Cyrillic_o_bar */
+    684, /* Cyrillic_pe */
+    686, /* Cyrillic_schwa */
+    688, /* Cyrillic_sha */
+    690, /* Cyrillic_shcha */
+    692, /* Cyrillic_shha */
+    694, /* Cyrillic_shorti */
+    696, /* Cyrillic_softsign */
+    698, /* Cyrillic_te */
+    700, /* Cyrillic_tse */
+    702, /* Cyrillic_u */
+    704, /* Cyrillic_u_macron */
+    706, /* Cyrillic_u_straight */
+    708, /* Cyrillic_u_straight_bar */
+    710, /* Cyrillic_ve */
+    712, /* Cyrillic_ya */
+    714, /* Cyrillic_yeru */
+    716, /* Cyrillic_yu */
+    718, /* Cyrillic_ze */
+    720, /* Cyrillic_zhe */
+    722, /* Cyrillic_zhe_descender */
+    724, /* d */
+    726, /* dabovedot */
+    727, /* Dacute_accent */
+    728, /* dagger */
+    730, /* dcaron */
+    731, /* Dcedilla_accent */
+    732, /* Dcircumflex_accent */
+    733, /* Ddiaeresis */
+    735, /* dead_a */
+    736, /* dead_abovecomma */
+    737, /* dead_abovedot */
+    738, /* dead_abovereversedcomma */
+    739, /* dead_abovering */
+    740, /* dead_aboveverticalline */
+    741, /* dead_acute */
+    742, /* dead_apostrophe */
+    743, /* dead_belowbreve */
+    744, /* dead_belowcircumflex */
+    745, /* dead_belowcomma */
+    746, /* dead_belowdiaeresis */
+    747, /* dead_belowdot */
+    748, /* dead_belowmacron */
+    749, /* dead_belowring */
+    750, /* dead_belowtilde */
+    751, /* dead_belowverticalline */
+    752, /* dead_breve */
+    753, /* dead_capital_schwa */
+    754, /* dead_caron */
+    755, /* dead_cedilla */
+    756, /* dead_circumflex */
+    757, /* dead_currency */
+    758, /* dead_dasia */
+    759, /* dead_diaeresis */
+    760, /* dead_doubleacute */
+    761, /* dead_doublegrave */
+    763, /* dead_e */
+    764, /* dead_grave */
+    765, /* dead_greek */
+    766, /* dead_hamza */
+    767, /* dead_hook */
+    768, /* dead_horn */
+    770, /* dead_i */
+    771, /* dead_invertedbreve */
+    772, /* dead_iota */
+    773, /* dead_longsolidusoverlay */
+    774, /* dead_lowline */
+    775, /* dead_macron */
+    777, /* dead_o */
+    778, /* dead_ogonek */
+    779, /* dead_perispomeni */
+    780, /* dead_psili */
+    782, /* dead_schwa */
+    783, /* dead_semivoiced_sound */
+    784, /* dead_small_schwa */
+    785, /* dead_stroke */
+    786, /* dead_tilde */
+    788, /* dead_u */
+    789, /* dead_voiced_sound */
+    790, /* decimalpoint */
+    791, /* degree */
+    792, /* Delete */
+    793, /* DeleteChar */
+    794, /* DeleteLine */
+    795, /* Dgrave_accent */
+    796, /* diaeresis */
+    797, /* diamond */
+    798, /* digitspace */
+    799, /* dintegral */
+    800, /* division */
+    801, /* dollar */
+    802, /* DongSign */
+    803, /* doubbaselinedot */
+    804, /* doubleacute */
+    805, /* doubledagger */
+    806, /* doublelowquotemark */
+    807, /* Down */
+    808, /* downarrow */
+    809, /* downcaret */
+    810, /* downshoe */
+    811, /* downstile */
+    812, /* downtack */
+    813, /* DRemove */
+    814, /* Dring_accent */
+    816, /* dstroke */
+    817, /* Dtilde */
+    819, /* e */
+    821, /* eabovedot */
+    823, /* eacute */
+    825, /* ebelowdot */
+    827, /* ecaron */
+    829, /* ecircumflex */
+    831, /* ecircumflexacute */
+    833, /* ecircumflexbelowdot */
+    835, /* ecircumflexgrave */
+    837, /* ecircumflexhook */
+    839, /* ecircumflextilde */
+    840, /* EcuSign */
+    842, /* ediaeresis */
+    844, /* egrave */
+    846, /* ehook */
+    847, /* eightsubscript */
+    848, /* eightsuperior */
+    849, /* Eisu_Shift */
+    850, /* Eisu_toggle */
+    851, /* elementof */
+    852, /* ellipsis */
+    853, /* em3space */
+    854, /* em4space */
+    856, /* emacron */
+    857, /* emdash */
+    858, /* emfilledcircle */
+    859, /* emfilledrect */
+    860, /* emopencircle */
+    861, /* emopenrectangle */
+    862, /* emptyset */
+    863, /* emspace */
+    864, /* End */
+    865, /* endash */
+    866, /* enfilledcircbullet */
+    867, /* enfilledsqbullet */
+    869, /* eng */
+    870, /* enopencircbullet */
+    871, /* enopensquarebullet */
+    872, /* enspace */
+    874, /* eogonek */
+    875, /* equal */
+    876, /* Escape */
+    879, /* eth */
+    881, /* etilde */
+    882, /* EuroSign */
+    883, /* exclam */
+    884, /* exclamdown */
+    885, /* Execute */
+    886, /* Ext16bit_L */
+    887, /* Ext16bit_R */
+    889, /* ezh */
+    891, /* f */
+    892, /* F1 */
+    893, /* F10 */
+    894, /* F11 */
+    895, /* F12 */
+    896, /* F13 */
+    897, /* F14 */
+    898, /* F15 */
+    899, /* F16 */
+    900, /* F17 */
+    901, /* F18 */
+    902, /* F19 */
+    903, /* F2 */
+    904, /* F20 */
+    905, /* F21 */
+    906, /* F22 */
+    907, /* F23 */
+    908, /* F24 */
+    909, /* F25 */
+    910, /* F26 */
+    911, /* F27 */
+    912, /* F28 */
+    913, /* F29 */
+    914, /* F3 */
+    915, /* F30 */
+    916, /* F31 */
+    917, /* F32 */
+    918, /* F33 */
+    919, /* F34 */
+    920, /* F35 */
+    921, /* F4 */
+    922, /* F5 */
+    923, /* F6 */
+    924, /* F7 */
+    925, /* F8 */
+    926, /* F9 */
+    928, /* fabovedot */
+    929, /* Farsi_0 */
+    930, /* Farsi_1 */
+    931, /* Farsi_2 */
+    932, /* Farsi_3 */
+    933, /* Farsi_4 */
+    934, /* Farsi_5 */
+    935, /* Farsi_6 */
+    936, /* Farsi_7 */
+    937, /* Farsi_8 */
+    938, /* Farsi_9 */
+    939, /* Farsi_yeh */
+    940, /* femalesymbol */
+    941, /* ff */
+    942, /* FFrancSign */
+    943, /* figdash */
+    944, /* filledlefttribullet */
+    945, /* filledrectbullet */
+    946, /* filledrighttribullet */
+    947, /* filledtribulletdown */
+    948, /* filledtribulletup */
+    949, /* Find */
+    950, /* First_Virtual_Screen */
+    951, /* fiveeighths */
+    952, /* fivesixths */
+    953, /* fivesubscript */
+    954, /* fivesuperior */
+    955, /* fourfifths */
+    956, /* foursubscript */
+    957, /* foursuperior */
+    958, /* fourthroot */
+    959, /* function */
+    961, /* g */
+    963, /* gabovedot */
+    965, /* gbreve */
+    967, /* gcaron */
+    969, /* gcedilla */
+    971, /* gcircumflex */
+    972, /* Georgian_an */
+    973, /* Georgian_ban */
+    974, /* Georgian_can */
+    975, /* Georgian_char */
+    976, /* Georgian_chin */
+    977, /* Georgian_cil */
+    978, /* Georgian_don */
+    979, /* Georgian_en */
+    980, /* Georgian_fi */
+    981, /* Georgian_gan */
+    982, /* Georgian_ghan */
+    983, /* Georgian_hae */
+    984, /* Georgian_har */
+    985, /* Georgian_he */
+    986, /* Georgian_hie */
+    987, /* Georgian_hoe */
+    988, /* Georgian_in */
+    989, /* Georgian_jhan */
+    990, /* Georgian_jil */
+    991, /* Georgian_kan */
+    992, /* Georgian_khar */
+    993, /* Georgian_las */
+    994, /* Georgian_man */
+    995, /* Georgian_nar */
+    996, /* Georgian_on */
+    997, /* Georgian_par */
+    998, /* Georgian_phar */
+    999, /* Georgian_qar */
+    1000, /* Georgian_rae */
+    1001, /* Georgian_san */
+    1002, /* Georgian_shin */
+    1003, /* Georgian_tan */
+    1004, /* Georgian_tar */
+    1005, /* Georgian_un */
+    1006, /* Georgian_vin */
+    1007, /* Georgian_we */
+    1008, /* Georgian_xan */
+    1009, /* Georgian_zen */
+    1010, /* Georgian_zhar */
+    1011, /* grave */
+    1012, /* greater */
+    1013, /* greaterthanequal */
+    1014, /* Greek_accentdieresis */
+    1016, /* Greek_alpha */
+    1018, /* Greek_alphaaccent */
+    1020, /* Greek_beta */
+    1022, /* Greek_chi */
+    1024, /* Greek_delta */
+    1026, /* Greek_epsilon */
+    1028, /* Greek_epsilonaccent */
+    1030, /* Greek_eta */
+    1032, /* Greek_etaaccent */
+    1033, /* Greek_finalsmallsigma */
+    1035, /* Greek_gamma */
+    1036, /* Greek_horizbar */
+    1038, /* Greek_iota */
+    1040, /* Greek_iotaaccent */
+    1041, /* Greek_iotaaccentdieresis */
+    1042, /* Greek_IOTAdiaeresis */
+    1044, /* Greek_iotadieresis */
+    1046, /* Greek_kappa */
+    1048, /* Greek_lambda */
+    1050, /* Greek_lamda */
+    1052, /* Greek_mu */
+    1054, /* Greek_nu */
+    1056, /* Greek_omega */
+    1058, /* Greek_omegaaccent */
+    1060, /* Greek_omicron */
+    1062, /* Greek_omicronaccent */
+    1064, /* Greek_phi */
+    1066, /* Greek_pi */
+    1068, /* Greek_psi */
+    1070, /* Greek_rho */
+    1072, /* Greek_sigma */
+    1073, /* Greek_switch */
+    1075, /* Greek_tau */
+    1077, /* Greek_theta */
+    1079, /* Greek_upsilon */
+    1081, /* Greek_upsilonaccent */
+    1082, /* Greek_upsilonaccentdieresis */
+    1084, /* Greek_upsilondieresis */
+    1086, /* Greek_xi */
+    1088, /* Greek_zeta */
+    1089, /* guilder */
+    1090, /* guillemetleft */
+    1091, /* guillemetright */
+    1092, /* guillemotleft */
+    1093, /* guillemotright */
+    1095, /* h */
+    1096, /* hairspace */
+    1097, /* Hangul */
+    1098, /* Hangul_A */
+    1099, /* Hangul_AE */
+    1100, /* Hangul_AraeA */
+    1101, /* Hangul_AraeAE */
+    1102, /* Hangul_Banja */
+    1103, /* Hangul_Cieuc */
+    1104, /* Hangul_Codeinput */
+    1105, /* Hangul_Dikeud */
+    1106, /* Hangul_E */
+    1107, /* Hangul_End */
+    1108, /* Hangul_EO */
+    1109, /* Hangul_EU */
+    1110, /* Hangul_Hanja */
+    1111, /* Hangul_Hieuh */
+    1112, /* Hangul_I */
+    1113, /* Hangul_Ieung */
+    1114, /* Hangul_J_Cieuc */
+    1115, /* Hangul_J_Dikeud */
+    1116, /* Hangul_J_Hieuh */
+    1117, /* Hangul_J_Ieung */
+    1118, /* Hangul_J_Jieuj */
+    1119, /* Hangul_J_Khieuq */
+    1120, /* Hangul_J_Kiyeog */
+    1121, /* Hangul_J_KiyeogSios */
+    1122, /* Hangul_J_KkogjiDalrinIeung */
+    1123, /* Hangul_J_Mieum */
+    1124, /* Hangul_J_Nieun */
+    1125, /* Hangul_J_NieunHieuh */
+    1126, /* Hangul_J_NieunJieuj */
+    1127, /* Hangul_J_PanSios */
+    1128, /* Hangul_J_Phieuf */
+    1129, /* Hangul_J_Pieub */
+    1130, /* Hangul_J_PieubSios */
+    1131, /* Hangul_J_Rieul */
+    1132, /* Hangul_J_RieulHieuh */
+    1133, /* Hangul_J_RieulKiyeog */
+    1134, /* Hangul_J_RieulMieum */
+    1135, /* Hangul_J_RieulPhieuf */
+    1136, /* Hangul_J_RieulPieub */
+    1137, /* Hangul_J_RieulSios */
+    1138, /* Hangul_J_RieulTieut */
+    1139, /* Hangul_J_Sios */
+    1140, /* Hangul_J_SsangKiyeog */
+    1141, /* Hangul_J_SsangSios */
+    1142, /* Hangul_J_Tieut */
+    1143, /* Hangul_J_YeorinHieuh */
+    1144, /* Hangul_Jamo */
+    1145, /* Hangul_Jeonja */
+    1146, /* Hangul_Jieuj */
+    1147, /* Hangul_Khieuq */
+    1148, /* Hangul_Kiyeog */
+    1149, /* Hangul_KiyeogSios */
+    1150, /* Hangul_KkogjiDalrinIeung */
+    1151, /* Hangul_Mieum */
+    1152, /* Hangul_MultipleCandidate */
+    1153, /* Hangul_Nieun */
+    1154, /* Hangul_NieunHieuh */
+    1155, /* Hangul_NieunJieuj */
+    1156, /* Hangul_O */
+    1157, /* Hangul_OE */
+    1158, /* Hangul_PanSios */
+    1159, /* Hangul_Phieuf */
+    1160, /* Hangul_Pieub */
+    1161, /* Hangul_PieubSios */
+    1162, /* Hangul_PostHanja */
+    1163, /* Hangul_PreHanja */
+    1164, /* Hangul_PreviousCandidate */
+    1165, /* Hangul_Rieul */
+    1166, /* Hangul_RieulHieuh */
+    1167, /* Hangul_RieulKiyeog */
+    1168, /* Hangul_RieulMieum */
+    1169, /* Hangul_RieulPhieuf */
+    1170, /* Hangul_RieulPieub */
+    1171, /* Hangul_RieulSios */
+    1172, /* Hangul_RieulTieut */
+    1173, /* Hangul_RieulYeorinHieuh */
+    1174, /* Hangul_Romaja */
+    1175, /* Hangul_SingleCandidate */
+    1176, /* Hangul_Sios */
+    1177, /* Hangul_Special */
+    1178, /* Hangul_SsangDikeud */
+    1179, /* Hangul_SsangJieuj */
+    1180, /* Hangul_SsangKiyeog */
+    1181, /* Hangul_SsangPieub */
+    1182, /* Hangul_SsangSios */
+    1183, /* Hangul_Start */
+    1184, /* Hangul_SunkyeongeumMieum */
+    1185, /* Hangul_SunkyeongeumPhieuf */
+    1186, /* Hangul_SunkyeongeumPieub */
+    1187, /* Hangul_switch */
+    1188, /* Hangul_Tieut */
+    1189, /* Hangul_U */
+    1190, /* Hangul_WA */
+    1191, /* Hangul_WAE */
+    1192, /* Hangul_WE */
+    1193, /* Hangul_WEO */
+    1194, /* Hangul_WI */
+    1195, /* Hangul_YA */
+    1196, /* Hangul_YAE */
+    1197, /* Hangul_YE */
+    1198, /* Hangul_YEO */
+    1199, /* Hangul_YeorinHieuh */
+    1200, /* Hangul_YI */
+    1201, /* Hangul_YO */
+    1202, /* Hangul_YU */
+    1203, /* Hankaku */
+    1205, /* hcircumflex */
+    1206, /* heart */
+    1207, /* hebrew_aleph */
+    1208, /* hebrew_ayin */
+    1209, /* hebrew_bet */
+    1210, /* hebrew_beth */
+    1211, /* hebrew_chet */
+    1212, /* hebrew_dalet */
+    1213, /* hebrew_daleth */
+    1214, /* hebrew_doublelowline */
+    1215, /* hebrew_finalkaph */
+    1216, /* hebrew_finalmem */
+    1217, /* hebrew_finalnun */
+    1218, /* hebrew_finalpe */
+    1219, /* hebrew_finalzade */
+    1220, /* hebrew_finalzadi */
+    1221, /* hebrew_gimel */
+    1222, /* hebrew_gimmel */
+    1223, /* hebrew_he */
+    1224, /* hebrew_het */
+    1225, /* hebrew_kaph */
+    1226, /* hebrew_kuf */
+    1227, /* hebrew_lamed */
+    1228, /* hebrew_mem */
+    1229, /* hebrew_nun */
+    1230, /* hebrew_pe */
+    1231, /* hebrew_qoph */
+    1232, /* hebrew_resh */
+    1233, /* hebrew_samech */
+    1234, /* hebrew_samekh */
+    1235, /* hebrew_shin */
+    1236, /* Hebrew_switch */
+    1237, /* hebrew_taf */
+    1238, /* hebrew_taw */
+    1239, /* hebrew_tet */
+    1240, /* hebrew_teth */
+    1241, /* hebrew_waw */
+    1242, /* hebrew_yod */
+    1243, /* hebrew_zade */
+    1244, /* hebrew_zadi */
+    1245, /* hebrew_zain */
+    1246, /* hebrew_zayin */
+    1247, /* Help */
+    1248, /* Henkan */
+    1249, /* Henkan_Mode */
+    1250, /* hexagram */
+    1251, /* Hiragana */
+    1252, /* Hiragana_Katakana */
+    1253, /* Home */
+    1254, /* horizconnector */
+    1255, /* horizlinescan1 */
+    1256, /* horizlinescan3 */
+    1257, /* horizlinescan5 */
+    1258, /* horizlinescan7 */
+    1259, /* horizlinescan9 */
+    1260, /* hpBackTab */
+    1261, /* hpblock */
+    1262, /* hpClearLine */
+    1263, /* hpDeleteChar */
+    1264, /* hpDeleteLine */
+    1265, /* hpguilder */
+    1266, /* hpInsertChar */
+    1267, /* hpInsertLine */
+    1268, /* hpIO */
+    1269, /* hpKP_BackTab */
+    1270, /* hplira */
+    1271, /* hplongminus */
+    1272, /* hpModelock1 */
+    1273, /* hpModelock2 */
+    1274, /* hpmute_acute */
+    1275, /* hpmute_asciicircum */
+    1276, /* hpmute_asciitilde */
+    1277, /* hpmute_diaeresis */
+    1278, /* hpmute_grave */
+    1279, /* hpReset */
+    1280, /* hpSystem */
+    1281, /* hpUser */
+    1282, /* hpYdiaeresis */
+    1284, /* hstroke */
+    1285, /* ht */
+    1286, /* Hyper_L */
+    1287, /* Hyper_R */
+    1288, /* hyphen */
+    1290, /* i */
+    1291, /* Iabovedot */
+    1293, /* iacute */
+    1295, /* ibelowdot */
+    1297, /* ibreve */
+    1299, /* icircumflex */
+    1300, /* identical */
+    1302, /* idiaeresis */
+    1303, /* idotless */
+    1304, /* ifonlyif */
+    1306, /* igrave */
+    1308, /* ihook */
+    1310, /* imacron */
+    1311, /* implies */
+    1312, /* includedin */
+    1313, /* includes */
+    1314, /* infinity */
+    1315, /* Insert */
+    1316, /* InsertChar */
+    1317, /* InsertLine */
+    1318, /* integral */
+    1319, /* intersection */
+    1320, /* IO */
+    1322, /* iogonek */
+    1323, /* ISO_Center_Object */
+    1324, /* ISO_Continuous_Underline */
+    1325, /* ISO_Discontinuous_Underline */
+    1326, /* ISO_Emphasize */
+    1327, /* ISO_Enter */
+    1328, /* ISO_Fast_Cursor_Down */
+    1329, /* ISO_Fast_Cursor_Left */
+    1330, /* ISO_Fast_Cursor_Right */
+    1331, /* ISO_Fast_Cursor_Up */
+    1332, /* ISO_First_Group */
+    1333, /* ISO_First_Group_Lock */
+    1334, /* ISO_Group_Latch */
+    1335, /* ISO_Group_Lock */
+    1336, /* ISO_Group_Shift */
+    1337, /* ISO_Last_Group */
+    1338, /* ISO_Last_Group_Lock */
+    1339, /* ISO_Left_Tab */
+    1340, /* ISO_Level2_Latch */
+    1341, /* ISO_Level3_Latch */
+    1342, /* ISO_Level3_Lock */
+    1343, /* ISO_Level3_Shift */
+    1344, /* ISO_Level5_Latch */
+    1345, /* ISO_Level5_Lock */
+    1346, /* ISO_Level5_Shift */
+    1347, /* ISO_Lock */
+    1348, /* ISO_Move_Line_Down */
+    1349, /* ISO_Move_Line_Up */
+    1350, /* ISO_Next_Group */
+    1351, /* ISO_Next_Group_Lock */
+    1352, /* ISO_Partial_Line_Down */
+    1353, /* ISO_Partial_Line_Up */
+    1354, /* ISO_Partial_Space_Left */
+    1355, /* ISO_Partial_Space_Right */
+    1356, /* ISO_Prev_Group */
+    1357, /* ISO_Prev_Group_Lock */
+    1358, /* ISO_Release_Both_Margins */
+    1359, /* ISO_Release_Margin_Left */
+    1360, /* ISO_Release_Margin_Right */
+    1361, /* ISO_Set_Margin_Left */
+    1362, /* ISO_Set_Margin_Right */
+    1364, /* itilde */
+    1366, /* j */
+    1368, /* jcircumflex */
+    1369, /* jot */
+    1371, /* k */
+    1373, /* kana_a */
+    1374, /* kana_CHI */
+    1375, /* kana_closingbracket */
+    1376, /* kana_comma */
+    1377, /* kana_conjunctive */
+    1379, /* kana_e */
+    1380, /* kana_FU */
+    1381, /* kana_fullstop */
+    1382, /* kana_HA */
+    1383, /* kana_HE */
+    1384, /* kana_HI */
+    1385, /* kana_HO */
+    1386, /* kana_HU */
+    1388, /* kana_i */
+    1389, /* kana_KA */
+    1390, /* kana_KE */
+    1391, /* kana_KI */
+    1392, /* kana_KO */
+    1393, /* kana_KU */
+    1394, /* Kana_Lock */
+    1395, /* kana_MA */
+    1396, /* kana_ME */
+    1397, /* kana_MI */
+    1398, /* kana_middledot */
+    1399, /* kana_MO */
+    1400, /* kana_MU */
+    1401, /* kana_N */
+    1402, /* kana_NA */
+    1403, /* kana_NE */
+    1404, /* kana_NI */
+    1405, /* kana_NO */
+    1406, /* kana_NU */
+    1408, /* kana_o */
+    1409, /* kana_openingbracket */
+    1410, /* kana_RA */
+    1411, /* kana_RE */
+    1412, /* kana_RI */
+    1413, /* kana_RO */
+    1414, /* kana_RU */
+    1415, /* kana_SA */
+    1416, /* kana_SE */
+    1417, /* kana_SHI */
+    1418, /* Kana_Shift */
+    1419, /* kana_SO */
+    1420, /* kana_SU */
+    1421, /* kana_switch */
+    1422, /* kana_TA */
+    1423, /* kana_TE */
+    1424, /* kana_TI */
+    1425, /* kana_TO */
+    1427, /* kana_tsu */
+    1429, /* kana_tu */
+    1431, /* kana_u */
+    1432, /* kana_WA */
+    1433, /* kana_WO */
+    1435, /* kana_ya */
+    1437, /* kana_yo */
+    1439, /* kana_yu */
+    1440, /* Kanji */
+    1441, /* Kanji_Bangou */
+    1442, /* kappa */
+    1443, /* Katakana */
+    1445, /* kcedilla */
+    1446, /* Korean_Won */
+    1447, /* KP_0 */
+    1448, /* KP_1 */
+    1449, /* KP_2 */
+    1450, /* KP_3 */
+    1451, /* KP_4 */
+    1452, /* KP_5 */
+    1453, /* KP_6 */
+    1454, /* KP_7 */
+    1455, /* KP_8 */
+    1456, /* KP_9 */
+    1457, /* KP_Add */
+    1458, /* KP_BackTab */
+    1459, /* KP_Begin */
+    1460, /* KP_Decimal */
+    1461, /* KP_Delete */
+    1462, /* KP_Divide */
+    1463, /* KP_Down */
+    1464, /* KP_End */
+    1465, /* KP_Enter */
+    1466, /* KP_Equal */
+    1467, /* KP_F1 */
+    1468, /* KP_F2 */
+    1469, /* KP_F3 */
+    1470, /* KP_F4 */
+    1471, /* KP_Home */
+    1472, /* KP_Insert */
+    1473, /* KP_Left */
+    1474, /* KP_Multiply */
+    1475, /* KP_Next */
+    1476, /* KP_Page_Down */
+    1477, /* KP_Page_Up */
+    1478, /* KP_Prior */
+    1479, /* KP_Right */
+    1480, /* KP_Separator */
+    1481, /* KP_Space */
+    1482, /* KP_Subtract */
+    1483, /* KP_Tab */
+    1484, /* KP_Up */
+    1485, /* kra */
+    1487, /* l */
+    1488, /* L1 */
+    1489, /* L10 */
+    1490, /* L2 */
+    1491, /* L3 */
+    1492, /* L4 */
+    1493, /* L5 */
+    1494, /* L6 */
+    1495, /* L7 */
+    1496, /* L8 */
+    1497, /* L9 */
+    1499, /* lacute */
+    1500, /* Last_Virtual_Screen */
+    1501, /* latincross */
+    1503, /* lbelowdot */
+    1505, /* lcaron */
+    1507, /* lcedilla */
+    1508, /* Left */
+    1509, /* leftanglebracket */
+    1510, /* leftarrow */
+    1511, /* leftcaret */
+    1512, /* leftdoublequotemark */
+    1513, /* leftmiddlecurlybrace */
+    1514, /* leftopentriangle */
+    1515, /* leftpointer */
+    1516, /* leftradical */
+    1517, /* leftshoe */
+    1518, /* leftsingleanglequotemark */
+    1519, /* leftsinglequotemark */
+    1520, /* leftt */
+    1521, /* lefttack */
+    1522, /* less */
+    1523, /* lessthanequal */
+    1524, /* lf */
+    1525, /* Linefeed */
+    1526, /* lira */
+    1527, /* LiraSign */
+    1528, /* logicaland */
+    1529, /* logicalor */
+    1530, /* longminus */
+    1531, /* lowleftcorner */
+    1532, /* lowrightcorner */
+    1534, /* lstroke */
+    1536, /* m */
+    1538, /* mabovedot */
+    1540, /* Macedonia_dse */
+    1542, /* Macedonia_gje */
+    1544, /* Macedonia_kje */
+    1545, /* macron */
+    1546, /* Mae_Koho */
+    1547, /* malesymbol */
+    1548, /* maltesecross */
+    1549, /* marker */
+    1550, /* masculine */
+    1551, /* Massyo */
+    1552, /* Menu */
+    1553, /* Meta_L */
+    1554, /* Meta_R */
+    1555, /* MillSign */
+    1556, /* minus */
+    1557, /* minutes */
+    1558, /* Mode_switch */
+    1559, /* MouseKeys_Accel_Enable */
+    1560, /* MouseKeys_Enable */
+    1561, /* mu */
+    1562, /* Muhenkan */
+    1563, /* Multi_key */
+    1564, /* MultipleCandidate */
+    1565, /* multiply */
+    1566, /* musicalflat */
+    1567, /* musicalsharp */
+    1568, /* mute_acute */
+    1569, /* mute_asciicircum */
+    1570, /* mute_asciitilde */
+    1571, /* mute_diaeresis */
+    1572, /* mute_grave */
+    1574, /* n */
+    1575, /* nabla */
+    1577, /* nacute */
+    1578, /* NairaSign */
+    1580, /* ncaron */
+    1582, /* ncedilla */
+    1583, /* NewSheqelSign */
+    1584, /* Next */
+    1585, /* Next_Virtual_Screen */
+    1586, /* ninesubscript */
+    1587, /* ninesuperior */
+    1588, /* nl */
+    1589, /* nobreakspace */
+    1590, /* NoSymbol */
+    1591, /* notapproxeq */
+    1592, /* notelementof */
+    1593, /* notequal */
+    1594, /* notidentical */
+    1595, /* notsign */
+    1597, /* ntilde */
+    1598, /* Num_Lock */
+    1599, /* numbersign */
+    1600, /* numerosign */
+    1602, /* o */
+    1604, /* oacute */
+    1606, /* obarred */
+    1608, /* obelowdot */
+    1610, /* ocaron */
+    1612, /* ocircumflex */
+    1614, /* ocircumflexacute */
+    1616, /* ocircumflexbelowdot */
+    1618, /* ocircumflexgrave */
+    1620, /* ocircumflexhook */
+    1622, /* ocircumflextilde */
+    1624, /* odiaeresis */
+    1626, /* odoubleacute */
+    1628, /* oe */
+    1629, /* ogonek */
+    1631, /* ograve */
+    1633, /* ohook */
+    1635, /* ohorn */
+    1637, /* ohornacute */
+    1639, /* ohornbelowdot */
+    1641, /* ohorngrave */
+    1643, /* ohornhook */
+    1645, /* ohorntilde */
+    1647, /* omacron */
+    1648, /* oneeighth */
+    1649, /* onefifth */
+    1650, /* onehalf */
+    1651, /* onequarter */
+    1652, /* onesixth */
+    1653, /* onesubscript */
+    1654, /* onesuperior */
+    1655, /* onethird */
+    1657, /* ooblique */
+    1658, /* openrectbullet */
+    1659, /* openstar */
+    1660, /* opentribulletdown */
+    1661, /* opentribulletup */
+    1662, /* ordfeminine */
+    1663, /* ordmasculine */
+    1664, /* osfActivate */
+    1665, /* osfAddMode */
+    1666, /* osfBackSpace */
+    1667, /* osfBackTab */
+    1668, /* osfBeginData */
+    1669, /* osfBeginLine */
+    1670, /* osfCancel */
+    1671, /* osfClear */
+    1672, /* osfCopy */
+    1673, /* osfCut */
+    1674, /* osfDelete */
+    1675, /* osfDeselectAll */
+    1676, /* osfDown */
+    1677, /* osfEndData */
+    1678, /* osfEndLine */
+    1679, /* osfEscape */
+    1680, /* osfExtend */
+    1681, /* osfHelp */
+    1682, /* osfInsert */
+    1683, /* osfLeft */
+    1684, /* osfMenu */
+    1685, /* osfMenuBar */
+    1686, /* osfNextField */
+    1687, /* osfNextMenu */
+    1688, /* osfPageDown */
+    1689, /* osfPageLeft */
+    1690, /* osfPageRight */
+    1691, /* osfPageUp */
+    1692, /* osfPaste */
+    1693, /* osfPrevField */
+    1694, /* osfPrevMenu */
+    1695, /* osfPrimaryPaste */
+    1696, /* osfQuickPaste */
+    1697, /* osfReselect */
+    1698, /* osfRestore */
+    1699, /* osfRight */
+    1700, /* osfSelect */
+    1701, /* osfSelectAll */
+    1702, /* osfUndo */
+    1703, /* osfUp */
+    1705, /* oslash */
+    1707, /* otilde */
+    1708, /* overbar */
+    1709, /* Overlay1_Enable */
+    1710, /* Overlay2_Enable */
+    1711, /* overline */
+    1713, /* p */
+    1715, /* pabovedot */
+    1716, /* Page_Down */
+    1717, /* Page_Up */
+    1718, /* paragraph */
+    1719, /* parenleft */
+    1720, /* parenright */
+    1721, /* partdifferential */
+    1722, /* partialderivative */
+    1723, /* Pause */
+    1724, /* percent */
+    1725, /* period */
+    1726, /* periodcentered */
+    1727, /* permille */
+    1728, /* PesetaSign */
+    1729, /* phonographcopyright */
+    1730, /* plus */
+    1731, /* plusminus */
+    1732, /* Pointer_Accelerate */
+    1733, /* Pointer_Button1 */
+    1734, /* Pointer_Button2 */
+    1735, /* Pointer_Button3 */
+    1736, /* Pointer_Button4 */
+    1737, /* Pointer_Button5 */
+    1738, /* Pointer_Button_Dflt */
+    1739, /* Pointer_DblClick1 */
+    1740, /* Pointer_DblClick2 */
+    1741, /* Pointer_DblClick3 */
+    1742, /* Pointer_DblClick4 */
+    1743, /* Pointer_DblClick5 */
+    1744, /* Pointer_DblClick_Dflt */
+    1745, /* Pointer_DfltBtnNext */
+    1746, /* Pointer_DfltBtnPrev */
+    1747, /* Pointer_Down */
+    1748, /* Pointer_DownLeft */
+    1749, /* Pointer_DownRight */
+    1750, /* Pointer_Drag1 */
+    1751, /* Pointer_Drag2 */
+    1752, /* Pointer_Drag3 */
+    1753, /* Pointer_Drag4 */
+    1754, /* Pointer_Drag5 */
+    1755, /* Pointer_Drag_Dflt */
+    1756, /* Pointer_EnableKeys */
+    1757, /* Pointer_Left */
+    1758, /* Pointer_Right */
+    1759, /* Pointer_Up */
+    1760, /* Pointer_UpLeft */
+    1761, /* Pointer_UpRight */
+    1762, /* prescription */
+    1763, /* Prev_Virtual_Screen */
+    1764, /* PreviousCandidate */
+    1765, /* Print */
+    1766, /* Prior */
+    1767, /* prolongedsound */
+    1768, /* punctspace */
+    1770, /* q */
+    1771, /* quad */
+    1772, /* question */
+    1773, /* questiondown */
+    1774, /* quotedbl */
+    1775, /* quoteleft */
+    1776, /* quoteright */
+    1778, /* r */
+    1779, /* R1 */
+    1780, /* R10 */
+    1781, /* R11 */
+    1782, /* R12 */
+    1783, /* R13 */
+    1784, /* R14 */
+    1785, /* R15 */
+    1786, /* R2 */
+    1787, /* R3 */
+    1788, /* R4 */
+    1789, /* R5 */
+    1790, /* R6 */
+    1791, /* R7 */
+    1792, /* R8 */
+    1793, /* R9 */
+    1795, /* racute */
+    1796, /* radical */
+    1798, /* rcaron */
+    1800, /* rcedilla */
+    1801, /* Redo */
+    1802, /* registered */
+    1803, /* RepeatKeys_Enable */
+    1804, /* Reset */
+    1805, /* Return */
+    1806, /* Right */
+    1807, /* rightanglebracket */
+    1808, /* rightarrow */
+    1809, /* rightcaret */
+    1810, /* rightdoublequotemark */
+    1811, /* rightmiddlecurlybrace */
+    1812, /* rightmiddlesummation */
+    1813, /* rightopentriangle */
+    1814, /* rightpointer */
+    1815, /* rightshoe */
+    1816, /* rightsingleanglequotemark */
+    1817, /* rightsinglequotemark */
+    1818, /* rightt */
+    1819, /* righttack */
+    1820, /* Romaji */
+    1821, /* RupeeSign */
+    1823, /* s */
+    1825, /* sabovedot */
+    1827, /* sacute */
+    1829, /* scaron */
+    1831, /* scedilla */
+    1833, /* schwa */
+    1835, /* scircumflex */
+    1836, /* script_switch */
+    1837, /* Scroll_Lock */
+    1838, /* seconds */
+    1839, /* section */
+    1840, /* Select */
+    1841, /* semicolon */
+    1842, /* semivoicedsound */
+    1844, /* Serbian_dje */
+    1846, /* Serbian_dze */
+    1848, /* Serbian_je */
+    1850, /* Serbian_lje */
+    1852, /* Serbian_nje */
+    1854, /* Serbian_tshe */
+    1855, /* seveneighths */
+    1856, /* sevensubscript */
+    1857, /* sevensuperior */
+    1858, /* Shift_L */
+    1859, /* Shift_Lock */
+    1860, /* Shift_R */
+    1861, /* signaturemark */
+    1862, /* signifblank */
+    1863, /* similarequal */
+    1864, /* SingleCandidate */
+    1865, /* singlelowquotemark */
+    1866, /* Sinh_a */
+    1867, /* Sinh_aa */
+    1868, /* Sinh_aa2 */
+    1869, /* Sinh_ae */
+    1870, /* Sinh_ae2 */
+    1871, /* Sinh_aee */
+    1872, /* Sinh_aee2 */
+    1873, /* Sinh_ai */
+    1874, /* Sinh_ai2 */
+    1875, /* Sinh_al */
+    1876, /* Sinh_au */
+    1877, /* Sinh_au2 */
+    1878, /* Sinh_ba */
+    1879, /* Sinh_bha */
+    1880, /* Sinh_ca */
+    1881, /* Sinh_cha */
+    1882, /* Sinh_dda */
+    1883, /* Sinh_ddha */
+    1884, /* Sinh_dha */
+    1885, /* Sinh_dhha */
+    1886, /* Sinh_e */
+    1887, /* Sinh_e2 */
+    1888, /* Sinh_ee */
+    1889, /* Sinh_ee2 */
+    1890, /* Sinh_fa */
+    1891, /* Sinh_ga */
+    1892, /* Sinh_gha */
+    1893, /* Sinh_h2 */
+    1894, /* Sinh_ha */
+    1895, /* Sinh_i */
+    1896, /* Sinh_i2 */
+    1897, /* Sinh_ii */
+    1898, /* Sinh_ii2 */
+    1899, /* Sinh_ja */
+    1900, /* Sinh_jha */
+    1901, /* Sinh_jnya */
+    1902, /* Sinh_ka */
+    1903, /* Sinh_kha */
+    1904, /* Sinh_kunddaliya */
+    1905, /* Sinh_la */
+    1906, /* Sinh_lla */
+    1907, /* Sinh_lu */
+    1908, /* Sinh_lu2 */
+    1909, /* Sinh_luu */
+    1910, /* Sinh_luu2 */
+    1911, /* Sinh_ma */
+    1912, /* Sinh_mba */
+    1913, /* Sinh_na */
+    1914, /* Sinh_ndda */
+    1915, /* Sinh_ndha */
+    1916, /* Sinh_ng */
+    1917, /* Sinh_ng2 */
+    1918, /* Sinh_nga */
+    1919, /* Sinh_nja */
+    1920, /* Sinh_nna */
+    1921, /* Sinh_nya */
+    1922, /* Sinh_o */
+    1923, /* Sinh_o2 */
+    1924, /* Sinh_oo */
+    1925, /* Sinh_oo2 */
+    1926, /* Sinh_pa */
+    1927, /* Sinh_pha */
+    1928, /* Sinh_ra */
+    1929, /* Sinh_ri */
+    1930, /* Sinh_rii */
+    1931, /* Sinh_ru2 */
+    1932, /* Sinh_ruu2 */
+    1933, /* Sinh_sa */
+    1934, /* Sinh_sha */
+    1935, /* Sinh_ssha */
+    1936, /* Sinh_tha */
+    1937, /* Sinh_thha */
+    1938, /* Sinh_tta */
+    1939, /* Sinh_ttha */
+    1940, /* Sinh_u */
+    1941, /* Sinh_u2 */
+    1942, /* Sinh_uu */
+    1943, /* Sinh_uu2 */
+    1944, /* Sinh_va */
+    1945, /* Sinh_ya */
+    1946, /* sixsubscript */
+    1947, /* sixsuperior */
+    1948, /* slash */
+    1949, /* SlowKeys_Enable */
+    1950, /* soliddiamond */
+    1951, /* space */
+    1952, /* squareroot */
+    1954, /* ssharp */
+    1955, /* sterling */
+    1956, /* StickyKeys_Enable */
+    1957, /* stricteq */
+    1958, /* SunAgain */
+    1959, /* SunAltGraph */
+    1960, /* SunAudioLowerVolume */
+    1961, /* SunAudioMute */
+    1962, /* SunAudioRaiseVolume */
+    1963, /* SunCompose */
+    1964, /* SunCopy */
+    1965, /* SunCut */
+    1966, /* SunF36 */
+    1967, /* SunF37 */
+    1968, /* SunFA_Acute */
+    1969, /* SunFA_Cedilla */
+    1970, /* SunFA_Circum */
+    1971, /* SunFA_Diaeresis */
+    1972, /* SunFA_Grave */
+    1973, /* SunFA_Tilde */
+    1974, /* SunFind */
+    1975, /* SunFront */
+    1976, /* SunOpen */
+    1977, /* SunPageDown */
+    1978, /* SunPageUp */
+    1979, /* SunPaste */
+    1980, /* SunPowerSwitch */
+    1981, /* SunPowerSwitchShift */
+    1982, /* SunPrint_Screen */
+    1983, /* SunProps */
+    1984, /* SunStop */
+    1985, /* SunSys_Req */
+    1986, /* SunUndo */
+    1987, /* SunVideoDegauss */
+    1988, /* SunVideoLowerBrightness */
+    1989, /* SunVideoRaiseBrightness */
+    1990, /* Super_L */
+    1991, /* Super_R */
+    1992, /* Sys_Req */
+    1993, /* System */
+    1995, /* t */
+    1996, /* Tab */
+    1998, /* tabovedot */
+    2000, /* tcaron */
+    2002, /* tcedilla */
+    2003, /* telephone */
+    2004, /* telephonerecorder */
+    2005, /* Terminate_Server */
+    2006, /* Thai_baht */
+    2007, /* Thai_bobaimai */
+    2008, /* Thai_chochan */
+    2009, /* Thai_chochang */
+    2010, /* Thai_choching */
+    2011, /* Thai_chochoe */
+    2012, /* Thai_dochada */
+    2013, /* Thai_dodek */
+    2014, /* Thai_fofa */
+    2015, /* Thai_fofan */
+    2016, /* Thai_hohip */
+    2017, /* Thai_honokhuk */
+    2018, /* Thai_khokhai */
+    2019, /* Thai_khokhon */
+    2020, /* Thai_khokhuat */
+    2021, /* Thai_khokhwai */
+    2022, /* Thai_khorakhang */
+    2023, /* Thai_kokai */
+    2024, /* Thai_lakkhangyao */
+    2025, /* Thai_lekchet */
+    2026, /* Thai_lekha */
+    2027, /* Thai_lekhok */
+    2028, /* Thai_lekkao */
+    2029, /* Thai_leknung */
+    2030, /* Thai_lekpaet */
+    2031, /* Thai_leksam */
+    2032, /* Thai_leksi */
+    2033, /* Thai_leksong */
+    2034, /* Thai_leksun */
+    2035, /* Thai_lochula */
+    2036, /* Thai_loling */
+    2037, /* Thai_lu */
+    2038, /* Thai_maichattawa */
+    2039, /* Thai_maiek */
+    2040, /* Thai_maihanakat */
+    2041, /* Thai_maihanakat_maitho */
+    2042, /* Thai_maitaikhu */
+    2043, /* Thai_maitho */
+    2044, /* Thai_maitri */
+    2045, /* Thai_maiyamok */
+    2046, /* Thai_moma */
+    2047, /* Thai_ngongu */
+    2048, /* Thai_nikhahit */
+    2049, /* Thai_nonen */
+    2050, /* Thai_nonu */
+    2051, /* Thai_oang */
+    2052, /* Thai_paiyannoi */
+    2053, /* Thai_phinthu */
+    2054, /* Thai_phophan */
+    2055, /* Thai_phophung */
+    2056, /* Thai_phosamphao */
+    2057, /* Thai_popla */
+    2058, /* Thai_rorua */
+    2059, /* Thai_ru */
+    2060, /* Thai_saraa */
+    2061, /* Thai_saraaa */
+    2062, /* Thai_saraae */
+    2063, /* Thai_saraaimaimalai */
+    2064, /* Thai_saraaimaimuan */
+    2065, /* Thai_saraam */
+    2066, /* Thai_sarae */
+    2067, /* Thai_sarai */
+    2068, /* Thai_saraii */
+    2069, /* Thai_sarao */
+    2070, /* Thai_sarau */
+    2071, /* Thai_saraue */
+    2072, /* Thai_sarauee */
+    2073, /* Thai_sarauu */
+    2074, /* Thai_sorusi */
+    2075, /* Thai_sosala */
+    2076, /* Thai_soso */
+    2077, /* Thai_sosua */
+    2078, /* Thai_thanthakhat */
+    2079, /* Thai_thonangmontho */
+    2080, /* Thai_thophuthao */
+    2081, /* Thai_thothahan */
+    2082, /* Thai_thothan */
+    2083, /* Thai_thothong */
+    2084, /* Thai_thothung */
+    2085, /* Thai_topatak */
+    2086, /* Thai_totao */
+    2087, /* Thai_wowaen */
+    2088, /* Thai_yoyak */
+    2089, /* Thai_yoying */
+    2090, /* therefore */
+    2091, /* thinspace */
+    2094, /* thorn */
+    2095, /* threeeighths */
+    2096, /* threefifths */
+    2097, /* threequarters */
+    2098, /* threesubscript */
+    2099, /* threesuperior */
+    2100, /* tintegral */
+    2101, /* topintegral */
+    2102, /* topleftparens */
+    2103, /* topleftradical */
+    2104, /* topleftsqbracket */
+    2105, /* topleftsummation */
+    2106, /* toprightparens */
+    2107, /* toprightsqbracket */
+    2108, /* toprightsummation */
+    2109, /* topt */
+    2110, /* topvertsummationconnector */
+    2111, /* Touroku */
+    2112, /* trademark */
+    2113, /* trademarkincircle */
+    2115, /* tslash */
+    2116, /* twofifths */
+    2117, /* twosubscript */
+    2118, /* twosuperior */
+    2119, /* twothirds */
+    2121, /* u */
+    2123, /* uacute */
+    2125, /* ubelowdot */
+    2127, /* ubreve */
+    2129, /* ucircumflex */
+    2131, /* udiaeresis */
+    2133, /* udoubleacute */
+    2135, /* ugrave */
+    2137, /* uhook */
+    2139, /* uhorn */
+    2141, /* uhornacute */
+    2143, /* uhornbelowdot */
+    2145, /* uhorngrave */
+    2147, /* uhornhook */
+    2149, /* uhorntilde */
+    2151, /* Ukrainian_ghe_with_upturn */
+    2153, /* Ukrainian_i */
+    2155, /* Ukrainian_ie */
+    2157, /* Ukrainian_yi */
+    2159, /* Ukranian_i */
+    2161, /* Ukranian_je */
+    2163, /* Ukranian_yi */
+    2165, /* umacron */
+    2166, /* underbar */
+    2167, /* underscore */
+    2168, /* Undo */
+    2169, /* union */
+    2171, /* uogonek */
+    2172, /* Up */
+    2173, /* uparrow */
+    2174, /* upcaret */
+    2175, /* upleftcorner */
+    2176, /* uprightcorner */
+    2177, /* upshoe */
+    2178, /* upstile */
+    2179, /* uptack */
+    2181, /* uring */
+    2182, /* User */
+    2184, /* utilde */
+    2186, /* v */
+    2187, /* variation */
+    2188, /* vertbar */
+    2189, /* vertconnector */
+    2190, /* voicedsound */
+    2191, /* VoidSymbol */
+    2192, /* vt */
+    2194, /* w */
+    2196, /* wacute */
+    2198, /* wcircumflex */
+    2200, /* wdiaeresis */
+    2202, /* wgrave */
+    2203, /* WonSign */
+    2205, /* x */
+    2207, /* xabovedot */
+    2208, /* XF8610ChannelsDown */
+    2209, /* XF8610ChannelsUp */
+    2210, /* XF863DMode */
+    2211, /* XF86Accessibility */
+    2212, /* XF86ActionOnSelection */
+    2213, /* XF86AddFavorite */
+    2214, /* XF86Addressbook */
+    2215, /* XF86ALSToggle */
+    2216, /* XF86ApplicationLeft */
+    2217, /* XF86ApplicationRight */
+    2218, /* XF86AppSelect */
+    2219, /* XF86AspectRatio */
+    2220, /* XF86Assistant */
+    2221, /* XF86AttendantOff */
+    2222, /* XF86AttendantOn */
+    2223, /* XF86AttendantToggle */
+    2224, /* XF86Audio */
+    2225, /* XF86AudioBassBoost */
+    2226, /* XF86AudioChannelMode */
+    2227, /* XF86AudioCycleTrack */
+    2228, /* XF86AudioDesc */
+    2229, /* XF86AudioForward */
+    2230, /* XF86AudioLowerVolume */
+    2231, /* XF86AudioMedia */
+    2232, /* XF86AudioMicMute */
+    2233, /* XF86AudioMute */
+    2234, /* XF86AudioNext */
+    2235, /* XF86AudioPause */
+    2236, /* XF86AudioPlay */
+    2237, /* XF86AudioPreset */
+    2238, /* XF86AudioPrev */
+    2239, /* XF86AudioRaiseVolume */
+    2240, /* XF86AudioRandomPlay */
+    2241, /* XF86AudioRecord */
+    2242, /* XF86AudioRepeat */
+    2243, /* XF86AudioRewind */
+    2244, /* XF86AudioStop */
+    2245, /* XF86AutopilotEngageToggle */
+    2246, /* XF86Away */
+    2247, /* XF86Back */
+    2248, /* XF86BackForward */
+    2249, /* XF86Battery */
+    2250, /* XF86Blue */
+    2251, /* XF86Bluetooth */
+    2252, /* XF86Book */
+    2253, /* XF86Break */
+    2254, /* XF86BrightnessAdjust */
+    2255, /* XF86BrightnessAuto */
+    2256, /* XF86BrightnessMax */
+    2257, /* XF86BrightnessMin */
+    2258, /* XF86Buttonconfig */
+    2259, /* XF86Calculater */
+    2260, /* XF86Calculator */
+    2261, /* XF86Calendar */
+    2262, /* XF86CameraAccessDisable */
+    2263, /* XF86CameraAccessEnable */
+    2264, /* XF86CameraAccessToggle */
+    2265, /* XF86CameraDown */
+    2266, /* XF86CameraFocus */
+    2267, /* XF86CameraLeft */
+    2268, /* XF86CameraRight */
+    2269, /* XF86CameraUp */
+    2270, /* XF86CameraZoomIn */
+    2271, /* XF86CameraZoomOut */
+    2272, /* XF86CD */
+    2273, /* XF86ChannelDown */
+    2274, /* XF86ChannelUp */
+    2275, /* XF86Clear */
+    2276, /* XF86ClearGrab */
+    2277, /* XF86ClearvuSonar */
+    2278, /* XF86Close */
+    2279, /* XF86Community */
+    2280, /* XF86ContextMenu */
+    2281, /* XF86ContextualInsert */
+    2282, /* XF86ContextualQuery */
+    2283, /* XF86ContrastAdjust */
+    2284, /* XF86ControlPanel */
+    2285, /* XF86Copy */
+    2286, /* XF86Cut */
+    2287, /* XF86CycleAngle */
+    2288, /* XF86Data */
+    2289, /* XF86Database */
+    2290, /* XF86Dictate */
+    2291, /* XF86Display */
+    2292, /* XF86DisplayOff */
+    2293, /* XF86DisplayToggle */
+    2294, /* XF86Documents */
+    2295, /* XF86DoNotDisturb */
+    2296, /* XF86DOS */
+    2297, /* XF86DualRangeRadar */
+    2298, /* XF86DVD */
+    2299, /* XF86Editor */
+    2300, /* XF86Eject */
+    2301, /* XF86ElectronicPrivacyScreenOff */
+    2302, /* XF86ElectronicPrivacyScreenOn */
+    2303, /* XF86EmojiPicker */
+    2304, /* XF86Excel */
+    2305, /* XF86Exit */
+    2306, /* XF86Explorer */
+    2307, /* XF86FastReverse */
+    2308, /* XF86Favorites */
+    2309, /* XF86Finance */
+    2310, /* XF86FishingChart */
+    2311, /* XF86Fn */
+    2312, /* XF86Fn_1 */
+    2313, /* XF86Fn_2 */
+    2314, /* XF86Fn_B */
+    2315, /* XF86Fn_D */
+    2316, /* XF86Fn_E */
+    2317, /* XF86Fn_Esc */
+    2318, /* XF86Fn_F */
+    2319, /* XF86Fn_F1 */
+    2320, /* XF86Fn_F10 */
+    2321, /* XF86Fn_F11 */
+    2322, /* XF86Fn_F12 */
+    2323, /* XF86Fn_F2 */
+    2324, /* XF86Fn_F3 */
+    2325, /* XF86Fn_F4 */
+    2326, /* XF86Fn_F5 */
+    2327, /* XF86Fn_F6 */
+    2328, /* XF86Fn_F7 */
+    2329, /* XF86Fn_F8 */
+    2330, /* XF86Fn_F9 */
+    2331, /* XF86Fn_S */
+    2332, /* XF86FnRightShift */
+    2333, /* XF86Forward */
+    2334, /* XF86FrameBack */
+    2335, /* XF86FrameForward */
+    2336, /* XF86FullScreen */
+    2337, /* XF86Game */
+    2338, /* XF86Go */
+    2339, /* XF86GoTo */
+    2340, /* XF86GraphicsEditor */
+    2341, /* XF86Green */
+    2342, /* XF86HangupPhone */
+    2343, /* XF86Hibernate */
+    2344, /* XF86History */
+    2345, /* XF86HomePage */
+    2346, /* XF86HotLinks */
+    2347, /* XF86Images */
+    2348, /* XF86Info */
+    2349, /* XF86iTouch */
+    2350, /* XF86Journal */
+    2351, /* XF86KbdBrightnessDown */
+    2352, /* XF86KbdBrightnessUp */
+    2353, /* XF86KbdInputAssistAccept */
+    2354, /* XF86KbdInputAssistCancel */
+    2355, /* XF86KbdInputAssistNext */
+    2356, /* XF86KbdInputAssistNextgroup */
+    2357, /* XF86KbdInputAssistPrev */
+    2358, /* XF86KbdInputAssistPrevgroup */
+    2359, /* XF86KbdLcdMenu1 */
+    2360, /* XF86KbdLcdMenu2 */
+    2361, /* XF86KbdLcdMenu3 */
+    2362, /* XF86KbdLcdMenu4 */
+    2363, /* XF86KbdLcdMenu5 */
+    2364, /* XF86KbdLightOnOff */
+    2365, /* XF86Keyboard */
+    2366, /* XF86Launch0 */
+    2367, /* XF86Launch1 */
+    2368, /* XF86Launch2 */
+    2369, /* XF86Launch3 */
+    2370, /* XF86Launch4 */
+    2371, /* XF86Launch5 */
+    2372, /* XF86Launch6 */
+    2373, /* XF86Launch7 */
+    2374, /* XF86Launch8 */
+    2375, /* XF86Launch9 */
+    2376, /* XF86LaunchA */
+    2377, /* XF86LaunchB */
+    2378, /* XF86LaunchC */
+    2379, /* XF86LaunchD */
+    2380, /* XF86LaunchE */
+    2381, /* XF86LaunchF */
+    2382, /* XF86LeftDown */
+    2383, /* XF86LeftUp */
+    2384, /* XF86LightBulb */
+    2385, /* XF86LightsToggle */
+    2386, /* XF86LinkPhone */
+    2387, /* XF86LogGrabInfo */
+    2388, /* XF86LogOff */
+    2389, /* XF86LogWindowTree */
+    2390, /* XF86Macro1 */
+    2391, /* XF86Macro10 */
+    2392, /* XF86Macro11 */
+    2393, /* XF86Macro12 */
+    2394, /* XF86Macro13 */
+    2395, /* XF86Macro14 */
+    2396, /* XF86Macro15 */
+    2397, /* XF86Macro16 */
+    2398, /* XF86Macro17 */
+    2399, /* XF86Macro18 */
+    2400, /* XF86Macro19 */
+    2401, /* XF86Macro2 */
+    2402, /* XF86Macro20 */
+    2403, /* XF86Macro21 */
+    2404, /* XF86Macro22 */
+    2405, /* XF86Macro23 */
+    2406, /* XF86Macro24 */
+    2407, /* XF86Macro25 */
+    2408, /* XF86Macro26 */
+    2409, /* XF86Macro27 */
+    2410, /* XF86Macro28 */
+    2411, /* XF86Macro29 */
+    2412, /* XF86Macro3 */
+    2413, /* XF86Macro30 */
+    2414, /* XF86Macro4 */
+    2415, /* XF86Macro5 */
+    2416, /* XF86Macro6 */
+    2417, /* XF86Macro7 */
+    2418, /* XF86Macro8 */
+    2419, /* XF86Macro9 */
+    2420, /* XF86MacroPreset1 */
+    2421, /* XF86MacroPreset2 */
+    2422, /* XF86MacroPreset3 */
+    2423, /* XF86MacroPresetCycle */
+    2424, /* XF86MacroRecordStart */
+    2425, /* XF86MacroRecordStop */
+    2426, /* XF86Mail */
+    2427, /* XF86MailForward */
+    2428, /* XF86Market */
+    2429, /* XF86MarkWaypoint */
+    2430, /* XF86MediaLanguageMenu */
+    2431, /* XF86MediaPlayer */
+    2432, /* XF86MediaPlayPause */
+    2433, /* XF86MediaPlaySlow */
+    2434, /* XF86MediaRepeat */
+    2435, /* XF86MediaSelectAuxiliary */
+    2436, /* XF86MediaSelectCable */
+    2437, /* XF86MediaSelectCD */
+    2438, /* XF86MediaSelectDVD */
+    2439, /* XF86MediaSelectHome */
+    2440, /* XF86MediaSelectPC */
+    2441, /* XF86MediaSelectProgramGuide */
+    2442, /* XF86MediaSelectRadio */
+    2443, /* XF86MediaSelectSatellite */
+    2444, /* XF86MediaSelectTape */
+    2445, /* XF86MediaSelectTeletext */
+    2446, /* XF86MediaSelectTuner */
+    2447, /* XF86MediaSelectTV */
+    2448, /* XF86MediaSelectVCR */
+    2449, /* XF86MediaSelectVCRPlus */
+    2450, /* XF86MediaTitleMenu */
+    2451, /* XF86MediaTopMenu */
+    2452, /* XF86Meeting */
+    2453, /* XF86Memo */
+    2454, /* XF86MenuKB */
+    2455, /* XF86MenuPB */
+    2456, /* XF86Messenger */
+    2457, /* XF86ModeLock */
+    2458, /* XF86MonBrightnessAuto */
+    2459, /* XF86MonBrightnessCycle */
+    2460, /* XF86MonBrightnessDown */
+    2461, /* XF86MonBrightnessUp */
+    2462, /* XF86Music */
+    2463, /* XF86MyComputer */
+    2464, /* XF86MySites */
+    2465, /* XF86NavChart */
+    2466, /* XF86NavInfo */
+    2467, /* XF86New */
+    2468, /* XF86News */
+    2469, /* XF86Next_VMode */
+    2470, /* XF86NextElement */
+    2471, /* XF86NextFavorite */
+    2472, /* XF86NotificationCenter */
+    2473, /* XF86NumberEntryMode */
+    2474, /* XF86Numeric0 */
+    2475, /* XF86Numeric1 */
+    2476, /* XF86Numeric11 */
+    2477, /* XF86Numeric12 */
+    2478, /* XF86Numeric2 */
+    2479, /* XF86Numeric3 */
+    2480, /* XF86Numeric4 */
+    2481, /* XF86Numeric5 */
+    2482, /* XF86Numeric6 */
+    2483, /* XF86Numeric7 */
+    2484, /* XF86Numeric8 */
+    2485, /* XF86Numeric9 */
+    2486, /* XF86NumericA */
+    2487, /* XF86NumericB */
+    2488, /* XF86NumericC */
+    2489, /* XF86NumericD */
+    2490, /* XF86NumericPound */
+    2491, /* XF86NumericStar */
+    2492, /* XF86OfficeHome */
+    2493, /* XF86OK */
+    2494, /* XF86OnScreenKeyboard */
+    2495, /* XF86Open */
+    2496, /* XF86OpenURL */
+    2497, /* XF86Option */
+    2498, /* XF86Paste */
+    2499, /* XF86PauseRecord */
+    2500, /* XF86PerformanceMode */
+    2501, /* XF86Phone */
+    2502, /* XF86PickupPhone */
+    2503, /* XF86Pictures */
+    2504, /* XF86PowerDown */
+    2505, /* XF86PowerOff */
+    2506, /* XF86Presentation */
+    2507, /* XF86Prev_VMode */
+    2508, /* XF86PreviousElement */
+    2509, /* XF86PrivacyScreenToggle */
+    2510, /* XF86Q */
+    2511, /* XF86RadarOverlay */
+    2512, /* XF86Red */
+    2513, /* XF86Refresh */
+    2514, /* XF86RefreshRateToggle */
+    2515, /* XF86Reload */
+    2516, /* XF86Reply */
+    2517, /* XF86RFKill */
+    2518, /* XF86RightDown */
+    2519, /* XF86RightUp */
+    2520, /* XF86RockerDown */
+    2521, /* XF86RockerEnter */
+    2522, /* XF86RockerUp */
+    2523, /* XF86RootMenu */
+    2524, /* XF86RotateWindows */
+    2525, /* XF86RotationKB */
+    2526, /* XF86RotationLockToggle */
+    2527, /* XF86RotationPB */
+    2528, /* XF86Save */
+    2530, /* XF86Screensaver */
+    2531, /* XF86ScrollClick */
+    2532, /* XF86ScrollDown */
+    2533, /* XF86ScrollUp */
+    2534, /* XF86Search */
+    2535, /* XF86Select */
+    2536, /* XF86SelectiveScreenshot */
+    2537, /* XF86Send */
+    2538, /* XF86Shop */
+    2539, /* XF86SidevuSonar */
+    2540, /* XF86SingleRangeRadar */
+    2541, /* XF86Sleep */
+    2542, /* XF86SlowReverse */
+    2543, /* XF86Sos */
+    2544, /* XF86Spell */
+    2545, /* XF86SpellCheck */
+    2546, /* XF86SplitScreen */
+    2547, /* XF86Sport */
+    2548, /* XF86Standby */
+    2549, /* XF86Start */
+    2550, /* XF86Stop */
+    2551, /* XF86StopRecord */
+    2552, /* XF86Subtitle */
+    2553, /* XF86Support */
+    2554, /* XF86Suspend */
+    2555, /* XF86Switch_VT_1 */
+    2556, /* XF86Switch_VT_10 */
+    2557, /* XF86Switch_VT_11 */
+    2558, /* XF86Switch_VT_12 */
+    2559, /* XF86Switch_VT_2 */
+    2560, /* XF86Switch_VT_3 */
+    2561, /* XF86Switch_VT_4 */
+    2562, /* XF86Switch_VT_5 */
+    2563, /* XF86Switch_VT_6 */
+    2564, /* XF86Switch_VT_7 */
+    2565, /* XF86Switch_VT_8 */
+    2566, /* XF86Switch_VT_9 */
+    2567, /* XF86Taskmanager */
+    2568, /* XF86TaskPane */
+    2569, /* XF86Terminal */
+    2570, /* XF86Time */
+    2571, /* XF86ToDoList */
+    2572, /* XF86Tools */
+    2573, /* XF86TopMenu */
+    2574, /* XF86TouchpadOff */
+    2575, /* XF86TouchpadOn */
+    2576, /* XF86TouchpadToggle */
+    2577, /* XF86TraditionalSonar */
+    2578, /* XF86Travel */
+    2579, /* XF86Ungrab */
+    2580, /* XF86Unmute */
+    2581, /* XF86User1KB */
+    2582, /* XF86User2KB */
+    2583, /* XF86UserPB */
+    2584, /* XF86UWB */
+    2585, /* XF86VendorHome */
+    2586, /* XF86VendorLogo */
+    2587, /* XF86Video */
+    2588, /* XF86VideoPhone */
+    2589, /* XF86View */
+    2590, /* XF86VOD */
+    2591, /* XF86VoiceCommand */
+    2592, /* XF86Voicemail */
+    2593, /* XF86WakeUp */
+    2594, /* XF86WebCam */
+    2595, /* XF86WheelButton */
+    2596, /* XF86WLAN */
+    2597, /* XF86Word */
+    2598, /* XF86WPSButton */
+    2599, /* XF86WWAN */
+    2600, /* XF86WWW */
+    2601, /* XF86Xfer */
+    2602, /* XF86Yellow */
+    2603, /* XF86ZoomIn */
+    2604, /* XF86ZoomOut */
+    2605, /* XF86ZoomReset */
+    2607, /* y */
+    2609, /* yacute */
+    2611, /* ybelowdot */
+    2613, /* ycircumflex */
+    2615, /* ydiaeresis */
+    2616, /* yen */
+    2618, /* ygrave */
+    2620, /* yhook */
+    2622, /* ytilde */
+    2624, /* z */
+    2626, /* zabovedot */
+    2628, /* zacute */
+    2630, /* zcaron */
+    2631, /* Zen_Koho */
+    2632, /* Zenkaku */
+    2633, /* Zenkaku_Hankaku */
+    2634, /* zerosubscript */
+    2635, /* zerosuperior */
+    2637, /* zstroke */
+};
+
 #define UNICODE_KEYSYM    0xfffe
 #define DEPRECATED_KEYSYM 0xffff
 
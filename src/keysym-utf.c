@@ -37,12 +37,15 @@
 
 #include "config.h"
 
+#include <limits.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "xkbcommon/xkbcommon.h"
 #include "utils.h"
 #include "utf8.h"
 #include "keysym.h"
+#include "keysym-utf.h"
 
 #define NO_KEYSYM_UNICODE_CONVERSION 0
 
@@ -53,7 +56,12 @@ struct codepair {
     uint16_t ucs;
 };
 
+/*
+ * The lookup tables in keysym-utf.h are generated from this table: run
+ * scripts/update-keysyms after editing it.
+ */
 static const struct codepair keysymtab[] = {
+    { 0x0000, false, 0x0000 }, /*                   NoSymbol   sentinel: no conversion */
     { 0x01a1, false, 0x0104 }, /*                     Aogonek Ą LATIN CAPITAL LETTER A WITH OGONEK */
     { 0x01a2, false, 0x02d8 }, /*                       breve ˘ BREVE */
     { 0x01a3, false, 0x0141 }, /*                     Lstroke Ł LATIN CAPITAL LETTER L WITH STROKE */
@@ -831,31 +839,6 @@ static const struct codepair keysymtab[] = {
     { 0x20ac, false, 0x20ac }, /*                    EuroSign € EURO SIGN */
 };
 
-/* binary search with range check */
-static uint32_t
-bin_search(const struct codepair *table, size_t length, xkb_keysym_t keysym)
-{
-    size_t first = 0;
-    size_t last = length;
-
-    if (keysym < table[0].keysym  || keysym > table[length].keysym)
-        return 0;
-
-    /* binary search in table */
-    while (last >= first) {
-        size_t mid = (first + last) / 2;
-        if (table[mid].keysym < keysym)
-            first = mid + 1;
-        else if (table[mid].keysym > keysym)
-            last = mid - 1;
-        else /* found it */
-            return table[mid].ucs;
-    }
-
-    /* no matching Unicode value found in table */
-    return NO_KEYSYM_UNICODE_CONVERSION;
-}
-
 uint32_t
 xkb_keysym_to_utf32(xkb_keysym_t keysym)
 {
@@ -864,6 +847,10 @@ xkb_keysym_to_utf32(xkb_keysym_t keysym)
         (keysym >= 0x00a0 && keysym <= 0x00ff))
         return keysym;
 
+    /* legacy keysyms: constant-time lookup in keysymtab */
+    if (keysym <= KEYSYMTAB_MAX_KEYSYM)
+        return keysymtab[get_keysymtab_index(keysym)].ucs;
+
     /* patch encoding botch */
     if (keysym == XKB_KEY_KP_Space)
         return XKB_KEY_space & 0x7f;
@@ -903,8 +890,7 @@ xkb_keysym_to_utf32(xkb_keysym_t keysym)
     case XKB_KEY_XF86NumericPound:
         return 0x23; /* # */
     default:
-        /* search main table */
-        return bin_search(keysymtab, ARRAY_SIZE(keysymtab) - 1, keysym);
+        return NO_KEYSYM_UNICODE_CONVERSION;
     }
 }
 
@@ -932,11 +918,23 @@ xkb_utf32_to_keysym(uint32_t ucs)
     if (unlikely(ucs == 0 || is_surrogate(ucs) || ucs > 0x10ffff))
         return XKB_KEY_NoSymbol;
 
-    /* search main table */
-    for (size_t i = 0; i < ARRAY_SIZE(keysymtab); i++) {
-        /* Do not use deprecated keysyms */
-        if (keysymtab[i].ucs == ucs && !keysymtab[i].deprecated)
-            return keysymtab[i].keysym;
+    /*
+     * Search the reverse table. It is generated from keysymtab by
+     * scripts/update-keysyms-utf.py and does not contain deprecated keysyms.
+     */
+    if (ucs >= ucs_keysymtab[0].ucs &&
+        ucs <= ucs_keysymtab[ARRAY_SIZE(ucs_keysymtab) - 1].ucs) {
+        size_t first = 0;
+        size_t last = ARRAY_SIZE(ucs_keysymtab);
+        while (first < last) {
+            const size_t mid = first + (last - first) / 2;
+            if (ucs_keysymtab[mid].ucs < ucs)
+                first = mid + 1;
+            else if (ucs_keysymtab[mid].ucs > ucs)
+                last = mid;
+            else /* found it */
+                return ucs_keysymtab[mid].keysym;
+        }
     }
 
     /* Use direct encoding if everything else failed */
@@ -970,3 +968,46 @@ xkb_keysym_to_utf8(xkb_keysym_t keysym, char *buffer, size_t size)
 }
 
 /* SPDX-SnippetEnd */
+
+int
+xkb_keysyms_to_utf8(const xkb_keysym_t *keysyms, size_t count,
+                    char *buffer, size_t size)
+{
+    /*
+     * `written` is the number of bytes written to the buffer, while `required`
+     * is the number of bytes required for the whole string. They differ only
+     * on truncation, which never occurs in the middle of a UTF-8 sequence.
+     */
+    size_t written = 0;
+    size_t required = 0;
+    char tmp[XKB_KEYSYM_UTF8_MAX_SIZE];
+    for (size_t k = 0; k < count; k++) {
+        const uint32_t cp = xkb_keysym_to_utf32(keysyms[k]);
+        if (cp == NO_KEYSYM_UNICODE_CONVERSION)
+            continue;
+        uint8_t length;
+        if (written == required && size - written >= XKB_KEYSYM_UTF8_MAX_SIZE) {
+            /* Enough room: encode directly into the buffer */
+            length = utf32_to_utf8(cp, buffer + written);
+            if (length == 0)
+                continue;
+            written += length - 1;
+        } else {
+            length = utf32_to_utf8(cp, tmp);
+            if (length == 0)
+                continue;
+            /* Keep room for the terminating byte */
+            if (written == required && written + length <= size) {
+                memcpy(buffer + written, tmp, length - 1);
+                written += length - 1;
+            }
+        }
+        required += length - 1;
+        if (required > INT_MAX)
+            return -1;
+    }
+
+    if (size > 0)
+        buffer[written] = '\0';
+    return (int) required;
+}
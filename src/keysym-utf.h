@@ -0,0 +1,961 @@
+/**
+ * This file comes from libxkbcommon and was generated by update-keysyms-utf.py
+ * You can always fetch the latest version from:
+ * https://raw.github.com/xkbcommon/libxkbcommon/master/src/keysym-utf.h
+ */
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * Unicode code point -> keysym mapping, sorted by code point.
+ *
+ * Derived from `keysymtab` in keysym-utf.c: deprecated keysyms are omitted
+ * and, when several keysyms map to the same code point, the lowest one wins.
+ */
+struct ucs_keysym_pair {
+    uint16_t ucs;
+    uint16_t keysym;
+};
+
+static const struct ucs_keysym_pair ucs_keysymtab[] = {
+    { 0x0100, 0x03c0 }, /* Amacron Ā LATIN CAPITAL LETTER A WITH MACRON */
+    { 0x0101, 0x03e0 }, /* amacron ā LATIN SMALL LETTER A WITH MACRON */
+    { 0x0102, 0x01c3 }, /* Abreve Ă LATIN CAPITAL LETTER A WITH BREVE */
+    { 0x0103, 0x01e3 }, /* abreve ă LATIN SMALL LETTER A WITH BREVE */
+    { 0x0104, 0x01a1 }, /* Aogonek Ą LATIN CAPITAL LETTER A WITH OGONEK */
+    { 0x0105, 0x01b1 }, /* aogonek ą LATIN SMALL LETTER A WITH OGONEK */
+    { 0x0106, 0x01c6 }, /* Cacute Ć LATIN CAPITAL LETTER C WITH ACUTE */
+    { 0x0107, 0x01e6 }, /* cacute ć LATIN SMALL LETTER C WITH ACUTE */
+    { 0x0108, 0x02c6 }, /* Ccircumflex Ĉ LATIN CAPITAL LETTER C WITH CIRCUMFLEX */
+    { 0x0109, 0x02e6 }, /* ccircumflex ĉ LATIN SMALL LETTER C WITH CIRCUMFLEX */
+    { 0x010a, 0x02c5 }, /* Cabovedot Ċ LATIN CAPITAL LETTER C WITH DOT ABOVE */
+    { 0x010b, 0x02e5 }, /* cabovedot ċ LATIN SMALL LETTER C WITH DOT ABOVE */
+    { 0x010c, 0x01c8 }, /* Ccaron Č LATIN CAPITAL LETTER C WITH CARON */
+    { 0x010d, 0x01e8 }, /* ccaron č LATIN SMALL LETTER C WITH CARON */
+    { 0x010e, 0x01cf }, /* Dcaron Ď LATIN CAPITAL LETTER D WITH CARON */
+    { 0x010f, 0x01ef }, /* dcaron ď LATIN SMALL LETTER D WITH CARON */
+    { 0x0110, 0x01d0 }, /* Dstroke Đ LATIN CAPITAL LETTER D WITH STROKE */
+    { 0x0111, 0x01f0 }, /* dstroke đ LATIN SMALL LETTER D WITH STROKE */
+    { 0x0112, 0x03aa }, /* Emacron Ē LATIN CAPITAL LETTER E WITH MACRON */
+    { 0x0113, 0x03ba }, /* emacron ē LATIN SMALL LETTER E WITH MACRON */
+    { 0x0116, 0x03cc }, /* Eabovedot Ė LATIN CAPITAL LETTER E WITH DOT ABOVE */
+    { 0x0117, 0x03ec }, /* eabovedot ė LATIN SMALL LETTER E WITH DOT ABOVE */
+    { 0x0118, 0x01ca }, /* Eogonek Ę LATIN CAPITAL LETTER E WITH OGONEK */
+    { 0x0119, 0x01ea }, /* eogonek ę LATIN SMALL LETTER E WITH OGONEK */
+    { 0x011a, 0x01cc }, /* Ecaron Ě LATIN CAPITAL LETTER E WITH CARON */
+    { 0x011b, 0x01ec }, /* ecaron ě LATIN SMALL LETTER E WITH CARON */
+    { 0x011c, 0x02d8 }, /* Gcircumflex Ĝ LATIN CAPITAL LETTER G WITH CIRCUMFLEX */
+    { 0x011d, 0x02f8 }, /* gcircumflex ĝ LATIN SMALL LETTER G WITH CIRCUMFLEX */
+    { 0x011e, 0x02ab }, /* Gbreve Ğ LATIN CAPITAL LETTER G WITH BREVE */
+    { 0x011f, 0x02bb }, /* gbreve ğ LATIN SMALL LETTER G WITH BREVE */
+    { 0x0120, 0x02d5 }, /* Gabovedot Ġ LATIN CAPITAL LETTER G WITH DOT ABOVE */
+    { 0x0121, 0x02f5 }, /* gabovedot ġ LATIN SMALL LETTER G WITH DOT ABOVE */
+    { 0x0122, 0x03ab }, /* Gcedilla Ģ LATIN CAPITAL LETTER G WITH CEDILLA */
+    { 0x0123, 0x03bb }, /* gcedilla ģ LATIN SMALL LETTER G WITH CEDILLA */
+    { 0x0124, 0x02a6 }, /* Hcircumflex Ĥ LATIN CAPITAL LETTER H WITH CIRCUMFLEX */
+    { 0x0125, 0x02b6 }, /* hcircumflex ĥ LATIN SMALL LETTER H WITH CIRCUMFLEX */
+    { 0x0126, 0x02a1 }, /* Hstroke Ħ LATIN CAPITAL LETTER H WITH STROKE */
+    { 0x0127, 0x02b1 }, /* hstroke ħ LATIN SMALL LETTER H WITH STROKE */
+    { 0x0128, 0x03a5 }, /* Itilde Ĩ LATIN CAPITAL LETTER I WITH TILDE */
+    { 0x0129, 0x03b5 }, /* itilde ĩ LATIN SMALL LETTER I WITH TILDE */
+    { 0x012a, 0x03cf }, /* Imacron Ī LATIN CAPITAL LETTER I WITH MACRON */
+    { 0x012b, 0x03ef }, /* imacron ī LATIN SMALL LETTER I WITH MACRON */
+    { 0x012e, 0x03c7 }, /* Iogonek Į LATIN CAPITAL LETTER I WITH OGONEK */
+    { 0x012f, 0x03e7 }, /* iogonek į LATIN SMALL LETTER I WITH OGONEK */
+    { 0x0130, 0x02a9 }, /* Iabovedot İ LATIN CAPITAL LETTER I WITH DOT ABOVE */
+    { 0x0131, 0x02b9 }, /* idotless ı LATIN SMALL LETTER DOTLESS I */
+    { 0x0134, 0x02ac }, /* Jcircumflex Ĵ LATIN CAPITAL LETTER J WITH CIRCUMFLEX */
+    { 0x0135, 0x02bc }, /* jcircumflex ĵ LATIN SMALL LETTER J WITH CIRCUMFLEX */
+    { 0x0136, 0x03d3 }, /* Kcedilla Ķ LATIN CAPITAL LETTER K WITH CEDILLA */
+    { 0x0137, 0x03f3 }, /* kcedilla ķ LATIN SMALL LETTER K WITH CEDILLA */
+    { 0x0138, 0x03a2 }, /* kra ĸ LATIN SMALL LETTER KRA */
+    { 0x0139, 0x01c5 }, /* Lacute Ĺ LATIN CAPITAL LETTER L WITH ACUTE */
+    { 0x013a, 0x01e5 }, /* lacute ĺ LATIN SMALL LETTER L WITH ACUTE */
+    { 0x013b, 0x03a6 }, /* Lcedilla Ļ LATIN CAPITAL LETTER L WITH CEDILLA */
+    { 0x013c, 0x03b6 }, /* lcedilla ļ LATIN SMALL LETTER L WITH CEDILLA */
+    { 0x013d, 0x01a5 }, /* Lcaron Ľ LATIN CAPITAL LETTER L WITH CARON */
+    { 0x013e, 0x01b5 }, /* lcaron ľ LATIN SMALL LETTER L WITH CARON */
+    { 0x0141, 0x01a3 }, /* Lstroke Ł LATIN CAPITAL LETTER L WITH STROKE */
+    { 0x0142, 0x01b3 }, /* lstroke ł LATIN SMALL LETTER L WITH STROKE */
+    { 0x0143, 0x01d1 }, /* Nacute Ń LATIN CAPITAL LETTER N WITH ACUTE */
+    { 0x0144, 0x01f1 }, /* nacute ń LATIN SMALL LETTER N WITH ACUTE */
+    { 0x0145, 0x03d1 }, /* Ncedilla Ņ LATIN CAPITAL LETTER N WITH CEDILLA */
+    { 0x0146, 0x03f1 }, /* ncedilla ņ LATIN SMALL LETTER N WITH CEDILLA */
+    { 0x0147, 0x01d2 }, /* Ncaron Ň LATIN CAPITAL LETTER N WITH CARON */
+    { 0x0148, 0x01f2 }, /* ncaron ň LATIN SMALL LETTER N WITH CARON */
+    { 0x014a, 0x03bd }, /* ENG Ŋ LATIN CAPITAL LETTER ENG */
+    { 0x014b, 0x03bf }, /* eng ŋ LATIN SMALL LETTER ENG */
+    { 0x014c, 0x03d2 }, /* Omacron Ō LATIN CAPITAL LETTER O WITH MACRON */
+    { 0x014d, 0x03f2 }, /* omacron ō LATIN SMALL LETTER O WITH MACRON */
+    { 0x0150, 0x01d5 }, /* Odoubleacute Ő LATIN CAPITAL LETTER O WITH DOUBLE ACUTE */
+    { 0x0151, 0x01f5 }, /* odoubleacute ő LATIN SMALL LETTER O WITH DOUBLE ACUTE */
+    { 0x0152, 0x13bc }, /* OE Œ LATIN CAPITAL LIGATURE OE */
+    { 0x0153, 0x13bd }, /* oe œ LATIN SMALL LIGATURE OE */
+    { 0x0154, 0x01c0 }, /* Racute Ŕ LATIN CAPITAL LETTER R WITH ACUTE */
+    { 0x0155, 0x01e0 }, /* racute ŕ LATIN SMALL LETTER R WITH ACUTE */
+    { 0x0156, 0x03a3 }, /* Rcedilla Ŗ LATIN CAPITAL LETTER R WITH CEDILLA */
+    { 0x0157, 0x03b3 }, /* rcedilla ŗ LATIN SMALL LETTER R WITH CEDILLA */
+    { 0x0158, 0x01d8 }, /* Rcaron Ř LATIN CAPITAL LETTER R WITH CARON */
+    { 0x0159, 0x01f8 }, /* rcaron ř LATIN SMALL LETTER R WITH CARON */
+    { 0x015a, 0x01a6 }, /* Sacute Ś LATIN CAPITAL LETTER S WITH ACUTE */
+    { 0x015b, 0x01b6 }, /* sacute ś LATIN SMALL LETTER S WITH ACUTE */
+    { 0x015c, 0x02de }, /* Scircumflex Ŝ LATIN CAPITAL LETTER S WITH CIRCUMFLEX */
+    { 0x015d, 0x02fe }, /* scircumflex ŝ LATIN SMALL LETTER S WITH CIRCUMFLEX */
+    { 0x015e, 0x01aa }, /* Scedilla Ş LATIN CAPITAL LETTER S WITH CEDILLA */
+    { 0x015f, 0x01ba }, /* scedilla ş LATIN SMALL LETTER S WITH CEDILLA */
+    { 0x0160, 0x01a9 }, /* Scaron Š LATIN CAPITAL LETTER S WITH CARON */
+    { 0x0161, 0x01b9 }, /* scaron š LATIN SMALL LETTER S WITH CARON */
+    { 0x0162, 0x01de }, /* Tcedilla Ţ LATIN CAPITAL LETTER T WITH CEDILLA */
+    { 0x0163, 0x01fe }, /* tcedilla ţ LATIN SMALL LETTER T WITH CEDILLA */
+    { 0x0164, 0x01ab }, /* Tcaron Ť LATIN CAPITAL LETTER T WITH CARON */
+    { 0x0165, 0x01bb }, /* tcaron ť LATIN SMALL LETTER T WITH CARON */
+    { 0x0166, 0x03ac }, /* Tslash Ŧ LATIN CAPITAL LETTER T WITH STROKE */
+    { 0x0167, 0x03bc }, /* tslash ŧ LATIN SMALL LETTER T WITH STROKE */
+    { 0x0168, 0x03dd }, /* Utilde Ũ LATIN CAPITAL LETTER U WITH TILDE */
+    { 0x0169, 0x03fd }, /* utilde ũ LATIN SMALL LETTER U WITH TILDE */
+    { 0x016a, 0x03de }, /* Umacron Ū LATIN CAPITAL LETTER U WITH MACRON */
+    { 0x016b, 0x03fe }, /* umacron ū LATIN SMALL LETTER U WITH MACRON */
+    { 0x016c, 0x02dd }, /* Ubreve Ŭ LATIN CAPITAL LETTER U WITH BREVE */
+    { 0x016d, 0x02fd }, /* ubreve ŭ LATIN SMALL LETTER U WITH BREVE */
+    { 0x016e, 0x01d9 }, /* Uring Ů LATIN CAPITAL LETTER U WITH RING ABOVE */
+    { 0x016f, 0x01f9 }, /* uring ů LATIN SMALL LETTER U WITH RING ABOVE */
+    { 0x0170, 0x01db }, /* Udoubleacute Ű LATIN CAPITAL LETTER U WITH DOUBLE ACUTE */
+    { 0x0171, 0x01fb }, /* udoubleacute ű LATIN SMALL LETTER U WITH DOUBLE ACUTE */
+    { 0x0172, 0x03d9 }, /* Uogonek Ų LATIN CAPITAL LETTER U WITH OGONEK */
+    { 0x0173, 0x03f9 }, /* uogonek ų LATIN SMALL LETTER U WITH OGONEK */
+    { 0x0178, 0x13be }, /* Ydiaeresis Ÿ LATIN CAPITAL LETTER Y WITH DIAERESIS */
+    { 0x0179, 0x01ac }, /* Zacute Ź LATIN CAPITAL LETTER Z WITH ACUTE */
+    { 0x017a, 0x01bc }, /* zacute ź LATIN SMALL LETTER Z WITH ACUTE */
+    { 0x017b, 0x01af }, /* Zabovedot Ż LATIN CAPITAL LETTER Z WITH DOT ABOVE */
+    { 0x017c, 0x01bf }, /* zabovedot ż LATIN SMALL LETTER Z WITH DOT ABOVE */
+    { 0x017d, 0x01ae }, /* Zcaron Ž LATIN CAPITAL LETTER Z WITH CARON */
+    { 0x017e, 0x01be }, /* zcaron ž LATIN SMALL LETTER Z WITH CARON */
+    { 0x0192, 0x08f6 }, /* function ƒ LATIN SMALL LETTER F WITH HOOK */
+    { 0x02c7, 0x01b7 }, /* caron ˇ CARON */
+    { 0x02d8, 0x01a2 }, /* breve ˘ BREVE */
+    { 0x02d9, 0x01ff }, /* abovedot ˙ DOT ABOVE */
+    { 0x02db, 0x01b2 }, /* ogonek ˛ OGONEK */
+    { 0x02dd, 0x01bd }, /* doubleacute ˝ DOUBLE ACUTE ACCENT */
+    { 0x0385, 0x07ae }, /* Greek_accentdieresis ΅ GREEK DIALYTIKA TONOS */
+    { 0x0386, 0x07a1 }, /* Greek_ALPHAaccent Ά GREEK CAPITAL LETTER ALPHA WITH TONOS */
+    { 0x0388, 0x07a2 }, /* Greek_EPSILONaccent Έ GREEK CAPITAL LETTER EPSILON WITH TONOS */
+    { 0x0389, 0x07a3 }, /* Greek_ETAaccent Ή GREEK CAPITAL LETTER ETA WITH TONOS */
+    { 0x038a, 0x07a4 }, /* Greek_IOTAaccent Ί GREEK CAPITAL LETTER IOTA WITH TONOS */
+    { 0x038c, 0x07a7 }, /* Greek_OMICRONaccent Ό GREEK CAPITAL LETTER OMICRON WITH TONOS */
+    { 0x038e, 0x07a8 }, /* Greek_UPSILONaccent Ύ GREEK CAPITAL LETTER UPSILON WITH TONOS */
+    { 0x038f, 0x07ab }, /* Greek_OMEGAaccent Ώ GREEK CAPITAL LETTER OMEGA WITH TONOS */
+    { 0x0390, 0x07b6 }, /* Greek_iotaaccentdieresis ΐ GREEK SMALL LETTER IOTA WITH DIALYTIKA AND TONOS */
+    { 0x0391, 0x07c1 }, /* Greek_ALPHA Α GREEK CAPITAL LETTER ALPHA */
+    { 0x0392, 0x07c2 }, /* Greek_BETA Β GREEK CAPITAL LETTER BETA */
+    { 0x0393, 0x07c3 }, /* Greek_GAMMA Γ GREEK CAPITAL LETTER GAMMA */
+    { 0x0394, 0x07c4 }, /* Greek_DELTA Δ GREEK CAPITAL LETTER DELTA */
+    { 0x0395, 0x07c5 }, /* Greek_EPSILON Ε GREEK CAPITAL LETTER EPSILON */
+    { 0x0396, 0x07c6 }, /* Greek_ZETA Ζ GREEK CAPITAL LETTER ZETA */
+    { 0x0397, 0x07c7 }, /* Greek_ETA Η GREEK CAPITAL LETTER ETA */
+    { 0x0398, 0x07c8 }, /* Greek_THETA Θ GREEK CAPITAL LETTER THETA */
+    { 0x0399, 0x07c9 }, /* Greek_IOTA Ι GREEK CAPITAL LETTER IOTA */
+    { 0x039a, 0x07ca }, /* Greek_KAPPA Κ GREEK CAPITAL LETTER KAPPA */
+    { 0x039b, 0x07cb }, /* Greek_LAMBDA Λ GREEK CAPITAL LETTER LAMDA */
+    { 0x039c, 0x07cc }, /* Greek_MU Μ GREEK CAPITAL LETTER MU */
+    { 0x039d, 0x07cd }, /* Greek_NU Ν GREEK CAPITAL LETTER NU */
+    { 0x039e, 0x07ce }, /* Greek_XI Ξ GREEK CAPITAL LETTER XI */
+    { 0x039f, 0x07cf }, /* Greek_OMICRON Ο GREEK CAPITAL LETTER OMICRON */
+    { 0x03a0, 0x07d0 }, /* Greek_PI Π GREEK CAPITAL LETTER PI */
+    { 0x03a1, 0x07d1 }, /* Greek_RHO Ρ GREEK CAPITAL LETTER RHO */
+    { 0x03a3, 0x07d2 }, /* Greek_SIGMA Σ GREEK CAPITAL LETTER SIGMA */
+    { 0x03a4, 0x07d4 }, /* Greek_TAU Τ GREEK CAPITAL LETTER TAU */
+    { 0x03a5, 0x07d5 }, /* Greek_UPSILON Υ GREEK CAPITAL LETTER UPSILON */
+    { 0x03a6, 0x07d6 }, /* Greek_PHI Φ GREEK CAPITAL LETTER PHI */
+    { 0x03a7, 0x07d7 }, /* Greek_CHI Χ GREEK CAPITAL LETTER CHI */
+    { 0x03a8, 0x07d8 }, /* Greek_PSI Ψ GREEK CAPITAL LETTER PSI */
+    { 0x03a9, 0x07d9 }, /* Greek_OMEGA Ω GREEK CAPITAL LETTER OMEGA */
+    { 0x03aa, 0x07a5 }, /* Greek_IOTAdiaeresis Ϊ GREEK CAPITAL LETTER IOTA WITH DIALYTIKA */
+    { 0x03ab, 0x07a9 }, /* Greek_UPSILONdieresis Ϋ GREEK CAPITAL LETTER UPSILON WITH DIALYTIKA */
+    { 0x03ac, 0x07b1 }, /* Greek_alphaaccent ά GREEK SMALL LETTER ALPHA WITH TONOS */
+    { 0x03ad, 0x07b2 }, /* Greek_epsilonaccent έ GREEK SMALL LETTER EPSILON WITH TONOS */
+    { 0x03ae, 0x07b3 }, /* Greek_etaaccent ή GREEK SMALL LETTER ETA WITH TONOS */
+    { 0x03af, 0x07b4 }, /* Greek_iotaaccent ί GREEK SMALL LETTER IOTA WITH TONOS */
+    { 0x03b0, 0x07ba }, /* Greek_upsilonaccentdieresis ΰ GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND TONOS */
+    { 0x03b1, 0x07e1 }, /* Greek_alpha α GREEK SMALL LETTER ALPHA */
+    { 0x03b2, 0x07e2 }, /* Greek_beta β GREEK SMALL LETTER BETA */
+    { 0x03b3, 0x07e3 }, /* Greek_gamma γ GREEK SMALL LETTER GAMMA */
+    { 0x03b4, 0x07e4 }, /* Greek_delta δ GREEK SMALL LETTER DELTA */
+    { 0x03b5, 0x07e5 }, /* Greek_epsilon ε GREEK SMALL LETTER EPSILON */
+    { 0x03b6, 0x07e6 }, /* Greek_zeta ζ GREEK SMALL LETTER ZETA */
+    { 0x03b7, 0x07e7 }, /* Greek_eta η GREEK SMALL LETTER ETA */
+    { 0x03b8, 0x07e8 }, /* Greek_theta θ GREEK SMALL LETTER THETA */
+    { 0x03b9, 0x07e9 }, /* Greek_iota ι GREEK SMALL LETTER IOTA */
+    { 0x03ba, 0x07ea }, /* Greek_kappa κ GREEK SMALL LETTER KAPPA */
+    { 0x03bb, 0x07eb }, /* Greek_lambda λ GREEK SMALL LETTER LAMDA */
+    { 0x03bc, 0x07ec }, /* Greek_mu μ GREEK SMALL LETTER MU */
+    { 0x03bd, 0x07ed }, /* Greek_nu ν GREEK SMALL LETTER NU */
+    { 0x03be, 0x07ee }, /* Greek_xi ξ GREEK SMALL LETTER XI */
+    { 0x03bf, 0x07ef }, /* Greek_omicron ο GREEK SMALL LETTER OMICRON */
+    { 0x03c0, 0x07f0 }, /* Greek_pi π GREEK SMALL LETTER PI */
+    { 0x03c1, 0x07f1 }, /* Greek_rho ρ GREEK SMALL LETTER RHO */
+    { 0x03c2, 0x07f3 }, /* Greek_finalsmallsigma ς GREEK SMALL LETTER FINAL SIGMA */
+    { 0x03c3, 0x07f2 }, /* Greek_sigma σ GREEK SMALL LETTER SIGMA */
+    { 0x03c4, 0x07f4 }, /* Greek_tau τ GREEK SMALL LETTER TAU */
+    { 0x03c5, 0x07f5 }, /* Greek_upsilon υ GREEK SMALL LETTER UPSILON */
+    { 0x03c6, 0x07f6 }, /* Greek_phi φ GREEK SMALL LETTER PHI */
+    { 0x03c7, 0x07f7 }, /* Greek_chi χ GREEK SMALL LETTER CHI */
+    { 0x03c8, 0x07f8 }, /* Greek_psi ψ GREEK SMALL LETTER PSI */
+    { 0x03c9, 0x07f9 }, /* Greek_omega ω GREEK SMALL LETTER OMEGA */
+    { 0x03ca, 0x07b5 }, /* Greek_iotadieresis ϊ GREEK SMALL LETTER IOTA WITH DIALYTIKA */
+    { 0x03cb, 0x07b9 }, /* Greek_upsilondieresis ϋ GREEK SMALL LETTER UPSILON WITH DIALYTIKA */
+    { 0x03cc, 0x07b7 }, /* Greek_omicronaccent ό GREEK SMALL LETTER OMICRON WITH TONOS */
+    { 0x03cd, 0x07b8 }, /* Greek_upsilonaccent ύ GREEK SMALL LETTER UPSILON WITH TONOS */
+    { 0x03ce, 0x07bb }, /* Greek_omegaaccent ώ GREEK SMALL LETTER OMEGA WITH TONOS */
+    { 0x0401, 0x06b3 }, /* Cyrillic_IO Ё CYRILLIC CAPITAL LETTER IO */
+    { 0x0402, 0x06b1 }, /* Serbian_DJE Ђ CYRILLIC CAPITAL LETTER DJE */
+    { 0x0403, 0x06b2 }, /* Macedonia_GJE Ѓ CYRILLIC CAPITAL LETTER GJE */
+    { 0x0404, 0x06b4 }, /* Ukrainian_IE Є CYRILLIC CAPITAL LETTER UKRAINIAN IE */
+    { 0x0405, 0x06b5 }, /* Macedonia_DSE Ѕ CYRILLIC CAPITAL LETTER DZE */
+    { 0x0406, 0x06b6 }, /* Ukrainian_I І CYRILLIC CAPITAL LETTER BYELORUSSIAN-UKRAINIAN I */
+    { 0x0407, 0x06b7 }, /* Ukrainian_YI Ї CYRILLIC CAPITAL LETTER YI */
+    { 0x0408, 0x06b8 }, /* Cyrillic_JE Ј CYRILLIC CAPITAL LETTER JE */
+    { 0x0409, 0x06b9 }, /* Cyrillic_LJE Љ CYRILLIC CAPITAL LETTER LJE */
+    { 0x040a, 0x06ba }, /* Cyrillic_NJE Њ CYRILLIC CAPITAL LETTER NJE */
+    { 0x040b, 0x06bb }, /* Serbian_TSHE Ћ CYRILLIC CAPITAL LETTER TSHE */
+    { 0x040c, 0x06bc }, /* Macedonia_KJE Ќ CYRILLIC CAPITAL LETTER KJE */
+    { 0x040e, 0x06be }, /* Byelorussian_SHORTU Ў CYRILLIC CAPITAL LETTER SHORT U */
+    { 0x040f, 0x06bf }, /* Cyrillic_DZHE Џ CYRILLIC CAPITAL LETTER DZHE */
+    { 0x0410, 0x06e1 }, /* Cyrillic_A А CYRILLIC CAPITAL LETTER A */
+    { 0x0411, 0x06e2 }, /* Cyrillic_BE Б CYRILLIC CAPITAL LETTER BE */
+    { 0x0412, 0x06f7 }, /* Cyrillic_VE В CYRILLIC CAPITAL LETTER VE */
+    { 0x0413, 0x06e7 }, /* Cyrillic_GHE Г CYRILLIC CAPITAL LETTER GHE */
+    { 0x0414, 0x06e4 }, /* Cyrillic_DE Д CYRILLIC CAPITAL LETTER DE */
+    { 0x0415, 0x06e5 }, /* Cyrillic_IE Е CYRILLIC CAPITAL LETTER IE */
+    { 0x0416, 0x06f6 }, /* Cyrillic_ZHE Ж CYRILLIC CAPITAL LETTER ZHE */
+    { 0x0417, 0x06fa }, /* Cyrillic_ZE З CYRILLIC CAPITAL LETTER ZE */
+    { 0x0418, 0x06e9 }, /* Cyrillic_I И CYRILLIC CAPITAL LETTER I */
+    { 0x0419, 0x06ea }, /* Cyrillic_SHORTI Й CYRILLIC CAPITAL LETTER SHORT I */
+    { 0x041a, 0x06eb }, /* Cyrillic_KA К CYRILLIC CAPITAL LETTER KA */
+    { 0x041b, 0x06ec }, /* Cyrillic_EL Л CYRILLIC CAPITAL LETTER EL */
+    { 0x041c, 0x06ed }, /* Cyrillic_EM М CYRILLIC CAPITAL LETTER EM */
+    { 0x041d, 0x06ee }, /* Cyrillic_EN Н CYRILLIC CAPITAL LETTER EN */
+    { 0x041e, 0x06ef }, /* Cyrillic_O О CYRILLIC CAPITAL LETTER O */
+    { 0x041f, 0x06f0 }, /* Cyrillic_PE П CYRILLIC CAPITAL LETTER PE */
+    { 0x0420, 0x06f2 }, /* Cyrillic_ER Р CYRILLIC CAPITAL LETTER ER */
+    { 0x0421, 0x06f3 }, /* Cyrillic_ES С CYRILLIC CAPITAL LETTER ES */
+    { 0x0422, 0x06f4 }, /* Cyrillic_TE Т CYRILLIC CAPITAL LETTER TE */
+    { 0x0423, 0x06f5 }, /* Cyrillic_U У CYRILLIC CAPITAL LETTER U */
+    { 0x0424, 0x06e6 }, /* Cyrillic_EF Ф CYRILLIC CAPITAL LETTER EF */
+    { 0x0425, 0x06e8 }, /* Cyrillic_HA Х CYRILLIC CAPITAL LETTER HA */
+    { 0x0426, 0x06e3 }, /* Cyrillic_TSE Ц CYRILLIC CAPITAL LETTER TSE */
+    { 0x0427, 0x06fe }, /* Cyrillic_CHE Ч CYRILLIC CAPITAL LETTER CHE */
+    { 0x0428, 0x06fb }, /* Cyrillic_SHA Ш CYRILLIC CAPITAL LETTER SHA */
+    { 0x0429, 0x06fd }, /* Cyrillic_SHCHA Щ CYRILLIC CAPITAL LETTER SHCHA */
+    { 0x042a, 0x06ff }, /* Cyrillic_HARDSIGN Ъ CYRILLIC CAPITAL LETTER HARD SIGN */
+    { 0x042b, 0x06f9 }, /* Cyrillic_YERU Ы CYRILLIC CAPITAL LETTER YERU */
+    { 0x042c, 0x06f8 }, /* Cyrillic_SOFTSIGN Ь CYRILLIC CAPITAL LETTER SOFT SIGN */
+    { 0x042d, 0x06fc }, /* Cyrillic_E Э CYRILLIC CAPITAL LETTER E */
+    { 0x042e, 0x06e0 }, /* Cyrillic_YU Ю CYRILLIC CAPITAL LETTER YU */
+    { 0x042f, 0x06f1 }, /* Cyrillic_YA Я CYRILLIC CAPITAL LETTER YA */
+    { 0x0430, 0x06c1 }, /* Cyrillic_a а CYRILLIC SMALL LETTER A */
+    { 0x0431, 0x06c2 }, /* Cyrillic_be б CYRILLIC SMALL LETTER BE */
+    { 0x0432, 0x06d7 }, /* Cyrillic_ve в CYRILLIC SMALL LETTER VE */
+    { 0x0433, 0x06c7 }, /* Cyrillic_ghe г CYRILLIC SMALL LETTER GHE */
+    { 0x0434, 0x06c4 }, /* Cyrillic_de д CYRILLIC SMALL LETTER DE */
+    { 0x0435, 0x06c5 }, /* Cyrillic_ie е CYRILLIC SMALL LETTER IE */
+    { 0x0436, 0x06d6 }, /* Cyrillic_zhe ж CYRILLIC SMALL LETTER ZHE */
+    { 0x0437, 0x06da }, /* Cyrillic_ze з CYRILLIC SMALL LETTER ZE */
+    { 0x0438, 0x06c9 }, /* Cyrillic_i и CYRILLIC SMALL LETTER I */
+    { 0x0439, 0x06ca }, /* Cyrillic_shorti й CYRILLIC SMALL LETTER SHORT I */
+    { 0x043a, 0x06cb }, /* Cyrillic_ka к CYRILLIC SMALL LETTER KA */
+    { 0x043b, 0x06cc }, /* Cyrillic_el л CYRILLIC SMALL LETTER EL */
+    { 0x043c, 0x06cd }, /* Cyrillic_em м CYRILLIC SMALL LETTER EM */
+    { 0x043d, 0x06ce }, /* Cyrillic_en н CYRILLIC SMALL LETTER EN */
+    { 0x043e, 0x06cf }, /* Cyrillic_o о CYRILLIC SMALL LETTER O */
+    { 0x043f, 0x06d0 }, /* Cyrillic_pe п CYRILLIC SMALL LETTER PE */
+    { 0x0440, 0x06d2 }, /* Cyrillic_er р CYRILLIC SMALL LETTER ER */
+    { 0x0441, 0x06d3 }, /* Cyrillic_es с CYRILLIC SMALL LETTER ES */
+    { 0x0442, 0x06d4 }, /* Cyrillic_te т CYRILLIC SMALL LETTER TE */
+    { 0x0443, 0x06d5 }, /* Cyrillic_u у CYRILLIC SMALL LETTER U */
+    { 0x0444, 0x06c6 }, /* Cyrillic_ef ф CYRILLIC SMALL LETTER EF */
+    { 0x0445, 0x06c8 }, /* Cyrillic_ha х CYRILLIC SMALL LETTER HA */
+    { 0x0446, 0x06c3 }, /* Cyrillic_tse ц CYRILLIC SMALL LETTER TSE */
+    { 0x0447, 0x06de }, /* Cyrillic_che ч CYRILLIC SMALL LETTER CHE */
+    { 0x0448, 0x06db }, /* Cyrillic_sha ш CYRILLIC SMALL LETTER SHA */
+    { 0x0449, 0x06dd }, /* Cyrillic_shcha щ CYRILLIC SMALL LETTER SHCHA */
+    { 0x044a, 0x06df }, /* Cyrillic_hardsign ъ CYRILLIC SMALL LETTER HARD SIGN */
+    { 0x044b, 0x06d9 }, /* Cyrillic_yeru ы CYRILLIC SMALL LETTER YERU */
+    { 0x044c, 0x06d8 }, /* Cyrillic_softsign ь CYRILLIC SMALL LETTER SOFT SIGN */
+    { 0x044d, 0x06dc }, /* Cyrillic_e э CYRILLIC SMALL LETTER E */
+    { 0x044e, 0x06c0 }, /* Cyrillic_yu ю CYRILLIC SMALL LETTER YU */
+    { 0x044f, 0x06d1 }, /* Cyrillic_ya я CYRILLIC SMALL LETTER YA */
+    { 0x0451, 0x06a3 }, /* Cyrillic_io ё CYRILLIC SMALL LETTER IO */
+    { 0x0452, 0x06a1 }, /* Serbian_dje ђ CYRILLIC SMALL LETTER DJE */
+    { 0x0453, 0x06a2 }, /* Macedonia_gje ѓ CYRILLIC SMALL LETTER GJE */
+    { 0x0454, 0x06a4 }, /* Ukrainian_ie є CYRILLIC SMALL LETTER UKRAINIAN IE */
+    { 0x0455, 0x06a5 }, /* Macedonia_dse ѕ CYRILLIC SMALL LETTER DZE */
+    { 0x0456, 0x06a6 }, /* Ukrainian_i і CYRILLIC SMALL LETTER BYELORUSSIAN-UKRAINIAN I */
+    { 0x0457, 0x06a7 }, /* Ukrainian_yi ї CYRILLIC SMALL LETTER YI */
+    { 0x0458, 0x06a8 }, /* Cyrillic_je ј CYRILLIC SMALL LETTER JE */
+    { 0x0459, 0x06a9 }, /* Cyrillic_lje љ CYRILLIC SMALL LETTER LJE */
+    { 0x045a, 0x06aa }, /* Cyrillic_nje њ CYRILLIC SMALL LETTER NJE */
+    { 0x045b, 0x06ab }, /* Serbian_tshe ћ CYRILLIC SMALL LETTER TSHE */
+    { 0x045c, 0x06ac }, /* Macedonia_kje ќ CYRILLIC SMALL LETTER KJE */
+    { 0x045e, 0x06ae }, /* Byelorussian_shortu ў CYRILLIC SMALL LETTER SHORT U */
+    { 0x045f, 0x06af }, /* Cyrillic_dzhe џ CYRILLIC SMALL LETTER DZHE */
+    { 0x0490, 0x06bd }, /* Ukrainian_GHE_WITH_UPTURN Ґ CYRILLIC CAPITAL LETTER GHE WITH UPTURN */
+    { 0x0491, 0x06ad }, /* Ukrainian_ghe_with_upturn ґ CYRILLIC SMALL LETTER GHE WITH UPTURN */
+    { 0x05d0, 0x0ce0 }, /* hebrew_aleph א HEBREW LETTER ALEF */
+    { 0x05d1, 0x0ce1 }, /* hebrew_bet ב HEBREW LETTER BET */
+    { 0x05d2, 0x0ce2 }, /* hebrew_gimel ג HEBREW LETTER GIMEL */
+    { 0x05d3, 0x0ce3 }, /* hebrew_dalet ד HEBREW LETTER DALET */
+    { 0x05d4, 0x0ce4 }, /* hebrew_he ה HEBREW LETTER HE */
+    { 0x05d5, 0x0ce5 }, /* hebrew_waw ו HEBREW LETTER VAV */
+    { 0x05d6, 0x0ce6 }, /* hebrew_zain ז HEBREW LETTER ZAYIN */
+    { 0x05d7, 0x0ce7 }, /* hebrew_chet ח HEBREW LETTER HET */
+    { 0x05d8, 0x0ce8 }, /* hebrew_tet ט HEBREW LETTER TET */
+    { 0x05d9, 0x0ce9 }, /* hebrew_yod י HEBREW LETTER YOD */
+    { 0x05da, 0x0cea }, /* hebrew_finalkaph ך HEBREW LETTER FINAL KAF */
+    { 0x05db, 0x0ceb }, /* hebrew_kaph כ HEBREW LETTER KAF */
+    { 0x05dc, 0x0cec }, /* hebrew_lamed ל HEBREW LETTER LAMED */
+    { 0x05dd, 0x0ced }, /* hebrew_finalmem ם HEBREW LETTER FINAL MEM */
+    { 0x05de, 0x0cee }, /* hebrew_mem מ HEBREW LETTER MEM */
+    { 0x05df, 0x0cef }, /* hebrew_finalnun ן HEBREW LETTER FINAL NUN */
+    { 0x05e0, 0x0cf0 }, /* hebrew_nun נ HEBREW LETTER NUN */
+    { 0x05e1, 0x0cf1 }, /* hebrew_samech ס HEBREW LETTER SAMEKH */
+    { 0x05e2, 0x0cf2 }, /* hebrew_ayin ע HEBREW LETTER AYIN */
+    { 0x05e3, 0x0cf3 }, /* hebrew_finalpe ף HEBREW LETTER FINAL PE */
+    { 0x05e4, 0x0cf4 }, /* hebrew_pe פ HEBREW LETTER PE */
+    { 0x05e5, 0x0cf5 }, /* hebrew_finalzade ץ HEBREW LETTER FINAL TSADI */
+    { 0x05e6, 0x0cf6 }, /* hebrew_zade צ HEBREW LETTER TSADI */
+    { 0x05e7, 0x0cf7 }, /* hebrew_qoph ק HEBREW LETTER QOF */
+    { 0x05e8, 0x0cf8 }, /* hebrew_resh ר HEBREW LETTER RESH */
+    { 0x05e9, 0x0cf9 }, /* hebrew_shin ש HEBREW LETTER SHIN */
+    { 0x05ea, 0x0cfa }, /* hebrew_taw ת HEBREW LETTER TAV */
+    { 0x060c, 0x05ac }, /* Arabic_comma ، ARABIC COMMA */
+    { 0x061b, 0x05bb }, /* Arabic_semicolon ؛ ARABIC SEMICOLON */
+    { 0x061f, 0x05bf }, /* Arabic_question_mark ؟ ARABIC QUESTION MARK */
+    { 0x0621, 0x05c1 }, /* Arabic_hamza ء ARABIC LETTER HAMZA */
+    { 0x0622, 0x05c2 }, /* Arabic_maddaonalef آ ARABIC LETTER ALEF WITH MADDA ABOVE */
+    { 0x0623, 0x05c3 }, /* Arabic_hamzaonalef أ ARABIC LETTER ALEF WITH HAMZA ABOVE */
+    { 0x0624, 0x05c4 }, /* Arabic_hamzaonwaw ؤ ARABIC LETTER WAW WITH HAMZA ABOVE */
+    { 0x0625, 0x05c5 }, /* Arabic_hamzaunderalef إ ARABIC LETTER ALEF WITH HAMZA BELOW */
+    { 0x0626, 0x05c6 }, /* Arabic_hamzaonyeh ئ ARABIC LETTER YEH WITH HAMZA ABOVE */
+    { 0x0627, 0x05c7 }, /* Arabic_alef ا ARABIC LETTER ALEF */
+    { 0x0628, 0x05c8 }, /* Arabic_beh ب ARABIC LETTER BEH */
+    { 0x0629, 0x05c9 }, /* Arabic_tehmarbuta ة ARABIC LETTER TEH MARBUTA */
+    { 0x062a, 0x05ca }, /* Arabic_teh ت ARABIC LETTER TEH */
+    { 0x062b, 0x05cb }, /* Arabic_theh ث ARABIC LETTER THEH */
+    { 0x062c, 0x05cc }, /* Arabic_jeem ج ARABIC LETTER JEEM */
+    { 0x062d, 0x05cd }, /* Arabic_hah ح ARABIC LETTER HAH */
+    { 0x062e, 0x05ce }, /* Arabic_khah خ ARABIC LETTER KHAH */
+    { 0x062f, 0x05cf }, /* Arabic_dal د ARABIC LETTER DAL */
+    { 0x0630, 0x05d0 }, /* Arabic_thal ذ ARABIC LETTER THAL */
+    { 0x0631, 0x05d1 }, /* Arabic_ra ر ARABIC LETTER REH */
+    { 0x0632, 0x05d2 }, /* Arabic_zain ز ARABIC LETTER ZAIN */
+    { 0x0633, 0x05d3 }, /* Arabic_seen س ARABIC LETTER SEEN */
+    { 0x0634, 0x05d4 }, /* Arabic_sheen ش ARABIC LETTER SHEEN */
+    { 0x0635, 0x05d5 }, /* Arabic_sad ص ARABIC LETTER SAD */
+    { 0x0636, 0x05d6 }, /* Arabic_dad ض ARABIC LETTER DAD */
+    { 0x0637, 0x05d7 }, /* Arabic_tah ط ARABIC LETTER TAH */
+    { 0x0638, 0x05d8 }, /* Arabic_zah ظ ARABIC LETTER ZAH */
+    { 0x0639, 0x05d9 }, /* Arabic_ain ع ARABIC LETTER AIN */
+    { 0x063a, 0x05da }, /* Arabic_ghain غ ARABIC LETTER GHAIN */
+    { 0x0640, 0x05e0 }, /* Arabic_tatweel ـ ARABIC TATWEEL */
+    { 0x0641, 0x05e1 }, /* Arabic_feh ف ARABIC LETTER FEH */
+    { 0x0642, 0x05e2 }, /* Arabic_qaf ق ARABIC LETTER QAF */
+    { 0x0643, 0x05e3 }, /* Arabic_kaf ك ARABIC LETTER KAF */
+    { 0x0644, 0x05e4 }, /* Arabic_lam ل ARABIC LETTER LAM */
+    { 0x0645, 0x05e5 }, /* Arabic_meem م ARABIC LETTER MEEM */
+    { 0x0646, 0x05e6 }, /* Arabic_noon ن ARABIC LETTER NOON */
+    { 0x0647, 0x05e7 }, /* Arabic_ha ه ARABIC LETTER HEH */
+    { 0x0648, 0x05e8 }, /* Arabic_waw و ARABIC LETTER WAW */
+    { 0x0649, 0x05e9 }, /* Arabic_alefmaksura ى ARABIC LETTER ALEF MAKSURA */
+    { 0x064a, 0x05ea }, /* Arabic_yeh ي ARABIC LETTER YEH */
+    { 0x064b, 0x05eb }, /* Arabic_fathatan ً ARABIC FATHATAN */
+    { 0x064c, 0x05ec }, /* Arabic_dammatan ٌ ARABIC DAMMATAN */
+    { 0x064d, 0x05ed }, /* Arabic_kasratan ٍ ARABIC KASRATAN */
+    { 0x064e, 0x05ee }, /* Arabic_fatha َ ARABIC FATHA */
+    { 0x064f, 0x05ef }, /* Arabic_damma ُ ARABIC DAMMA */
+    { 0x0650, 0x05f0 }, /* Arabic_kasra ِ ARABIC KASRA */
+    { 0x0651, 0x05f1 }, /* Arabic_shadda ّ ARABIC SHADDA */
+    { 0x0652, 0x05f2 }, /* Arabic_sukun ْ ARABIC SUKUN */
+    { 0x0e01, 0x0da1 }, /* Thai_kokai ก THAI CHARACTER KO KAI */
+    { 0x0e02, 0x0da2 }, /* Thai_khokhai ข THAI CHARACTER KHO KHAI */
+    { 0x0e03, 0x0da3 }, /* Thai_khokhuat ฃ THAI CHARACTER KHO KHUAT */
+    { 0x0e04, 0x0da4 }, /* Thai_khokhwai ค THAI CHARACTER KHO KHWAI */
+    { 0x0e05, 0x0da5 }, /* Thai_khokhon ฅ THAI CHARACTER KHO KHON */
+    { 0x0e06, 0x0da6 }, /* Thai_khorakhang ฆ THAI CHARACTER KHO RAKHANG */
+    { 0x0e07, 0x0da7 }, /* Thai_ngongu ง THAI CHARACTER NGO NGU */
+    { 0x0e08, 0x0da8 }, /* Thai_chochan จ THAI CHARACTER CHO CHAN */
+    { 0x0e09, 0x0da9 }, /* Thai_choching ฉ THAI CHARACTER CHO CHING */
+    { 0x0e0a, 0x0daa }, /* Thai_chochang ช THAI CHARACTER CHO CHANG */
+    { 0x0e0b, 0x0dab }, /* Thai_soso ซ THAI CHARACTER SO SO */
+    { 0x0e0c, 0x0dac }, /* Thai_chochoe ฌ THAI CHARACTER CHO CHOE */
+    { 0x0e0d, 0x0dad }, /* Thai_yoying ญ THAI CHARACTER YO YING */
+    { 0x0e0e, 0x0dae }, /* Thai_dochada ฎ THAI CHARACTER DO CHADA */
+    { 0x0e0f, 0x0daf }, /* Thai_topatak ฏ THAI CHARACTER TO PATAK */
+    { 0x0e10, 0x0db0 }, /* Thai_thothan ฐ THAI CHARACTER THO THAN */
+    { 0x0e11, 0x0db1 }, /* Thai_thonangmontho ฑ THAI CHARACTER THO NANGMONTHO */
+    { 0x0e12, 0x0db2 }, /* Thai_thophuthao ฒ THAI CHARACTER THO PHUTHAO */
+    { 0x0e13, 0x0db3 }, /* Thai_nonen ณ THAI CHARACTER NO NEN */
+    { 0x0e14, 0x0db4 }, /* Thai_dodek ด THAI CHARACTER DO DEK */
+    { 0x0e15, 0x0db5 }, /* Thai_totao ต THAI CHARACTER TO TAO */
+    { 0x0e16, 0x0db6 }, /* Thai_thothung ถ THAI CHARACTER THO THUNG */
+    { 0x0e17, 0x0db7 }, /* Thai_thothahan ท THAI CHARACTER THO THAHAN */
+    { 0x0e18, 0x0db8 }, /* Thai_thothong ธ THAI CHARACTER THO THONG */
+    { 0x0e19, 0x0db9 }, /* Thai_nonu น THAI CHARACTER NO NU */
+    { 0x0e1a, 0x0dba }, /* Thai_bobaimai บ THAI CHARACTER BO BAIMAI */
+    { 0x0e1b, 0x0dbb }, /* Thai_popla ป THAI CHARACTER PO PLA */
+    { 0x0e1c, 0x0dbc }, /* Thai_phophung ผ THAI CHARACTER PHO PHUNG */
+    { 0x0e1d, 0x0dbd }, /* Thai_fofa ฝ THAI CHARACTER FO FA */
+    { 0x0e1e, 0x0dbe }, /* Thai_phophan พ THAI CHARACTER PHO PHAN */
+    { 0x0e1f, 0x0dbf }, /* Thai_fofan ฟ THAI CHARACTER FO FAN */
+    { 0x0e20, 0x0dc0 }, /* Thai_phosamphao ภ THAI CHARACTER PHO SAMPHAO */
+    { 0x0e21, 0x0dc1 }, /* Thai_moma ม THAI CHARACTER MO MA */
+    { 0x0e22, 0x0dc2 }, /* Thai_yoyak ย THAI CHARACTER YO YAK */
+    { 0x0e23, 0x0dc3 }, /* Thai_rorua ร THAI CHARACTER RO RUA */
+    { 0x0e24, 0x0dc4 }, /* Thai_ru ฤ THAI CHARACTER RU */
+    { 0x0e25, 0x0dc5 }, /* Thai_loling ล THAI CHARACTER LO LING */
+    { 0x0e26, 0x0dc6 }, /* Thai_lu ฦ THAI CHARACTER LU */
+    { 0x0e27, 0x0dc7 }, /* Thai_wowaen ว THAI CHARACTER WO WAEN */
+    { 0x0e28, 0x0dc8 }, /* Thai_sosala ศ THAI CHARACTER SO SALA */
+    { 0x0e29, 0x0dc9 }, /* Thai_sorusi ษ THAI CHARACTER SO RUSI */
+    { 0x0e2a, 0x0dca }, /* Thai_sosua ส THAI CHARACTER SO SUA */
+    { 0x0e2b, 0x0dcb }, /* Thai_hohip ห THAI CHARACTER HO HIP */
+    { 0x0e2c, 0x0dcc }, /* Thai_lochula ฬ THAI CHARACTER LO CHULA */
+    { 0x0e2d, 0x0dcd }, /* Thai_oang อ THAI CHARACTER O ANG */
+    { 0x0e2e, 0x0dce }, /* Thai_honokhuk ฮ THAI CHARACTER HO NOKHUK */
+    { 0x0e2f, 0x0dcf }, /* Thai_paiyannoi ฯ THAI CHARACTER PAIYANNOI */
+    { 0x0e30, 0x0dd0 }, /* Thai_saraa ะ THAI CHARACTER SARA A */
+    { 0x0e31, 0x0dd1 }, /* Thai_maihanakat ั THAI CHARACTER MAI HAN-AKAT */
+    { 0x0e32, 0x0dd2 }, /* Thai_saraaa า THAI CHARACTER SARA AA */
+    { 0x0e33, 0x0dd3 }, /* Thai_saraam ำ THAI CHARACTER SARA AM */
+    { 0x0e34, 0x0dd4 }, /* Thai_sarai ิ THAI CHARACTER SARA I */
+    { 0x0e35, 0x0dd5 }, /* Thai_saraii ี THAI CHARACTER SARA II */
+    { 0x0e36, 0x0dd6 }, /* Thai_saraue ึ THAI CHARACTER SARA UE */
+    { 0x0e37, 0x0dd7 }, /* Thai_sarauee ื THAI CHARACTER SARA UEE */
+    { 0x0e38, 0x0dd8 }, /* Thai_sarau ุ THAI CHARACTER SARA U */
+    { 0x0e39, 0x0dd9 }, /* Thai_sarauu ู THAI CHARACTER SARA UU */
+    { 0x0e3a, 0x0dda }, /* Thai_phinthu ฺ THAI CHARACTER PHINTHU */
+    { 0x0e3f, 0x0ddf }, /* Thai_baht ฿ THAI CURRENCY SYMBOL BAHT */
+    { 0x0e40, 0x0de0 }, /* Thai_sarae เ THAI CHARACTER SARA E */
+    { 0x0e41, 0x0de1 }, /* Thai_saraae แ THAI CHARACTER SARA AE */
+    { 0x0e42, 0x0de2 }, /* Thai_sarao โ THAI CHARACTER SARA O */
+    { 0x0e43, 0x0de3 }, /* Thai_saraaimaimuan ใ THAI CHARACTER SARA AI MAIMUAN */
+    { 0x0e44, 0x0de4 }, /* Thai_saraaimaimalai ไ THAI CHARACTER SARA AI MAIMALAI */
+    { 0x0e45, 0x0de5 }, /* Thai_lakkhangyao ๅ THAI CHARACTER LAKKHANGYAO */
+    { 0x0e46, 0x0de6 }, /* Thai_maiyamok ๆ THAI CHARACTER MAIYAMOK */
+    { 0x0e47, 0x0de7 }, /* Thai_maitaikhu ็ THAI CHARACTER MAITAIKHU */
+    { 0x0e48, 0x0de8 }, /* Thai_maiek ่ THAI CHARACTER MAI EK */
+    { 0x0e49, 0x0de9 }, /* Thai_maitho ้ THAI CHARACTER MAI THO */
+    { 0x0e4a, 0x0dea }, /* Thai_maitri ๊ THAI CHARACTER MAI TRI */
+    { 0x0e4b, 0x0deb }, /* Thai_maichattawa ๋ THAI CHARACTER MAI CHATTAWA */
+    { 0x0e4c, 0x0dec }, /* Thai_thanthakhat ์ THAI CHARACTER THANTHAKHAT */
+    { 0x0e4d, 0x0ded }, /* Thai_nikhahit ํ THAI CHARACTER NIKHAHIT */
+    { 0x0e50, 0x0df0 }, /* Thai_leksun ๐ THAI DIGIT ZERO */
+    { 0x0e51, 0x0df1 }, /* Thai_leknung ๑ THAI DIGIT ONE */
+    { 0x0e52, 0x0df2 }, /* Thai_leksong ๒ THAI DIGIT TWO */
+    { 0x0e53, 0x0df3 }, /* Thai_leksam ๓ THAI DIGIT THREE */
+    { 0x0e54, 0x0df4 }, /* Thai_leksi ๔ THAI DIGIT FOUR */
+    { 0x0e55, 0x0df5 }, /* Thai_lekha ๕ THAI DIGIT FIVE */
+    { 0x0e56, 0x0df6 }, /* Thai_lekhok ๖ THAI DIGIT SIX */
+    { 0x0e57, 0x0df7 }, /* Thai_lekchet ๗ THAI DIGIT SEVEN */
+    { 0x0e58, 0x0df8 }, /* Thai_lekpaet ๘ THAI DIGIT EIGHT */
+    { 0x0e59, 0x0df9 }, /* Thai_lekkao ๙ THAI DIGIT NINE */
+    { 0x11a8, 0x0ed4 }, /* Hangul_J_Kiyeog ᆨ HANGUL JONGSEONG KIYEOK */
+    { 0x11a9, 0x0ed5 }, /* Hangul_J_SsangKiyeog ᆩ HANGUL JONGSEONG SSANGKIYEOK */
+    { 0x11aa, 0x0ed6 }, /* Hangul_J_KiyeogSios ᆪ HANGUL JONGSEONG KIYEOK-SIOS */
+    { 0x11ab, 0x0ed7 }, /* Hangul_J_Nieun ᆫ HANGUL JONGSEONG NIEUN */
+    { 0x11ac, 0x0ed8 }, /* Hangul_J_NieunJieuj ᆬ HANGUL JONGSEONG NIEUN-CIEUC */
+    { 0x11ad, 0x0ed9 }, /* Hangul_J_NieunHieuh ᆭ HANGUL JONGSEONG NIEUN-HIEUH */
+    { 0x11ae, 0x0eda }, /* Hangul_J_Dikeud ᆮ HANGUL JONGSEONG TIKEUT */
+    { 0x11af, 0x0edb }, /* Hangul_J_Rieul ᆯ HANGUL JONGSEONG RIEUL */
+    { 0x11b0, 0x0edc }, /* Hangul_J_RieulKiyeog ᆰ HANGUL JONGSEONG RIEUL-KIYEOK */
+    { 0x11b1, 0x0edd }, /* Hangul_J_RieulMieum ᆱ HANGUL JONGSEONG RIEUL-MIEUM */
+    { 0x11b2, 0x0ede }, /* Hangul_J_RieulPieub ᆲ HANGUL JONGSEONG RIEUL-PIEUP */
+    { 0x11b3, 0x0edf }, /* Hangul_J_RieulSios ᆳ HANGUL JONGSEONG RIEUL-SIOS */
+    { 0x11b4, 0x0ee0 }, /* Hangul_J_RieulTieut ᆴ HANGUL JONGSEONG RIEUL-THIEUTH */
+    { 0x11b5, 0x0ee1 }, /* Hangul_J_RieulPhieuf ᆵ HANGUL JONGSEONG RIEUL-PHIEUPH */
+    { 0x11b6, 0x0ee2 }, /* Hangul_J_RieulHieuh ᆶ HANGUL JONGSEONG RIEUL-HIEUH */
+    { 0x11b7, 0x0ee3 }, /* Hangul_J_Mieum ᆷ HANGUL JONGSEONG MIEUM */
+    { 0x11b8, 0x0ee4 }, /* Hangul_J_Pieub ᆸ HANGUL JONGSEONG PIEUP */
+    { 0x11b9, 0x0ee5 }, /* Hangul_J_PieubSios ᆹ HANGUL JONGSEONG PIEUP-SIOS */
+    { 0x11ba, 0x0ee6 }, /* Hangul_J_Sios ᆺ HANGUL JONGSEONG SIOS */
+    { 0x11bb, 0x0ee7 }, /* Hangul_J_SsangSios ᆻ HANGUL JONGSEONG SSANGSIOS */
+    { 0x11bc, 0x0ee8 }, /* Hangul_J_Ieung ᆼ HANGUL JONGSEONG IEUNG */
+    { 0x11bd, 0x0ee9 }, /* Hangul_J_Jieuj ᆽ HANGUL JONGSEONG CIEUC */
+    { 0x11be, 0x0eea }, /* Hangul_J_Cieuc ᆾ HANGUL JONGSEONG CHIEUCH */
+    { 0x11bf, 0x0eeb }, /* Hangul_J_Khieuq ᆿ HANGUL JONGSEONG KHIEUKH */
+    { 0x11c0, 0x0eec }, /* Hangul_J_Tieut ᇀ HANGUL JONGSEONG THIEUTH */
+    { 0x11c1, 0x0eed }, /* Hangul_J_Phieuf ᇁ HANGUL JONGSEONG PHIEUPH */
+    { 0x11c2, 0x0eee }, /* Hangul_J_Hieuh ᇂ HANGUL JONGSEONG HIEUH */
+    { 0x11eb, 0x0ef8 }, /* Hangul_J_PanSios ᇫ HANGUL JONGSEONG PANSIOS */
+    { 0x11f0, 0x0ef9 }, /* Hangul_J_KkogjiDalrinIeung ᇰ HANGUL JONGSEONG YESIEUNG */
+    { 0x11f9, 0x0efa }, /* Hangul_J_YeorinHieuh ᇹ HANGUL JONGSEONG YEORINHIEUH */
+    { 0x2002, 0x0aa2 }, /* enspace   EN SPACE */
+    { 0x2003, 0x0aa1 }, /* emspace   EM SPACE */
+    { 0x2004, 0x0aa3 }, /* em3space   THREE-PER-EM SPACE */
+    { 0x2005, 0x0aa4 }, /* em4space   FOUR-PER-EM SPACE */
+    { 0x2007, 0x0aa5 }, /* digitspace   FIGURE SPACE */
+    { 0x2008, 0x0aa6 }, /* punctspace   PUNCTUATION SPACE */
+    { 0x2009, 0x0aa7 }, /* thinspace   THIN SPACE */
+    { 0x200a, 0x0aa8 }, /* hairspace   HAIR SPACE */
+    { 0x2012, 0x0abb }, /* figdash ‒ FIGURE DASH */
+    { 0x2013, 0x0aaa }, /* endash – EN DASH */
+    { 0x2014, 0x0aa9 }, /* emdash — EM DASH */
+    { 0x2015, 0x07af }, /* Greek_horizbar ― HORIZONTAL BAR */
+    { 0x2017, 0x0cdf }, /* hebrew_doublelowline ‗ DOUBLE LOW LINE */
+    { 0x2018, 0x0ad0 }, /* leftsinglequotemark ‘ LEFT SINGLE QUOTATION MARK */
+    { 0x2019, 0x0ad1 }, /* rightsinglequotemark ’ RIGHT SINGLE QUOTATION MARK */
+    { 0x201a, 0x0afd }, /* singlelowquotemark ‚ SINGLE LOW-9 QUOTATION MARK */
+    { 0x201c, 0x0ad2 }, /* leftdoublequotemark “ LEFT DOUBLE QUOTATION MARK */
+    { 0x201d, 0x0ad3 }, /* rightdoublequotemark ” RIGHT DOUBLE QUOTATION MARK */
+    { 0x201e, 0x0afe }, /* doublelowquotemark „ DOUBLE LOW-9 QUOTATION MARK */
+    { 0x2020, 0x0af1 }, /* dagger † DAGGER */
+    { 0x2021, 0x0af2 }, /* doubledagger ‡ DOUBLE DAGGER */
+    { 0x2025, 0x0aaf }, /* doubbaselinedot ‥ TWO DOT LEADER */
+    { 0x2026, 0x0aae }, /* ellipsis … HORIZONTAL ELLIPSIS */
+    { 0x2030, 0x0ad5 }, /* permille ‰ PER MILLE SIGN */
+    { 0x2032, 0x0ad6 }, /* minutes ′ PRIME */
+    { 0x2033, 0x0ad7 }, /* seconds ″ DOUBLE PRIME */
+    { 0x2038, 0x0afc }, /* caret ‸ CARET */
+    { 0x203e, 0x047e }, /* overline ‾ OVERLINE */
+    { 0x20ac, 0x20ac }, /* EuroSign € EURO SIGN */
+    { 0x2105, 0x0ab8 }, /* careof ℅ CARE OF */
+    { 0x2116, 0x06b0 }, /* numerosign № NUMERO SIGN */
+    { 0x2117, 0x0afb }, /* phonographcopyright ℗ SOUND RECORDING COPYRIGHT */
+    { 0x211e, 0x0ad4 }, /* prescription ℞ PRESCRIPTION TAKE */
+    { 0x2122, 0x0ac9 }, /* trademark ™ TRADE MARK SIGN */
+    { 0x2153, 0x0ab0 }, /* onethird ⅓ VULGAR FRACTION ONE THIRD */
+    { 0x2154, 0x0ab1 }, /* twothirds ⅔ VULGAR FRACTION TWO THIRDS */
+    { 0x2155, 0x0ab2 }, /* onefifth ⅕ VULGAR FRACTION ONE FIFTH */
+    { 0x2156, 0x0ab3 }, /* twofifths ⅖ VULGAR FRACTION TWO FIFTHS */
+    { 0x2157, 0x0ab4 }, /* threefifths ⅗ VULGAR FRACTION THREE FIFTHS */
+    { 0x2158, 0x0ab5 }, /* fourfifths ⅘ VULGAR FRACTION FOUR FIFTHS */
+    { 0x2159, 0x0ab6 }, /* onesixth ⅙ VULGAR FRACTION ONE SIXTH */
+    { 0x215a, 0x0ab7 }, /* fivesixths ⅚ VULGAR FRACTION FIVE SIXTHS */
+    { 0x215b, 0x0ac3 }, /* oneeighth ⅛ VULGAR FRACTION ONE EIGHTH */
+    { 0x215c, 0x0ac4 }, /* threeeighths ⅜ VULGAR FRACTION THREE EIGHTHS */
+    { 0x215d, 0x0ac5 }, /* fiveeighths ⅝ VULGAR FRACTION FIVE EIGHTHS */
+    { 0x215e, 0x0ac6 }, /* seveneighths ⅞ VULGAR FRACTION SEVEN EIGHTHS */
+    { 0x2190, 0x08fb }, /* leftarrow ← LEFTWARDS ARROW */
+    { 0x2191, 0x08fc }, /* uparrow ↑ UPWARDS ARROW */
+    { 0x2192, 0x08fd }, /* rightarrow → RIGHTWARDS ARROW */
+    { 0x2193, 0x08fe }, /* downarrow ↓ DOWNWARDS ARROW */
+    { 0x21d2, 0x08ce }, /* implies ⇒ RIGHTWARDS DOUBLE ARROW */
+    { 0x21d4, 0x08cd }, /* ifonlyif ⇔ LEFT RIGHT DOUBLE ARROW */
+    { 0x2202, 0x08ef }, /* partialderivative ∂ PARTIAL DIFFERENTIAL */
+    { 0x2207, 0x08c5 }, /* nabla ∇ NABLA */
+    { 0x2218, 0x0bca }, /* jot ∘ RING OPERATOR */
+    { 0x221a, 0x08d6 }, /* radical √ SQUARE ROOT */
+    { 0x221d, 0x08c1 }, /* variation ∝ PROPORTIONAL TO */
+    { 0x221e, 0x08c2 }, /* infinity ∞ INFINITY */
+    { 0x2227, 0x08de }, /* logicaland ∧ LOGICAL AND */
+    { 0x2228, 0x08df }, /* logicalor ∨ LOGICAL OR */
+    { 0x2229, 0x08dc }, /* intersection ∩ INTERSECTION */
+    { 0x222a, 0x08dd }, /* union ∪ UNION */
+    { 0x222b, 0x08bf }, /* integral ∫ INTEGRAL */
+    { 0x2234, 0x08c0 }, /* therefore ∴ THEREFORE */
+    { 0x223c, 0x08c8 }, /* approximate ∼ TILDE OPERATOR */
+    { 0x2243, 0x08c9 }, /* similarequal ≃ ASYMPTOTICALLY EQUAL TO */
+    { 0x2260, 0x08bd }, /* notequal ≠ NOT EQUAL TO */
+    { 0x2261, 0x08cf }, /* identical ≡ IDENTICAL TO */
+    { 0x2264, 0x08bc }, /* lessthanequal ≤ LESS-THAN OR EQUAL TO */
+    { 0x2265, 0x08be }, /* greaterthanequal ≥ GREATER-THAN OR EQUAL TO */
+    { 0x2282, 0x08da }, /* includedin ⊂ SUBSET OF */
+    { 0x2283, 0x08db }, /* includes ⊃ SUPERSET OF */
+    { 0x22a2, 0x0bfc }, /* righttack ⊢ RIGHT TACK */
+    { 0x22a3, 0x0bdc }, /* lefttack ⊣ LEFT TACK */
+    { 0x22a4, 0x0bc2 }, /* downtack ⊤ DOWN TACK */
+    { 0x22a5, 0x0bce }, /* uptack ⊥ UP TACK */
+    { 0x2308, 0x0bd3 }, /* upstile ⌈ LEFT CEILING */
+    { 0x230a, 0x0bc4 }, /* downstile ⌊ LEFT FLOOR */
+    { 0x2315, 0x0afa }, /* telephonerecorder ⌕ TELEPHONE RECORDER */
+    { 0x2320, 0x08a4 }, /* topintegral ⌠ TOP HALF INTEGRAL */
+    { 0x2321, 0x08a5 }, /* botintegral ⌡ BOTTOM HALF INTEGRAL */
+    { 0x2395, 0x0bcc }, /* quad ⎕ APL FUNCTIONAL SYMBOL QUAD (Unicode 3.0) */
+    { 0x239b, 0x08ab }, /* topleftparens ⎛ ??? */
+    { 0x239d, 0x08ac }, /* botleftparens ⎝ ??? */
+    { 0x239e, 0x08ad }, /* toprightparens ⎞ ??? */
+    { 0x23a0, 0x08ae }, /* botrightparens ⎠ ??? */
+    { 0x23a1, 0x08a7 }, /* topleftsqbracket ⎡ ??? */
+    { 0x23a3, 0x08a8 }, /* botleftsqbracket ⎣ ??? */
+    { 0x23a4, 0x08a9 }, /* toprightsqbracket ⎤ ??? */
+    { 0x23a6, 0x08aa }, /* botrightsqbracket ⎦ ??? */
+    { 0x23a8, 0x08af }, /* leftmiddlecurlybrace ⎨ ??? */
+    { 0x23ac, 0x08b0 }, /* rightmiddlecurlybrace ⎬ ??? */
+    { 0x23b7, 0x08a1 }, /* leftradical ⎷ ??? */
+    { 0x23ba, 0x09ef }, /* horizlinescan1 ⎺ HORIZONTAL SCAN LINE-1 (Unicode 3.2 draft) */
+    { 0x23bb, 0x09f0 }, /* horizlinescan3 ⎻ HORIZONTAL SCAN LINE-3 (Unicode 3.2 draft) */
+    { 0x23bc, 0x09f2 }, /* horizlinescan7 ⎼ HORIZONTAL SCAN LINE-7 (Unicode 3.2 draft) */
+    { 0x23bd, 0x09f3 }, /* horizlinescan9 ⎽ HORIZONTAL SCAN LINE-9 (Unicode 3.2 draft) */
+    { 0x2409, 0x09e2 }, /* ht ␉ SYMBOL FOR HORIZONTAL TABULATION */
+    { 0x240a, 0x09e5 }, /* lf ␊ SYMBOL FOR LINE FEED */
+    { 0x240b, 0x09e9 }, /* vt ␋ SYMBOL FOR VERTICAL TABULATION */
+    { 0x240c, 0x09e3 }, /* ff ␌ SYMBOL FOR FORM FEED */
+    { 0x240d, 0x09e4 }, /* cr ␍ SYMBOL FOR CARRIAGE RETURN */
+    { 0x2424, 0x09e8 }, /* nl ␤ SYMBOL FOR NEWLINE */
+    { 0x2500, 0x09f1 }, /* horizlinescan5 ─ BOX DRAWINGS LIGHT HORIZONTAL */
+    { 0x2502, 0x09f8 }, /* vertbar │ BOX DRAWINGS LIGHT VERTICAL */
+    { 0x250c, 0x09ec }, /* upleftcorner ┌ BOX DRAWINGS LIGHT DOWN AND RIGHT */
+    { 0x2510, 0x09eb }, /* uprightcorner ┐ BOX DRAWINGS LIGHT DOWN AND LEFT */
+    { 0x2514, 0x09ed }, /* lowleftcorner └ BOX DRAWINGS LIGHT UP AND RIGHT */
+    { 0x2518, 0x09ea }, /* lowrightcorner ┘ BOX DRAWINGS LIGHT UP AND LEFT */
+    { 0x251c, 0x09f4 }, /* leftt ├ BOX DRAWINGS LIGHT VERTICAL AND RIGHT */
+    { 0x2524, 0x09f5 }, /* rightt ┤ BOX DRAWINGS LIGHT VERTICAL AND LEFT */
+    { 0x252c, 0x09f7 }, /* topt ┬ BOX DRAWINGS LIGHT DOWN AND HORIZONTAL */
+    { 0x2534, 0x09f6 }, /* bott ┴ BOX DRAWINGS LIGHT UP AND HORIZONTAL */
+    { 0x253c, 0x09ee }, /* crossinglines ┼ BOX DRAWINGS LIGHT VERTICAL AND HORIZONTAL */
+    { 0x2592, 0x09e1 }, /* checkerboard ▒ MEDIUM SHADE */
+    { 0x25c6, 0x09e0 }, /* soliddiamond ◆ BLACK DIAMOND */
+    { 0x25cb, 0x0bcf }, /* circle ○ WHITE CIRCLE */
+    { 0x260e, 0x0af9 }, /* telephone ☎ BLACK TELEPHONE */
+    { 0x2640, 0x0af8 }, /* femalesymbol ♀ FEMALE SIGN */
+    { 0x2642, 0x0af7 }, /* malesymbol ♂ MALE SIGN */
+    { 0x2663, 0x0aec }, /* club ♣ BLACK CLUB SUIT */
+    { 0x2665, 0x0aee }, /* heart ♥ BLACK HEART SUIT */
+    { 0x2666, 0x0aed }, /* diamond ♦ BLACK DIAMOND SUIT */
+    { 0x266d, 0x0af6 }, /* musicalflat ♭ MUSIC FLAT SIGN */
+    { 0x266f, 0x0af5 }, /* musicalsharp ♯ MUSIC SHARP SIGN */
+    { 0x2713, 0x0af3 }, /* checkmark ✓ CHECK MARK */
+    { 0x2717, 0x0af4 }, /* ballotcross ✗ BALLOT X */
+    { 0x271d, 0x0ad9 }, /* latincross ✝ LATIN CROSS */
+    { 0x2720, 0x0af0 }, /* maltesecross ✠ MALTESE CROSS */
+    { 0x3001, 0x04a4 }, /* kana_comma 、 IDEOGRAPHIC COMMA */
+    { 0x3002, 0x04a1 }, /* kana_fullstop 。 IDEOGRAPHIC FULL STOP */
+    { 0x300c, 0x04a2 }, /* kana_openingbracket 「 LEFT CORNER BRACKET */
+    { 0x300d, 0x04a3 }, /* kana_closingbracket 」 RIGHT CORNER BRACKET */
+    { 0x309b, 0x04de }, /* voicedsound ゛ KATAKANA-HIRAGANA VOICED SOUND MARK */
+    { 0x309c, 0x04df }, /* semivoicedsound ゜ KATAKANA-HIRAGANA SEMI-VOICED SOUND MARK */
+    { 0x30a1, 0x04a7 }, /* kana_a ァ KATAKANA LETTER SMALL A */
+    { 0x30a2, 0x04b1 }, /* kana_A ア KATAKANA LETTER A */
+    { 0x30a3, 0x04a8 }, /* kana_i ィ KATAKANA LETTER SMALL I */
+    { 0x30a4, 0x04b2 }, /* kana_I イ KATAKANA LETTER I */
+    { 0x30a5, 0x04a9 }, /* kana_u ゥ KATAKANA LETTER SMALL U */
+    { 0x30a6, 0x04b3 }, /* kana_U ウ KATAKANA LETTER U */
+    { 0x30a7, 0x04aa }, /* kana_e ェ KATAKANA LETTER SMALL E */
+    { 0x30a8, 0x04b4 }, /* kana_E エ KATAKANA LETTER E */
+    { 0x30a9, 0x04ab }, /* kana_o ォ KATAKANA LETTER SMALL O */
+    { 0x30aa, 0x04b5 }, /* kana_O オ KATAKANA LETTER O */
+    { 0x30ab, 0x04b6 }, /* kana_KA カ KATAKANA LETTER KA */
+    { 0x30ad, 0x04b7 }, /* kana_KI キ KATAKANA LETTER KI */
+    { 0x30af, 0x04b8 }, /* kana_KU ク KATAKANA LETTER KU */
+    { 0x30b1, 0x04b9 }, /* kana_KE ケ KATAKANA LETTER KE */
+    { 0x30b3, 0x04ba }, /* kana_KO コ KATAKANA LETTER KO */
+    { 0x30b5, 0x04bb }, /* kana_SA サ KATAKANA LETTER SA */
+    { 0x30b7, 0x04bc }, /* kana_SHI シ KATAKANA LETTER SI */
+    { 0x30b9, 0x04bd }, /* kana_SU ス KATAKANA LETTER SU */
+    { 0x30bb, 0x04be }, /* kana_SE セ KATAKANA LETTER SE */
+    { 0x30bd, 0x04bf }, /* kana_SO ソ KATAKANA LETTER SO */
+    { 0x30bf, 0x04c0 }, /* kana_TA タ KATAKANA LETTER TA */
+    { 0x30c1, 0x04c1 }, /* kana_CHI チ KATAKANA LETTER TI */
+    { 0x30c3, 0x04af }, /* kana_tsu ッ KATAKANA LETTER SMALL TU */
+    { 0x30c4, 0x04c2 }, /* kana_TSU ツ KATAKANA LETTER TU */
+    { 0x30c6, 0x04c3 }, /* kana_TE テ KATAKANA LETTER TE */
+    { 0x30c8, 0x04c4 }, /* kana_TO ト KATAKANA LETTER TO */
+    { 0x30ca, 0x04c5 }, /* kana_NA ナ KATAKANA LETTER NA */
+    { 0x30cb, 0x04c6 }, /* kana_NI ニ KATAKANA LETTER NI */
+    { 0x30cc, 0x04c7 }, /* kana_NU ヌ KATAKANA LETTER NU */
+    { 0x30cd, 0x04c8 }, /* kana_NE ネ KATAKANA LETTER NE */
+    { 0x30ce, 0x04c9 }, /* kana_NO ノ KATAKANA LETTER NO */
+    { 0x30cf, 0x04ca }, /* kana_HA ハ KATAKANA LETTER HA */
+    { 0x30d2, 0x04cb }, /* kana_HI ヒ KATAKANA LETTER HI */
+    { 0x30d5, 0x04cc }, /* kana_FU フ KATAKANA LETTER HU */
+    { 0x30d8, 0x04cd }, /* kana_HE ヘ KATAKANA LETTER HE */
+    { 0x30db, 0x04ce }, /* kana_HO ホ KATAKANA LETTER HO */
+    { 0x30de, 0x04cf }, /* kana_MA マ KATAKANA LETTER MA */
+    { 0x30df, 0x04d0 }, /* kana_MI ミ KATAKANA LETTER MI */
+    { 0x30e0, 0x04d1 }, /* kana_MU ム KATAKANA LETTER MU */
+    { 0x30e1, 0x04d2 }, /* kana_ME メ KATAKANA LETTER ME */
+    { 0x30e2, 0x04d3 }, /* kana_MO モ KATAKANA LETTER MO */
+    { 0x30e3, 0x04ac }, /* kana_ya ャ KATAKANA LETTER SMALL YA */
+    { 0x30e4, 0x04d4 }, /* kana_YA ヤ KATAKANA LETTER YA */
+    { 0x30e5, 0x04ad }, /* kana_yu ュ KATAKANA LETTER SMALL YU */
+    { 0x30e6, 0x04d5 }, /* kana_YU ユ KATAKANA LETTER YU */
+    { 0x30e7, 0x04ae }, /* kana_yo ョ KATAKANA LETTER SMALL YO */
+    { 0x30e8, 0x04d6 }, /* kana_YO ヨ KATAKANA LETTER YO */
+    { 0x30e9, 0x04d7 }, /* kana_RA ラ KATAKANA LETTER RA */
+    { 0x30ea, 0x04d8 }, /* kana_RI リ KATAKANA LETTER RI */
+    { 0x30eb, 0x04d9 }, /* kana_RU ル KATAKANA LETTER RU */
+    { 0x30ec, 0x04da }, /* kana_RE レ KATAKANA LETTER RE */
+    { 0x30ed, 0x04db }, /* kana_RO ロ KATAKANA LETTER RO */
+    { 0x30ef, 0x04dc }, /* kana_WA ワ KATAKANA LETTER WA */
+    { 0x30f2, 0x04a6 }, /* kana_WO ヲ KATAKANA LETTER WO */
+    { 0x30f3, 0x04dd }, /* kana_N ン KATAKANA LETTER N */
+    { 0x30fb, 0x04a5 }, /* kana_conjunctive ・ KATAKANA MIDDLE DOT */
+    { 0x30fc, 0x04b0 }, /* prolongedsound ー KATAKANA-HIRAGANA PROLONGED SOUND MARK */
+    { 0x3131, 0x0ea1 }, /* Hangul_Kiyeog ㄱ HANGUL LETTER KIYEOK */
+    { 0x3132, 0x0ea2 }, /* Hangul_SsangKiyeog ㄲ HANGUL LETTER SSANGKIYEOK */
+    { 0x3133, 0x0ea3 }, /* Hangul_KiyeogSios ㄳ HANGUL LETTER KIYEOK-SIOS */
+    { 0x3134, 0x0ea4 }, /* Hangul_Nieun ㄴ HANGUL LETTER NIEUN */
+    { 0x3135, 0x0ea5 }, /* Hangul_NieunJieuj ㄵ HANGUL LETTER NIEUN-CIEUC */
+    { 0x3136, 0x0ea6 }, /* Hangul_NieunHieuh ㄶ HANGUL LETTER NIEUN-HIEUH */
+    { 0x3137, 0x0ea7 }, /* Hangul_Dikeud ㄷ HANGUL LETTER TIKEUT */
+    { 0x3138, 0x0ea8 }, /* Hangul_SsangDikeud ㄸ HANGUL LETTER SSANGTIKEUT */
+    { 0x3139, 0x0ea9 }, /* Hangul_Rieul ㄹ HANGUL LETTER RIEUL */
+    { 0x313a, 0x0eaa }, /* Hangul_RieulKiyeog ㄺ HANGUL LETTER RIEUL-KIYEOK */
+    { 0x313b, 0x0eab }, /* Hangul_RieulMieum ㄻ HANGUL LETTER RIEUL-MIEUM */
+    { 0x313c, 0x0eac }, /* Hangul_RieulPieub ㄼ HANGUL LETTER RIEUL-PIEUP */
+    { 0x313d, 0x0ead }, /* Hangul_RieulSios ㄽ HANGUL LETTER RIEUL-SIOS */
+    { 0x313e, 0x0eae }, /* Hangul_RieulTieut ㄾ HANGUL LETTER RIEUL-THIEUTH */
+    { 0x313f, 0x0eaf }, /* Hangul_RieulPhieuf ㄿ HANGUL LETTER RIEUL-PHIEUPH */
+    { 0x3140, 0x0eb0 }, /* Hangul_RieulHieuh ㅀ HANGUL LETTER RIEUL-HIEUH */
+    { 0x3141, 0x0eb1 }, /* Hangul_Mieum ㅁ HANGUL LETTER MIEUM */
+    { 0x3142, 0x0eb2 }, /* Hangul_Pieub ㅂ HANGUL LETTER PIEUP */
+    { 0x3143, 0x0eb3 }, /* Hangul_SsangPieub ㅃ HANGUL LETTER SSANGPIEUP */
+    { 0x3144, 0x0eb4 }, /* Hangul_PieubSios ㅄ HANGUL LETTER PIEUP-SIOS */
+    { 0x3145, 0x0eb5 }, /* Hangul_Sios ㅅ HANGUL LETTER SIOS */
+    { 0x3146, 0x0eb6 }, /* Hangul_SsangSios ㅆ HANGUL LETTER SSANGSIOS */
+    { 0x3147, 0x0eb7 }, /* Hangul_Ieung ㅇ HANGUL LETTER IEUNG */
+    { 0x3148, 0x0eb8 }, /* Hangul_Jieuj ㅈ HANGUL LETTER CIEUC */
+    { 0x3149, 0x0eb9 }, /* Hangul_SsangJieuj ㅉ HANGUL LETTER SSANGCIEUC */
+    { 0x314a, 0x0eba }, /* Hangul_Cieuc ㅊ HANGUL LETTER CHIEUCH */
+    { 0x314b, 0x0ebb }, /* Hangul_Khieuq ㅋ HANGUL LETTER KHIEUKH */
+    { 0x314c, 0x0ebc }, /* Hangul_Tieut ㅌ HANGUL LETTER THIEUTH */
+    { 0x314d, 0x0ebd }, /* Hangul_Phieuf ㅍ HANGUL LETTER PHIEUPH */
+    { 0x314e, 0x0ebe }, /* Hangul_Hieuh ㅎ HANGUL LETTER HIEUH */
+    { 0x314f, 0x0ebf }, /* Hangul_A ㅏ HANGUL LETTER A */
+    { 0x3150, 0x0ec0 }, /* Hangul_AE ㅐ HANGUL LETTER AE */
+    { 0x3151, 0x0ec1 }, /* Hangul_YA ㅑ HANGUL LETTER YA */
+    { 0x3152, 0x0ec2 }, /* Hangul_YAE ㅒ HANGUL LETTER YAE */
+    { 0x3153, 0x0ec3 }, /* Hangul_EO ㅓ HANGUL LETTER EO */
+    { 0x3154, 0x0ec4 }, /* Hangul_E ㅔ HANGUL LETTER E */
+    { 0x3155, 0x0ec5 }, /* Hangul_YEO ㅕ HANGUL LETTER YEO */
+    { 0x3156, 0x0ec6 }, /* Hangul_YE ㅖ HANGUL LETTER YE */
+    { 0x3157, 0x0ec7 }, /* Hangul_O ㅗ HANGUL LETTER O */
+    { 0x3158, 0x0ec8 }, /* Hangul_WA ㅘ HANGUL LETTER WA */
+    { 0x3159, 0x0ec9 }, /* Hangul_WAE ㅙ HANGUL LETTER WAE */
+    { 0x315a, 0x0eca }, /* Hangul_OE ㅚ HANGUL LETTER OE */
+    { 0x315b, 0x0ecb }, /* Hangul_YO ㅛ HANGUL LETTER YO */
+    { 0x315c, 0x0ecc }, /* Hangul_U ㅜ HANGUL LETTER U */
+    { 0x315d, 0x0ecd }, /* Hangul_WEO ㅝ HANGUL LETTER WEO */
+    { 0x315e, 0x0ece }, /* Hangul_WE ㅞ HANGUL LETTER WE */
+    { 0x315f, 0x0ecf }, /* Hangul_WI ㅟ HANGUL LETTER WI */
+    { 0x3160, 0x0ed0 }, /* Hangul_YU ㅠ HANGUL LETTER YU */
+    { 0x3161, 0x0ed1 }, /* Hangul_EU ㅡ HANGUL LETTER EU */
+    { 0x3162, 0x0ed2 }, /* Hangul_YI ㅢ HANGUL LETTER YI */
+    { 0x3163, 0x0ed3 }, /* Hangul_I ㅣ HANGUL LETTER I */
+    { 0x316d, 0x0eef }, /* Hangul_RieulYeorinHieuh ㅭ HANGUL LETTER RIEUL-YEORINHIEUH */
+    { 0x3171, 0x0ef0 }, /* Hangul_SunkyeongeumMieum ㅱ HANGUL LETTER KAPYEOUNMIEUM */
+    { 0x3178, 0x0ef1 }, /* Hangul_SunkyeongeumPieub ㅸ HANGUL LETTER KAPYEOUNPIEUP */
+    { 0x317f, 0x0ef2 }, /* Hangul_PanSios ㅿ HANGUL LETTER PANSIOS */
+    { 0x3181, 0x0ef3 }, /* Hangul_KkogjiDalrinIeung ㆁ HANGUL LETTER YESIEUNG */
+    { 0x3184, 0x0ef4 }, /* Hangul_SunkyeongeumPhieuf ㆄ HANGUL LETTER KAPYEOUNPHIEUPH */
+    { 0x3186, 0x0ef5 }, /* Hangul_YeorinHieuh ㆆ HANGUL LETTER YEORINHIEUH */
+    { 0x318d, 0x0ef6 }, /* Hangul_AraeA ㆍ HANGUL LETTER ARAEA */
+    { 0x318e, 0x0ef7 }, /* Hangul_AraeAE ㆎ HANGUL LETTER ARAEAE */
+};
+
+/*
+ * Keysym -> index in `keysymtab`, for keysyms in the range
+ * [0, KEYSYMTAB_MAX_KEYSYM]. Index 0 is the sentinel entry with no Unicode
+ * representation.
+ */
+#define KEYSYMTAB_MAX_KEYSYM 0x20ac
+
+static const uint16_t keysymtab_offsets1[1320] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0001, 0x0002, 0x0003, 0x0000, 0x0004, 0x0005, 0x0000, 0x0000,
+    0x0006, 0x0007, 0x0008, 0x0009, 0x0000, 0x000a, 0x000b, 0x0000,
+    0x000c, 0x000d, 0x000e, 0x0000, 0x000f, 0x0010, 0x0011, 0x0000,
+    0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019,
+    0x0000, 0x0000, 0x001a, 0x0000, 0x001b, 0x001c, 0x0000, 0x001d,
+    0x0000, 0x001e, 0x0000, 0x001f, 0x0000, 0x0000, 0x0020, 0x0021,
+    0x0022, 0x0023, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000, 0x0025,
+    0x0026, 0x0000, 0x0027, 0x0000, 0x0000, 0x0028, 0x0000, 0x0029,
+    0x0000, 0x0000, 0x002a, 0x0000, 0x002b, 0x002c, 0x0000, 0x002d,
+    0x0000, 0x002e, 0x0000, 0x002f, 0x0000, 0x0000, 0x0030, 0x0031,
+    0x0032, 0x0033, 0x0000, 0x0000, 0x0034, 0x0000, 0x0000, 0x0035,
+    0x0036, 0x0000, 0x0037, 0x0000, 0x0000, 0x0038, 0x0039, 0x0000,
+    0x003a, 0x0000, 0x0000, 0x0000, 0x0000, 0x003b, 0x0000, 0x0000,
+    0x003c, 0x0000, 0x003d, 0x003e, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x003f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0000, 0x0000,
+    0x0041, 0x0000, 0x0042, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0044, 0x0045, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0046, 0x0000, 0x0000, 0x0047, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0048, 0x0049, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x004a, 0x004b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x004c, 0x0000, 0x0000, 0x004d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x004e, 0x004f, 0x0000, 0x0000, 0x0050, 0x0051, 0x0000, 0x0052,
+    0x0053, 0x0000, 0x0000, 0x0000, 0x0054, 0x0055, 0x0056, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0057, 0x0000, 0x0058,
+    0x0059, 0x0000, 0x0000, 0x0000, 0x005a, 0x005b, 0x005c, 0x005d,
+    0x0000, 0x005e, 0x005f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0061, 0x0000,
+    0x0000, 0x0062, 0x0000, 0x0063, 0x0064, 0x0065, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0066, 0x0000, 0x0000, 0x0000, 0x0067,
+    0x0068, 0x0000, 0x0069, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x006a, 0x0000, 0x0000, 0x0000, 0x0000, 0x006b, 0x0000,
+    0x0000, 0x006c, 0x0000, 0x006d, 0x006e, 0x006f, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0070, 0x0000, 0x0000, 0x0000, 0x0071,
+    0x0072, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0073,
+    0x0000, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a,
+    0x007b, 0x007c, 0x007d, 0x007e, 0x007f, 0x0080, 0x0081, 0x0082,
+    0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008a,
+    0x008b, 0x008c, 0x008d, 0x008e, 0x008f, 0x0090, 0x0091, 0x0092,
+    0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009a,
+    0x009b, 0x009c, 0x009d, 0x009e, 0x009f, 0x00a0, 0x00a1, 0x00a2,
+    0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7, 0x00a8, 0x00a9, 0x00aa,
+    0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af, 0x00b0, 0x00b1, 0x00b2,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00b3, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x00b4, 0x0000, 0x0000, 0x0000, 0x00b5,
+    0x0000, 0x00b6, 0x00b7, 0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc,
+    0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4,
+    0x00c5, 0x00c6, 0x00c7, 0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc,
+    0x00cd, 0x00ce, 0x00cf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
+    0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df,
+    0x00e0, 0x00e1, 0x00e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7, 0x00e8, 0x00e9, 0x00ea,
+    0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef, 0x00f0, 0x00f1, 0x00f2,
+    0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7, 0x00f8, 0x00f9, 0x00fa,
+    0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff, 0x0100, 0x0101, 0x0102,
+    0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x0108, 0x0109, 0x010a,
+    0x010b, 0x010c, 0x010d, 0x010e, 0x010f, 0x0110, 0x0111, 0x0112,
+    0x0113, 0x0114, 0x0115, 0x0116, 0x0117, 0x0118, 0x0119, 0x011a,
+    0x011b, 0x011c, 0x011d, 0x011e, 0x011f, 0x0120, 0x0121, 0x0122,
+    0x0123, 0x0124, 0x0125, 0x0126, 0x0127, 0x0128, 0x0129, 0x012a,
+    0x012b, 0x012c, 0x012d, 0x012e, 0x012f, 0x0130, 0x0131, 0x0132,
+    0x0133, 0x0134, 0x0135, 0x0136, 0x0137, 0x0138, 0x0139, 0x013a,
+    0x013b, 0x013c, 0x013d, 0x013e, 0x013f, 0x0140, 0x0141, 0x0000,
+    0x0142, 0x0143, 0x0144, 0x0145, 0x0146, 0x0000, 0x0147, 0x0148,
+    0x0149, 0x0000, 0x014a, 0x0000, 0x0000, 0x014b, 0x014c, 0x0000,
+    0x014d, 0x014e, 0x014f, 0x0150, 0x0151, 0x0152, 0x0153, 0x0154,
+    0x0155, 0x0156, 0x0157, 0x0000, 0x0000, 0x0000, 0x0000, 0x0158,
+    0x0159, 0x015a, 0x015b, 0x015c, 0x015d, 0x015e, 0x015f, 0x0160,
+    0x0161, 0x0162, 0x0163, 0x0164, 0x0165, 0x0166, 0x0167, 0x0168,
+    0x0169, 0x0000, 0x016a, 0x016b, 0x016c, 0x016d, 0x016e, 0x016f,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0170, 0x0171,
+    0x0172, 0x0173, 0x0174, 0x0175, 0x0176, 0x0177, 0x0178, 0x0179,
+    0x017a, 0x017b, 0x017c, 0x017d, 0x017e, 0x017f, 0x0180, 0x0181,
+    0x0182, 0x0183, 0x0184, 0x0185, 0x0186, 0x0187, 0x0188, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0189, 0x018a, 0x018b,
+    0x018c, 0x018d, 0x018e, 0x018f, 0x0190, 0x0191, 0x0192, 0x0193,
+    0x0194, 0x0195, 0x0196, 0x0197, 0x0198, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0199, 0x019a, 0x019b, 0x019c, 0x019d, 0x019e, 0x019f, 0x0000,
+    0x0000, 0x01a0, 0x0000, 0x0000, 0x01a1, 0x01a2, 0x0000, 0x0000,
+    0x0000, 0x01a3, 0x01a4, 0x01a5, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x01a6, 0x0000, 0x0000, 0x0000, 0x01a7, 0x01a8,
+    0x01a9, 0x01aa, 0x01ab, 0x01ac, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x01ad, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x01ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x01af,
+    0x01b0, 0x01b1, 0x01b2, 0x0000, 0x01b3, 0x01b4, 0x01b5, 0x01b6,
+    0x01b7, 0x01b8, 0x0000, 0x0000, 0x01b9, 0x01ba, 0x01bb, 0x01bc,
+    0x01bd, 0x01be, 0x01bf, 0x01c0, 0x01c1, 0x01c2, 0x01c3, 0x01c4,
+    0x01c5, 0x01c6, 0x01c7, 0x01c8, 0x01c9, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01ca, 0x01cb, 0x01cc, 0x01cd,
+    0x01ce, 0x01cf, 0x01d0, 0x01d1, 0x01d2, 0x01d3, 0x0000, 0x01d4,
+    0x0000, 0x01d5, 0x01d6, 0x01d7, 0x01d8, 0x01d9, 0x01da, 0x01db,
+    0x01dc, 0x01dd, 0x01de, 0x01df, 0x0000, 0x0000, 0x01e0, 0x01e1,
+    0x01e2, 0x01e3, 0x0000, 0x0000, 0x0000, 0x01e4, 0x01e5, 0x01e6,
+    0x01e7, 0x0000, 0x0000, 0x01e8, 0x01e9, 0x0000, 0x01ea, 0x01eb,
+    0x01ec, 0x01ed, 0x01ee, 0x01ef, 0x01f0, 0x01f1, 0x01f2, 0x01f3,
+    0x01f4, 0x01f5, 0x0000, 0x01f6, 0x0000, 0x01f7, 0x01f8, 0x01f9,
+    0x01fa, 0x01fb, 0x01fc, 0x01fd, 0x01fe, 0x01ff, 0x0200, 0x0201,
+    0x0202, 0x0203, 0x0204, 0x0205, 0x0206, 0x0207, 0x0208, 0x0209,
+    0x020a, 0x0000, 0x020b, 0x020c, 0x020d, 0x020e, 0x020f, 0x0210,
+    0x0211, 0x0212, 0x0213, 0x0214, 0x0215, 0x0216, 0x0217, 0x0218,
+    0x0219, 0x0000, 0x0000, 0x0000, 0x021a, 0x0000, 0x0000, 0x021b,
+    0x0000, 0x021c, 0x021d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x021e, 0x0000, 0x021f, 0x0220, 0x0221, 0x0000, 0x0222,
+    0x0000, 0x0000, 0x0000, 0x0223, 0x0000, 0x0224, 0x0000, 0x0225,
+    0x0226, 0x0000, 0x0000, 0x0000, 0x0227, 0x0000, 0x0000, 0x0228,
+    0x0000, 0x0229, 0x0000, 0x022a, 0x0000, 0x022b, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x022c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x022d, 0x022e, 0x022f, 0x0230, 0x0231, 0x0232,
+    0x0233, 0x0234, 0x0235, 0x0236, 0x0237, 0x0238, 0x0239, 0x023a,
+    0x023b, 0x023c, 0x023d, 0x023e, 0x023f, 0x0240, 0x0241, 0x0242,
+    0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0249, 0x024a, 0x024b, 0x024c, 0x024d,
+    0x024e, 0x024f, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255,
+    0x0256, 0x0257, 0x0258, 0x0259, 0x025a, 0x025b, 0x025c, 0x025d,
+    0x025e, 0x025f, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265,
+    0x0266, 0x0267, 0x0268, 0x0269, 0x026a, 0x026b, 0x026c, 0x026d,
+    0x026e, 0x026f, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275,
+    0x0276, 0x0277, 0x0278, 0x0279, 0x027a, 0x027b, 0x027c, 0x027d,
+    0x027e, 0x027f, 0x0280, 0x0281, 0x0282, 0x0000, 0x0000, 0x0000,
+    0x0283, 0x0284, 0x0285, 0x0286, 0x0287, 0x0288, 0x0289, 0x028a,
+    0x028b, 0x028c, 0x028d, 0x028e, 0x028f, 0x0290, 0x0291, 0x0292,
+    0x0000, 0x0000, 0x0293, 0x0294, 0x0295, 0x0296, 0x0297, 0x0298,
+    0x0299, 0x029a, 0x029b, 0x029c, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x029d, 0x029e, 0x029f, 0x02a0, 0x02a1, 0x02a2,
+    0x02a3, 0x02a4, 0x02a5, 0x02a6, 0x02a7, 0x02a8, 0x02a9, 0x02aa,
+    0x02ab, 0x02ac, 0x02ad, 0x02ae, 0x02af, 0x02b0, 0x02b1, 0x02b2,
+    0x02b3, 0x02b4, 0x02b5, 0x02b6, 0x02b7, 0x02b8, 0x02b9, 0x02ba,
+    0x02bb, 0x02bc, 0x02bd, 0x02be, 0x02bf, 0x02c0, 0x02c1, 0x02c2,
+    0x02c3, 0x02c4, 0x02c5, 0x02c6, 0x02c7, 0x02c8, 0x02c9, 0x02ca,
+    0x02cb, 0x02cc, 0x02cd, 0x02ce, 0x02cf, 0x02d0, 0x02d1, 0x02d2,
+    0x02d3, 0x02d4, 0x02d5, 0x02d6, 0x02d7, 0x02d8, 0x02d9, 0x02da,
+    0x02db, 0x02dc, 0x02dd, 0x02de, 0x02df, 0x02e0, 0x02e1, 0x02e2,
+    0x02e3, 0x02e4, 0x02e5, 0x02e6, 0x02e7, 0x02e8, 0x02e9, 0x02ea,
+    0x02eb, 0x02ec, 0x02ed, 0x02ee, 0x02ef, 0x02f0, 0x02f1, 0x02f2,
+    0x02f3, 0x02f4, 0x02f5, 0x02f6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x02f7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02f8, 0x02f9, 0x02fa,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x02fb, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};
+
+static const uint16_t keysymtab_offsets2[262] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001f, 0x003f, 0x005f,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x007f, 0x009c, 0x00bb,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00da, 0x00fa, 0x011a,
+    0x0000, 0x0000, 0x0000, 0x0139, 0x0000, 0x0158, 0x0178, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0198, 0x01b8, 0x01d8,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01f7, 0x0217, 0x0237,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0257, 0x0276, 0x0295,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02b4, 0x02d4, 0x02f4,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0314,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0333, 0x0352, 0x0372,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0391, 0x03b1, 0x03ce,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03eb, 0x040b,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x042a, 0x044a, 0x046a,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0489, 0x04a9, 0x04c9,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04e9, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0508,
+};
+
+static inline uint16_t
+get_keysymtab_index(uint32_t ks)
+{
+    return keysymtab_offsets1[keysymtab_offsets2[ks >> 5] + (ks & 0x1f)];
+}
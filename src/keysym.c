@@ -11,6 +11,7 @@
 #include "config.h"
 
 #include <assert.h>
+#include <limits.h>
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -94,6 +95,49 @@ xkb_keysym_get_name(xkb_keysym_t ks, char *buffer, size_t size)
     return snprintf(buffer, size, "0x%08"PRIx32, ks);
 }
 
+int
+xkb_keysyms_get_names(const xkb_keysym_t *keysyms, size_t count,
+                      const char **names, char *arena, size_t arena_size)
+{
+    size_t required = 0;
+    char tmp[XKB_KEYSYM_NAME_MAX_SIZE];
+    for (size_t k = 0; k < count; k++) {
+        const xkb_keysym_t ks = keysyms[k];
+        names[k] = NULL;
+        if (ks > XKB_KEYSYM_MAX)
+            continue;
+
+        /* Explicit names are static strings: no need to copy them */
+        const ssize_t index = find_keysym_index(ks);
+        if (index != -1) {
+            names[k] = get_name(&keysym_to_name[index]);
+            continue;
+        }
+
+        /* Unnamed keysym: format its name in the arena */
+        const int length = (ks >= XKB_KEYSYM_UNICODE_MIN &&
+                            ks <= XKB_KEYSYM_UNICODE_MAX)
+            ? get_unicode_name(ks, tmp, sizeof(tmp))
+            : snprintf(tmp, sizeof(tmp), "0x%08"PRIx32, ks);
+        assert(length > 0 && (size_t) length < sizeof(tmp));
+        if (required + (size_t) length < arena_size) {
+            memcpy(arena + required, tmp, (size_t) length + 1);
+            names[k] = arena + required;
+        }
+        required += (size_t) length + 1;
+        if (required > INT_MAX)
+            return -1;
+    }
+    return (int) required;
+}
+
+const char *
+xkb_keysym_get_canonical_name(xkb_keysym_t ks)
+{
+    const ssize_t index = find_keysym_index(ks);
+    return (index == -1) ? NULL : get_name(&keysym_to_name[index]);
+}
+
 bool
 xkb_keysym_is_assigned(xkb_keysym_t ks)
 {
@@ -236,16 +280,16 @@ parse_keysym_hex(const char *s, uint32_t *out)
     return (count > 0 && s[count] == '\0');
 }
 
+/* Supported flags of the keysym name lookups */
+static const enum xkb_keysym_flags XKB_KEYSYM_FLAGS =
+    XKB_KEYSYM_CASE_INSENSITIVE;
+
 xkb_keysym_t
 xkb_keysym_from_name(const char *name, enum xkb_keysym_flags flags)
 {
-    static const enum xkb_keysym_flags XKB_KEYSYM_FLAGS =
-        XKB_KEYSYM_CASE_INSENSITIVE;
-
     if (flags & ~XKB_KEYSYM_FLAGS)
         return XKB_KEY_NoSymbol;
 
-    const struct name_keysym *entry = NULL;
     char *tmp;
     uint32_t val;
     bool icase = (flags & XKB_KEYSYM_CASE_INSENSITIVE);
@@ -263,48 +307,28 @@ xkb_keysym_from_name(const char *name, enum xkb_keysym_flags flags)
         }
     }
     /*
-    * Find the correct keysym for case-insensitive match.
-    *
-    * The name_to_keysym table is sorted by istrcmp(). So the binary
-    * search may return _any_ of all possible case-insensitive duplicates. The
-    * duplicates are sorted so that the "best" case-insensitive match comes
-    * last. So the code searches the entry and all next entries that match by
-    * case-insensitive comparison and returns the "best" case-insensitive match.
-    *
-    * The "best" case-insensitive match is the lower-case keysym name. Most
-    * keysyms names that only differ by letter-case are keysyms that are
-    * available as “small” and “big” variants. For example:
-    *
-    * - Bicameral scripts: Lower-case and upper-case variants,
-    *   e.g. KEY_a and KEY_A.
-    * - Non-bicameral scripts: e.g. KEY_kana_a and KEY_kana_A.
-    *
-    * There are some exceptions, e.g. `XF86Screensaver` and `XF86ScreenSaver`.
-    */
+     * Find the correct keysym for case-insensitive match.
+     *
+     * There may be multiple case-insensitive duplicates. The case-insensitive
+     * perfect hash maps each case-insensitive name to its "best" match.
+     *
+     * The "best" case-insensitive match is the lower-case keysym name. Most
+     * keysyms names that only differ by letter-case are keysyms that are
+     * available as “small” and “big” variants. For example:
+     *
+     * - Bicameral scripts: Lower-case and upper-case variants,
+     *   e.g. KEY_a and KEY_A.
+     * - Non-bicameral scripts: e.g. KEY_kana_a and KEY_kana_A.
+     *
+     * There are some exceptions, e.g. `XF86Screensaver` and `XF86ScreenSaver`.
+     */
     else {
-        int32_t lo = 0, hi = ARRAY_SIZE(name_to_keysym) - 1;
-        while (hi >= lo) {
-            int32_t mid = (lo + hi) / 2;
-            int cmp = istrcmp(name, get_name(&name_to_keysym[mid]));
-            if (cmp > 0) {
-                lo = mid + 1;
-            } else if (cmp < 0) {
-                hi = mid - 1;
-            } else {
-                entry = &name_to_keysym[mid];
-                break;
-            }
-        }
-        if (entry) {
-            const struct name_keysym *last;
-            last = name_to_keysym + ARRAY_SIZE(name_to_keysym) - 1;
-            /* Keep going until we reach end of array
-             * or non case-insensitve match */
-            while (entry < last &&
-                   istrcmp(get_name(entry + 1), get_name(entry)) == 0) {
-                entry++;
-            }
-            return entry->keysym;
+        const size_t pos = keysym_name_icase_perfect_hash(name);
+        if (pos < ARRAY_SIZE(name_to_keysym_icase)) {
+            const struct name_keysym * const entry =
+                &name_to_keysym[name_to_keysym_icase[pos]];
+            if (istrcmp(name, get_name(entry)) == 0)
+                return entry->keysym;
         }
     }
 
@@ -356,6 +380,24 @@ xkb_keysym_from_name(const char *name, enum xkb_keysym_flags flags)
     return XKB_KEY_NoSymbol;
 }
 
+int
+xkb_keysyms_from_names(const char * const *names, size_t count,
+                       enum xkb_keysym_flags flags, xkb_keysym_t *keysyms)
+{
+    if (flags & ~XKB_KEYSYM_FLAGS || count > INT_MAX)
+        return -1;
+
+    int resolved = 0;
+    for (size_t k = 0; k < count; k++) {
+        keysyms[k] = (names[k])
+            ? xkb_keysym_from_name(names[k], flags)
+            : XKB_KEY_NoSymbol;
+        if (keysyms[k] != XKB_KEY_NoSymbol)
+            resolved++;
+    }
+    return resolved;
+}
+
 xkb_keysym_t
 xkb_utf8_to_keysym(const char *buffer, size_t size)
 {
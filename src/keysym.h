@@ -69,6 +69,15 @@ xkb_keysym_is_assigned(xkb_keysym_t ks);
 XKB_EXPORT_PRIVATE int
 xkb_keysym_get_explicit_names(xkb_keysym_t ks, const char **buffer, size_t size);
 
+/**
+ * Get the canonical name of a keysym without copying it.
+ *
+ * Returns NULL if the keysym has no explicit name; see
+ * `xkb_keysym_get_name()` for the fallback representations.
+ */
+const char *
+xkb_keysym_get_canonical_name(xkb_keysym_t ks);
+
 struct xkb_keysym_iterator;
 
 XKB_EXPORT_PRIVATE struct xkb_keysym_iterator*
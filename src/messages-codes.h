@@ -194,6 +194,8 @@ enum xkb_message_code {
     XKB_WARNING_MULTIPLE_GROUPS_AT_ONCE = 700,
     /** A legacy X11 symbol field is not supported */
     XKB_WARNING_UNSUPPORTED_SYMBOLS_FIELD = 711,
+    /** Cannot write the keymap serialization */
+    XKB_ERROR_KEYMAP_SERIALIZATION_WRITE_FAILURE_ = 727,
     /** The keymap has features unsupported in the target format */
     XKB_ERROR_INCOMPATIBLE_KEYMAP_TEXT_FORMAT = 742,
     /** Cannot expand `%%i`: missing layout or variant in MLVO rule fields */
@@ -8,18 +8,20 @@
 #include <assert.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
 #include <libxml/parser.h>
+#include <libxml/SAX2.h>
+#if HAVE_PTHREAD
+#include <pthread.h>
+#endif
 
-#if HAVE_XKB_EXTENSIONS_DIRECTORIES
-    #include <limits.h>
-    #if HAVE_UNISTD_H && HAVE_DIRENT_H
-        #include <dirent.h>
-        #include <unistd.h>
-    #endif
+#if HAVE_XKB_EXTENSIONS_DIRECTORIES && HAVE_UNISTD_H && HAVE_DIRENT_H
+    #include <dirent.h>
+    #include <unistd.h>
 #endif
 
 #include "xkbcommon/xkbregistry.h"
@@ -42,6 +44,43 @@ struct rxkb_object {
     struct list link;
 };
 
+/**
+ * A registry XML file retained in memory, so that the descriptive fields of
+ * its items can be resolved on demand.
+ *
+ * See: `RXKB_CONTEXT_LAZY_DESCRIPTIONS`
+ */
+struct rxkb_xml_file {
+    uint32_t refcount;
+    char *string;
+    size_t size;
+};
+
+/** Location of the “configItem” element of an item to resolve */
+struct rxkb_lazy_item {
+    struct rxkb_xml_file *file; /* NULL if already resolved */
+    size_t start;
+    size_t end;
+};
+
+struct rxkb_index_entry {
+    const char *name;
+    const char *variant; /* Only used for layouts */
+    void *item;
+};
+
+/*
+ * Index of registry items, built once the registry is parsed. The hash table
+ * is an insert-only linear probing hash table for exact lookups, while the
+ * sorted entries enable prefix lookups.
+ */
+struct rxkb_index {
+    struct rxkb_index_entry *table;
+    size_t table_size; /* Power of 2 */
+    struct rxkb_index_entry *sorted;
+    size_t count;
+};
+
 struct rxkb_iso639_code {
     struct rxkb_object base;
     char *code;
@@ -64,6 +103,10 @@ struct rxkb_context {
 
     bool load_extra_rules_files;
     bool use_secure_getenv;
+    bool lazy_descriptions;
+    bool parallel_parsing;
+    /* File being parsed, if its descriptions are resolved lazily */
+    struct rxkb_xml_file *lazy_file;
 
     struct list models;         /* list of struct rxkb_models */
     struct list layouts;        /* list of struct rxkb_layouts */
@@ -71,6 +114,10 @@ struct rxkb_context {
 
     darray(char *) includes;
 
+    struct rxkb_index models_index;
+    struct rxkb_index layouts_index;
+    struct rxkb_index option_groups_index;
+    struct rxkb_index options_index;
 
     ATTR_PRINTF(3, 0) void (*log_fn)(struct rxkb_context *ctx,
                                      enum rxkb_log_level level,
@@ -87,6 +134,7 @@ struct rxkb_model {
     char *vendor;
     char *description;
     enum rxkb_popularity popularity;
+    struct rxkb_lazy_item lazy;
 };
 
 struct rxkb_layout {
@@ -97,6 +145,13 @@ struct rxkb_layout {
     char *description;
     char *variant;
     enum rxkb_popularity popularity;
+    struct rxkb_lazy_item lazy;
+    /*
+     * Base layout to inherit from, if the variant is resolved lazily.
+     * Not refcounted: the context holds a reference to every layout until it
+     * is destroyed, and the variants that outlive it are resolved beforehand.
+     */
+    struct rxkb_layout *lazy_base;
 
     struct list iso639s;  /* list of struct rxkb_iso639_code */
     struct list iso3166s; /* list of struct rxkb_iso3166_code */
@@ -110,6 +165,7 @@ struct rxkb_option_group {
     char *name;
     char *description;
     enum rxkb_popularity popularity;
+    struct rxkb_lazy_item lazy;
 };
 
 struct rxkb_option {
@@ -120,11 +176,49 @@ struct rxkb_option {
     char *description;
     enum rxkb_popularity popularity;
     bool layout_specific;
+    struct rxkb_lazy_item lazy;
 };
 
+struct parse_message {
+    enum rxkb_log_level level;
+    char *text;
+};
+
+/*
+ * A registry file to parse. The XML document is loaded and validated
+ * independently of the other files, possibly in a worker thread, then its
+ * items are merged into the context in include-path order.
+ */
+struct parse_job {
+    struct rxkb_context *ctx; /* Read-only until merged */
+    char path[PATH_MAX];
+    enum rxkb_popularity popularity;
+    struct rxkb_xml_file *file;
+    xmlDoc *doc;
+    /* Logged when merging, so that the log function is always called from
+     * the thread calling rxkb_context_parse() */
+    darray(struct parse_message) messages;
+    /* Buffer to re-assemble the libxml2 error messages */
+    char error_buf[PATH_MAX];
+    size_t error_len;
+};
+
+static void
+parse_job_load(struct parse_job *job);
 static bool
-parse(struct rxkb_context *ctx, const char *path,
-      enum rxkb_popularity popularity);
+parse_job_merge(struct rxkb_context *ctx, struct parse_job *job);
+#if HAVE_PTHREAD
+static void
+parse_jobs_load_parallel(struct parse_job *jobs, size_t count);
+#endif
+static void
+rxkb_model_resolve(struct rxkb_model *m);
+static void
+rxkb_layout_resolve(struct rxkb_layout *l);
+static void
+rxkb_option_group_resolve(struct rxkb_option_group *g);
+static void
+rxkb_option_resolve(struct rxkb_option *o);
 
 ATTR_PRINTF(3, 4)
 static void
@@ -193,6 +287,13 @@ rtype_ type_##_get_##field_(struct type_ *object) { \
 #define DECLARE_GETTER_FOR_TYPE(type_, field_) \
    DECLARE_TYPED_GETTER_FOR_TYPE(type_, field_, const char*)
 
+/* Getter for a descriptive field, which may be resolved lazily */
+#define DECLARE_LAZY_GETTER_FOR_TYPE(type_, field_) \
+const char * type_##_get_##field_(struct type_ *object) { \
+    type_##_resolve(object); \
+    return object->field_; \
+}
+
 #define DECLARE_FIRST_NEXT_FOR_TYPE(type_, parent_type_, parent_field_) \
 struct type_ * type_##_first(struct parent_type_ *parent) { \
     struct type_ *o = NULL; \
@@ -220,6 +321,14 @@ rxkb_object_init(struct rxkb_object *object, struct rxkb_object *parent)
     list_init(&object->link);
 }
 
+/* Unlink an object from its parent list, which it may outlive */
+static void
+rxkb_object_detach(struct rxkb_object *object)
+{
+    list_remove(&object->link);
+    list_init(&object->link);
+}
+
 static void *
 rxkb_object_ref(struct rxkb_object *object)
 {
@@ -228,6 +337,33 @@ rxkb_object_ref(struct rxkb_object *object)
     return object;
 }
 
+static struct rxkb_xml_file *
+rxkb_xml_file_ref(struct rxkb_xml_file *file)
+{
+    assert(file->refcount >= 1);
+    ++file->refcount;
+    return file;
+}
+
+static void
+rxkb_xml_file_unref(struct rxkb_xml_file *file)
+{
+    if (!file)
+        return;
+    assert(file->refcount >= 1);
+    if (--file->refcount == 0) {
+        unmap_file(file->string, file->size);
+        free(file);
+    }
+}
+
+static void
+rxkb_lazy_item_release(struct rxkb_lazy_item *item)
+{
+    rxkb_xml_file_unref(item->file);
+    item->file = NULL;
+}
+
 static void
 rxkb_iso639_code_destroy(struct rxkb_iso639_code *code)
 {
@@ -239,6 +375,8 @@ rxkb_layout_get_iso639_first(struct rxkb_layout *layout)
 {
     struct rxkb_iso639_code *code = NULL;
 
+    rxkb_layout_resolve(layout);
+
     if (!list_empty(&layout->iso639s))
         code = list_first_entry(&layout->iso639s, code, base.link);
 
@@ -276,6 +414,8 @@ rxkb_layout_get_iso3166_first(struct rxkb_layout *layout)
 {
     struct rxkb_iso3166_code *code = NULL;
 
+    rxkb_layout_resolve(layout);
+
     if (!list_empty(&layout->iso3166s))
         code = list_first_entry(&layout->iso3166s, code, base.link);
 
@@ -308,13 +448,14 @@ rxkb_option_destroy(struct rxkb_option *o)
     free(o->name);
     free(o->brief);
     free(o->description);
+    rxkb_lazy_item_release(&o->lazy);
 }
 
 DECLARE_REF_UNREF_FOR_TYPE(rxkb_option);
 DECLARE_CREATE_FOR_TYPE(rxkb_option);
 DECLARE_GETTER_FOR_TYPE(rxkb_option, name);
-DECLARE_GETTER_FOR_TYPE(rxkb_option, brief);
-DECLARE_GETTER_FOR_TYPE(rxkb_option, description);
+DECLARE_LAZY_GETTER_FOR_TYPE(rxkb_option, brief);
+DECLARE_LAZY_GETTER_FOR_TYPE(rxkb_option, description);
 DECLARE_TYPED_GETTER_FOR_TYPE(rxkb_option, popularity, enum rxkb_popularity);
 bool rxkb_option_is_layout_specific(struct rxkb_option *object) {
     return object->layout_specific;
@@ -331,6 +472,7 @@ rxkb_layout_destroy(struct rxkb_layout *l)
     free(l->brief);
     free(l->description);
     free(l->variant);
+    rxkb_lazy_item_release(&l->lazy);
 
     list_for_each_safe(iso639, tmp_639, &l->iso639s, base.link) {
         rxkb_iso639_code_unref(iso639);
@@ -343,8 +485,8 @@ rxkb_layout_destroy(struct rxkb_layout *l)
 DECLARE_REF_UNREF_FOR_TYPE(rxkb_layout);
 DECLARE_CREATE_FOR_TYPE(rxkb_layout);
 DECLARE_GETTER_FOR_TYPE(rxkb_layout, name);
-DECLARE_GETTER_FOR_TYPE(rxkb_layout, brief);
-DECLARE_GETTER_FOR_TYPE(rxkb_layout, description);
+DECLARE_LAZY_GETTER_FOR_TYPE(rxkb_layout, brief);
+DECLARE_LAZY_GETTER_FOR_TYPE(rxkb_layout, description);
 DECLARE_GETTER_FOR_TYPE(rxkb_layout, variant);
 DECLARE_TYPED_GETTER_FOR_TYPE(rxkb_layout, popularity, enum rxkb_popularity);
 DECLARE_FIRST_NEXT_FOR_TYPE(rxkb_layout, rxkb_context, layouts);
@@ -355,13 +497,14 @@ rxkb_model_destroy(struct rxkb_model *m)
     free(m->name);
     free(m->vendor);
     free(m->description);
+    rxkb_lazy_item_release(&m->lazy);
 }
 
 DECLARE_REF_UNREF_FOR_TYPE(rxkb_model);
 DECLARE_CREATE_FOR_TYPE(rxkb_model);
 DECLARE_GETTER_FOR_TYPE(rxkb_model, name);
-DECLARE_GETTER_FOR_TYPE(rxkb_model, vendor);
-DECLARE_GETTER_FOR_TYPE(rxkb_model, description);
+DECLARE_LAZY_GETTER_FOR_TYPE(rxkb_model, vendor);
+DECLARE_LAZY_GETTER_FOR_TYPE(rxkb_model, description);
 DECLARE_TYPED_GETTER_FOR_TYPE(rxkb_model, popularity, enum rxkb_popularity);
 DECLARE_FIRST_NEXT_FOR_TYPE(rxkb_model, rxkb_context, models);
 
@@ -372,6 +515,7 @@ rxkb_option_group_destroy(struct rxkb_option_group *og)
 
     free(og->name);
     free(og->description);
+    rxkb_lazy_item_release(&og->lazy);
 
     list_for_each_safe(o, otmp, &og->options, base.link) {
         rxkb_option_unref(o);
@@ -387,10 +531,182 @@ rxkb_option_group_allows_multiple(struct rxkb_option_group *g)
 DECLARE_REF_UNREF_FOR_TYPE(rxkb_option_group);
 DECLARE_CREATE_FOR_TYPE(rxkb_option_group);
 DECLARE_GETTER_FOR_TYPE(rxkb_option_group, name);
-DECLARE_GETTER_FOR_TYPE(rxkb_option_group, description);
+DECLARE_LAZY_GETTER_FOR_TYPE(rxkb_option_group, description);
 DECLARE_TYPED_GETTER_FOR_TYPE(rxkb_option_group, popularity, enum rxkb_popularity);
 DECLARE_FIRST_NEXT_FOR_TYPE(rxkb_option_group, rxkb_context, option_groups);
 
+/* FNV-1a (http://www.isthe.com/chongo/tech/comp/fnv/). */
+static uint32_t
+rxkb_index_hash(const char *name, const char *variant)
+{
+    uint32_t hash = UINT32_C(2166136261);
+    for (const char *c = name; *c; c++) {
+        hash ^= (uint8_t) *c;
+        hash *= 0x01000193;
+    }
+    if (variant) {
+        /* Separator that cannot be part of a name */
+        hash ^= (uint8_t) '(';
+        hash *= 0x01000193;
+        for (const char *c = variant; *c; c++) {
+            hash ^= (uint8_t) *c;
+            hash *= 0x01000193;
+        }
+    }
+    return hash;
+}
+
+static int
+rxkb_index_entry_cmp(const void *a, const void *b)
+{
+    const struct rxkb_index_entry * const ea = a;
+    const struct rxkb_index_entry * const eb = b;
+    const int ret = strcmp(ea->name, eb->name);
+    if (ret || ea->variant == eb->variant)
+        return ret;
+    /* Base layout first */
+    if (!ea->variant)
+        return -1;
+    if (!eb->variant)
+        return 1;
+    return strcmp(ea->variant, eb->variant);
+}
+
+static bool
+rxkb_index_init(struct rxkb_index *index, size_t count)
+{
+    /* Keep the load factor below 0.5 */
+    size_t size = 8;
+    while (size < 2 * count)
+        size *= 2;
+
+    index->table = calloc(size, sizeof(*index->table));
+    index->sorted = calloc(MAX(count, 1), sizeof(*index->sorted));
+    if (!index->table || !index->sorted)
+        return false;
+    index->table_size = size;
+    index->count = 0;
+    return true;
+}
+
+static void
+rxkb_index_free(struct rxkb_index *index)
+{
+    free(index->table);
+    free(index->sorted);
+    *index = (struct rxkb_index) { 0 };
+}
+
+static void
+rxkb_index_insert(struct rxkb_index *index, const char *name,
+                  const char *variant, void *item)
+{
+    const size_t mask = index->table_size - 1;
+    for (size_t pos = rxkb_index_hash(name, variant) & mask;;
+         pos = (pos + 1) & mask) {
+        struct rxkb_index_entry * const entry = &index->table[pos];
+        if (!entry->item) {
+            *entry = (struct rxkb_index_entry) {
+                .name = name, .variant = variant, .item = item
+            };
+            index->sorted[index->count++] = *entry;
+            return;
+        }
+        /* Keep the first item in iteration order */
+        if (streq(entry->name, name) && streq_null(entry->variant, variant))
+            return;
+    }
+}
+
+/* Sort the entries once all items are inserted */
+static void
+rxkb_index_sort(struct rxkb_index *index)
+{
+    qsort(index->sorted, index->count, sizeof(*index->sorted),
+          &rxkb_index_entry_cmp);
+}
+
+static void *
+rxkb_index_lookup(const struct rxkb_index *index, const char *name,
+                  const char *variant)
+{
+    if (!index->table_size || !name)
+        return NULL;
+
+    const size_t mask = index->table_size - 1;
+    for (size_t pos = rxkb_index_hash(name, variant) & mask;;
+         pos = (pos + 1) & mask) {
+        const struct rxkb_index_entry * const entry = &index->table[pos];
+        if (!entry->item)
+            return NULL;
+        if (streq(entry->name, name) && streq_null(entry->variant, variant))
+            return entry->item;
+    }
+}
+
+/*
+ * Get the range of the sorted entries whose name starts with the given prefix.
+ * Returns the count of matching entries.
+ */
+static size_t
+rxkb_index_prefix_range(const struct rxkb_index *index, const char *prefix,
+                        size_t *first)
+{
+    const size_t len = strlen_safe(prefix);
+
+    /* Lower bound */
+    size_t lo = 0;
+    size_t hi = index->count;
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        if (strncmp(index->sorted[mid].name, strempty(prefix), len) < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    *first = lo;
+
+    size_t last = lo;
+    while (last < index->count &&
+           strncmp(index->sorted[last].name, strempty(prefix), len) == 0)
+        last++;
+    return last - lo;
+}
+
+/*
+ * Resolve the lazy items still referenced by the user: they outlive the
+ * context, while their resolution requires it, as well as the base layouts.
+ */
+static void
+rxkb_context_resolve_referenced(struct rxkb_context *ctx)
+{
+    struct rxkb_model *m;
+    struct rxkb_layout *l;
+    struct rxkb_option_group *og;
+    struct rxkb_option *o;
+
+    list_for_each(m, &ctx->models, base.link) {
+        if (m->base.refcount > 1)
+            rxkb_model_resolve(m);
+    }
+
+    list_for_each(l, &ctx->layouts, base.link) {
+        if (l->base.refcount > 1)
+            rxkb_layout_resolve(l);
+    }
+
+    list_for_each(og, &ctx->option_groups, base.link) {
+        /* A referenced group keeps its options alive */
+        const bool referenced = og->base.refcount > 1;
+        if (referenced)
+            rxkb_option_group_resolve(og);
+        list_for_each(o, &og->options, base.link) {
+            if (referenced || o->base.refcount > 1)
+                rxkb_option_resolve(o);
+        }
+    }
+}
+
 static void
 rxkb_context_destroy(struct rxkb_context *ctx)
 {
@@ -399,26 +715,125 @@ rxkb_context_destroy(struct rxkb_context *ctx)
     struct rxkb_option_group *og, *ogtmp;
     char **path;
 
-    list_for_each_safe(m, mtmp, &ctx->models, base.link)
+    if (ctx->lazy_descriptions)
+        rxkb_context_resolve_referenced(ctx);
+
+    /* Detach first: items referenced by the user outlive the context */
+    list_for_each_safe(m, mtmp, &ctx->models, base.link) {
+        rxkb_object_detach(&m->base);
         rxkb_model_unref(m);
+    }
     assert(list_empty(&ctx->models));
 
-    list_for_each_safe(l, ltmp, &ctx->layouts, base.link)
+    list_for_each_safe(l, ltmp, &ctx->layouts, base.link) {
+        rxkb_object_detach(&l->base);
         rxkb_layout_unref(l);
+    }
     assert(list_empty(&ctx->layouts));
 
-    list_for_each_safe(og, ogtmp, &ctx->option_groups, base.link)
+    list_for_each_safe(og, ogtmp, &ctx->option_groups, base.link) {
+        rxkb_object_detach(&og->base);
         rxkb_option_group_unref(og);
+    }
     assert(list_empty(&ctx->option_groups));
 
     darray_foreach(path, ctx->includes)
         free(*path);
     darray_free(ctx->includes);
 
+    rxkb_index_free(&ctx->models_index);
+    rxkb_index_free(&ctx->layouts_index);
+    rxkb_index_free(&ctx->option_groups_index);
+    rxkb_index_free(&ctx->options_index);
+
     assert(darray_empty(ctx->includes));
 }
 
 DECLARE_REF_UNREF_FOR_TYPE(rxkb_context);
+
+#define DECLARE_FIND_PREFIX_FOR_TYPE(type_, index_) \
+size_t type_##_find_prefix(struct rxkb_context *ctx, const char *prefix, \
+                           struct type_ **items, size_t count) { \
+    size_t first = 0; \
+    const size_t total = rxkb_index_prefix_range(&ctx->index_, prefix, \
+                                                 &first); \
+    for (size_t k = 0; k < MIN(total, count); k++) \
+        items[k] = ctx->index_.sorted[first + k].item; \
+    return total; \
+}
+
+struct rxkb_model *
+rxkb_model_find(struct rxkb_context *ctx, const char *name)
+{
+    return rxkb_index_lookup(&ctx->models_index, name, NULL);
+}
+
+struct rxkb_layout *
+rxkb_layout_find(struct rxkb_context *ctx, const char *name,
+                 const char *variant)
+{
+    return rxkb_index_lookup(&ctx->layouts_index, name, variant);
+}
+
+struct rxkb_option_group *
+rxkb_option_group_find(struct rxkb_context *ctx, const char *name)
+{
+    return rxkb_index_lookup(&ctx->option_groups_index, name, NULL);
+}
+
+struct rxkb_option *
+rxkb_option_find(struct rxkb_context *ctx, const char *name)
+{
+    return rxkb_index_lookup(&ctx->options_index, name, NULL);
+}
+
+DECLARE_FIND_PREFIX_FOR_TYPE(rxkb_model, models_index)
+DECLARE_FIND_PREFIX_FOR_TYPE(rxkb_layout, layouts_index)
+DECLARE_FIND_PREFIX_FOR_TYPE(rxkb_option_group, option_groups_index)
+DECLARE_FIND_PREFIX_FOR_TYPE(rxkb_option, options_index)
+
+static bool
+build_indexes(struct rxkb_context *ctx)
+{
+    struct rxkb_model *m;
+    struct rxkb_layout *l;
+    struct rxkb_option_group *g;
+    struct rxkb_option *o;
+    size_t models = 0, layouts = 0, groups = 0, options = 0;
+
+    list_for_each(m, &ctx->models, base.link)
+        models++;
+    list_for_each(l, &ctx->layouts, base.link)
+        layouts++;
+    list_for_each(g, &ctx->option_groups, base.link) {
+        groups++;
+        list_for_each(o, &g->options, base.link)
+            options++;
+    }
+
+    if (!rxkb_index_init(&ctx->models_index, models) ||
+        !rxkb_index_init(&ctx->layouts_index, layouts) ||
+        !rxkb_index_init(&ctx->option_groups_index, groups) ||
+        !rxkb_index_init(&ctx->options_index, options))
+        return false;
+
+    list_for_each(m, &ctx->models, base.link)
+        rxkb_index_insert(&ctx->models_index, m->name, NULL, m);
+    list_for_each(l, &ctx->layouts, base.link)
+        rxkb_index_insert(&ctx->layouts_index, l->name, l->variant, l);
+    list_for_each(g, &ctx->option_groups, base.link) {
+        rxkb_index_insert(&ctx->option_groups_index, g->name, NULL, g);
+        list_for_each(o, &g->options, base.link)
+            rxkb_index_insert(&ctx->options_index, o->name, NULL, o);
+    }
+
+    rxkb_index_sort(&ctx->models_index);
+    rxkb_index_sort(&ctx->layouts_index);
+    rxkb_index_sort(&ctx->option_groups_index);
+    rxkb_index_sort(&ctx->options_index);
+    return true;
+}
+
 DECLARE_CREATE_FOR_TYPE(rxkb_context);
 DECLARE_TYPED_GETTER_FOR_TYPE(rxkb_context, log_level, enum rxkb_log_level);
 
@@ -504,6 +919,8 @@ rxkb_context_new(enum rxkb_context_flags flags)
     ctx->context_state = CONTEXT_NEW;
     ctx->load_extra_rules_files = flags & RXKB_CONTEXT_LOAD_EXOTIC_RULES;
     ctx->use_secure_getenv = !(flags & RXKB_CONTEXT_NO_SECURE_GETENV);
+    ctx->lazy_descriptions = flags & RXKB_CONTEXT_LAZY_DESCRIPTIONS;
+    ctx->parallel_parsing = flags & RXKB_CONTEXT_PARALLEL_PARSING;
     ctx->log_fn = default_log_fn;
     ctx->log_level = RXKB_LOG_LEVEL_ERROR;
 
@@ -515,7 +932,9 @@ rxkb_context_new(enum rxkb_context_flags flags)
     static const enum rxkb_context_flags  RXKB_CONTEXT_FLAGS
         = RXKB_CONTEXT_NO_DEFAULT_INCLUDES
         | RXKB_CONTEXT_LOAD_EXOTIC_RULES
-        | RXKB_CONTEXT_NO_SECURE_GETENV;
+        | RXKB_CONTEXT_NO_SECURE_GETENV
+        | RXKB_CONTEXT_LAZY_DESCRIPTIONS
+        | RXKB_CONTEXT_PARALLEL_PARSING;
 
     if (flags & ~RXKB_CONTEXT_FLAGS) {
         log_err(ctx, XKB_LOG_MESSAGE_NO_ID,
@@ -623,6 +1042,16 @@ compare_str(const void *a, const void *b)
     return strcmp(*(char **)a, *(char **) b);
 }
 
+/*
+ * Append the direct subdirectories of an extensions directory to the include
+ * paths.
+ *
+ * This walk is deliberately sequential, even with
+ * RXKB_CONTEXT_PARALLEL_PARSING: it only costs a few `stat()` calls per
+ * directory, which is cheaper than dispatching to threads, while the
+ * expensive part, i.e. loading the XML files of each extension directory,
+ * is already distributed to the parse pool as any other include path.
+ */
 static int
 add_direct_subdirectories(struct rxkb_context *ctx, const char *path,
                           darray_string *extensions,
@@ -847,25 +1276,60 @@ rxkb_context_parse(struct rxkb_context *ctx, const char *ruleset)
         return false;
     }
 
-    darray_foreach_reverse(path, ctx->includes) {
-        char rules[PATH_MAX];
+    /* Files are loaded independently, then merged in include-path order */
+    const size_t max_jobs = 2 * (size_t) darray_size(ctx->includes);
+    struct parse_job *jobs = calloc(MAX(max_jobs, 1), sizeof(*jobs));
+    if (!jobs) {
+        log_err(ctx, XKB_ERROR_ALLOCATION_FAILURE_,
+                "Could not allocate the registry parsing jobs\n");
+        ctx->context_state = CONTEXT_FAILED;
+        return false;
+    }
 
-        if (snprintf_safe(rules, sizeof(rules), "%s/rules/%s.xml",
-                           *path, ruleset)) {
-            log_dbg(ctx, "Parsing %s\n", rules);
-            if (parse(ctx, rules, RXKB_POPULARITY_STANDARD))
-                success = true;
+    size_t count = 0;
+    darray_foreach_reverse(path, ctx->includes) {
+        struct parse_job *job = &jobs[count];
+        if (snprintf_safe(job->path, sizeof(job->path), "%s/rules/%s.xml",
+                          *path, ruleset)) {
+            job->ctx = ctx;
+            job->popularity = RXKB_POPULARITY_STANDARD;
+            job = &jobs[++count];
         }
 
         if (ctx->load_extra_rules_files &&
-            snprintf_safe(rules, sizeof(rules), "%s/rules/%s.extras.xml",
-                          *path, ruleset)) {
-            log_dbg(ctx, "Parsing %s\n", rules);
-            if (parse(ctx, rules, RXKB_POPULARITY_EXOTIC))
-                success = true;
+            snprintf_safe(job->path, sizeof(job->path),
+                          "%s/rules/%s.extras.xml", *path, ruleset)) {
+            job->ctx = ctx;
+            job->popularity = RXKB_POPULARITY_EXOTIC;
+            count++;
         }
     }
 
+    LIBXML_TEST_VERSION
+
+    bool loaded = false;
+#if HAVE_PTHREAD
+    if (ctx->parallel_parsing && count > 1) {
+        parse_jobs_load_parallel(jobs, count);
+        loaded = true;
+    }
+#endif
+
+    for (size_t k = 0; k < count; k++) {
+        /* Sequential parsing: keep only one document in memory at a time */
+        if (!loaded)
+            parse_job_load(&jobs[k]);
+        if (parse_job_merge(ctx, &jobs[k]))
+            success = true;
+    }
+    free(jobs);
+
+    if (success && !build_indexes(ctx)) {
+        log_err(ctx, XKB_ERROR_ALLOCATION_FAILURE_,
+                "Could not allocate the registry indexes\n");
+        success = false;
+    }
+
     ctx->context_state = success ? CONTEXT_PARSED : CONTEXT_FAILED;
 
     return success;
@@ -912,6 +1376,7 @@ struct config_item {
     char *vendor;
     enum rxkb_popularity popularity;
     bool layout_specific;
+    struct rxkb_lazy_item lazy;
 };
 
 #define config_item_new(popularity_) { \
@@ -920,7 +1385,8 @@ struct config_item {
     .brief = NULL, \
     .vendor = NULL, \
     .popularity = (popularity_), \
-    .layout_specific = false \
+    .layout_specific = false, \
+    .lazy = { .file = NULL, .start = 0, .end = 0 } \
 }
 
 static void
@@ -929,6 +1395,56 @@ config_item_free(struct config_item *config) {
     free(config->description);
     free(config->brief);
     free(config->vendor);
+    rxkb_lazy_item_release(&config->lazy);
+}
+
+static inline struct rxkb_lazy_item
+steal_lazy_item(struct rxkb_lazy_item *item)
+{
+    const struct rxkb_lazy_item stolen = *item;
+    item->file = NULL;
+    return stolen;
+}
+
+/*
+ * Locate the “configItem” element in the retained file. Only the nodes parsed
+ * with `lazy_start_element_ns()` carry their offset.
+ */
+static bool
+locate_config_item(struct rxkb_xml_file *file, xmlNode *ci,
+                   struct rxkb_lazy_item *item)
+{
+    static const char start_tag[] = "<configItem";
+    static const char end_tag[] = "</configItem>";
+    const size_t start_len = sizeof(start_tag) - 1;
+    const size_t end_len = sizeof(end_tag) - 1;
+    const char * const s = file->string;
+    const size_t pos = (size_t) (uintptr_t) ci->_private;
+
+    if (pos < start_len || pos > file->size)
+        return false;
+
+    /* The offset is within or right after the start tag */
+    size_t start = pos;
+    while (start >= start_len &&
+           memcmp(s + start - start_len, start_tag, start_len) != 0)
+        start--;
+    if (start < start_len)
+        return false;
+    start -= start_len;
+
+    /* “configItem” elements do not nest */
+    size_t end = pos;
+    while (end + end_len <= file->size &&
+           memcmp(s + end, end_tag, end_len) != 0)
+        end++;
+    if (end + end_len > file->size)
+        return false;
+
+    item->file = rxkb_xml_file_ref(file);
+    item->start = start;
+    item->end = end + end_len;
+    return true;
 }
 
 static bool
@@ -963,10 +1479,17 @@ parse_config_item(struct rxkb_context *ctx, xmlNode *parent,
                 config->layout_specific = true;
             xmlFree(raw_layout_specific);
 
+            /* Descriptive fields may be resolved on demand */
+            const bool lazy = ctx->lazy_file &&
+                              locate_config_item(ctx->lazy_file, ci,
+                                                 &config->lazy);
+
             /* Process children */
             for (node = ci->children; node; node = node->next) {
                 if (is_node(node, "name"))
                     config->name = extract_text(node);
+                else if (lazy)
+                    continue;
                 else if (is_node(node, "description"))
                     config->description = extract_text(node);
                 else if (is_node(node, "shortDescription"))
@@ -1014,6 +1537,7 @@ parse_model(struct rxkb_context *ctx, xmlNode *model,
         m->description = steal(&config.description);
         m->vendor = steal(&config.vendor);
         m->popularity = config.popularity;
+        m->lazy = steal_lazy_item(&config.lazy);
         list_append(&ctx->models, &m->base.link);
     }
 }
@@ -1078,6 +1602,54 @@ parse_country_list(xmlNode *country_list, struct rxkb_layout *layout)
     }
 }
 
+/*
+ * Parse the language and country lists of a “configItem” node. A variant
+ * inherits the lists it omits from its parent layout.
+ */
+static void
+parse_config_item_lists(xmlNode *ci, struct rxkb_layout *layout,
+                        struct rxkb_layout *parent)
+{
+    xmlNode *node;
+    bool found_language_list = false;
+    bool found_country_list = false;
+
+    for (node = ci->children; node; node = node->next) {
+        if (is_node(node, "languageList")) {
+            parse_language_list(node, layout);
+            found_language_list = true;
+        }
+        if (is_node(node, "countryList")) {
+            parse_country_list(node, layout);
+            found_country_list = true;
+        }
+    }
+
+    if (!parent)
+        return;
+
+    rxkb_layout_resolve(parent);
+
+    if (!found_language_list) {
+        // inherit from parent layout
+        struct rxkb_iso639_code* x;
+        list_for_each(x, &parent->iso639s, base.link) {
+            struct rxkb_iso639_code* code = rxkb_iso639_code_create(&layout->base);
+            code->code = strdup(x->code);
+            list_append(&layout->iso639s, &code->base.link);
+        }
+    }
+    if (!found_country_list) {
+        // inherit from parent layout
+        struct rxkb_iso3166_code* x;
+        list_for_each(x, &parent->iso3166s, base.link) {
+            struct rxkb_iso3166_code* code = rxkb_iso3166_code_create(&layout->base);
+            code->code = strdup(x->code);
+            list_append(&layout->iso3166s, &code->base.link);
+        }
+    }
+}
+
 static void
 parse_variant(struct rxkb_context *ctx, struct rxkb_layout *l,
               xmlNode *variant, enum rxkb_popularity popularity)
@@ -1104,47 +1676,24 @@ parse_variant(struct rxkb_context *ctx, struct rxkb_layout *l,
             v->name = strdup(l->name);
             v->variant = steal(&config.name);
             v->description = steal(&config.description);
-            // if variant omits brief, inherit from parent layout.
-            v->brief = config.brief == NULL ? strdup_safe(l->brief) : steal(&config.brief);
             v->popularity = config.popularity;
+            v->lazy = steal_lazy_item(&config.lazy);
             list_append(&ctx->layouts, &v->base.link);
 
-            for (ci = variant->children; ci; ci = ci->next) {
-                xmlNode *node;
+            if (v->lazy.file) {
+                /* Inherit from the parent layout when resolved */
+                v->lazy_base = l;
+                return;
+            }
 
-                if (!is_node(ci, "configItem"))
-                    continue;
+            // if variant omits brief, inherit from parent layout.
+            v->brief = config.brief == NULL
+                ? strdup_safe(rxkb_layout_get_brief(l))
+                : steal(&config.brief);
 
-                bool found_language_list = false;
-                bool found_country_list = false;
-                for (node = ci->children; node; node = node->next) {
-                    if (is_node(node, "languageList")) {
-                        parse_language_list(node, v);
-                        found_language_list = true;
-                    }
-                    if (is_node(node, "countryList")) {
-                        parse_country_list(node, v);
-                        found_country_list = true;
-                    }
-                }
-                if (!found_language_list) {
-                    // inherit from parent layout
-                    struct rxkb_iso639_code* x;
-                    list_for_each(x, &l->iso639s, base.link) {
-                        struct rxkb_iso639_code* code = rxkb_iso639_code_create(&v->base);
-                        code->code = strdup(x->code);
-                        list_append(&v->iso639s, &code->base.link);
-                    }
-                }
-                if (!found_country_list) {
-                    // inherit from parent layout
-                    struct rxkb_iso3166_code* x;
-                    list_for_each(x, &l->iso3166s, base.link) {
-                        struct rxkb_iso3166_code* code = rxkb_iso3166_code_create(&v->base);
-                        code->code = strdup(x->code);
-                        list_append(&v->iso3166s, &code->base.link);
-                    }
-                }
+            for (ci = variant->children; ci; ci = ci->next) {
+                if (is_node(ci, "configItem"))
+                    parse_config_item_lists(ci, v, l);
             }
         } else {
             config_item_free(&config);
@@ -1192,6 +1741,7 @@ parse_layout(struct rxkb_context *ctx, xmlNode *layout,
         l->description = steal(&config.description);
         l->brief = steal(&config.brief);
         l->popularity = config.popularity;
+        l->lazy = steal_lazy_item(&config.lazy);
         list_append(&ctx->layouts, &l->base.link);
     } else {
         config_item_free(&config);
@@ -1201,15 +1751,8 @@ parse_layout(struct rxkb_context *ctx, xmlNode *layout,
         if (is_node(node, "variantList")) {
             parse_variant_list(ctx, l, node, popularity);
         }
-        if (!exists && is_node(node, "configItem")) {
-            xmlNode *ll;
-            for (ll = node->children; ll; ll = ll->next) {
-                if (is_node(ll, "languageList"))
-                    parse_language_list(ll, l);
-                if (is_node(ll, "countryList"))
-                    parse_country_list(ll, l);
-            }
-        }
+        if (!exists && !l->lazy.file && is_node(node, "configItem"))
+            parse_config_item_lists(node, l, NULL);
     }
 }
 
@@ -1246,6 +1789,7 @@ parse_option(struct rxkb_context *ctx, struct rxkb_option_group *group,
         o->description = steal(&config.description);
         o->popularity = config.popularity;
         o->layout_specific = config.layout_specific;
+        o->lazy = steal_lazy_item(&config.lazy);
         list_append(&group->options, &o->base.link);
     }
 }
@@ -1275,6 +1819,7 @@ parse_group(struct rxkb_context *ctx, xmlNode *group,
         g->name = steal(&config.name);
         g->description = steal(&config.description);
         g->popularity = config.popularity;
+        g->lazy = steal_lazy_item(&config.lazy);
 
         multiple = xmlGetProp(group, (const xmlChar*)"allowMultipleSelection");
         if (multiple && xmlStrEqual(multiple, (const xmlChar*)"true"))
@@ -1321,12 +1866,39 @@ parse_rules_xml(struct rxkb_context *ctx, xmlNode *root,
     }
 }
 
+ATTR_PRINTF(3, 4)
+static void
+parse_job_log(struct parse_job *job, enum rxkb_log_level level,
+              const char *fmt, ...)
+{
+    va_list args;
+
+    if (job->ctx->log_level < level)
+        return;
+
+    va_start(args, fmt);
+    char * const text = vasprintf_safe(fmt, args);
+    va_end(args);
+
+    if (text) {
+        const struct parse_message message = { .level = level, .text = text };
+        darray_append(job->messages, message);
+    }
+}
+
+#define job_log_dbg(job, ...) \
+    parse_job_log((job), RXKB_LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define job_log_err(job, id, fmt, ...) \
+    parse_job_log((job), RXKB_LOG_LEVEL_ERROR, \
+                  PREPEND_MESSAGE_ID(id, fmt), ##__VA_ARGS__)
+
 static void
 ATTR_PRINTF(2, 0)
-xml_error_func(void *ctx, const char *msg, ...)
+xml_error_func(void *data, const char *msg, ...)
 {
-    static char buf[PATH_MAX];
-    static size_t slen = 0;
+    struct parse_job * const job = data;
+    char * const buf = job->error_buf;
+    const size_t size = sizeof(job->error_buf);
     va_list args;
     int rc;
 
@@ -1336,30 +1908,30 @@ xml_error_func(void *ctx, const char *msg, ...)
      * the line break. My enthusiasm about this is indescribable.
      */
     va_start(args, msg);
-    rc = vsnprintf(&buf[slen], sizeof(buf) - slen, msg, args);
+    rc = vsnprintf(&buf[job->error_len], size - job->error_len, msg, args);
     va_end(args);
 
     /* This shouldn't really happen */
     if (rc < 0) {
-        log_err(ctx, XKB_ERROR_INSUFFICIENT_BUFFER_SIZE,
-                "+++ out of cheese error. redo from start +++\n");
-        slen = 0;
-        memset(buf, 0, sizeof(buf));
+        job_log_err(job, XKB_ERROR_INSUFFICIENT_BUFFER_SIZE,
+                    "+++ out of cheese error. redo from start +++\n");
+        job->error_len = 0;
+        memset(buf, 0, size);
         return;
     }
 
-    slen += (size_t)rc;
-    if (slen >= sizeof(buf)) {
+    job->error_len += (size_t)rc;
+    if (job->error_len >= size) {
         /* truncated, let's flush this */
-        buf[sizeof(buf) - 1] = '\n';
-        slen = sizeof(buf);
+        buf[size - 1] = '\n';
+        job->error_len = size;
     }
 
     /* We're assuming here that the last character is \n. */
-    if (buf[slen - 1] == '\n') {
-        log_err(ctx, XKB_LOG_MESSAGE_NO_ID, "%s", buf);
-        memset(buf, 0, sizeof(buf));
-        slen = 0;
+    if (buf[job->error_len - 1] == '\n') {
+        job_log_err(job, XKB_LOG_MESSAGE_NO_ID, "%s", buf);
+        memset(buf, 0, size);
+        job->error_len = 0;
     }
 }
 
@@ -1378,7 +1950,7 @@ xml_structured_error_func(void *userData, const xmlError * error)
 #endif
 
 static bool
-validate(struct rxkb_context *ctx, xmlDoc *doc)
+validate(struct parse_job *job, xmlDoc *doc)
 {
     bool success = false;
     /* This is a modified version of the xkeyboard-config xkb.dtd:
@@ -1425,7 +1997,7 @@ validate(struct rxkb_context *ctx, xmlDoc *doc)
     static_assert(HAVE_XML_CTXT_SET_ERRORHANDLER,
                   "xmlCtxtSetErrorHandler (2.13) introduced before "
                   "xmlCtxtParseDtd (2.14)");
-    xmlCtxtSetErrorHandler(xmlCtxt, xml_structured_error_func, ctx);
+    xmlCtxtSetErrorHandler(xmlCtxt, xml_structured_error_func, job);
     xmlCtxtSetOptions(xmlCtxt, _XML_OPTIONS | XML_PARSE_DTDLOAD);
 
     xmlParserInputPtr pinput =
@@ -1447,7 +2019,7 @@ validate(struct rxkb_context *ctx, xmlDoc *doc)
 #endif
 
     if (!dtd) {
-        log_err(ctx, XKB_LOG_MESSAGE_NO_ID, "Failed to load DTD\n");
+        job_log_err(job, XKB_LOG_MESSAGE_NO_ID, "Failed to load DTD\n");
         goto dtd_error;
     }
 
@@ -1460,7 +2032,7 @@ validate(struct rxkb_context *ctx, xmlDoc *doc)
         goto ctx_error;
     }
     dtdvalid->error = &xml_error_func;
-    dtdvalid->userData = ctx;
+    dtdvalid->userData = job;
     success = xmlValidateDtd(dtdvalid, doc, dtd);
     xmlFreeValidCtxt(dtdvalid);
 
@@ -1475,22 +2047,78 @@ dtd_error:
     return success;
 }
 
-static bool
-parse(struct rxkb_context *ctx, const char *path,
-      enum rxkb_popularity popularity)
+static struct rxkb_xml_file *
+rxkb_xml_file_new(struct parse_job *job, const char *path)
 {
-    bool success = false;
+    FILE *file = open_file(path);
+    if (!file)
+        return NULL;
+
+    struct rxkb_xml_file *xml = calloc(1, sizeof(*xml));
+    if (!xml)
+        goto error;
+
+    if (!map_file(file, &xml->string, &xml->size)) {
+        job_log_dbg(job, "Failed to map %s (%s); descriptions will not be "
+                    "resolved lazily\n", path, strerror(errno));
+        free(xml);
+        xml = NULL;
+        goto error;
+    }
+
+    if (xml->size > INT_MAX) {
+        rxkb_xml_file_unref(xml);
+        xml = NULL;
+        goto error;
+    }
+
+    xml->refcount = 1;
+
+error:
+    fclose(file);
+    return xml;
+}
+
+/*
+ * Record the offset of the “configItem” elements, so that they can be parsed
+ * again on demand.
+ */
+static void
+lazy_start_element_ns(void *ctx, const xmlChar *localname,
+                      const xmlChar *prefix, const xmlChar *URI,
+                      int nb_namespaces, const xmlChar **namespaces,
+                      int nb_attributes, int nb_defaulted,
+                      const xmlChar **attributes)
+{
+    xmlParserCtxtPtr xmlCtxt = ctx;
+
+    xmlSAX2StartElementNs(ctx, localname, prefix, URI,
+                          nb_namespaces, namespaces,
+                          nb_attributes, nb_defaulted, attributes);
+
+    if (xmlCtxt->node &&
+        xmlStrEqual(localname, (const xmlChar *) "configItem")) {
+        const long offset = xmlByteConsumed(xmlCtxt);
+        if (offset > 0)
+            xmlCtxt->node->_private = (void *) (uintptr_t) offset;
+    }
+}
+
+/* Load and validate the XML document of a job */
+static void
+parse_job_load(struct parse_job *job)
+{
+    const char * const path = job->path;
     xmlDoc *doc = NULL;
-    xmlNode *root = NULL;
 
-    if (!check_eaccess(path, R_OK))
-        return false;
+    job_log_dbg(job, "Parsing %s\n", path);
 
-    LIBXML_TEST_VERSION
+    if (!check_eaccess(path, R_OK))
+        return;
 
     xmlParserCtxtPtr xmlCtxt = xmlNewParserCtxt();
     if (!xmlCtxt)
-        return false;
+        return;
 
 #ifdef XML_PARSE_NO_XXE
 #define _XML_OPTIONS (XML_PARSE_NONET | XML_PARSE_NOENT | XML_PARSE_NO_XXE)
@@ -1499,32 +2127,38 @@ parse(struct rxkb_context *ctx, const char *path,
 #endif
     xmlCtxtUseOptions(xmlCtxt, _XML_OPTIONS);
 
+    if (job->ctx->lazy_descriptions)
+        job->file = rxkb_xml_file_new(job, path);
+
 #if HAVE_XML_CTXT_SET_ERRORHANDLER
     /* Prefer contextual handler whenever possible. It takes precedence over
      * the global generic handler. */
-    xmlCtxtSetErrorHandler(xmlCtxt, xml_structured_error_func, ctx);
+    xmlCtxtSetErrorHandler(xmlCtxt, xml_structured_error_func, job);
 #endif
 #if !HAVE_XML_CTXT_PARSE_DTD
     /* This is needed for the DTD validation */
-    xmlSetGenericErrorFunc(ctx, xml_error_func);
+    xmlSetGenericErrorFunc(job, xml_error_func);
 #endif
 
-    doc = xmlCtxtReadFile(xmlCtxt, path, NULL, 0);
+    if (job->file) {
+        xmlCtxt->sax->startElementNs = lazy_start_element_ns;
+        doc = xmlCtxtReadMemory(xmlCtxt, job->file->string,
+                                (int) job->file->size, path, NULL, 0);
+    } else {
+        doc = xmlCtxtReadFile(xmlCtxt, path, NULL, 0);
+    }
     if (!doc)
         goto parse_error;
 
-    if (!validate(ctx, doc)) {
-        log_err(ctx, XKB_LOG_MESSAGE_NO_ID,
-                "XML error: failed to validate document at %s\n", path);
-        goto validate_error;
+    if (!validate(job, doc)) {
+        job_log_err(job, XKB_LOG_MESSAGE_NO_ID,
+                    "XML error: failed to validate document at %s\n", path);
+        xmlFreeDoc(doc);
+        goto parse_error;
     }
 
-    root = xmlDocGetRootElement(doc);
-    parse_rules_xml(ctx, root, popularity);
+    job->doc = doc;
 
-    success = true;
-validate_error:
-    xmlFreeDoc(doc);
 parse_error:
 
 #if !HAVE_XML_CTXT_PARSE_DTD
@@ -1543,6 +2177,214 @@ parse_error:
     xmlCtxtSetErrorHandler(xmlCtxt, NULL, NULL);
 #endif
     xmlFreeParserCtxt(xmlCtxt);
+}
+
+/* Merge the items of a loaded job into the context and release the job */
+static bool
+parse_job_merge(struct rxkb_context *ctx, struct parse_job *job)
+{
+    const bool success = (job->doc != NULL);
+    struct parse_message *message;
+
+    darray_foreach(message, job->messages) {
+        rxkb_log(ctx, message->level, "%s", message->text);
+        free(message->text);
+    }
+    darray_free(job->messages);
+
+    if (success) {
+        /* Offsets are only meaningful if the fragments can be parsed alone */
+        const xmlChar * const encoding = job->doc->encoding;
+        if (job->file &&
+            (!encoding ||
+             xmlStrcasecmp(encoding, (const xmlChar *) "UTF-8") == 0))
+            ctx->lazy_file = job->file;
+
+        parse_rules_xml(ctx, xmlDocGetRootElement(job->doc), job->popularity);
+        ctx->lazy_file = NULL;
+        xmlFreeDoc(job->doc);
+        job->doc = NULL;
+    }
+
+    /* The items keep a reference to the file while they are not resolved */
+    rxkb_xml_file_unref(job->file);
+    job->file = NULL;
 
     return success;
 }
+
+#if HAVE_PTHREAD
+#define MAX_PARSE_THREADS 4
+
+struct parse_pool {
+    struct parse_job *jobs;
+    size_t count;
+    size_t next;
+    pthread_mutex_t mutex;
+};
+
+static void *
+parse_worker(void *data)
+{
+    struct parse_pool * const pool = data;
+
+    while (true) {
+        pthread_mutex_lock(&pool->mutex);
+        const size_t k = pool->next;
+        if (k < pool->count)
+            pool->next++;
+        pthread_mutex_unlock(&pool->mutex);
+
+        if (k >= pool->count)
+            break;
+        parse_job_load(&pool->jobs[k]);
+    }
+
+    return NULL;
+}
+
+/* Load the jobs concurrently; the calling thread participates as well */
+static void
+parse_jobs_load_parallel(struct parse_job *jobs, size_t count)
+{
+    pthread_t threads[MAX_PARSE_THREADS - 1];
+    struct parse_pool pool = { .jobs = jobs, .count = count, .next = 0 };
+    size_t started = 0;
+
+    if (pthread_mutex_init(&pool.mutex, NULL) != 0) {
+        for (size_t k = 0; k < count; k++)
+            parse_job_load(&jobs[k]);
+        return;
+    }
+
+    const size_t workers = MIN(count, MAX_PARSE_THREADS) - 1;
+    for (; started < workers; started++) {
+        if (pthread_create(&threads[started], NULL, parse_worker, &pool) != 0)
+            break;
+    }
+
+    parse_worker(&pool);
+
+    for (size_t k = 0; k < started; k++)
+        pthread_join(threads[k], NULL);
+    pthread_mutex_destroy(&pool.mutex);
+}
+#endif
+
+/*
+ * Parse the retained “configItem” element of a lazy item. Returns the parsed
+ * fragment, to be freed by the caller, or NULL if there is nothing to resolve.
+ */
+static xmlDoc *
+resolve_config_item(struct rxkb_context *ctx, struct rxkb_lazy_item *item,
+                    struct config_item *config)
+{
+    xmlDoc *doc = xmlReadMemory(item->file->string + item->start,
+                                (int) (item->end - item->start),
+                                NULL, NULL, _XML_OPTIONS);
+    rxkb_lazy_item_release(item);
+
+    if (!doc) {
+        log_err(ctx, XKB_LOG_MESSAGE_NO_ID,
+                "XML error: failed to resolve item at offset %zu\n",
+                item->start);
+        return NULL;
+    }
+
+    /* The document node is the parent of the “configItem” element */
+    if (!parse_config_item(ctx, (xmlNode *) doc, config)) {
+        xmlFreeDoc(doc);
+        return NULL;
+    }
+
+    return doc;
+}
+
+static void
+rxkb_model_resolve(struct rxkb_model *m)
+{
+    if (!m->lazy.file)
+        return;
+
+    struct rxkb_context *ctx = container_of(m->base.parent,
+                                            struct rxkb_context, base);
+    struct config_item config = config_item_new(m->popularity);
+
+    xmlDoc *doc = resolve_config_item(ctx, &m->lazy, &config);
+    if (!doc)
+        return;
+
+    m->description = steal(&config.description);
+    m->vendor = steal(&config.vendor);
+    config_item_free(&config);
+    xmlFreeDoc(doc);
+}
+
+static void
+rxkb_layout_resolve(struct rxkb_layout *l)
+{
+    if (!l->lazy.file)
+        return;
+
+    struct rxkb_context *ctx = container_of(l->base.parent,
+                                            struct rxkb_context, base);
+    struct rxkb_layout * const parent = steal(&l->lazy_base);
+    struct config_item config = config_item_new(l->popularity);
+
+    xmlDoc *doc = resolve_config_item(ctx, &l->lazy, &config);
+    if (!doc) {
+        /* Still inherit the brief from the parent layout, as when parsing */
+        if (parent)
+            l->brief = strdup_safe(rxkb_layout_get_brief(parent));
+        return;
+    }
+
+    l->description = steal(&config.description);
+    // if variant omits brief, inherit from parent layout.
+    l->brief = (config.brief == NULL && parent)
+        ? strdup_safe(rxkb_layout_get_brief(parent))
+        : steal(&config.brief);
+    parse_config_item_lists(xmlDocGetRootElement(doc), l, parent);
+    config_item_free(&config);
+    xmlFreeDoc(doc);
+}
+
+static void
+rxkb_option_group_resolve(struct rxkb_option_group *g)
+{
+    if (!g->lazy.file)
+        return;
+
+    struct rxkb_context *ctx = container_of(g->base.parent,
+                                            struct rxkb_context, base);
+    struct config_item config = config_item_new(g->popularity);
+
+    xmlDoc *doc = resolve_config_item(ctx, &g->lazy, &config);
+    if (!doc)
+        return;
+
+    g->description = steal(&config.description);
+    config_item_free(&config);
+    xmlFreeDoc(doc);
+}
+
+static void
+rxkb_option_resolve(struct rxkb_option *o)
+{
+    if (!o->lazy.file)
+        return;
+
+    struct rxkb_option_group *g = container_of(o->base.parent,
+                                               struct rxkb_option_group, base);
+    struct rxkb_context *ctx = container_of(g->base.parent,
+                                            struct rxkb_context, base);
+    struct config_item config = config_item_new(o->popularity);
+
+    xmlDoc *doc = resolve_config_item(ctx, &o->lazy, &config);
+    if (!doc)
+        return;
+
+    o->description = steal(&config.description);
+    config_item_free(&config);
+    xmlFreeDoc(doc);
+}
@@ -18,6 +18,15 @@
 #include "utils-numbers.h"
 #include "utf8.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define SCANNER_SIMD_SSE2 1
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define SCANNER_SIMD_NEON 1
+#endif
+
 /* Point to some substring in the file; used to avoid copying. */
 struct sval {
     size_t len;
@@ -47,6 +56,15 @@ svaleq_prefix(struct sval s1, struct sval s2)
 #define SVAL_LIT(literal) SVAL(literal, sizeof(literal) - 1)
 #define SVAL_INIT(literal) { .start = (literal), .len = sizeof(literal) - 1 }
 
+/*
+ * A string literal. Literals without escape sequences point directly into the
+ * input buffer; otherwise they point to the unescaped copy in `owned`.
+ */
+struct string_literal {
+    struct sval sval;
+    char *owned;
+};
+
 /* A line:column location in the input string (1-based). */
 struct scanner_loc {
     size_t line, column;
@@ -151,6 +169,205 @@ scanner_next(struct scanner *s)
     return s->s[s->pos++];
 }
 
+/** Character classes for `scanner_span()` */
+enum scanner_chars {
+    /** `is_space()` */
+    SCANNER_CHARS_SPACE,
+    /** `is_space()`, except new line */
+    SCANNER_CHARS_SPACE_NO_EOL,
+    /** Space, tabulation and carriage return */
+    SCANNER_CHARS_SPACE_TAB_CR,
+    /** `is_alnum()` and underscore */
+    SCANNER_CHARS_IDENT,
+    /** `is_graph()`, except backslash */
+    SCANNER_CHARS_GRAPH_NO_BACKSLASH,
+    /** Any character, except double quote, backslash and new line */
+    SCANNER_CHARS_STRING,
+    /** Any character, except `>` and new line */
+    SCANNER_CHARS_ANGLE_LITERAL,
+    /** Any character, except braces, `"`, `<`, `#`, `/` and NULL */
+    SCANNER_CHARS_BLOCK,
+};
+
+static inline bool
+scanner_chars_match(enum scanner_chars chars, char ch)
+{
+    switch (chars) {
+    case SCANNER_CHARS_SPACE:
+        return is_space(ch);
+    case SCANNER_CHARS_SPACE_NO_EOL:
+        return is_space(ch) && ch != '\n';
+    case SCANNER_CHARS_SPACE_TAB_CR:
+        return ch == ' ' || ch == '\t' || ch == '\r';
+    case SCANNER_CHARS_IDENT:
+        return is_alnum(ch) || ch == '_';
+    case SCANNER_CHARS_GRAPH_NO_BACKSLASH:
+        return is_graph(ch) && ch != '\\';
+    case SCANNER_CHARS_STRING:
+        return ch != '"' && ch != '\\' && ch != '\n';
+    case SCANNER_CHARS_ANGLE_LITERAL:
+        return ch != '>' && ch != '\n';
+    case SCANNER_CHARS_BLOCK:
+        return ch != '{' && ch != '}' && ch != '"' && ch != '<' &&
+               ch != '#' && ch != '/' && ch != '\0';
+    default:
+        return false;
+    }
+}
+
+#if SCANNER_SIMD_SSE2
+/* Unsigned comparison: v <= k */
+#define scanner_sse2_le(v, k) _mm_cmpeq_epi8(_mm_min_epu8((v), (k)), (v))
+#define scanner_sse2_in_range(v, lo, hi) \
+    scanner_sse2_le(_mm_sub_epi8((v), _mm_set1_epi8(lo)), \
+                    _mm_set1_epi8((char) ((hi) - (lo))))
+#define scanner_sse2_eq(v, ch) _mm_cmpeq_epi8((v), _mm_set1_epi8(ch))
+
+static inline __m128i
+scanner_chars_match_sse2(enum scanner_chars chars, __m128i x)
+{
+    const __m128i ones = _mm_set1_epi8(-1);
+    __m128i m;
+    switch (chars) {
+    case SCANNER_CHARS_SPACE:
+    case SCANNER_CHARS_SPACE_NO_EOL:
+        m = _mm_or_si128(scanner_sse2_eq(x, ' '),
+                         scanner_sse2_in_range(x, '\t', '\r'));
+        if (chars == SCANNER_CHARS_SPACE_NO_EOL)
+            m = _mm_andnot_si128(scanner_sse2_eq(x, '\n'), m);
+        return m;
+    case SCANNER_CHARS_SPACE_TAB_CR:
+        return _mm_or_si128(_mm_or_si128(scanner_sse2_eq(x, ' '),
+                                         scanner_sse2_eq(x, '\t')),
+                            scanner_sse2_eq(x, '\r'));
+    case SCANNER_CHARS_IDENT:
+        /* ASCII letters are case-folded by setting the bit 0x20 */
+        m = scanner_sse2_in_range(_mm_or_si128(x, _mm_set1_epi8(0x20)),
+                                  'a', 'z');
+        m = _mm_or_si128(m, scanner_sse2_in_range(x, '0', '9'));
+        return _mm_or_si128(m, scanner_sse2_eq(x, '_'));
+    case SCANNER_CHARS_GRAPH_NO_BACKSLASH:
+        return _mm_andnot_si128(scanner_sse2_eq(x, '\\'),
+                                scanner_sse2_in_range(x, '!', '~'));
+    case SCANNER_CHARS_STRING:
+        m = _mm_or_si128(_mm_or_si128(scanner_sse2_eq(x, '"'),
+                                      scanner_sse2_eq(x, '\\')),
+                         scanner_sse2_eq(x, '\n'));
+        return _mm_xor_si128(m, ones);
+    case SCANNER_CHARS_ANGLE_LITERAL:
+        m = _mm_or_si128(scanner_sse2_eq(x, '>'), scanner_sse2_eq(x, '\n'));
+        return _mm_xor_si128(m, ones);
+    case SCANNER_CHARS_BLOCK:
+        m = _mm_or_si128(scanner_sse2_eq(x, '{'), scanner_sse2_eq(x, '}'));
+        m = _mm_or_si128(m, _mm_or_si128(scanner_sse2_eq(x, '"'),
+                                         scanner_sse2_eq(x, '<')));
+        m = _mm_or_si128(m, _mm_or_si128(scanner_sse2_eq(x, '#'),
+                                         scanner_sse2_eq(x, '/')));
+        m = _mm_or_si128(m, scanner_sse2_eq(x, '\0'));
+        return _mm_xor_si128(m, ones);
+    default:
+        return _mm_setzero_si128();
+    }
+}
+#elif SCANNER_SIMD_NEON
+#define scanner_neon_in_range(v, lo, hi) \
+    vcleq_u8(vsubq_u8((v), vdupq_n_u8(lo)), vdupq_n_u8((hi) - (lo)))
+#define scanner_neon_eq(v, ch) vceqq_u8((v), vdupq_n_u8(ch))
+
+static inline uint8x16_t
+scanner_chars_match_neon(enum scanner_chars chars, uint8x16_t x)
+{
+    uint8x16_t m;
+    switch (chars) {
+    case SCANNER_CHARS_SPACE:
+    case SCANNER_CHARS_SPACE_NO_EOL:
+        m = vorrq_u8(scanner_neon_eq(x, ' '),
+                     scanner_neon_in_range(x, '\t', '\r'));
+        if (chars == SCANNER_CHARS_SPACE_NO_EOL)
+            m = vbicq_u8(m, scanner_neon_eq(x, '\n'));
+        return m;
+    case SCANNER_CHARS_SPACE_TAB_CR:
+        return vorrq_u8(vorrq_u8(scanner_neon_eq(x, ' '),
+                                 scanner_neon_eq(x, '\t')),
+                        scanner_neon_eq(x, '\r'));
+    case SCANNER_CHARS_IDENT:
+        /* ASCII letters are case-folded by setting the bit 0x20 */
+        m = scanner_neon_in_range(vorrq_u8(x, vdupq_n_u8(0x20)), 'a', 'z');
+        m = vorrq_u8(m, scanner_neon_in_range(x, '0', '9'));
+        return vorrq_u8(m, scanner_neon_eq(x, '_'));
+    case SCANNER_CHARS_GRAPH_NO_BACKSLASH:
+        return vbicq_u8(scanner_neon_in_range(x, '!', '~'),
+                        scanner_neon_eq(x, '\\'));
+    case SCANNER_CHARS_STRING:
+        m = vorrq_u8(vorrq_u8(scanner_neon_eq(x, '"'),
+                              scanner_neon_eq(x, '\\')),
+                     scanner_neon_eq(x, '\n'));
+        return vmvnq_u8(m);
+    case SCANNER_CHARS_ANGLE_LITERAL:
+        m = vorrq_u8(scanner_neon_eq(x, '>'), scanner_neon_eq(x, '\n'));
+        return vmvnq_u8(m);
+    case SCANNER_CHARS_BLOCK:
+        m = vorrq_u8(scanner_neon_eq(x, '{'), scanner_neon_eq(x, '}'));
+        m = vorrq_u8(m, vorrq_u8(scanner_neon_eq(x, '"'),
+                                 scanner_neon_eq(x, '<')));
+        m = vorrq_u8(m, vorrq_u8(scanner_neon_eq(x, '#'),
+                                 scanner_neon_eq(x, '/')));
+        m = vorrq_u8(m, scanner_neon_eq(x, '\0'));
+        return vmvnq_u8(m);
+    default:
+        return vdupq_n_u8(0);
+    }
+}
+#endif
+
+/**
+ * Return the length of the longest prefix of a string that contains only
+ * characters of the given class.
+ *
+ * Uses SIMD instructions when available, by blocks of 16 bytes.
+ */
+static inline size_t
+scanner_span(const char *str, size_t len, enum scanner_chars chars)
+{
+    size_t i = 0;
+#if SCANNER_SIMD_SSE2
+    for (; i + 16 <= len; i += 16) {
+        const __m128i x = _mm_loadu_si128((const __m128i *) (str + i));
+        const uint32_t mismatch =
+            (uint32_t) _mm_movemask_epi8(scanner_chars_match_sse2(chars, x))
+            ^ UINT32_C(0xffff);
+        if (mismatch)
+            return i + ctz32(mismatch);
+    }
+#elif SCANNER_SIMD_NEON
+    for (; i + 16 <= len; i += 16) {
+        const uint8x16_t x = vld1q_u8((const uint8_t *) (str + i));
+        const uint8x16_t m = scanner_chars_match_neon(chars, x);
+        /* Narrow to 4 bits per byte, as NEON has no “movemask” */
+        const uint64_t mismatch = ~vget_lane_u64(
+            vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+        if (mismatch) {
+            const unsigned int bit = ((uint32_t) mismatch)
+                ? ctz32((uint32_t) mismatch)
+                : 32 + ctz32((uint32_t) (mismatch >> 32));
+            return i + bit / 4;
+        }
+    }
+#endif
+    while (i < len && scanner_chars_match(chars, str[i]))
+        i++;
+    return i;
+}
+
+/* Skip the characters of the given class; returns the count of skipped bytes */
+static inline size_t
+scanner_skip_chars(struct scanner *s, enum scanner_chars chars)
+{
+    const size_t count = scanner_span(s->s + s->pos, s->len - s->pos, chars);
+    s->pos += count;
+    return count;
+}
+
 static inline bool
 scanner_chr(struct scanner *s, char ch)
 {
@@ -182,6 +399,16 @@ scanner_buf_append(struct scanner *s, char ch)
     return true;
 }
 
+/* Append as many bytes as possible; returns false if truncated */
+static inline bool
+scanner_buf_appendn(struct scanner *s, const char *str, size_t len)
+{
+    const size_t count = MIN(len, sizeof(s->buf) - 1 - s->buf_pos);
+    memcpy(s->buf + s->buf_pos, str, count);
+    s->buf_pos += count;
+    return count == len;
+}
+
 static inline bool
 scanner_buf_appends(struct scanner *s, const char *str)
 {
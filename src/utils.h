@@ -299,6 +299,79 @@ open_file(const char *path);
 # define unlikely(x) (x)
 #endif
 
+/*
+ * Minimal atomics, used to publish immutable caches shared between threads.
+ * Use C11 atomics if available, else the GCC builtins or the MSVC intrinsics.
+ * Only `int` and pointer objects are supported.
+ */
+#ifndef __STDC_NO_ATOMICS__
+# include <stdatomic.h>
+# define XKB_ATOMIC(type) _Atomic(type)
+# define xkb_atomic_load(ptr) atomic_load(ptr)
+# define xkb_atomic_store(ptr, value) atomic_store(ptr, value)
+# define xkb_atomic_compare_exchange(ptr, expected, desired) \
+    atomic_compare_exchange_strong(ptr, expected, desired)
+#elif defined(__GNUC__)
+# define XKB_ATOMIC(type) type
+# define xkb_atomic_load(ptr) __atomic_load_n(ptr, __ATOMIC_SEQ_CST)
+# define xkb_atomic_store(ptr, value) \
+    __atomic_store_n(ptr, value, __ATOMIC_SEQ_CST)
+# define xkb_atomic_compare_exchange(ptr, expected, desired) \
+    __atomic_compare_exchange_n(ptr, expected, desired, false, \
+                                __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)
+#elif defined(_MSC_VER)
+# include <intrin.h>
+# define XKB_ATOMIC(type) type volatile
+static inline int
+xkb_atomic_load_int(int volatile *ptr)
+{
+    return (int) _InterlockedOr((long volatile *) ptr, 0);
+}
+static inline void *
+xkb_atomic_load_ptr(void * volatile *ptr)
+{
+    return _InterlockedCompareExchangePointer(ptr, NULL, NULL);
+}
+static inline bool
+xkb_atomic_compare_exchange_int(int volatile *ptr, int *expected, int desired)
+{
+    const long prev = _InterlockedCompareExchange((long volatile *) ptr,
+                                                  desired, *expected);
+    if (prev == *expected)
+        return true;
+    *expected = (int) prev;
+    return false;
+}
+static inline bool
+xkb_atomic_compare_exchange_ptr(void * volatile *ptr, void *expected,
+                                void *desired)
+{
+    void ** const exp = expected;
+    void * const prev = _InterlockedCompareExchangePointer(ptr, desired, *exp);
+    if (prev == *exp)
+        return true;
+    *exp = prev;
+    return false;
+}
+# define xkb_atomic_load(ptr) _Generic(*(ptr),                              \
+    int: xkb_atomic_load_int((int volatile *) (ptr)),                        \
+    default: xkb_atomic_load_ptr((void * volatile *) (ptr)))
+# define xkb_atomic_store(ptr, value) _Generic(*(ptr),                      \
+    int: (void) _InterlockedExchange((long volatile *) (ptr),                \
+                                     (long) (intptr_t) (value)),             \
+    default: (void) _InterlockedExchangePointer((void * volatile *) (ptr),   \
+                                                (void *) (intptr_t) (value)))
+# define xkb_atomic_compare_exchange(ptr, expected, desired) _Generic(*(ptr),\
+    int: xkb_atomic_compare_exchange_int((int volatile *) (ptr),             \
+                                         (int *) (expected),                 \
+                                         (int) (intptr_t) (desired)),        \
+    default: xkb_atomic_compare_exchange_ptr((void * volatile *) (ptr),      \
+                                             (expected),                     \
+                                             (void *) (intptr_t) (desired)))
+#else
+# error "C11 atomics, the GCC atomic builtins or the MSVC intrinsics are required"
+#endif
+
 /* Compiler Attributes */
 
 /* Private functions only exposed in tests. */
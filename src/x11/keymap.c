@@ -6,6 +6,7 @@
 #include "config.h"
 
 #include <assert.h>
+#include <xcb/xcbext.h>
 #include <xcb/xkb.h>
 
 #include "darray.h"
@@ -449,26 +450,13 @@ fail:
 }
 
 static bool
-get_sym_maps(struct xkb_keymap *keymap, xcb_connection_t *conn,
-             xcb_xkb_get_map_reply_t *reply, xcb_xkb_get_map_map_t *map)
+get_key_sym_maps(struct xkb_keymap *keymap, xcb_xkb_get_map_reply_t *reply,
+                 xcb_xkb_get_map_map_t *map)
 {
     int sym_maps_length = xcb_xkb_get_map_map_syms_rtrn_length(reply, map);
     xcb_xkb_key_sym_map_iterator_t sym_maps_iter =
         xcb_xkb_get_map_map_syms_rtrn_iterator(reply, map);
 
-    FAIL_UNLESS(reply->minKeyCode <= reply->maxKeyCode);
-    FAIL_UNLESS(reply->firstKeySym >= reply->minKeyCode);
-    FAIL_UNLESS(reply->firstKeySym + reply->nKeySyms <= reply->maxKeyCode + 1);
-
-    keymap->min_key_code = reply->minKeyCode;
-    keymap->max_key_code = reply->maxKeyCode;
-    keymap->num_keys = keymap->num_keys_low = reply->maxKeyCode + 1;
-
-    ALLOC_OR_FAIL(keymap->keys, keymap->max_key_code + 1);
-
-    for (xkb_keycode_t kc = keymap->min_key_code; kc <= keymap->max_key_code; kc++)
-        keymap->keys[kc].keycode = kc;
-
     for (int i = 0; i < sym_maps_length; i++) {
         xcb_xkb_key_sym_map_t *wire_sym_map = sym_maps_iter.data;
         struct xkb_key *key = &keymap->keys[reply->firstKeySym + i];
@@ -535,6 +523,29 @@ fail:
     return false;
 }
 
+static bool
+get_sym_maps(struct xkb_keymap *keymap, xcb_connection_t *conn,
+             xcb_xkb_get_map_reply_t *reply, xcb_xkb_get_map_map_t *map)
+{
+    FAIL_UNLESS(reply->minKeyCode <= reply->maxKeyCode);
+    FAIL_UNLESS(reply->firstKeySym >= reply->minKeyCode);
+    FAIL_UNLESS(reply->firstKeySym + reply->nKeySyms <= reply->maxKeyCode + 1);
+
+    keymap->min_key_code = reply->minKeyCode;
+    keymap->max_key_code = reply->maxKeyCode;
+    keymap->num_keys = keymap->num_keys_low = reply->maxKeyCode + 1;
+
+    ALLOC_OR_FAIL(keymap->keys, keymap->max_key_code + 1);
+
+    for (xkb_keycode_t kc = keymap->min_key_code; kc <= keymap->max_key_code; kc++)
+        keymap->keys[kc].keycode = kc;
+
+    return get_key_sym_maps(keymap, reply, map);
+
+fail:
+    return false;
+}
+
 static bool
 get_actions(struct xkb_keymap *keymap, xcb_connection_t *conn,
             xcb_xkb_get_map_reply_t *reply, xcb_xkb_get_map_map_t *map)
@@ -547,9 +558,9 @@ get_actions(struct xkb_keymap *keymap, xcb_connection_t *conn,
     xcb_xkb_key_sym_map_iterator_t sym_maps_iter =
         xcb_xkb_get_map_map_syms_rtrn_iterator(reply, map);
 
-    FAIL_UNLESS(reply->firstKeyAction == keymap->min_key_code);
-    FAIL_UNLESS(reply->firstKeyAction + reply->nKeyActions ==
-                keymap->max_key_code + 1);
+    /* Actions are iterated together with the symbols maps */
+    FAIL_UNLESS(reply->firstKeyAction == reply->firstKeySym);
+    FAIL_UNLESS(reply->nKeyActions == reply->nKeySyms);
 
     for (int i = 0; i < acts_count_length; i++) {
         xcb_xkb_key_sym_map_t *wire_sym_map = sym_maps_iter.data;
@@ -706,6 +717,13 @@ get_modmaps(struct xkb_keymap *keymap, xcb_connection_t *conn,
 
     darray(ModMapEntry) modmaps = darray_new();
 
+    /* Keep the entries outside the range of the reply, if any (update) */
+    const xkb_keycode_t first = reply->firstModMapKey;
+    const xkb_keycode_t last = first + reply->nModMapKeys;
+    darray_size_t m = 0;
+    for (; m < keymap->num_modmaps && keymap->modmaps[m].keyCode < first; m++)
+        darray_append(modmaps, keymap->modmaps[m]);
+
     for (int i = 0; i < length; i++) {
         xcb_xkb_key_mod_map_t *wire = iter.data;
         struct xkb_key *key;
@@ -726,6 +744,12 @@ get_modmaps(struct xkb_keymap *keymap, xcb_connection_t *conn,
         xcb_xkb_key_mod_map_next(&iter);
     }
 
+    for (; m < keymap->num_modmaps; m++) {
+        if (keymap->modmaps[m].keyCode >= last)
+            darray_append(modmaps, keymap->modmaps[m]);
+    }
+
+    free(keymap->modmaps);
     darray_steal(modmaps, &keymap->modmaps, &keymap->num_modmaps);
     return true;
 
@@ -763,11 +787,13 @@ fail:
 
 static bool
 get_map(struct xkb_keymap *keymap, xcb_connection_t *conn,
-        xcb_xkb_get_map_cookie_t cookie)
+        xcb_xkb_get_map_reply_t *reply)
 {
-    xcb_xkb_get_map_reply_t *reply = xcb_xkb_get_map_reply(conn, cookie, NULL);
     xcb_xkb_get_map_map_t map;
 
+    /* A frozen keymap must not be modified */
+    assert(!keymap->frozen && !keymap->high_keys);
+
     FAIL_IF_BAD_REPLY(reply, "XkbGetMap");
 
     if ((reply->present & get_map_required_components) != get_map_required_components)
@@ -787,19 +813,23 @@ get_map(struct xkb_keymap *keymap, xcb_connection_t *conn,
                                &map);
 
     if (!get_types(keymap, conn, reply, &map) ||
-        !get_sym_maps(keymap, conn, reply, &map) ||
-        !get_actions(keymap, conn, reply, &map) ||
+        !get_sym_maps(keymap, conn, reply, &map))
+        goto fail;
+
+    FAIL_UNLESS(reply->firstKeyAction == keymap->min_key_code);
+    FAIL_UNLESS(reply->firstKeyAction + reply->nKeyActions ==
+                keymap->max_key_code + 1);
+
+    if (!get_actions(keymap, conn, reply, &map) ||
         !get_vmods(keymap, conn, reply, &map) ||
         !get_explicits(keymap, conn, reply, &map) ||
         !get_modmaps(keymap, conn, reply, &map) ||
         !get_vmodmaps(keymap, conn, reply, &map))
         goto fail;
 
-    free(reply);
     return true;
 
 fail:
-    free(reply);
     return false;
 }
 
@@ -860,21 +890,16 @@ fail:
 
 static bool
 get_indicator_map(struct xkb_keymap *keymap, xcb_connection_t *conn,
-                  xcb_xkb_get_indicator_map_cookie_t cookie)
+                  xcb_xkb_get_indicator_map_reply_t *reply)
 {
-    xcb_xkb_get_indicator_map_reply_t *reply =
-        xcb_xkb_get_indicator_map_reply(conn, cookie, NULL);
-
     FAIL_IF_BAD_REPLY(reply, "XkbGetIndicatorMap");
 
     if (!get_indicators(keymap, conn, reply))
         goto fail;
 
-    free(reply);
     return true;
 
 fail:
-    free(reply);
     return false;
 }
 
@@ -954,21 +979,16 @@ fail:
 
 static bool
 get_compat_map(struct xkb_keymap *keymap, xcb_connection_t *conn,
-               xcb_xkb_get_compat_map_cookie_t cookie)
+               xcb_xkb_get_compat_map_reply_t *reply)
 {
-    xcb_xkb_get_compat_map_reply_t *reply =
-        xcb_xkb_get_compat_map_reply(conn, cookie, NULL);
-
     FAIL_IF_BAD_REPLY(reply, "XkbGetCompatMap");
 
     if (!get_sym_interprets(keymap, conn, reply))
         goto fail;
 
-    free(reply);
     return true;
 
 fail:
-    free(reply);
     return false;
 }
 
@@ -1181,11 +1201,9 @@ fail:
 
 static bool
 get_names(struct xkb_keymap *keymap, struct x11_atom_interner *interner,
-          xcb_xkb_get_names_cookie_t cookie)
+          xcb_xkb_get_names_reply_t *reply)
 {
     xcb_connection_t *conn = interner->conn;
-    xcb_xkb_get_names_reply_t *reply =
-        xcb_xkb_get_names_reply(conn, cookie, NULL);
     xcb_xkb_get_names_value_list_t list;
 
     FAIL_IF_BAD_REPLY(reply, "XkbGetNames");
@@ -1219,21 +1237,16 @@ get_names(struct xkb_keymap *keymap, struct x11_atom_interner *interner,
         !get_aliases(keymap, conn, reply, &list))
         goto fail;
 
-    free(reply);
     return true;
 
 fail:
-    free(reply);
     return false;
 }
 
 static bool
 get_controls(struct xkb_keymap *keymap, xcb_connection_t *conn,
-             xcb_xkb_get_controls_cookie_t cookie)
+             xcb_xkb_get_controls_reply_t *reply)
 {
-    xcb_xkb_get_controls_reply_t *reply =
-        xcb_xkb_get_controls_reply(conn, cookie, NULL);
-
     FAIL_IF_BAD_REPLY(reply, "XkbGetControls");
     FAIL_UNLESS(reply->numGroups > 0 && reply->numGroups <= 4);
 
@@ -1244,80 +1257,516 @@ get_controls(struct xkb_keymap *keymap, xcb_connection_t *conn,
     for (xkb_keycode_t i = keymap->min_key_code; i <= keymap->max_key_code; i++)
         keymap->keys[i].repeats = (reply->perKeyRepeat[i / 8] & (1u << (i % 8)));
 
-    free(reply);
     return true;
 
 fail:
-    free(reply);
     return false;
 }
 
-struct xkb_keymap *
-xkb_x11_keymap_new_from_device(struct xkb_context *ctx,
-                               xcb_connection_t *conn,
-                               int32_t device_id,
-                               enum xkb_keymap_compile_flags flags)
+/* Requests sent to fetch a keymap, in processing order */
+enum x11_keymap_reply {
+    X11_REPLY_MAP = 0,
+    X11_REPLY_INDICATOR_MAP,
+    X11_REPLY_COMPAT_MAP,
+    X11_REPLY_NAMES,
+    X11_REPLY_CONTROLS,
+    X11_REPLY_COUNT
+};
+
+struct xkb_x11_keymap_request {
+    struct xkb_keymap *keymap;
+    xcb_connection_t *conn;
+    struct x11_atom_interner interner;
+    /* Sequence numbers of the requests, indexed by enum x11_keymap_reply */
+    unsigned int sequences[X11_REPLY_COUNT];
+    /* Replies; NULL if the request failed */
+    void *replies[X11_REPLY_COUNT];
+    /* Mask of the received replies */
+    unsigned int received;
+    /* Set once the replies have been converted to the keymap */
+    bool processed;
+    bool failed;
+};
+
+static bool
+keymap_request_init(struct xkb_x11_keymap_request *request,
+                    struct xkb_context *ctx, xcb_connection_t *conn,
+                    int32_t device_id, enum xkb_keymap_compile_flags flags,
+                    const char *func)
 {
     if (device_id < 0 || device_id > 127) {
-        log_err_func(ctx, XKB_LOG_MESSAGE_NO_ID,
-                     "illegal device ID: %"PRId32"\n", device_id);
-        return NULL;
+        log_err(ctx, XKB_LOG_MESSAGE_NO_ID,
+                "%s: illegal device ID: %"PRId32"\n", func, device_id);
+        return false;
     }
 
     const enum xkb_keymap_format format = XKB_KEYMAP_FORMAT_TEXT_V1;
-    struct xkb_keymap * const keymap =
-        xkb_keymap_new(ctx, __func__, format, flags);
+    struct xkb_keymap * const keymap = xkb_keymap_new(ctx, func, format, flags);
     if (!keymap)
-        return NULL;
+        return false;
 
     keymap->redirect_key_auto = XKB_KEYCODE_MAX; /* Invalid X11 keycode */
 
-    struct x11_atom_interner interner;
-    x11_atom_interner_init(&interner, ctx, conn);
+    *request = (struct xkb_x11_keymap_request) {
+        .keymap = keymap,
+        .conn = conn,
+    };
+    x11_atom_interner_init(&request->interner, ctx, conn);
 
     /*
      * Send all requests together so only one roundtrip is needed
      * to get the replies.
      */
-    xcb_xkb_get_map_cookie_t map_cookie =
+    request->sequences[X11_REPLY_MAP] =
         xcb_xkb_get_map(conn, device_id, get_map_required_components,
-                        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
-    xcb_xkb_get_indicator_map_cookie_t indicator_map_cookie =
-        xcb_xkb_get_indicator_map(conn, device_id, ALL_INDICATORS_MASK);
-    xcb_xkb_get_compat_map_cookie_t compat_map_cookie =
-        xcb_xkb_get_compat_map(conn, device_id, 0, true, 0, 0);
-    xcb_xkb_get_names_cookie_t names_cookie =
-        xcb_xkb_get_names(conn, device_id, get_names_wanted);
-    xcb_xkb_get_controls_cookie_t controls_cookie =
-        xcb_xkb_get_controls(conn, device_id);
-
-    if (!get_map(keymap, conn, map_cookie))
-        goto err_map;
-    if (!get_indicator_map(keymap, conn, indicator_map_cookie))
-        goto err_indicator_map;
-    if (!get_compat_map(keymap, conn, compat_map_cookie))
-        goto err_compat_map;
-    if (!get_names(keymap, &interner, names_cookie))
-        goto err_names;
-    if (!get_controls(keymap, conn, controls_cookie))
-        goto err_controls;
-    x11_atom_interner_round_trip(&interner);
-    if (interner.had_error)
-        goto err_interner;
+                        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0).sequence;
+    request->sequences[X11_REPLY_INDICATOR_MAP] =
+        xcb_xkb_get_indicator_map(conn, device_id, ALL_INDICATORS_MASK).sequence;
+    request->sequences[X11_REPLY_COMPAT_MAP] =
+        xcb_xkb_get_compat_map(conn, device_id, 0, true, 0, 0).sequence;
+    request->sequences[X11_REPLY_NAMES] =
+        xcb_xkb_get_names(conn, device_id, get_names_wanted).sequence;
+    request->sequences[X11_REPLY_CONTROLS] =
+        xcb_xkb_get_controls(conn, device_id).sequence;
+
+    return true;
+}
+
+/*
+ * Collect the replies of the keymap requests. If `wait` is false, do not
+ * block and return whether all the replies are available.
+ */
+static bool
+keymap_request_receive(struct xkb_x11_keymap_request *request, bool wait)
+{
+    xcb_connection_t * const conn = request->conn;
+    for (unsigned int r = 0; r < X11_REPLY_COUNT; r++) {
+        if (request->received & (1u << r))
+            continue;
+
+        void *reply = NULL;
+        xcb_generic_error_t *error = NULL;
+        if (wait) {
+            reply = xcb_wait_for_reply(conn, request->sequences[r], &error);
+        } else if (!xcb_poll_for_reply(conn, request->sequences[r],
+                                       &reply, &error) &&
+                   !xcb_connection_has_error(conn)) {
+            /* Not available yet */
+            continue;
+        }
+        free(error);
+        request->replies[r] = reply;
+        request->received |= (1u << r);
+    }
+    return request->received == (1u << X11_REPLY_COUNT) - 1;
+}
+
+/* Convert the replies to the keymap; the atom names are still pending */
+static bool
+keymap_request_process(struct xkb_x11_keymap_request *request)
+{
+    struct xkb_keymap * const keymap = request->keymap;
+    xcb_connection_t * const conn = request->conn;
+    void ** const replies = request->replies;
+
+    request->processed = true;
+    request->failed =
+        !get_map(keymap, conn, replies[X11_REPLY_MAP]) ||
+        !get_indicator_map(keymap, conn, replies[X11_REPLY_INDICATOR_MAP]) ||
+        !get_compat_map(keymap, conn, replies[X11_REPLY_COMPAT_MAP]) ||
+        !get_names(keymap, &request->interner, replies[X11_REPLY_NAMES]) ||
+        !get_controls(keymap, conn, replies[X11_REPLY_CONTROLS]);
+
+    for (unsigned int r = 0; r < X11_REPLY_COUNT; r++) {
+        free(replies[r]);
+        replies[r] = NULL;
+    }
+
+    return !request->failed;
+}
+
+/* Block until the keymap is complete; returns it on success */
+static struct xkb_keymap *
+keymap_request_complete(struct xkb_x11_keymap_request *request)
+{
+    if (!request->processed) {
+        keymap_request_receive(request, true);
+        keymap_request_process(request);
+    }
+
+    if (request->failed) {
+        x11_atom_interner_discard(&request->interner);
+        return NULL;
+    }
+
+    x11_atom_interner_round_trip(&request->interner);
+    if (request->interner.had_error)
+        return NULL;
+
+    struct xkb_keymap * const keymap = request->keymap;
+    request->keymap = NULL;
+    xkb_keymap_freeze(keymap);
+    return keymap;
+}
+
+/* Release the resources; the pending replies are discarded */
+static void
+keymap_request_clear(struct xkb_x11_keymap_request *request)
+{
+    for (unsigned int r = 0; r < X11_REPLY_COUNT; r++) {
+        if (request->received & (1u << r))
+            free(request->replies[r]);
+        else
+            xcb_discard_reply(request->conn, request->sequences[r]);
+    }
+    request->received = (1u << X11_REPLY_COUNT) - 1;
+    memset(request->replies, 0, sizeof(request->replies));
+    x11_atom_interner_discard(&request->interner);
+    xkb_keymap_unref(request->keymap);
+    request->keymap = NULL;
+}
+
+struct xkb_x11_keymap_request *
+xkb_x11_keymap_request_new(struct xkb_context *ctx, xcb_connection_t *conn,
+                           int32_t device_id,
+                           enum xkb_keymap_compile_flags flags)
+{
+    struct xkb_x11_keymap_request * const request = calloc(1, sizeof(*request));
+    if (!request) {
+        log_err_func1(ctx, XKB_ERROR_ALLOCATION_FAILURE_,
+                      "could not allocate the keymap request\n");
+        return NULL;
+    }
+
+    if (!keymap_request_init(request, ctx, conn, device_id, flags, __func__)) {
+        free(request);
+        return NULL;
+    }
+
+    /* Let the client wait for the replies in its event loop */
+    xcb_flush(conn);
+    return request;
+}
 
+int
+xkb_x11_keymap_request_poll(struct xkb_x11_keymap_request *request)
+{
+    if (request->failed)
+        return -1;
+
+    if (!request->processed) {
+        if (!keymap_request_receive(request, false))
+            return 0;
+        if (!keymap_request_process(request))
+            return -1;
+        /* Send the atoms requests */
+        xcb_flush(request->conn);
+    }
+
+    return x11_atom_interner_poll(&request->interner);
+}
+
+struct xkb_keymap *
+xkb_x11_keymap_request_finish(struct xkb_x11_keymap_request *request)
+{
+    struct xkb_keymap * const keymap = keymap_request_complete(request);
+    keymap_request_clear(request);
+    free(request);
     return keymap;
+}
+
+void
+xkb_x11_keymap_request_destroy(struct xkb_x11_keymap_request *request)
+{
+    if (!request)
+        return;
+    keymap_request_clear(request);
+    free(request);
+}
+
+struct xkb_keymap *
+xkb_x11_keymap_new_from_device(struct xkb_context *ctx,
+                               xcb_connection_t *conn,
+                               int32_t device_id,
+                               enum xkb_keymap_compile_flags flags)
+{
+    struct xkb_x11_keymap_request request;
+    if (!keymap_request_init(&request, ctx, conn, device_id, flags, __func__))
+        return NULL;
+
+    struct xkb_keymap * const keymap = keymap_request_complete(&request);
+    keymap_request_clear(&request);
+    return keymap;
+}
+
+/* Components of the keyboard mapping that can be updated for a range of keys */
+static const xcb_xkb_map_part_t update_map_components =
+    (XCB_XKB_MAP_PART_KEY_SYMS |
+     XCB_XKB_MAP_PART_MODIFIER_MAP |
+     XCB_XKB_MAP_PART_EXPLICIT_COMPONENTS |
+     XCB_XKB_MAP_PART_KEY_ACTIONS |
+     XCB_XKB_MAP_PART_VIRTUAL_MOD_MAP);
+
+#define COPY_OR_FAIL(dst, src, nmemb) do {                  \
+    if ((nmemb) > 0) {                                      \
+        (dst) = memdup((src), (nmemb), sizeof(*(src)));     \
+        if (!(dst))                                         \
+            goto fail;                                      \
+    }                                                       \
+} while (0)
+
+/*
+ * Copy a keymap retrieved from the X server. Fails if the keymap uses
+ * features that X11 does not support, i.e. overlays and multiple keysyms or
+ * actions per level.
+ */
+static struct xkb_keymap *
+keymap_copy(const struct xkb_keymap *old)
+{
+    struct xkb_keymap * const keymap = malloc(sizeof(*keymap));
+    if (!keymap)
+        return NULL;
+
+    memcpy(keymap, old, sizeof(*keymap));
+    keymap->refcnt = 1;
+    keymap->ctx = xkb_context_ref(old->ctx);
+    xkb_atomic_store(&keymap->serializations, NULL);
+    xkb_atomic_store(&keymap->key_name_index, NULL);
+    xkb_atomic_store(&keymap->keysym_index, NULL);
+    /* The copy uses separate allocations, until it is frozen */
+    keymap->frozen = NULL;
+    keymap->high_keys = NULL;
+
+    /* Detach from the arrays of the old keymap, so that we can bail out */
+    keymap->keys = NULL;
+    keymap->key_aliases = NULL;
+    keymap->types = NULL;
+    keymap->num_types = 0;
+    keymap->sym_interprets = NULL;
+    keymap->num_sym_interprets = 0;
+    keymap->modmaps = NULL;
+    keymap->group_names = NULL;
+    keymap->keycodes_section_name = NULL;
+    keymap->symbols_section_name = NULL;
+    keymap->types_section_name = NULL;
+    keymap->compat_section_name = NULL;
+
+    /* Types */
+    COPY_OR_FAIL(keymap->types, old->types, old->num_types);
+    for (darray_size_t t = 0; t < old->num_types; t++) {
+        keymap->types[t].entries = NULL;
+        keymap->types[t].level_names = NULL;
+    }
+    keymap->num_types = old->num_types;
+    for (darray_size_t t = 0; t < old->num_types; t++) {
+        struct xkb_key_type * const type = &keymap->types[t];
+        COPY_OR_FAIL(type->entries, old->types[t].entries, type->num_entries);
+        COPY_OR_FAIL(type->level_names, old->types[t].level_names,
+                     type->num_level_names);
+    }
+
+    /* Keys */
+    COPY_OR_FAIL(keymap->keys, old->keys, old->num_keys);
+    for (xkb_keycode_t k = 0; k < old->num_keys; k++) {
+        keymap->keys[k].groups = NULL;
+        keymap->keys[k].overlays_keys = NULL;
+    }
+    struct xkb_key *key;
+    xkb_keys_foreach(key, keymap) {
+        const struct xkb_key * const old_key = &old->keys[key - keymap->keys];
+        if (old_key->overlays)
+            goto fail;
+        COPY_OR_FAIL(key->groups, old_key->groups, key->num_groups);
+        for (xkb_layout_index_t g = 0; g < key->num_groups; g++) {
+            key->groups[g].levels = NULL;
+            key->groups[g].type =
+                &keymap->types[old_key->groups[g].type - old->types];
+        }
+        for (xkb_layout_index_t g = 0; g < key->num_groups; g++) {
+            const xkb_level_index_t num_levels = XkbKeyNumLevels(key, g);
+            const struct xkb_level * const levels = old_key->groups[g].levels;
+            for (xkb_level_index_t l = 0; l < num_levels; l++) {
+                if (levels[l].num_syms > 1 || levels[l].num_actions > 1)
+                    goto fail;
+            }
+            COPY_OR_FAIL(key->groups[g].levels, levels, num_levels);
+        }
+    }
+
+    /* Compatibility */
+    for (darray_size_t i = 0; i < old->num_sym_interprets; i++) {
+        if (old->sym_interprets[i].num_actions > 1)
+            goto fail;
+    }
+    COPY_OR_FAIL(keymap->sym_interprets, old->sym_interprets,
+                 old->num_sym_interprets);
+    keymap->num_sym_interprets = old->num_sym_interprets;
+
+    /* Miscellaneous */
+    COPY_OR_FAIL(keymap->modmaps, old->modmaps, old->num_modmaps);
+    COPY_OR_FAIL(keymap->key_aliases, old->key_aliases, old->num_key_aliases);
+    COPY_OR_FAIL(keymap->group_names, old->group_names, old->num_group_names);
+
+    char ** const names[] = {
+        &keymap->keycodes_section_name, &keymap->symbols_section_name,
+        &keymap->types_section_name, &keymap->compat_section_name,
+    };
+    const char * const old_names[] = {
+        old->keycodes_section_name, old->symbols_section_name,
+        old->types_section_name, old->compat_section_name,
+    };
+    for (size_t n = 0; n < ARRAY_SIZE(names); n++) {
+        if (old_names[n] && !(*names[n] = strdup(old_names[n])))
+            goto fail;
+    }
 
-err_map:
-    xcb_discard_reply(conn, indicator_map_cookie.sequence);
-err_indicator_map:
-    xcb_discard_reply(conn, compat_map_cookie.sequence);
-err_compat_map:
-    xcb_discard_reply(conn, names_cookie.sequence);
-err_names:
-    xcb_discard_reply(conn, controls_cookie.sequence);
-err_controls:
-    x11_atom_interner_round_trip(&interner);
-err_interner:
+    return keymap;
+
+fail:
     xkb_keymap_unref(keymap);
     return NULL;
 }
+
+/* Apply the partial GetMap reply of the keys [first, last] */
+static bool
+get_map_update(struct xkb_keymap *keymap, xcb_connection_t *conn,
+               xcb_xkb_get_map_reply_t *reply,
+               xkb_keycode_t first, xkb_keycode_t last)
+{
+    xcb_xkb_get_map_map_t map;
+
+    /* Only the unfrozen copy of the keymap may be updated */
+    assert(!keymap->frozen && !keymap->high_keys);
+
+    FAIL_IF_BAD_REPLY(reply, "XkbGetMap");
+
+    FAIL_UNLESS((reply->present & update_map_components) ==
+                update_map_components);
+    FAIL_UNLESS(reply->minKeyCode == keymap->min_key_code &&
+                reply->maxKeyCode == keymap->max_key_code);
+    FAIL_UNLESS(reply->firstKeySym == first &&
+                reply->nKeySyms == last - first + 1);
+
+    xcb_xkb_get_map_map_unpack(xcb_xkb_get_map_map(reply),
+                               reply->nTypes,
+                               reply->nKeySyms,
+                               reply->nKeyActions,
+                               reply->totalActions,
+                               reply->totalKeyBehaviors,
+                               reply->virtualMods,
+                               reply->totalKeyExplicit,
+                               reply->totalModMapKeys,
+                               reply->totalVModMapKeys,
+                               reply->present,
+                               &map);
+
+    /* Reset the updated keys, keeping the data from the other requests */
+    for (xkb_keycode_t kc = first; kc <= last; kc++) {
+        struct xkb_key * const key = &keymap->keys[kc];
+        for (xkb_layout_index_t g = 0; g < key->num_groups; g++)
+            free(key->groups[g].levels);
+        free(key->groups);
+        *key = (struct xkb_key) {
+            .keycode = key->keycode,
+            .name = key->name,
+            .repeats = key->repeats,
+        };
+    }
+
+    if (!get_key_sym_maps(keymap, reply, &map) ||
+        !get_actions(keymap, conn, reply, &map) ||
+        !get_explicits(keymap, conn, reply, &map) ||
+        !get_modmaps(keymap, conn, reply, &map) ||
+        !get_vmodmaps(keymap, conn, reply, &map))
+        goto fail;
+
+    return true;
+
+fail:
+    return false;
+}
+
+/* Extend the range [*first, *last] with the given component range */
+static void
+extend_key_range(xkb_keycode_t *first, xkb_keycode_t *last,
+                 xcb_keycode_t range_first, uint8_t range_count)
+{
+    if (range_count == 0)
+        return;
+    const xkb_keycode_t range_last = range_first + range_count - 1u;
+    if (*first > *last) {
+        *first = range_first;
+        *last = range_last;
+    } else {
+        *first = MIN(*first, (xkb_keycode_t) range_first);
+        *last = MAX(*last, range_last);
+    }
+}
+
+struct xkb_keymap *
+xkb_x11_keymap_new_from_map_notify(struct xkb_keymap *keymap,
+                                   xcb_connection_t *conn,
+                                   const xcb_xkb_map_notify_event_t *event)
+{
+    /* Empty range */
+    xkb_keycode_t first = 1;
+    xkb_keycode_t last = 0;
+    if (event->changed & XCB_XKB_MAP_PART_KEY_SYMS)
+        extend_key_range(&first, &last, event->firstKeySym, event->nKeySyms);
+    if (event->changed & XCB_XKB_MAP_PART_KEY_ACTIONS)
+        extend_key_range(&first, &last, event->firstKeyAct, event->nKeyActs);
+    if (event->changed & XCB_XKB_MAP_PART_EXPLICIT_COMPONENTS)
+        extend_key_range(&first, &last, event->firstKeyExplicit,
+                         event->nKeyExplicit);
+    if (event->changed & XCB_XKB_MAP_PART_MODIFIER_MAP)
+        extend_key_range(&first, &last, event->firstModMapKey,
+                         event->nModMapKeys);
+    if (event->changed & XCB_XKB_MAP_PART_VIRTUAL_MOD_MAP)
+        extend_key_range(&first, &last, event->firstVModMapKey,
+                         event->nVModMapKeys);
+
+    /*
+     * Changes of the types, of the virtual modifiers or of the keycodes range
+     * affect the whole keymap: fetch it again.
+     */
+    if ((event->changed & (XCB_XKB_MAP_PART_KEY_TYPES |
+                           XCB_XKB_MAP_PART_VIRTUAL_MODS)) ||
+        event->minKeyCode != keymap->min_key_code ||
+        event->maxKeyCode != keymap->max_key_code ||
+        (first <= last && (first < keymap->min_key_code ||
+                           last > keymap->max_key_code)))
+        goto full;
+
+    /* Nothing that we handle changed, e.g. only key behaviors */
+    if (first > last)
+        return xkb_keymap_ref(keymap);
+
+    const uint8_t count = (uint8_t) (last - first + 1);
+    xcb_xkb_get_map_cookie_t cookie =
+        xcb_xkb_get_map(conn, event->deviceID, 0, update_map_components,
+                        0, 0, first, count, first, count, 0, 0, 0,
+                        first, count, first, count, first, count);
+
+    /* Copy the keymap while the server processes the request */
+    struct xkb_keymap * const updated = keymap_copy(keymap);
+    if (!updated) {
+        xcb_discard_reply(conn, cookie.sequence);
+        goto full;
+    }
+
+    xcb_xkb_get_map_reply_t * const reply =
+        xcb_xkb_get_map_reply(conn, cookie, NULL);
+    const bool ok = get_map_update(updated, conn, reply, first, last);
+    free(reply);
+    if (ok) {
+        xkb_keymap_freeze(updated);
+        return updated;
+    }
+
+    xkb_keymap_unref(updated);
+    return NULL;
+
+full:
+    return xkb_x11_keymap_new_from_device(keymap->ctx, conn, event->deviceID,
+                                          keymap->flags);
+}
@@ -21,32 +21,40 @@
 } while (0)
 
 static bool
-update_initial_state(struct xkb_state *state, xcb_connection_t *conn,
-                     uint16_t device_id, enum xkb_action_controls controls)
+update_controls(struct xkb_state *state, enum xkb_action_controls affect,
+                enum xkb_action_controls controls,
+                enum xkb_state_component *changed)
 {
-    xcb_xkb_get_state_cookie_t cookie =
-        xcb_xkb_get_state(conn, device_id);
-    xcb_xkb_get_state_reply_t *reply =
-        xcb_xkb_get_state_reply(conn, cookie, NULL);
-
-    if (!reply)
-        return false;
-
     /* NOTE: Use the public API with private enum values */
     const struct xkb_state_components_update components = {
         .size = sizeof(components),
         .components = XKB_STATE_CONTROLS,
-        .affect_controls = (enum xkb_keyboard_control_flags) controls,
+        .affect_controls = (enum xkb_keyboard_control_flags) affect,
         .controls = (enum xkb_keyboard_control_flags) controls,
     };
     const struct xkb_state_update update = {
         .size = sizeof(update),
         .components = &components,
     };
-    const int error = xkb_state_update_synthetic(state, &update, NULL);
-    if (error)
+    return xkb_state_update_synthetic(state, &update, changed) == 0;
+}
+
+static bool
+update_initial_state(struct xkb_state *state, xcb_connection_t *conn,
+                     xcb_xkb_get_state_cookie_t cookie,
+                     enum xkb_action_controls controls)
+{
+    xcb_xkb_get_state_reply_t *reply =
+        xcb_xkb_get_state_reply(conn, cookie, NULL);
+
+    if (!reply)
         return false;
 
+    if (!update_controls(state, controls, controls, NULL)) {
+        free(reply);
+        return false;
+    }
+
     xkb_state_update_mask(state,
                           reply->baseMods,
                           reply->latchedMods,
@@ -73,10 +81,10 @@ translate_state_accessibility_flags(const xcb_xkb_get_controls_reply_t *reply)
 #endif
 
 static bool
-get_controls(struct xkb_context *ctx, xcb_connection_t *conn, int32_t device_id,
+get_controls(struct xkb_context *ctx, xcb_connection_t *conn,
+             xcb_xkb_get_controls_cookie_t cookie,
              enum xkb_action_controls *controls)
 {
-    xcb_xkb_get_controls_cookie_t cookie = xcb_xkb_get_controls(conn, device_id);
     xcb_xkb_get_controls_reply_t *reply =
         xcb_xkb_get_controls_reply(conn, cookie, NULL);
 
@@ -103,22 +111,115 @@ xkb_x11_state_new_from_device(struct xkb_keymap *keymap,
         return NULL;
     }
 
+    /* Send both requests together so only one roundtrip is needed */
+    const xcb_xkb_get_controls_cookie_t controls_cookie =
+        xcb_xkb_get_controls(conn, device_id);
+    const xcb_xkb_get_state_cookie_t state_cookie =
+        xcb_xkb_get_state(conn, device_id);
+
     enum xkb_action_controls controls = 0;
-    if (!get_controls(keymap->ctx, conn, device_id, &controls))
+    if (!get_controls(keymap->ctx, conn, controls_cookie, &controls)) {
+        xcb_discard_reply(conn, state_cookie.sequence);
         return NULL;
+    }
 
     /*
      * Use the legacy state mode for compatibility, as there is no plan
      * to change the libxkbcommon X11 API.
      */
     struct xkb_state * const state = xkb_state_new(keymap);
-    if (!state)
+    if (!state) {
+        xcb_discard_reply(conn, state_cookie.sequence);
         return NULL;
+    }
 
-    if (!update_initial_state(state, conn, device_id, controls)) {
+    if (!update_initial_state(state, conn, state_cookie, controls)) {
         xkb_state_unref(state);
         return NULL;
     }
 
     return state;
 }
+
+enum xkb_state_component
+xkb_x11_state_update_from_state_notify(struct xkb_state *state,
+                                       const xcb_xkb_state_notify_event_t *event)
+{
+    return xkb_state_update_mask(state,
+                                 event->baseMods,
+                                 event->latchedMods,
+                                 event->lockedMods,
+                                 event->baseGroup,
+                                 event->latchedGroup,
+                                 event->lockedGroup);
+}
+
+enum xkb_state_component
+xkb_x11_state_update_from_controls_notify(
+    struct xkb_state *state, const xcb_xkb_controls_notify_event_t *event)
+{
+    enum xkb_state_component changed = 0;
+    if (!update_controls(state,
+                         translate_controls_mask(event->enabledControlChanges),
+                         translate_controls_mask(event->enabledControls),
+                         &changed))
+        return 0;
+    return changed;
+}
+
+enum xkb_state_component
+xkb_x11_state_update_from_events(struct xkb_state *state, int32_t device_id,
+                                 uint8_t base_event,
+                                 const xcb_generic_event_t * const *events,
+                                 size_t count)
+{
+    /*
+     * The notify events carry the whole state and the whole set of enabled
+     * controls, so only the last ones matter.
+     */
+    const xcb_xkb_state_notify_event_t *state_notify = NULL;
+    const xcb_xkb_controls_notify_event_t *controls_notify = NULL;
+    uint32_t enabled_controls_changes = 0;
+
+    for (size_t e = 0; e < count; e++) {
+        if ((events[e]->response_type & ~0x80) != base_event)
+            continue;
+
+        /* All XKB events share the same header */
+        const xcb_xkb_state_notify_event_t * const header =
+            (const xcb_xkb_state_notify_event_t *) events[e];
+        if (header->deviceID != device_id)
+            continue;
+
+        switch (header->xkbType) {
+        case XCB_XKB_STATE_NOTIFY:
+            state_notify = header;
+            break;
+        case XCB_XKB_CONTROLS_NOTIFY:
+            controls_notify =
+                (const xcb_xkb_controls_notify_event_t *) events[e];
+            enabled_controls_changes |= controls_notify->enabledControlChanges;
+            break;
+        default:
+            break;
+        }
+    }
+
+    enum xkb_state_component changed = 0;
+
+    /* Controls first, since they may affect the state */
+    if (controls_notify) {
+        enum xkb_state_component controls_changed = 0;
+        if (update_controls(state,
+                            translate_controls_mask(enabled_controls_changes),
+                            translate_controls_mask(
+                                controls_notify->enabledControls),
+                            &controls_changed))
+            changed |= controls_changed;
+    }
+
+    if (state_notify)
+        changed |= xkb_x11_state_update_from_state_notify(state, state_notify);
+
+    return changed;
+}
@@ -5,6 +5,8 @@
 
 #include "config.h"
 
+#include <xcb/xcbext.h>
+
 #include "x11-priv.h"
 
 int
@@ -109,33 +111,128 @@ xkb_x11_get_core_keyboard_device_id(xcb_connection_t *conn)
     return device_id;
 }
 
+/*
+ * The atom cache is an insert-only linear probing hash table mapping the X
+ * atoms of the connections to xkb atoms. It is allocated as a single block
+ * so that the context can free it without knowing its layout.
+ *
+ * The cache is keyed on the XCB connection. X11 atoms are actually not per
+ * connection or client, but per X server session. But better be safe just
+ * in case we survive an X server restart.
+ */
 struct x11_atom_cache {
-    /*
-     * Invalidate the cache based on the XCB connection.
-     * X11 atoms are actually not per connection or client, but per X server
-     * session. But better be safe just in case we survive an X server restart.
-     */
-    xcb_connection_t *conn;
+    /* Count of entries; a power of 2 */
+    uint32_t size;
+    /* Count of used entries */
+    uint32_t count;
     struct {
+        xcb_connection_t *conn;
         xcb_atom_t from;
         xkb_atom_t to;
-    } cache[256];
-    size_t len;
+    } entries[];
+};
+
+enum {
+    X11_ATOM_CACHE_MIN_SIZE = 256,
+    /* Reset the cache rather than growing it past this size */
+    X11_ATOM_CACHE_MAX_SIZE = 1u << 16,
 };
 
+static inline uint32_t
+hash_atom(xcb_atom_t atom)
+{
+    /* Fibonacci hashing: atoms are mostly contiguous small integers */
+    return atom * UINT32_C(2654435761);
+}
+
+static inline uint32_t
+hash_conn_atom(xcb_connection_t *conn, xcb_atom_t atom)
+{
+    return hash_atom(atom) ^ (uint32_t) ((uintptr_t) conn >> 4);
+}
+
 static struct x11_atom_cache *
-get_cache(struct xkb_context *ctx, xcb_connection_t *conn)
+x11_atom_cache_new(uint32_t size)
+{
+    struct x11_atom_cache * const cache =
+        calloc(1, sizeof(*cache) + size * sizeof(cache->entries[0]));
+    if (cache)
+        cache->size = size;
+    return cache;
+}
+
+static void
+x11_atom_cache_insert(struct x11_atom_cache *cache, xcb_connection_t *conn,
+                      xcb_atom_t from, xkb_atom_t to)
+{
+    const uint32_t mask = cache->size - 1;
+    for (uint32_t i = hash_conn_atom(conn, from);; i++) {
+        const uint32_t pos = i & mask;
+        if (cache->entries[pos].from == XCB_ATOM_NONE) {
+            cache->entries[pos].conn = conn;
+            cache->entries[pos].from = from;
+            cache->entries[pos].to = to;
+            cache->count++;
+            return;
+        }
+        if (cache->entries[pos].from == from && cache->entries[pos].conn == conn)
+            return;
+    }
+}
+
+static xkb_atom_t
+x11_atom_cache_lookup(const struct x11_atom_cache *cache,
+                      xcb_connection_t *conn, xcb_atom_t from)
 {
-    if (!ctx->x11_atom_cache) {
-        ctx->x11_atom_cache = calloc(1, sizeof(struct x11_atom_cache));
+    const uint32_t mask = cache->size - 1;
+    for (uint32_t i = hash_conn_atom(conn, from);; i++) {
+        const uint32_t pos = i & mask;
+        if (cache->entries[pos].from == XCB_ATOM_NONE)
+            return XKB_ATOM_NONE;
+        if (cache->entries[pos].from == from && cache->entries[pos].conn == conn)
+            return cache->entries[pos].to;
     }
-    /* Can be NULL in case the malloc failed. */
-    struct x11_atom_cache *cache = ctx->x11_atom_cache;
-    if (cache && cache->conn != conn) {
-        cache->conn = conn;
-        cache->len = 0;
+}
+
+/* Can return NULL in case the malloc failed. */
+static struct x11_atom_cache *
+get_cache(struct xkb_context *ctx)
+{
+    if (!ctx->x11_atom_cache)
+        ctx->x11_atom_cache = x11_atom_cache_new(X11_ATOM_CACHE_MIN_SIZE);
+    return ctx->x11_atom_cache;
+}
+
+static void
+add_to_cache(struct xkb_context *ctx, xcb_connection_t *conn,
+             xcb_atom_t from, xkb_atom_t to)
+{
+    struct x11_atom_cache *cache = get_cache(ctx);
+    if (!cache)
+        return;
+
+    /* Keep the load factor under 1/2 */
+    if (cache->count + 1 > cache->size / 2) {
+        struct x11_atom_cache * const new_cache =
+            x11_atom_cache_new(cache->size < X11_ATOM_CACHE_MAX_SIZE
+                                ? cache->size * 2
+                                : cache->size);
+        if (!new_cache)
+            return;
+        /* Rehash, unless we reset a full cache */
+        if (new_cache->size > cache->size) {
+            for (uint32_t i = 0; i < cache->size; i++) {
+                if (cache->entries[i].from != XCB_ATOM_NONE)
+                    x11_atom_cache_insert(new_cache, cache->entries[i].conn,
+                                          cache->entries[i].from,
+                                          cache->entries[i].to);
+            }
+        }
+        free(cache);
+        ctx->x11_atom_cache = cache = new_cache;
     }
-    return cache;
+
+    x11_atom_cache_insert(cache, conn, from, to);
 }
 
 void
@@ -145,11 +242,78 @@ x11_atom_interner_init(struct x11_atom_interner *interner,
     interner->had_error = false;
     interner->ctx = ctx;
     interner->conn = conn;
-    interner->num_pending = 0;
-    interner->num_copies = 0;
+    darray_init(interner->pending);
+    interner->pending_index = NULL;
+    interner->pending_index_size = 0;
+    darray_init(interner->copies);
     interner->num_escaped = 0;
 }
 
+/* Release the arrays of the interner, which remains usable */
+static void
+x11_atom_interner_clear(struct x11_atom_interner *interner)
+{
+    darray_free(interner->pending);
+    free(interner->pending_index);
+    interner->pending_index = NULL;
+    interner->pending_index_size = 0;
+    darray_free(interner->copies);
+    interner->num_escaped = 0;
+}
+
+/* Returns the index + 1 of a pending atom, or 0 if it is not pending */
+static darray_size_t
+find_pending(const struct x11_atom_interner *interner, xcb_atom_t atom)
+{
+    if (interner->pending_index_size == 0)
+        return 0;
+    const uint32_t mask = interner->pending_index_size - 1;
+    for (uint32_t i = hash_atom(atom);; i++) {
+        const darray_size_t idx = interner->pending_index[i & mask];
+        if (idx == 0 || darray_item(interner->pending, idx - 1).from == atom)
+            return idx;
+    }
+}
+
+/* Index the last pending atom; if the allocation fails, it may be requested
+ * again */
+static void
+index_pending(struct x11_atom_interner *interner)
+{
+    const darray_size_t count = darray_size(interner->pending);
+
+    /* Keep the load factor under 1/2 */
+    if (count > interner->pending_index_size / 2) {
+        const uint32_t size = MAX(64u, interner->pending_index_size * 2);
+        darray_size_t * const index = calloc(size, sizeof(*index));
+        if (!index)
+            return;
+        free(interner->pending_index);
+        interner->pending_index = index;
+        interner->pending_index_size = size;
+        /* Rehash all the pending atoms, including the new one */
+        for (darray_size_t p = 0; p < count; p++) {
+            for (uint32_t i = hash_atom(darray_item(interner->pending, p).from);;
+                 i++) {
+                if (!index[i & (size - 1)]) {
+                    index[i & (size - 1)] = p + 1;
+                    break;
+                }
+            }
+        }
+        return;
+    }
+
+    const uint32_t mask = interner->pending_index_size - 1;
+    for (uint32_t i = hash_atom(darray_item(interner->pending, count - 1).from);;
+         i++) {
+        if (!interner->pending_index[i & mask]) {
+            interner->pending_index[i & mask] = count;
+            return;
+        }
+    }
+}
+
 void
 x11_atom_interner_adopt_atom(struct x11_atom_interner *interner,
                              const xcb_atom_t atom, xkb_atom_t *out)
@@ -159,45 +323,99 @@ x11_atom_interner_adopt_atom(struct x11_atom_interner *interner,
     if (atom == XCB_ATOM_NONE)
         return;
 
-    /* Can be NULL in case the malloc failed. */
-    struct x11_atom_cache *cache = get_cache(interner->ctx, interner->conn);
-
-retry:
-
     /* Already in the cache? */
+    const struct x11_atom_cache * const cache = interner->ctx->x11_atom_cache;
     if (cache) {
-        for (size_t c = 0; c < cache->len; c++) {
-            if (cache->cache[c].from == atom) {
-                *out = cache->cache[c].to;
-                return;
-            }
+        const xkb_atom_t cached =
+            x11_atom_cache_lookup(cache, interner->conn, atom);
+        if (cached != XKB_ATOM_NONE) {
+            *out = cached;
+            return;
         }
     }
 
     /* Already pending? */
-    for (size_t i = 0; i < interner->num_pending; i++) {
-        if (interner->pending[i].from == atom) {
-            if (interner->num_copies == ARRAY_SIZE(interner->copies)) {
-                x11_atom_interner_round_trip(interner);
-                goto retry;
-            }
+    const darray_size_t pending = find_pending(interner, atom);
+    if (pending) {
+        darray_append(interner->copies, (struct x11_atom_copy) {
+            .pending = pending - 1,
+            .out = out,
+        });
+        return;
+    }
 
-            size_t idx = interner->num_copies++;
-            interner->copies[idx].from = atom;
-            interner->copies[idx].out = out;
-            return;
-        }
+    /*
+     * We have to send a GetAtomName request. All the requests are sent
+     * together and their replies are collected in the next round trip.
+     */
+    darray_append(interner->pending, (struct x11_pending_atom) {
+        .from = atom,
+        .out = out,
+        .cookie = xcb_get_atom_name(interner->conn, atom),
+        .reply = NULL,
+        .received = false,
+    });
+    index_pending(interner);
+}
+
+/* Poll a reply; returns true if it is available */
+static bool
+poll_atom_name_reply(xcb_connection_t *conn, xcb_get_atom_name_cookie_t cookie,
+                     xcb_get_atom_name_reply_t **reply, bool *received)
+{
+    if (*received)
+        return true;
+
+    void *data = NULL;
+    xcb_generic_error_t *error = NULL;
+    if (!xcb_poll_for_reply(conn, cookie.sequence, &data, &error)) {
+        /* Not available yet, unless the connection is broken */
+        if (!xcb_connection_has_error(conn))
+            return false;
+    }
+    free(error);
+    *reply = data;
+    *received = true;
+    return true;
+}
+
+bool
+x11_atom_interner_poll(struct x11_atom_interner *interner)
+{
+    bool ready = true;
+    struct x11_pending_atom *pending;
+    darray_foreach(pending, interner->pending) {
+        ready = poll_atom_name_reply(interner->conn, pending->cookie,
+                                     &pending->reply, &pending->received)
+             && ready;
+    }
+    for (size_t i = 0; i < interner->num_escaped; i++) {
+        ready = poll_atom_name_reply(interner->conn,
+                                     interner->escaped[i].cookie,
+                                     &interner->escaped[i].reply,
+                                     &interner->escaped[i].received) && ready;
     }
+    return ready;
+}
 
-    /* We have to send a GetAtomName request */
-    if (interner->num_pending == ARRAY_SIZE(interner->pending)) {
-        x11_atom_interner_round_trip(interner);
-        assert(interner->num_pending < ARRAY_SIZE(interner->pending));
+void
+x11_atom_interner_discard(struct x11_atom_interner *interner)
+{
+    struct x11_pending_atom *pending;
+    darray_foreach(pending, interner->pending) {
+        if (pending->received)
+            free(pending->reply);
+        else
+            xcb_discard_reply(interner->conn, pending->cookie.sequence);
     }
-    size_t idx = interner->num_pending++;
-    interner->pending[idx].from = atom;
-    interner->pending[idx].out = out;
-    interner->pending[idx].cookie = xcb_get_atom_name(interner->conn, atom);
+    for (size_t i = 0; i < interner->num_escaped; i++) {
+        if (interner->escaped[i].received)
+            free(interner->escaped[i].reply);
+        else
+            xcb_discard_reply(interner->conn,
+                              interner->escaped[i].cookie.sequence);
+    }
+    x11_atom_interner_clear(interner);
 }
 
 void
@@ -205,44 +423,38 @@ x11_atom_interner_round_trip(struct x11_atom_interner *interner) {
     struct xkb_context *ctx = interner->ctx;
     xcb_connection_t *conn = interner->conn;
 
-    /* Can be NULL in case the malloc failed. */
-    struct x11_atom_cache *cache = get_cache(ctx, conn);
-
-    for (size_t i = 0; i < interner->num_pending; i++) {
-        xcb_get_atom_name_reply_t *reply;
-
-        reply = xcb_get_atom_name_reply(conn, interner->pending[i].cookie, NULL);
+    struct x11_pending_atom *pending;
+    darray_foreach(pending, interner->pending) {
+        xcb_get_atom_name_reply_t *reply = (pending->received)
+            ? pending->reply
+            : xcb_get_atom_name_reply(conn, pending->cookie, NULL);
         if (!reply) {
             interner->had_error = true;
             continue;
         }
-        xcb_atom_t x11_atom = interner->pending[i].from;
         xkb_atom_t atom = xkb_atom_intern(ctx,
                                           xcb_get_atom_name_name(reply),
                                           xcb_get_atom_name_name_length(reply));
         free(reply);
 
-        if (cache && cache->len < ARRAY_SIZE(cache->cache)) {
-            size_t idx = cache->len++;
-            cache->cache[idx].from = x11_atom;
-            cache->cache[idx].to = atom;
-        }
+        add_to_cache(ctx, conn, pending->from, atom);
 
-        *interner->pending[i].out = atom;
+        *pending->out = atom;
+    }
 
-        for (size_t j = 0; j < interner->num_copies; j++) {
-            if (interner->copies[j].from == x11_atom)
-                *interner->copies[j].out = atom;
-        }
+    struct x11_atom_copy *copy;
+    darray_foreach(copy, interner->copies) {
+        *copy->out = *darray_item(interner->pending, copy->pending).out;
     }
 
     for (size_t i = 0; i < interner->num_escaped; i++) {
-        xcb_get_atom_name_reply_t *reply;
         int length;
         char *name;
         char **out = interner->escaped[i].out;
 
-        reply = xcb_get_atom_name_reply(conn, interner->escaped[i].cookie, NULL);
+        xcb_get_atom_name_reply_t *reply = (interner->escaped[i].received)
+            ? interner->escaped[i].reply
+            : xcb_get_atom_name_reply(conn, interner->escaped[i].cookie, NULL);
         *interner->escaped[i].out = NULL;
         if (!reply) {
             interner->had_error = true;
@@ -260,9 +472,7 @@ x11_atom_interner_round_trip(struct x11_atom_interner *interner) {
         }
     }
 
-    interner->num_pending = 0;
-    interner->num_copies = 0;
-    interner->num_escaped = 0;
+    x11_atom_interner_clear(interner);
 }
 
 void
@@ -280,4 +490,6 @@ x11_atom_interner_get_escaped_atom_name(struct x11_atom_interner *interner,
     assert(idx < ARRAY_SIZE(interner->escaped));
     interner->escaped[idx].out = out;
     interner->escaped[idx].cookie = xcb_get_atom_name(interner->conn, atom);
+    interner->escaped[idx].reply = NULL;
+    interner->escaped[idx].received = false;
 }
@@ -8,30 +8,42 @@
 
 #include <xcb/xkb.h>
 
+#include "darray.h"
 #include "keymap.h"
 #include "xkbcommon/xkbcommon-x11.h"
 
+struct x11_pending_atom {
+    xcb_atom_t from;
+    xkb_atom_t *out;
+    xcb_get_atom_name_cookie_t cookie;
+    /* Reply already received by x11_atom_interner_poll(), if any */
+    xcb_get_atom_name_reply_t *reply;
+    bool received;
+};
+
+struct x11_atom_copy {
+    /* Index of the pending atom */
+    darray_size_t pending;
+    xkb_atom_t *out;
+};
+
 struct x11_atom_interner {
     struct xkb_context *ctx;
     xcb_connection_t *conn;
     bool had_error;
     /* Atoms for which we send a GetAtomName request */
-    struct {
-        xcb_atom_t from;
-        xkb_atom_t *out;
-        xcb_get_atom_name_cookie_t cookie;
-    } pending[128];
-    size_t num_pending;
+    darray(struct x11_pending_atom) pending;
+    /* Linear probing hash table: X atom -> index + 1 in `pending` */
+    darray_size_t *pending_index;
+    uint32_t pending_index_size;
     /* Atoms which were already pending but queried again */
-    struct {
-        xcb_atom_t from;
-        xkb_atom_t *out;
-    } copies[128];
-    size_t num_copies;
+    darray(struct x11_atom_copy) copies;
     /* These are not interned, but saved directly (after XkbEscapeMapName) */
     struct {
         xcb_get_atom_name_cookie_t cookie;
         char **out;
+        xcb_get_atom_name_reply_t *reply;
+        bool received;
     } escaped[4];
     size_t num_escaped;
 };
@@ -43,9 +55,22 @@ x11_atom_interner_init(struct x11_atom_interner *interner,
 void
 x11_atom_interner_round_trip(struct x11_atom_interner *interner);
 
+/*
+ * Receive the pending replies without blocking. Returns true if they are all
+ * available, so that x11_atom_interner_round_trip() will not block.
+ */
+bool
+x11_atom_interner_poll(struct x11_atom_interner *interner);
+
+/*
+ * Drop the pending requests without writing their results.
+ */
+void
+x11_atom_interner_discard(struct x11_atom_interner *interner);
+
 /*
  * Make an xkb_atom_t's from X atoms. The actual write is delayed until the next
- * call to x11_atom_interner_round_trip() or when too many atoms are pending.
+ * call to x11_atom_interner_round_trip(), so that all the requests are batched.
  */
 void
 x11_atom_interner_adopt_atom(struct x11_atom_interner *interner,
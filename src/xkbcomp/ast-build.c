@@ -209,15 +209,15 @@ ExprAppendKeySymList(ExprDef *expr, xkb_keysym_t sym)
 
 ExprDef *
 ExprKeySymListAppendString(struct scanner *scanner,
-                           ExprDef *expr, const char *string)
+                           ExprDef *expr, struct sval string)
 {
-    /* TODO: use strnlen with max len = 4 * MAX_KEYSYMS_LIST_LENGTH */
-    const size_t len = strlen(string);
+    const char *const start = string.start;
+    const size_t len = string.len;
     size_t idx = 0;
     size_t idx_cp = 1;
     while (idx < len) {
         size_t count = 0;
-        uint32_t cp = utf8_next_code_point(string + idx, len - idx, &count);
+        uint32_t cp = utf8_next_code_point(start + idx, len - idx, &count);
         if (cp == INVALID_UTF8_CODE_POINT) {
             scanner_err(scanner, XKB_ERROR_INVALID_FILE_ENCODING,
                         "Cannot convert string to keysyms: "
@@ -239,7 +239,7 @@ ExprKeySymListAppendString(struct scanner *scanner,
         idx += count;
         idx_cp++;
     }
-    assert(string[idx] == '\0');
+    assert(idx == len);
     return expr;
 error:
     FreeStmt((ParseCommon*) expr);
@@ -247,16 +247,16 @@ error:
 }
 
 xkb_keysym_t
-KeysymParseString(struct scanner *scanner, const char *string)
+KeysymParseString(struct scanner *scanner, struct sval string)
 {
-    const size_t len = strlen(string);
+    const size_t len = string.len;
     if (len == 0) {
         scanner_err(scanner, XKB_LOG_MESSAGE_NO_ID,
                     "Cannot convert string to single keysym: empty string.");
         return XKB_KEY_NoSymbol;
     }
     size_t count = 0;
-    const uint32_t cp = utf8_next_code_point(string, len, &count);
+    const uint32_t cp = utf8_next_code_point(string.start, len, &count);
     if (cp == INVALID_UTF8_CODE_POINT) {
         scanner_err(scanner, XKB_ERROR_INVALID_FILE_ENCODING,
                     "Cannot convert string to single keysym: "
@@ -265,8 +265,8 @@ KeysymParseString(struct scanner *scanner, const char *string)
     } else if (count != len) {
         scanner_err(scanner, XKB_ERROR_INVALID_FILE_ENCODING,
                     "Cannot convert string to single keysym: "
-                    "Expected a single Unicode code point, got: \"%s\".",
-                    string);
+                    "Expected a single Unicode code point, got: \"%.*s\".",
+                    (int) len, string.start);
         return XKB_KEY_NoSymbol;
     }
     const xkb_keysym_t sym = xkb_utf32_to_keysym(cp);
@@ -279,6 +279,98 @@ KeysymParseString(struct scanner *scanner, const char *string)
     return sym;
 }
 
+static bool
+resolve_keysym(struct scanner *scanner, struct sval name,
+               xkb_keysym_t *sym_rtrn)
+{
+    xkb_keysym_t sym;
+
+    if (isvaleq(name, SVAL_LIT("any")) || isvaleq(name, SVAL_LIT("nosymbol"))) {
+        *sym_rtrn = XKB_KEY_NoSymbol;
+        return true;
+    }
+
+    if (isvaleq(name, SVAL_LIT("none")) || isvaleq(name, SVAL_LIT("voidsymbol"))) {
+        *sym_rtrn = XKB_KEY_VoidSymbol;
+        return true;
+    }
+
+    /* xkb_keysym_from_name needs a C string. */
+    char buf[XKB_KEYSYM_NAME_MAX_SIZE];
+    if (name.len >= sizeof(buf)) {
+        return false;
+    }
+    memcpy(buf, name.start, name.len);
+    buf[name.len] = '\0';
+
+    sym = xkb_keysym_from_name(buf, XKB_KEYSYM_NO_FLAGS);
+    if (sym != XKB_KEY_NoSymbol) {
+        *sym_rtrn = sym;
+        check_deprecated_keysyms(scanner_warn, scanner, scanner->ctx,
+                                 sym, buf, buf, "%s", "");
+        return true;
+    }
+
+    return false;
+}
+
+xkb_keysym_t
+KeysymParseIdent(struct scanner *scanner, struct sval name)
+{
+    xkb_keysym_t sym;
+    if (!resolve_keysym(scanner, name, &sym)) {
+        scanner_warn(scanner, XKB_WARNING_UNRECOGNIZED_KEYSYM,
+                     "unrecognized keysym \"%.*s\"",
+                     (unsigned int) name.len, name.start);
+        sym = XKB_KEY_NoSymbol;
+    }
+    return sym;
+}
+
+xkb_keysym_t
+KeysymParseInteger(struct scanner *scanner, int64_t value)
+{
+    xkb_keysym_t sym;
+    if (value < XKB_KEYSYM_MIN) {
+        /* Negative value */
+        static_assert(XKB_KEYSYM_MIN == 0, "Keysyms are positive");
+        scanner_warn(scanner, XKB_ERROR_INVALID_NUMERIC_KEYSYM,
+                     "unrecognized keysym \"-%#06"PRIx64"\" (%"PRId64")",
+                     -value, value);
+        return XKB_KEY_NoSymbol;
+    }
+    /*
+     * Integers 0..9 are handled with DECIMAL_DIGIT if they were formatted as
+     * single characters '0'..'9'. Otherwise they are handled here as raw
+     * keysyms values. E.g. `01` and `0x1` are interpreted as the keysym
+     * 0x0001, while `1` is interpreted as XKB_KEY_1.
+     */
+    if (value <= XKB_KEYSYM_MAX) {
+        /*
+         * Valid keysym
+         * No normalization is performed and value is used as is.
+         */
+        sym = (xkb_keysym_t) value;
+        check_deprecated_keysyms(scanner_warn, scanner, scanner->ctx,
+                                 sym, NULL, sym, "%#06"PRIx32, "");
+    } else {
+        /* Invalid keysym */
+        scanner_warn(scanner, XKB_ERROR_INVALID_NUMERIC_KEYSYM,
+                     "unrecognized keysym \"%#06"PRIx64"\" (%"PRId64")",
+                     value, value);
+        sym = XKB_KEY_NoSymbol;
+    }
+    /*
+     * Require an extra high verbosity, because keysyms are formatted as number
+     * unless enabling pretty-pretting for the serialization.
+     */
+    scanner_vrb(scanner, XKB_LOG_VERBOSITY_COMPREHENSIVE,
+                XKB_WARNING_NUMERIC_KEYSYM,
+                "numeric keysym \"%#06"PRIx64"\" (%"PRId64")",
+                value, value);
+    return sym;
+}
+
 KeycodeDef *
 KeycodeCreate(xkb_atom_t name, int64_t value)
 {
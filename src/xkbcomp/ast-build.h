@@ -59,10 +59,16 @@ ExprAppendKeySymList(ExprDef *list, xkb_keysym_t sym);
 
 ExprDef *
 ExprKeySymListAppendString(struct scanner *param,
-                           ExprDef *expr, const char *string);
+                           ExprDef *expr, struct sval string);
 
 xkb_keysym_t
-KeysymParseString(struct scanner *scanner, const char *string);
+KeysymParseString(struct scanner *scanner, struct sval string);
+
+xkb_keysym_t
+KeysymParseIdent(struct scanner *scanner, struct sval name);
+
+xkb_keysym_t
+KeysymParseInteger(struct scanner *scanner, int64_t value);
 
 KeycodeDef *
 KeycodeCreate(xkb_atom_t name, int64_t value);
@@ -329,8 +329,21 @@ FindFileInXkbPath(struct xkb_context *ctx, const char* parent_file_name,
     FILE *file = NULL;
     char *name_buffer = NULL;
     const char *typeDir = DirectoryForInclude(type);
+    /* Cached lookups, if enabled */
+    uint8_t * const states =
+        xkb_context_include_cache_get(ctx, typeDir, name, name_len);
 
     for (unsigned int i = *offset; i < xkb_context_num_include_paths(ctx); i++) {
+        if (states) {
+            if (states[i] == INCLUDE_CACHE_UNKNOWN) {
+                ctx->include_cache.misses++;
+            } else {
+                ctx->include_cache.hits++;
+                if (states[i] == INCLUDE_CACHE_MISSING)
+                    continue;
+            }
+        }
+
         if (!snprintf_safe(buf, buf_size, "%s/%s/%.*s",
                            xkb_context_include_path_get(ctx, i),
                            typeDir, (unsigned int) name_len, name)) {
@@ -343,6 +356,8 @@ FindFileInXkbPath(struct xkb_context *ctx, const char* parent_file_name,
         }
 
         file = fopen(buf, "rb");
+        if (states)
+            states[i] = (file) ? INCLUDE_CACHE_FOUND : INCLUDE_CACHE_MISSING;
         if (file) {
             *offset = i;
             goto out;
@@ -45,6 +45,11 @@ typedef struct {
      * name -> keycode mapping
      */
     darray(KeycodeMatch) names;
+    /**
+     * Alias names, in definition order. Entries are unique, but may no longer
+     * be aliases: always check the corresponding `names` entry.
+     */
+    darray_atom aliases;
 } KeycodeStore;
 
 static inline void
@@ -53,6 +58,7 @@ keycode_store_init(KeycodeStore *store)
     darray_init(store->low);
     darray_init(store->high);
     darray_init(store->names);
+    darray_init(store->aliases);
     static_assert(XKB_KEYCODE_INVALID > XKB_KEYCODE_MAX,
                   "Hey, you can't be changing stuff like that!");
     store->min = XKB_KEYCODE_INVALID;
@@ -64,6 +70,7 @@ keycode_store_free(KeycodeStore *store)
     darray_free(store->low);
     darray_free(store->high);
     darray_free(store->names);
+    darray_free(store->aliases);
 }
 
 static inline void
@@ -173,9 +180,29 @@ keycode_store_insert_key(KeycodeStore *store, xkb_keycode_t kc, xkb_atom_t name)
 static inline bool
 keycode_store_insert_alias(KeycodeStore *store, xkb_atom_t alias, xkb_atom_t real)
 {
+    bool listed = false;
     if (alias >= darray_size(store->names)) {
         darray_resize0(store->names, alias + 1);
+    } else {
+        if (darray_item(store->names, alias).is_alias) {
+            /* Alias entries are listed on creation and never unlisted */
+            listed = true;
+        } else {
+            /*
+             * Possibly an alias overridden by a key. Atoms are usually
+             * interned in definition order, so this is rare: just search.
+             */
+            const xkb_atom_t *a;
+            darray_foreach(a, store->aliases) {
+                if (*a == alias) {
+                    listed = true;
+                    break;
+                }
+            }
+        }
     }
+    if (!listed)
+        darray_append(store->aliases, alias);
     darray_item(store->names, alias) = (KeycodeMatch) {
         .alias = {
             .found = true,
@@ -587,6 +614,7 @@ MergeKeycodeStores(KeyNamesInfo *into, KeyNamesInfo *from,
         darray_init(from->keycodes.low);
         darray_init(from->keycodes.high);
         darray_init(from->keycodes.names);
+        darray_init(from->keycodes.aliases);
     } else {
         /* Slow path: check for conflicts */
 
@@ -611,16 +639,17 @@ MergeKeycodeStores(KeyNamesInfo *into, KeyNamesInfo *from,
                 into->errorCount++;
         }
 
-        /* Aliases. */
-        KeycodeMatch *match;
-        xkb_atom_t alias;
-        darray_enumerate(alias, match, from->keycodes.names) {
+        /* Aliases, in definition order */
+        const xkb_atom_t *alias;
+        darray_foreach(alias, from->keycodes.aliases) {
+            const KeycodeMatch *match =
+                &darray_item(from->keycodes.names, *alias);
             if (!match->found || !match->is_alias)
                 continue;
 
             const KeyAliasDef def = {
                 .merge = merge,
-                .alias = alias,
+                .alias = *alias,
                 .real = match->alias.real
             };
             if (!HandleAliasDef(into, &def, report))
@@ -1092,6 +1121,10 @@ CompileKeycodes(XkbFile *file, struct xkb_keymap_info *keymap_info)
     if (!CopyKeyNamesInfoToKeymap(&keymap_info->keymap, &info))
         goto err_info;
 
+    /* Used to create the key alias list, once the key names LUT is done */
+    keymap_info->key_aliases = info.keycodes.aliases;
+    darray_init(info.keycodes.aliases);
+
     ClearKeyNamesInfo(&info);
     return true;
 
@@ -25,17 +25,50 @@
 #include "context.h"
 #include "darray.h"
 #include "keymap.h"
+#include "keysym.h"
 #include "messages-codes.h"
 #include "text.h"
 #include "utils-numbers.h"
 #include "xkbcomp-priv.h"
 
 #define BUF_CHUNK_SIZE 4096
+/*
+ * Count of trailing bytes kept in the buffer when flushing to a sink, so that
+ * the serializer may still remove trailing separators.
+ */
+#define BUF_FLUSH_KEEP 2
+
+/**
+ * State of the removal of optional whitespace, for compact serializations.
+ *
+ * The serializer always writes the whitespace; it is stripped only when the
+ * buffer is finalized or flushed, so that the lexical state must be carried
+ * over between chunks.
+ */
+struct compact_state {
+    bool enabled;
+    bool in_string;
+    bool in_escape;
+    bool in_key_name;
+    /** Last character written */
+    char last;
+};
 
 struct buf {
     char *buf;
     size_t size;
     size_t alloc;
+    /*
+     * Optional sink. If set, the buffer is flushed to it whenever it exceeds
+     * BUF_CHUNK_SIZE, so that its size remains bounded.
+     */
+    xkb_keymap_serialize_write_fn write;
+    void *write_data;
+    /** Count of bytes written to the sink */
+    size_t flushed;
+    /** Set if the sink reported a failure */
+    bool write_failed;
+    struct compact_state compact;
 };
 
 #define xkb_abs(n) _Generic((n),                \
@@ -58,6 +91,97 @@ do_realloc(struct buf *buf, size_t at_least)
     return true;
 }
 
+static inline bool
+is_word_char(char c)
+{
+    return is_alnum(c) || c == '_';
+}
+
+/**
+ * Remove the optional whitespace of the first `length` bytes of `data`,
+ * in place.
+ *
+ * A whitespace run is replaced with a single space if it separates two
+ * identifiers or numbers, else it is dropped. String literals and key names
+ * are left untouched.
+ *
+ * Returns the count of bytes processed, which is less than `length` if
+ * `data` ends with a whitespace run: it must be processed with the next
+ * token. The length of the result is stored in `*out`.
+ */
+static size_t
+compact_whitespace(struct compact_state *state, char *data, size_t length,
+                   size_t *out)
+{
+    size_t i = 0;
+    size_t o = 0;
+    while (i < length) {
+        const char c = data[i];
+        if (state->in_string) {
+            if (state->in_escape)
+                state->in_escape = false;
+            else if (c == '\\')
+                state->in_escape = true;
+            else if (c == '"')
+                state->in_string = false;
+        } else if (state->in_key_name) {
+            if (c == '>')
+                state->in_key_name = false;
+        } else if (is_space(c)) {
+            size_t next = i + 1;
+            while (next < length && is_space(data[next]))
+                next++;
+            if (next >= length)
+                break;
+            if (is_word_char(state->last) && is_word_char(data[next]))
+                data[o++] = ' ';
+            i = next;
+            continue;
+        } else if (c == '"') {
+            state->in_string = true;
+        } else if (c == '<') {
+            state->in_key_name = true;
+        }
+        data[o++] = c;
+        state->last = c;
+        i++;
+    }
+    *out = o;
+    return i;
+}
+
+/** Write all but the last `keep` bytes to the sink */
+static bool
+flush_buf(struct buf *buf, size_t keep)
+{
+    if (buf->size <= keep)
+        return true;
+
+    size_t length = buf->size - keep;
+    const size_t consumed = (buf->compact.enabled)
+        ? compact_whitespace(&buf->compact, buf->buf, length, &length)
+        : length;
+    if (!buf->write(buf->write_data, buf->buf, length)) {
+        buf->write_failed = true;
+        free(buf->buf);
+        buf->buf = NULL;
+        return false;
+    }
+
+    buf->size -= consumed;
+    memmove(buf->buf, buf->buf + consumed, buf->size);
+    buf->buf[buf->size] = '\0';
+    buf->flushed += length;
+    return true;
+}
+
+static inline bool
+maybe_flush_buf(struct buf *buf)
+{
+    return (!buf->write || buf->size < BUF_CHUNK_SIZE ||
+            flush_buf(buf, BUF_FLUSH_KEEP));
+}
+
 ATTR_PRINTF(2, 3) static bool
 check_write_buf(struct buf *buf, const char *fmt, ...)
 {
@@ -95,7 +219,7 @@ check_write_buf(struct buf *buf, const char *fmt, ...)
     }
 
     buf->size += (size_t)printed;
-    return true;
+    return maybe_flush_buf(buf);
 
 err:
     free(buf->buf);
@@ -128,7 +252,7 @@ check_copy_to_buf(struct buf *buf, const char* source, size_t len)
     buf->size += len;
     /* Append NULL byte */
     buf->buf[buf->size] = '\0';
-    return true;
+    return maybe_flush_buf(buf);
 }
 
 #define copy_to_buf_len(buf, source, len) do { \
@@ -139,6 +263,214 @@ check_copy_to_buf(struct buf *buf, const char* source, size_t len)
 #define copy_to_buf(buf, source) \
     copy_to_buf_len(buf, source, sizeof(source) - 1)
 
+#define copy_to_buf_str(buf, string) do { \
+    const char * const _s = (string); \
+    copy_to_buf_len(buf, _s, strlen(_s)); \
+} while (0)
+
+/*
+ * Specialized emitters, to avoid the overhead of `vsnprintf()` for the most
+ * common tokens.
+ */
+
+/** Write `count` spaces */
+static bool
+check_write_spaces(struct buf *buf, size_t count)
+{
+    static const char spaces[] = "                                ";
+    while (count > sizeof(spaces) - 1) {
+        if (!check_copy_to_buf(buf, spaces, sizeof(spaces) - 1))
+            return false;
+        count -= sizeof(spaces) - 1;
+    }
+    return check_copy_to_buf(buf, spaces, count);
+}
+
+/**
+ * Write a string padded with spaces, with the semantics of `%*s`: right
+ * aligned if `width` is positive, else left aligned.
+ */
+static bool
+check_write_padded(struct buf *buf, const char *string, size_t len, int width)
+{
+    const size_t abs_width = (size_t) xkb_abs(width);
+    const size_t padding = (len < abs_width) ? abs_width - len : 0;
+    if (width > 0 && !check_write_spaces(buf, padding))
+        return false;
+    if (!check_copy_to_buf(buf, string, len))
+        return false;
+    return (width >= 0 || check_write_spaces(buf, padding));
+}
+
+/** Copy the content of another buffer, with the semantics of `%*s` */
+#define copy_to_buf_padded(buf, source, width) do { \
+    if (!check_write_padded(buf, (source)->buf, (source)->size, width)) \
+        return false; \
+} while (0)
+
+/* Enough for a 32-bit integer with its sign */
+#define FORMAT_INT_SIZE 11
+
+/**
+ * Format an unsigned integer, right aligned in the given buffer, with at least
+ * `min_digits` digits. Returns the first digit.
+ */
+static inline char *
+format_uint(char *end, uint32_t value, unsigned int base,
+            const char *digits, unsigned int min_digits)
+{
+    char *p = end;
+    do {
+        *(--p) = digits[value % base];
+        value /= base;
+    } while (value);
+    while ((unsigned int) (end - p) < min_digits)
+        *(--p) = '0';
+    return p;
+}
+
+static const char lower_hex_digits[] = "0123456789abcdef";
+static const char upper_hex_digits[] = "0123456789ABCDEF";
+
+/** Same as `%"PRIu32"` */
+static bool
+check_write_uint(struct buf *buf, uint32_t value)
+{
+    char buffer[FORMAT_INT_SIZE];
+    char * const end = buffer + sizeof(buffer);
+    const char * const start = format_uint(end, value, 10, lower_hex_digits, 1);
+    return check_copy_to_buf(buf, start, (size_t) (end - start));
+}
+
+#define write_buf_uint(buf, value) do { \
+    if (!check_write_uint(buf, value)) \
+        return false; \
+} while (0)
+
+/** Same as `%"PRId32"`, or `%+"PRId32"` if `plus` is true */
+static bool
+check_write_int(struct buf *buf, int32_t value, bool plus)
+{
+    char buffer[FORMAT_INT_SIZE];
+    char * const end = buffer + sizeof(buffer);
+    const uint32_t abs_value = (value < 0)
+        ? (uint32_t) -(int64_t) value
+        : (uint32_t) value;
+    char *start = format_uint(end, abs_value, 10, lower_hex_digits, 1);
+    if (value < 0)
+        *(--start) = '-';
+    else if (plus)
+        *(--start) = '+';
+    return check_copy_to_buf(buf, start, (size_t) (end - start));
+}
+
+#define write_buf_int(buf, value, plus) do { \
+    if (!check_write_int(buf, value, plus)) \
+        return false; \
+} while (0)
+
+/** Same as `0x%0*"PRIx32"` */
+static bool
+check_write_hex(struct buf *buf, uint32_t value, unsigned int min_digits)
+{
+    char buffer[2 + 8];
+    char * const end = buffer + sizeof(buffer);
+    char *start = format_uint(end, value, 16, lower_hex_digits, min_digits);
+    *(--start) = 'x';
+    *(--start) = '0';
+    return check_copy_to_buf(buf, start, (size_t) (end - start));
+}
+
+#define write_buf_hex(buf, value, min_digits) do { \
+    if (!check_write_hex(buf, value, min_digits)) \
+        return false; \
+} while (0)
+
+/**
+ * Same as `%*s` with `xkb_keysym_get_name()`, but without copying the
+ * canonical names.
+ */
+static bool
+check_write_keysym(struct buf *buf, xkb_keysym_t ks, int width)
+{
+    const char *name = xkb_keysym_get_canonical_name(ks);
+    if (name)
+        return check_write_padded(buf, name, strlen(name), width);
+
+    char buffer[XKB_KEYSYM_NAME_MAX_SIZE];
+    char * const end = buffer + sizeof(buffer);
+    char *start;
+    if (ks > XKB_KEYSYM_MAX) {
+        start = end - (sizeof("Invalid") - 1);
+        memcpy(start, "Invalid", sizeof("Invalid") - 1);
+    } else if (ks >= XKB_KEYSYM_UNICODE_MIN && ks <= XKB_KEYSYM_UNICODE_MAX) {
+        /* Unnamed Unicode code point: same as `U%04"PRIX32` */
+        start = format_uint(end, ks & UINT32_C(0xffffff), 16,
+                            upper_hex_digits, 4);
+        *(--start) = 'U';
+    } else {
+        /* Unnamed, non-Unicode, symbol: same as `0x%08"PRIx32` */
+        start = format_uint(end, ks, 16, lower_hex_digits, 8);
+        *(--start) = 'x';
+        *(--start) = '0';
+    }
+    return check_write_padded(buf, start, (size_t) (end - start), width);
+}
+
+#define write_buf_keysym(buf, ks, width) do { \
+    if (!check_write_keysym(buf, ks, width)) \
+        return false; \
+} while (0)
+
+/**
+ * Write a keysym as a hexadecimal value, or for compact serializations with
+ * the shortest of its name and its hexadecimal value.
+ */
+static bool
+check_write_keysym_value(struct buf *buf, xkb_keysym_t ks)
+{
+    if (buf->compact.enabled) {
+        const char * const name = xkb_keysym_get_canonical_name(ks);
+        if (name) {
+            unsigned int digits = 1;
+            for (xkb_keysym_t v = ks >> 4; v; v >>= 4)
+                digits++;
+            const size_t len = strlen(name);
+            if (len < 2 + digits)
+                return check_copy_to_buf(buf, name, len);
+        }
+    }
+    return check_write_hex(buf, ks, 1);
+}
+
+#define write_buf_keysym_value(buf, ks) do { \
+    if (!check_write_keysym_value(buf, ks)) \
+        return false; \
+} while (0)
+
+/** Same as `%*s` with `KeyNameText()` */
+static bool
+check_write_key_name(struct buf *buf, struct xkb_context *ctx,
+                     xkb_atom_t name, int width)
+{
+    const char * const text = strempty(xkb_atom_text(ctx, name));
+    const size_t len = strlen(text);
+    const size_t abs_width = (size_t) xkb_abs(width);
+    const size_t padding = (len + 2 < abs_width) ? abs_width - (len + 2) : 0;
+    if (width > 0 && !check_write_spaces(buf, padding))
+        return false;
+    if (!check_copy_to_buf(buf, "<", 1) ||
+        !check_copy_to_buf(buf, text, len) ||
+        !check_copy_to_buf(buf, ">", 1))
+        return false;
+    return (width >= 0 || check_write_spaces(buf, padding));
+}
+
+#define write_buf_key_name(buf, ctx, name, width) do { \
+    if (!check_write_key_name(buf, ctx, name, width)) \
+        return false; \
+} while (0)
+
 static bool
 check_write_string_literal(struct buf *buf, const char* string)
 {
@@ -447,7 +779,7 @@ write_vmods(const struct xkb_keymap *keymap, enum xkb_keymap_format format,
         } else {
             copy_to_buf(buf, ",");
         }
-        write_buf(buf, "%s", xkb_atom_text(keymap->ctx, mod->name));
+        copy_to_buf_str(buf, xkb_atom_text(keymap->ctx, mod->name));
 
         /*
          * Ensure to always honor explicit mappings when auto canonical vmods
@@ -474,9 +806,9 @@ write_vmods(const struct xkb_keymap *keymap, enum xkb_keymap_format format,
              * Explicit non-default mapping
              * NOTE: we can only pretty-print *real* modifiers in this context.
              */
-            write_buf(buf, "=%s",
-                      ModMaskText(keymap->ctx, MOD_REAL, &keymap->mods,
-                                  mod->mapping));
+            copy_to_buf(buf, "=");
+            copy_to_buf_str(buf, ModMaskText(keymap->ctx, MOD_REAL,
+                                             &keymap->mods, mod->mapping));
         }
     }
 
@@ -509,8 +841,11 @@ write_keycodes(const struct xkb_keymap *keymap,
      * a maximum of at least 255, else XWayland really starts hating life.
      * If this is a problem and people really need strictly bounded keymaps,
      * we should probably control this with a flag. */
-    write_buf(buf, "\tminimum = %"PRIu32";\n", MIN(keymap->min_key_code, 8));
-    write_buf(buf, "\tmaximum = %"PRIu32";\n", MAX(keymap->max_key_code, 255));
+    copy_to_buf(buf, "\tminimum = ");
+    write_buf_uint(buf, MIN(keymap->min_key_code, 8));
+    copy_to_buf(buf, ";\n\tmaximum = ");
+    write_buf_uint(buf, MAX(keymap->max_key_code, 255));
+    copy_to_buf(buf, ";\n");
 
     xkb_keys_foreach(key, keymap) {
         if (key->name == XKB_ATOM_NONE)
@@ -519,16 +854,18 @@ write_keycodes(const struct xkb_keymap *keymap,
         const xkb_atom_t name = (substitutions == NULL)
             ? key->name
             : substitute_name(substitutions, key->name);
-        if (pretty)
-            write_buf(buf, "\t%-20s", KeyNameText(keymap->ctx, name));
-        else
-            write_buf(buf, "\t%s", KeyNameText(keymap->ctx, name));
-        write_buf(buf, " = %"PRIu32";\n", key->keycode);
+        copy_to_buf(buf, "\t");
+        write_buf_key_name(buf, keymap->ctx, name, (pretty ? -20 : 0));
+        copy_to_buf(buf, " = ");
+        write_buf_uint(buf, key->keycode);
+        copy_to_buf(buf, ";\n");
     }
 
     xkb_leds_enumerate(idx, led, keymap)
         if (led->name != XKB_ATOM_NONE) {
-            write_buf(buf, "\tindicator %"PRIu32" = ", idx + 1);
+            copy_to_buf(buf, "\tindicator ");
+            write_buf_uint(buf, idx + 1);
+            copy_to_buf(buf, " = ");
             write_buf_string_literal(buf, xkb_atom_text(keymap->ctx, led->name));
             copy_to_buf(buf, ";\n");
         }
@@ -541,14 +878,11 @@ write_keycodes(const struct xkb_keymap *keymap,
             ? keymap->key_aliases[i].real
             : substitute_name(substitutions, keymap->key_aliases[i].real);
 
-        if (pretty)
-            write_buf(buf, "\talias %-14s",
-                      KeyNameText(keymap->ctx, alias));
-        else
-            write_buf(buf, "\talias %s",
-                      KeyNameText(keymap->ctx, alias));
-        write_buf(buf, " = %s;\n",
-                  KeyNameText(keymap->ctx, real));
+        copy_to_buf(buf, "\talias ");
+        write_buf_key_name(buf, keymap->ctx, alias, (pretty ? -14 : 0));
+        copy_to_buf(buf, " = ");
+        write_buf_key_name(buf, keymap->ctx, real, 0);
+        copy_to_buf(buf, ";\n");
     }
 
     copy_to_buf(buf, "};\n\n");
@@ -581,9 +915,17 @@ write_types(const struct xkb_keymap *keymap, enum xkb_keymap_format format,
         write_buf_string_literal(buf, xkb_atom_text(keymap->ctx, type->name));
         copy_to_buf(buf, " {\n");
 
-        write_buf(buf, "\t\tmodifiers= %s;\n",
-                  ModMaskText(keymap->ctx, MOD_BOTH, &keymap->mods,
-                              type->mods.mods));
+        /*
+         * No modifiers is the default: omit it in compact mode, but print it
+         * for clarity otherwise
+         */
+        if (type->mods.mods || !buf->compact.enabled ||
+            (flags & XKB_KEYMAP_SERIALIZE_EXPLICIT_DEFAULT_VALUES)) {
+            copy_to_buf(buf, "\t\tmodifiers= ");
+            copy_to_buf_str(buf, ModMaskText(keymap->ctx, MOD_BOTH,
+                                             &keymap->mods, type->mods.mods));
+            copy_to_buf(buf, ";\n");
+        }
 
         for (darray_size_t j = 0; j < type->num_entries; j++) {
             const char *str;
@@ -599,8 +941,11 @@ write_types(const struct xkb_keymap *keymap, enum xkb_keymap_format format,
 
             str = ModMaskText(keymap->ctx, MOD_BOTH, &keymap->mods,
                               entry->mods.mods);
-            write_buf(buf, "\t\tmap[%s]= %"PRIu32";\n",
-                      str, entry->level + 1);
+            copy_to_buf(buf, "\t\tmap[");
+            copy_to_buf_str(buf, str);
+            copy_to_buf(buf, "]= ");
+            write_buf_uint(buf, entry->level + 1);
+            copy_to_buf(buf, ";\n");
 
             if (entry->preserve.mods)
                 write_buf(buf, "\t\tpreserve[%s]= %s;\n",
@@ -610,7 +955,9 @@ write_types(const struct xkb_keymap *keymap, enum xkb_keymap_format format,
 
         for (xkb_level_index_t n = 0; n < type->num_level_names; n++)
             if (type->level_names[n]) {
-                write_buf(buf, "\t\tlevel_name[%"PRIu32"]= ", n + 1);
+                copy_to_buf(buf, "\t\tlevel_name[");
+                write_buf_uint(buf, n + 1);
+                copy_to_buf(buf, "]= ");
                 write_buf_string_literal(
                     buf, xkb_atom_text(keymap->ctx, type->level_names[n]));
                 copy_to_buf(buf, ";\n");
@@ -637,8 +984,9 @@ write_led_map(const struct xkb_keymap *keymap, enum xkb_keymap_format format,
                       LedStateMaskText(keymap->ctx, groupComponentMaskNames,
                                        led->which_groups));
         }
-        write_buf(buf, "\t\tgroups= 0x%02"PRIx32";\n",
-                  led->groups);
+        copy_to_buf(buf, "\t\tgroups= ");
+        write_buf_hex(buf, led->groups, 2);
+        copy_to_buf(buf, ";\n");
     }
 
     if (led->which_mods) {
@@ -721,13 +1069,24 @@ write_action(const struct xkb_keymap *keymap, enum xkb_keymap_format format,
                     "in keymap format %d\n", format);
             latchOnPress = false;
         }
-        write_buf(buf, "%s%s(modifiers=%s%s%s%s%s%s)%s", prefix, type, args,
-                  (action->type != ACTION_TYPE_MOD_LOCK && (action->mods.flags & ACTION_LOCK_CLEAR)) ? ",clearLocks" : "",
-                  (action->type == ACTION_TYPE_MOD_LATCH && (action->mods.flags & ACTION_LATCH_TO_LOCK)) ? ",latchToLock" : "",
-                  (action->type == ACTION_TYPE_MOD_LOCK) ? affect_lock_text(action->mods.flags, false) : "",
-                  (unlockOnPress) ? ",unlockOnPress" : "",
-                  (latchOnPress) ? ",latchOnPress" : "",
-                  suffix);
+        copy_to_buf_str(buf, prefix);
+        copy_to_buf_str(buf, type);
+        copy_to_buf(buf, "(modifiers=");
+        copy_to_buf_str(buf, args);
+        if (action->type != ACTION_TYPE_MOD_LOCK &&
+            (action->mods.flags & ACTION_LOCK_CLEAR))
+            copy_to_buf(buf, ",clearLocks");
+        if (action->type == ACTION_TYPE_MOD_LATCH &&
+            (action->mods.flags & ACTION_LATCH_TO_LOCK))
+            copy_to_buf(buf, ",latchToLock");
+        if (action->type == ACTION_TYPE_MOD_LOCK)
+            copy_to_buf_str(buf, affect_lock_text(action->mods.flags, false));
+        if (unlockOnPress)
+            copy_to_buf(buf, ",unlockOnPress");
+        if (latchOnPress)
+            copy_to_buf(buf, ",latchOnPress");
+        copy_to_buf(buf, ")");
+        copy_to_buf_str(buf, suffix);
         break;
 
     case ACTION_TYPE_GROUP_SET:
@@ -743,13 +1102,25 @@ write_action(const struct xkb_keymap *keymap, enum xkb_keymap_format format,
                         "in keymap format %d\n", format);
                 lockOnRelease = false;
             }
-            write_buf(buf, "%s%s(group=%s%"PRId32"%s%s%s)%s", prefix, type,
-                      (!(action->group.flags & ACTION_ABSOLUTE_SWITCH) && action->group.group >= 0) ? "+" : "",
-                      (action->group.flags & ACTION_ABSOLUTE_SWITCH) ? action->group.group + 1 : action->group.group,
-                      (action->type != ACTION_TYPE_GROUP_LOCK && (action->group.flags & ACTION_LOCK_CLEAR)) ? ",clearLocks" : "",
-                      (action->type == ACTION_TYPE_GROUP_LATCH && (action->group.flags & ACTION_LATCH_TO_LOCK)) ? ",latchToLock" : "",
-                      (lockOnRelease) ? ",lockOnRelease" : "",
-                      suffix);
+            const bool absolute =
+                (action->group.flags & ACTION_ABSOLUTE_SWITCH);
+            copy_to_buf_str(buf, prefix);
+            copy_to_buf_str(buf, type);
+            copy_to_buf(buf, "(group=");
+            write_buf_int(buf, (absolute
+                                ? action->group.group + 1
+                                : action->group.group),
+                          !absolute);
+            if (action->type != ACTION_TYPE_GROUP_LOCK &&
+                (action->group.flags & ACTION_LOCK_CLEAR))
+                copy_to_buf(buf, ",clearLocks");
+            if (action->type == ACTION_TYPE_GROUP_LATCH &&
+                (action->group.flags & ACTION_LATCH_TO_LOCK))
+                copy_to_buf(buf, ",latchToLock");
+            if (lockOnRelease)
+                copy_to_buf(buf, ",lockOnRelease");
+            copy_to_buf(buf, ")");
+            copy_to_buf_str(buf, suffix);
         } else {
             /* Unsupported group index: degrade to VoidAction() */
             log_warn(keymap->ctx, XKB_LOG_MESSAGE_NO_ID,
@@ -762,85 +1133,119 @@ write_action(const struct xkb_keymap *keymap, enum xkb_keymap_format format,
         break;
 
     case ACTION_TYPE_TERMINATE:
-        write_buf(buf, "%s%s()%s", prefix, type, suffix);
+        copy_to_buf_str(buf, prefix);
+        copy_to_buf_str(buf, type);
+        copy_to_buf(buf, "()");
+        copy_to_buf_str(buf, suffix);
         break;
 
     case ACTION_TYPE_PTR_MOVE:
-        write_buf(buf, "%s%s(x=%s%d,y=%s%d%s)%s", prefix, type,
-                  (!(action->ptr.flags & ACTION_ABSOLUTE_X) && action->ptr.x >= 0) ? "+" : "",
-                  action->ptr.x,
-                  (!(action->ptr.flags & ACTION_ABSOLUTE_Y) && action->ptr.y >= 0) ? "+" : "",
-                  action->ptr.y,
-                  (action->ptr.flags & ACTION_ACCEL) ? "" : ",!accel",
-                  suffix);
+        copy_to_buf_str(buf, prefix);
+        copy_to_buf_str(buf, type);
+        copy_to_buf(buf, "(x=");
+        write_buf_int(buf, action->ptr.x,
+                      !(action->ptr.flags & ACTION_ABSOLUTE_X));
+        copy_to_buf(buf, ",y=");
+        write_buf_int(buf, action->ptr.y,
+                      !(action->ptr.flags & ACTION_ABSOLUTE_Y));
+        if (!(action->ptr.flags & ACTION_ACCEL))
+            copy_to_buf(buf, ",!accel");
+        copy_to_buf(buf, ")");
+        copy_to_buf_str(buf, suffix);
         break;
 
     case ACTION_TYPE_PTR_LOCK:
         args = affect_lock_text(action->btn.flags, true);
         /* fallthrough */
     case ACTION_TYPE_PTR_BUTTON:
-        write_buf(buf, "%s%s(button=", prefix, type);
+        copy_to_buf_str(buf, prefix);
+        copy_to_buf_str(buf, type);
+        copy_to_buf(buf, "(button=");
         if (action->btn.button > 0 && action->btn.button <= 5)
-            write_buf(buf, "%u", action->btn.button);
+            write_buf_uint(buf, action->btn.button);
         else
             copy_to_buf(buf, "default");
-        if (action->btn.count)
-            write_buf(buf, ",count=%u", action->btn.count);
+        if (action->btn.count) {
+            copy_to_buf(buf, ",count=");
+            write_buf_uint(buf, action->btn.count);
+        }
         if (args)
-            write_buf(buf, "%s", args);
-        write_buf(buf, ")%s", suffix);
+            copy_to_buf_str(buf, args);
+        copy_to_buf(buf, ")");
+        copy_to_buf_str(buf, suffix);
         break;
 
     case ACTION_TYPE_PTR_DEFAULT:
-        write_buf(buf, "%s%s(", prefix, type);
-        write_buf(buf, "affect=button,button=%s%d",
-                  (!(action->dflt.flags & ACTION_ABSOLUTE_SWITCH) && action->dflt.value >= 0) ? "+" : "",
-                  action->dflt.value);
-        write_buf(buf, ")%s", suffix);
+        copy_to_buf_str(buf, prefix);
+        copy_to_buf_str(buf, type);
+        copy_to_buf(buf, "(affect=button,button=");
+        write_buf_int(buf, action->dflt.value,
+                      !(action->dflt.flags & ACTION_ABSOLUTE_SWITCH));
+        copy_to_buf(buf, ")");
+        copy_to_buf_str(buf, suffix);
         break;
 
     case ACTION_TYPE_SWITCH_VT:
-        write_buf(buf, "%s%s(screen=%s%d,%ssame)%s", prefix, type,
-                  (!(action->screen.flags & ACTION_ABSOLUTE_SWITCH) && action->screen.screen >= 0) ? "+" : "",
-                  action->screen.screen,
-                  (action->screen.flags & ACTION_SAME_SCREEN) ? "" : "!",
-                  suffix);
+        copy_to_buf_str(buf, prefix);
+        copy_to_buf_str(buf, type);
+        copy_to_buf(buf, "(screen=");
+        write_buf_int(buf, action->screen.screen,
+                      !(action->screen.flags & ACTION_ABSOLUTE_SWITCH));
+        if (action->screen.flags & ACTION_SAME_SCREEN)
+            copy_to_buf(buf, ",same)");
+        else
+            copy_to_buf(buf, ",!same)");
+        copy_to_buf_str(buf, suffix);
         break;
 
     case ACTION_TYPE_CTRL_SET:
     case ACTION_TYPE_CTRL_LOCK:
-        write_buf(buf, "%s%s(controls=%s%s)%s", prefix, type,
-                  ControlMaskText(keymap->ctx, format, action->ctrls.ctrls),
-                  (action->type == ACTION_TYPE_CTRL_LOCK
-                    ? affect_lock_text(action->ctrls.flags, false)
-                    : ""),
-                  suffix);
+        copy_to_buf_str(buf, prefix);
+        copy_to_buf_str(buf, type);
+        copy_to_buf(buf, "(controls=");
+        copy_to_buf_str(buf, ControlMaskText(keymap->ctx, format,
+                                             action->ctrls.ctrls));
+        if (action->type == ACTION_TYPE_CTRL_LOCK)
+            copy_to_buf_str(buf, affect_lock_text(action->ctrls.flags, false));
+        copy_to_buf(buf, ")");
+        copy_to_buf_str(buf, suffix);
         break;
 
     case ACTION_TYPE_REDIRECT_KEY: {
-        write_buf(buf, "%s%s(", prefix, type);
+        copy_to_buf_str(buf, prefix);
+        copy_to_buf_str(buf, type);
+        copy_to_buf(buf, "(");
         const struct xkb_key * const key = XkbKey(keymap, action->redirect.keycode);
         /* Can fail if the keycode was not initialized */
-        if (key)
-            write_buf(buf, "keycode=%s", KeyNameText(keymap->ctx, key->name));
+        if (key) {
+            copy_to_buf(buf, "keycode=");
+            write_buf_key_name(buf, keymap->ctx, key->name, 0);
+        }
         if (action->redirect.affect) {
             xkb_mod_mask_t mask;
             mask = (action->redirect.affect & action->redirect.mods);
-            if (mask)
-                write_buf(buf, ",modifiers=%s",
-                          ModMaskText(keymap->ctx, MOD_BOTH, &keymap->mods, mask));
+            if (mask) {
+                copy_to_buf(buf, ",modifiers=");
+                copy_to_buf_str(buf, ModMaskText(keymap->ctx, MOD_BOTH,
+                                                 &keymap->mods, mask));
+            }
             mask = (action->redirect.affect & ~action->redirect.mods);
-            if (mask)
-                write_buf(buf, ",clearMods=%s",
-                          ModMaskText(keymap->ctx, MOD_BOTH, &keymap->mods, mask));
+            if (mask) {
+                copy_to_buf(buf, ",clearMods=");
+                copy_to_buf_str(buf, ModMaskText(keymap->ctx, MOD_BOTH,
+                                                 &keymap->mods, mask));
+            }
         }
-        write_buf(buf, ")%s", suffix);
+        copy_to_buf(buf, ")");
+        copy_to_buf_str(buf, suffix);
         break;
     }
 
     case ACTION_TYPE_UNKNOWN:
     case ACTION_TYPE_NONE:
-        write_buf(buf, "%sNoAction()%s", prefix, suffix);
+        copy_to_buf_str(buf, prefix);
+        copy_to_buf(buf, "NoAction()");
+        copy_to_buf_str(buf, suffix);
         break;
 
     case ACTION_TYPE_VOID:
@@ -853,11 +1258,12 @@ void_action:
          * We better not use `Private` either, because it could still be
          * interpreted by X11.
          */
+        copy_to_buf_str(buf, prefix);
         if (format == XKB_KEYMAP_FORMAT_TEXT_V1)
-            write_buf(buf, "%sLockControls(controls=none,affect=neither)%s",
-                      prefix, suffix);
+            copy_to_buf(buf, "LockControls(controls=none,affect=neither)");
         else
-            write_buf(buf, "%sVoidAction()%s", prefix, suffix);
+            copy_to_buf(buf, "VoidAction()");
+        copy_to_buf_str(buf, suffix);
         break;
 
     default:
@@ -917,13 +1323,13 @@ write_actions(const struct xkb_keymap *keymap, enum xkb_keymap_format format,
             if (!write_action(keymap, format, max_groups,
                               buf2, &noAction, NULL, NULL))
                 return false;
-            write_buf(buf, "%*s", ACTION_PADDING, buf2->buf);
+            copy_to_buf_padded(buf, buf2, ACTION_PADDING);
         }
         else if (count == 1) {
             if (!write_action(keymap, format, max_groups,
                               buf2, &(actions[0]), NULL, NULL))
                 return false;
-            write_buf(buf, "%*s", ACTION_PADDING, buf2->buf);
+            copy_to_buf_padded(buf, buf2, ACTION_PADDING);
         }
         else {
             copy_to_buf(buf2, "{ ");
@@ -940,13 +1346,14 @@ write_actions(const struct xkb_keymap *keymap, enum xkb_keymap_format format,
                 /* Compute and write padding, then write the action again */
                 const int padding = (int)(old_size + ACTION_PADDING - buf2->size);
                 buf2->size = old_size;
-                write_buf(buf2, "%*s", padding, "");
+                if (!check_write_spaces(buf2, (size_t) padding))
+                    return false;
                 if (!write_action(keymap, format, max_groups,
                                   buf2, &(actions[k]), NULL, NULL))
                     return false;
             }
             copy_to_buf(buf2, " }");
-            write_buf(buf, "%*s", ACTION_PADDING, buf2->buf);
+            copy_to_buf_padded(buf, buf2, ACTION_PADDING);
         }
     }
 
@@ -1143,20 +1550,24 @@ write_compat(const struct xkb_keymap * restrict keymap,
         if (!si->sym) {
             copy_to_buf(buf, "Any");
         } else if (pretty) {
-            write_buf(buf, "%s", KeysymText(keymap->ctx, si->sym));
+            write_buf_keysym(buf, si->sym, 0);
         } else {
-            write_buf(buf, "0x%"PRIx32, si->sym);
+            write_buf_keysym_value(buf, si->sym);
         }
-        write_buf(buf, "+%s(%s) {",
-                  SIMatchText(si->match),
-                  ModMaskText(keymap->ctx, MOD_BOTH, &keymap->mods, si->mods));
+        copy_to_buf(buf, "+");
+        copy_to_buf_str(buf, SIMatchText(si->match));
+        copy_to_buf(buf, "(");
+        copy_to_buf_str(buf, ModMaskText(keymap->ctx, MOD_BOTH, &keymap->mods,
+                                         si->mods));
+        copy_to_buf(buf, ") {");
 
         bool has_explicit_properties = false;
 
         if (si->virtual_mod != XKB_MOD_INVALID) {
-            write_buf(buf, "\n\t\tvirtualModifier= %s;",
-                      ModIndexText(keymap->ctx, &keymap->mods,
-                                   si->virtual_mod));
+            copy_to_buf(buf, "\n\t\tvirtualModifier= ");
+            copy_to_buf_str(buf, ModIndexText(keymap->ctx, &keymap->mods,
+                                              si->virtual_mod));
+            copy_to_buf(buf, ";");
             has_explicit_properties = true;
         }
 
@@ -1206,11 +1617,12 @@ write_compat(const struct xkb_keymap * restrict keymap,
                 return false;
             has_explicit_properties = true;
         }
-        write_buf(buf, (has_explicit_properties
-                        ? "\n\t};\n"
-                        /* Empty interpret is a syntax error in xkbcomp, so
-                         * use a dummy entry */
-                        : "\n\t\taction= NoAction();\n\t};\n"));
+        if (has_explicit_properties)
+            copy_to_buf(buf, "\n\t};\n");
+        else
+            /* Empty interpret is a syntax error in xkbcomp, so use a dummy
+             * entry */
+            copy_to_buf(buf, "\n\t\taction= NoAction();\n\t};\n");
     }
 
     if (use_fallback_interpret || (
@@ -1275,9 +1687,9 @@ write_keysyms(const struct xkb_keymap *keymap,
 
         if (num_syms == 1) {
             if (pretty || syms[0] == XKB_KEY_NoSymbol)
-                write_buf(buf, "%*s", padding, KeysymText(keymap->ctx, syms[0]));
+                write_buf_keysym(buf, syms[0], (int) padding);
             else
-                write_buf(buf, "0x%"PRIx32, syms[0]);
+                write_buf_keysym_value(buf, syms[0]);
         } else {
             if (pretty) {
                 buf2->size = 0;
@@ -1285,11 +1697,11 @@ write_keysyms(const struct xkb_keymap *keymap,
                 for (int s = 0; s < num_syms; s++) {
                     if (s != 0)
                         copy_to_buf(buf2, ", ");
-                    write_buf(buf2, "%*s", (show_actions ? padding : 0),
-                              KeysymText(keymap->ctx, syms[s]));
+                    write_buf_keysym(buf2, syms[s],
+                                     (show_actions ? (int) padding : 0));
                 }
                 copy_to_buf(buf2, " }");
-                write_buf(buf, "%*s", padding, buf2->buf);
+                copy_to_buf_padded(buf, buf2, (int) padding);
             } else {
                 copy_to_buf(buf, "{");
                 for (int s = 0; s < num_syms; s++) {
@@ -1298,7 +1710,7 @@ write_keysyms(const struct xkb_keymap *keymap,
                     if (syms[s] == XKB_KEY_NoSymbol)
                         copy_to_buf(buf, "NoSymbol");
                     else
-                        write_buf(buf, "0x%"PRIx32, syms[s]);
+                        write_buf_keysym_value(buf, syms[s]);
                 }
                 copy_to_buf(buf, "}");
             }
@@ -1341,10 +1753,9 @@ write_key(const struct xkb_keymap *keymap,
         ? key->name
         : substitute_name(substitutions, key->name);
 
-    if (pretty)
-        write_buf(buf, "\tkey %-20s {", KeyNameText(keymap->ctx, name));
-    else
-        write_buf(buf, "\tkey %s {", KeyNameText(keymap->ctx, name));
+    copy_to_buf(buf, "\tkey ");
+    write_buf_key_name(buf, keymap->ctx, name, (pretty ? -20 : 0));
+    copy_to_buf(buf, " {");
 
     if ((key->explicit & EXPLICIT_TYPES) || explicit) {
         simple = false;
@@ -1375,7 +1786,9 @@ write_key(const struct xkb_keymap *keymap,
                     continue;
 
                 const struct xkb_key_type * const type = key->groups[group].type;
-                write_buf(buf, "\n\t\ttype[%"PRIu32"]= ", new_group + 1);
+                copy_to_buf(buf, "\n\t\ttype[");
+                write_buf_uint(buf, new_group + 1);
+                copy_to_buf(buf, "]= ");
                 write_buf_string_literal(
                   buf, xkb_atom_text(keymap->ctx, type->name));
                 copy_to_buf(buf, ",");
@@ -1383,7 +1796,7 @@ write_key(const struct xkb_keymap *keymap,
         }
         else {
             const struct xkb_key_type * const type = key->groups[0].type;
-            write_buf(buf, "\n\t\ttype= ");
+            copy_to_buf(buf, "\n\t\ttype= ");
             write_buf_string_literal(
                 buf, xkb_atom_text(keymap->ctx, type->name));
             copy_to_buf(buf, ",");
@@ -1438,9 +1851,10 @@ write_key(const struct xkb_keymap *keymap,
     if (require_explicit(key, EXPLICIT_VMODMAP, key->vmodmap,
                          (xkb_mod_mask_t) DEFAULT_KEY_VMODMAP,
                          (xkb_mod_mask_t) DEFAULT_INTERPRET_VMODMAP)) {
-        write_buf(buf, "\n\t\tvirtualMods= %s,",
-                  ModMaskText(keymap->ctx, MOD_BOTH, &keymap->mods,
-                              key->vmodmap));
+        copy_to_buf(buf, "\n\t\tvirtualMods= ");
+        copy_to_buf_str(buf, ModMaskText(keymap->ctx, MOD_BOTH, &keymap->mods,
+                                         key->vmodmap));
+        copy_to_buf(buf, ",");
         simple = false;
     }
 
@@ -1476,7 +1890,9 @@ write_key(const struct xkb_keymap *keymap,
         /* In case some lower layouts were discarded, update the group index */
         const xkb_layout_mask_t low = (layouts & (layout_mask - 1));
         const xkb_layout_index_t new = popcount32(low);
-        write_buf(buf, "\n\t\tgroupsRedirect= %"PRIu32",", new + 1);
+        copy_to_buf(buf, "\n\t\tgroupsRedirect= ");
+        write_buf_uint(buf, new + 1);
+        copy_to_buf(buf, ",");
         simple = false;
         break;
     }
@@ -1547,8 +1963,11 @@ write_key(const struct xkb_keymap *keymap,
             const xkb_atom_t overlay_key_name = (substitutions == NULL)
                 ? overlay_key->name
                 : substitute_name(substitutions, overlay_key->name);
-            write_buf(buf, "\n\t\toverlay%u= %s,",
-                      overlay + 1, KeyNameText(keymap->ctx, overlay_key_name));
+            copy_to_buf(buf, "\n\t\toverlay");
+            write_buf_uint(buf, overlay + 1);
+            copy_to_buf(buf, "= ");
+            write_buf_key_name(buf, keymap->ctx, overlay_key_name, 0);
+            copy_to_buf(buf, ",");
         }
     }
 
@@ -1597,14 +2016,23 @@ write_key(const struct xkb_keymap *keymap,
 
             if (new_group != 0)
                 copy_to_buf(buf, ",");
-            write_buf(buf, "\n\t\tsymbols[%"PRIu32"]= [ ", new_group + 1);
+            if (buf->compact.enabled) {
+                /* Groups are written in order: the index is implicit */
+                copy_to_buf(buf, "\n\t\t[ ");
+            } else {
+                copy_to_buf(buf, "\n\t\tsymbols[");
+                write_buf_uint(buf, new_group + 1);
+                copy_to_buf(buf, "]= [ ");
+            }
 
             if (!write_keysyms(keymap, buf, buf2, key, group,
                                pretty, print_actions))
                 return false;
             copy_to_buf(buf, " ]");
             if (print_actions) {
-                write_buf(buf, ",\n\t\tactions[%"PRIu32"]= [ ", new_group + 1);
+                copy_to_buf(buf, ",\n\t\tactions[");
+                write_buf_uint(buf, new_group + 1);
+                copy_to_buf(buf, "]= [ ");
                 if (!write_actions(keymap, config->format, max_groups,
                                    buf, buf2, key, group))
                     return false;
@@ -1803,23 +2231,24 @@ write_modmaps(const struct xkb_keymap *keymap, enum xkb_keymap_format format,
                 copy_to_buf(buf, " };\n");
             }
             current_mods = entry->mods;
-            write_buf(buf, "\tmodifier_map %s { ",
-                      ModMaskText(keymap->ctx, MOD_REAL, &keymap->mods,
-                                  current_mods));
+            copy_to_buf(buf, "\tmodifier_map ");
+            copy_to_buf_str(buf, ModMaskText(keymap->ctx, MOD_REAL,
+                                             &keymap->mods, current_mods));
+            copy_to_buf(buf, " { ");
         } else {
             copy_to_buf(buf, ", ");
         }
 
         if (entry->haveSymbol) {
             if (pretty || entry->u.keySym == XKB_KEY_NoSymbol)
-                write_buf(buf, "%s", KeysymText(keymap->ctx, entry->u.keySym));
+                write_buf_keysym(buf, entry->u.keySym, 0);
             else
-                write_buf(buf, "0x%"PRIx32, entry->u.keySym);
+                write_buf_keysym_value(buf, entry->u.keySym);
         } else {
             const xkb_atom_t name = (substitutions == NULL)
                 ? entry->u.keyName
                 : substitute_name(substitutions, entry->u.keyName);
-            write_buf(buf, "%s", KeyNameText(keymap->ctx, name));
+            write_buf_key_name(buf, keymap->ctx, name, 0);
         }
     }
     if (current_mods) {
@@ -1861,7 +2290,9 @@ write_symbols(const struct xkb_keymap *keymap,
         new_group++;
 
         if (keymap->group_names[group]) {
-            write_buf(buf, "\tname[%"PRIu32"]=", new_group + 1);
+            copy_to_buf(buf, "\tname[");
+            write_buf_uint(buf, new_group + 1);
+            copy_to_buf(buf, "]=");
             write_buf_string_literal(
                 buf, xkb_atom_text(keymap->ctx, keymap->group_names[group]));
             copy_to_buf(buf, ";\n");
@@ -1935,7 +2366,9 @@ text_v1_keymap_serialize(
         struct xkb_keymap_serialize_result *result
 )
 {
-    struct buf buf = { NULL, 0, 0 };
+    struct buf buf = {
+        .compact.enabled = (config->flags & XKB_KEYMAP_SERIALIZE_COMPACT)
+    };
 
     const enum xkb_error_code error =
         write_keymap(keymap, config, &buf, result);
@@ -1945,9 +2378,48 @@ text_v1_keymap_serialize(
         return error;
     }
 
+    if (buf.compact.enabled) {
+        /* Drop the optional whitespace (trailing whitespace included) */
+        compact_whitespace(&buf.compact, buf.buf, buf.size, &buf.size);
+        buf.buf[buf.size] = '\0';
+    }
+
     result->serialized = buf.buf;
     result->length = buf.size + 1;
     result->layouts = config->layouts;
 
     return XKB_SUCCESS;
 }
+
+enum xkb_error_code
+text_v1_keymap_serialize_stream(
+        const struct xkb_keymap *keymap,
+        const struct xkb_keymap_serialize_config *config,
+        xkb_keymap_serialize_write_fn write, void *user_data,
+        struct xkb_keymap_serialize_result *result
+)
+{
+    struct buf buf = {
+        .write = write,
+        .write_data = user_data,
+        .compact.enabled = (config->flags & XKB_KEYMAP_SERIALIZE_COMPACT)
+    };
+
+    enum xkb_error_code error = write_keymap(keymap, config, &buf, result);
+    if (error == XKB_SUCCESS && !flush_buf(&buf, 0))
+        error = XKB_ERROR_KEYMAP_SERIALIZATION_WRITE_FAILURE;
+
+    free(buf.buf);
+    result->serialized = NULL;
+
+    if (error != XKB_SUCCESS) {
+        return (buf.write_failed)
+            ? XKB_ERROR_KEYMAP_SERIALIZATION_WRITE_FAILURE
+            : error;
+    }
+
+    result->length = buf.flushed;
+    result->layouts = config->layouts;
+
+    return XKB_SUCCESS;
+}
@@ -341,15 +341,20 @@ CheckMultipleActionsCategories(struct xkb_keymap *keymap, struct xkb_key *key)
     }
 }
 
+/*
+ * Write the aliases in definition order, so that it does not depend on the
+ * order of interning of the atoms.
+ */
 static void
-add_key_aliases(struct xkb_keymap *keymap, darray_size_t min, darray_size_t max,
-                struct xkb_key_alias *aliases)
+add_key_aliases(struct xkb_keymap_info *info, struct xkb_key_alias *aliases)
 {
-    for (darray_size_t alias = min; alias <= max; alias++) {
-        const KeycodeMatch entry = keymap->key_names[alias];
+    const struct xkb_keymap * const keymap = &info->keymap;
+    const xkb_atom_t *alias;
+    darray_foreach(alias, info->key_aliases) {
+        const KeycodeMatch entry = keymap->key_names[*alias];
         if (entry.is_alias && entry.found) {
             *aliases = (struct xkb_key_alias) {
-                .alias = alias,
+                .alias = *alias,
                 .real = entry.alias.real
             };
             aliases++;
@@ -529,7 +534,7 @@ UpdateDerivedKeymapFields(struct xkb_keymap_info *info)
         assert(num_key_aliases <= keymap->num_key_names);
         if (min_alias >= required_space) {
             /* Overwrite before the *first* alias entry */
-            add_key_aliases(keymap, min_alias, max_alias, keymap->key_aliases);
+            add_key_aliases(info, keymap->key_aliases);
             /* Shrink */
             struct xkb_key_alias * const r =
                 realloc(keymap->key_aliases,
@@ -543,7 +548,7 @@ UpdateDerivedKeymapFields(struct xkb_keymap_info *info)
                 keymap->key_names + max_alias + 1 +
                 !is_aligned(keymap->key_names + max_alias + 1, sizeof(*aliases))
             );
-            add_key_aliases(keymap, min_alias, max_alias, aliases);
+            add_key_aliases(info, aliases);
             /* Move to the start */
             memcpy(keymap->key_aliases, aliases,
                    num_key_aliases * sizeof(*keymap->key_aliases));
@@ -563,7 +568,7 @@ UpdateDerivedKeymapFields(struct xkb_keymap_info *info)
                                                           sizeof(*aliases));
             if (!aliases)
                 return false;
-            add_key_aliases(keymap, min_alias, max_alias, aliases);
+            add_key_aliases(info, aliases);
             free(keymap->key_names);
             keymap->key_aliases = aliases;
         }
@@ -886,6 +891,7 @@ CompileKeymap(XkbFile *file, struct xkb_keymap *keymap)
             /* Copy back to the keymap, so that all can be properly freed */
             *keymap = info.keymap;
             pending_computations_array_free(&pending_computations);
+            darray_free(info.key_aliases);
             return false;
         }
     }
@@ -894,5 +900,8 @@ CompileKeymap(XkbFile *file, struct xkb_keymap *keymap)
     /* Copy back the keymap */
     *keymap = info.keymap;
     pending_computations_array_free(&pending_computations);
+    darray_free(info.key_aliases);
+    if (ok)
+        xkb_keymap_freeze(keymap);
     return ok;
 }
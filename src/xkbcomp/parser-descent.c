@@ -0,0 +1,1728 @@
+/*
+ * Copyright © 2026 agent <agent@local>
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Hand-written recursive descent parser of the XKB text format.
+ *
+ * It accepts the same language as the bison grammar in `parser.y` and builds
+ * the same AST, using the same lexer. It is selected at build time with the
+ * `xkb-parser` option, or at run time with `xkb_context_set_parser()`.
+ *
+ * The grammar is LL(3): the lookahead is only needed to disambiguate the
+ * identifiers that are also keywords (e.g. `type "X" {}` vs `type = …`) and
+ * the keysyms from the actions in `[…]` lists.
+ *
+ * Differences with the bison parser:
+ * - The declarations of the geometry sections are discarded as soon as they
+ *   are parsed, if the configuration requests it.
+ * - The syntax error messages only report the unexpected token, and at most
+ *   one expected token.
+ */
+
+#include "config.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "xkbcommon/xkbcommon-keysyms.h"
+#include "messages-codes.h"
+#include "scanner-utils.h"
+#include "xkbcomp-priv.h"
+#include "ast-build.h"
+#include "parser-priv.h"
+
+/** Maximum count of lookahead tokens */
+#define MAX_LOOKAHEAD 3
+
+struct descent {
+    struct xkb_context *ctx;
+    struct scanner *scanner;
+    const struct parser_keymap_config *config;
+    /** Lookahead tokens and their values */
+    int toks[MAX_LOOKAHEAD];
+    YYSTYPE vals[MAX_LOOKAHEAD];
+    unsigned int num_toks;
+    /** Value of the last consumed token */
+    YYSTYPE val;
+};
+
+struct stmt_list {
+    ParseCommon *head;
+    ParseCommon *last;
+};
+
+static inline void
+stmt_list_append(struct stmt_list *list, ParseCommon *stmt)
+{
+    if (list->head)
+        list->last->next = stmt;
+    else
+        list->head = stmt;
+    list->last = stmt;
+}
+
+/* Append a statement that may be a list itself */
+static inline void
+stmt_list_append_all(struct stmt_list *list, ParseCommon *stmt)
+{
+    stmt_list_append(list, stmt);
+    while (list->last->next)
+        list->last = list->last->next;
+}
+
+#define expr_list_append(list, expr) \
+    stmt_list_append((list), (ParseCommon *) (expr))
+
+static const char *
+token_name(int tok)
+{
+    static const char *names[] = {
+        [END_OF_FILE] = "end of file",
+        [ERROR_TOK] = "invalid token",
+        [XKB_KEYMAP] = "xkb_keymap",
+        [XKB_KEYCODES] = "xkb_keycodes",
+        [XKB_TYPES] = "xkb_types",
+        [XKB_SYMBOLS] = "xkb_symbols",
+        [XKB_COMPATMAP] = "xkb_compatibility",
+        [XKB_GEOMETRY] = "xkb_geometry",
+        [XKB_SEMANTICS] = "xkb_semantics",
+        [XKB_LAYOUT] = "xkb_layout",
+        [INCLUDE] = "include",
+        [OVERRIDE] = "override",
+        [AUGMENT] = "augment",
+        [REPLACE] = "replace",
+        [ALTERNATE] = "alternate",
+        [VIRTUAL_MODS] = "virtual_modifiers",
+        [TYPE] = "type",
+        [INTERPRET] = "interpret",
+        [ACTION_TOK] = "action",
+        [KEY] = "key",
+        [ALIAS] = "alias",
+        [GROUP] = "group",
+        [MODIFIER_MAP] = "modifier_map",
+        [INDICATOR] = "indicator",
+        [SHAPE] = "shape",
+        [KEYS] = "keys",
+        [ROW] = "row",
+        [SECTION] = "section",
+        [OVERLAY] = "overlay",
+        [TEXT] = "text",
+        [OUTLINE] = "outline",
+        [SOLID] = "solid",
+        [LOGO] = "logo",
+        [VIRTUAL] = "virtual",
+        [EQUALS] = "=",
+        [PLUS] = "+",
+        [MINUS] = "-",
+        [DIVIDE] = "/",
+        [TIMES] = "*",
+        [OBRACE] = "{",
+        [CBRACE] = "}",
+        [OPAREN] = "(",
+        [CPAREN] = ")",
+        [OBRACKET] = "[",
+        [CBRACKET] = "]",
+        [DOT] = ".",
+        [COMMA] = ",",
+        [SEMI] = ";",
+        [EXCLAM] = "!",
+        [INVERT] = "~",
+        [STRING] = "string literal",
+        [DECIMAL_DIGIT] = "decimal digit",
+        [INTEGER] = "integer literal",
+        [FLOAT] = "float literal",
+        [IDENT] = "identifier",
+        [KEYNAME] = "key name",
+        [PARTIAL] = "partial",
+        [DEFAULT] = "default",
+        [HIDDEN] = "hidden",
+        [ALPHANUMERIC_KEYS] = "alphanumeric_keys",
+        [MODIFIER_KEYS] = "modifier_keys",
+        [KEYPAD_KEYS] = "keypad_keys",
+        [FUNCTION_KEYS] = "function_keys",
+        [ALTERNATE_GROUP] = "alternate_group",
+        [DEPRECATED] = "deprecated",
+    };
+    if (tok < 0 || (size_t) tok >= ARRAY_SIZE(names) || !names[tok])
+        return "invalid token";
+    return names[tok];
+}
+
+/*
+ * Tokens
+ */
+
+static int
+peek_at(struct descent *p, unsigned int idx)
+{
+    assert(idx < MAX_LOOKAHEAD);
+    while (p->num_toks <= idx) {
+        p->toks[p->num_toks] = _xkbcommon_lex(&p->vals[p->num_toks],
+                                              p->scanner);
+        p->num_toks++;
+    }
+    return p->toks[idx];
+}
+
+static inline int
+peek(struct descent *p)
+{
+    return peek_at(p, 0);
+}
+
+/* Consume the next token; its value is then available in `p->val` */
+static int
+next(struct descent *p)
+{
+    const int tok = peek(p);
+    p->val = p->vals[0];
+    p->num_toks--;
+    memmove(p->toks, p->toks + 1, p->num_toks * sizeof(*p->toks));
+    memmove(p->vals, p->vals + 1, p->num_toks * sizeof(*p->vals));
+    return tok;
+}
+
+/* Drop the pending lookahead tokens */
+static void
+drop_lookahead(struct descent *p)
+{
+    for (unsigned int k = 0; k < p->num_toks; k++) {
+        if (p->toks[k] == STRING)
+            free(p->vals[k].lit.owned);
+    }
+    p->num_toks = 0;
+}
+
+static bool
+syntax_error(struct descent *p, int expected)
+{
+    const int tok = peek(p);
+    if (expected == YYEMPTY) {
+        scanner_err(p->scanner, XKB_ERROR_INVALID_XKB_SYNTAX,
+                    "syntax error, unexpected %s", token_name(tok));
+    } else {
+        scanner_err(p->scanner, XKB_ERROR_INVALID_XKB_SYNTAX,
+                    "syntax error, unexpected %s, expecting %s",
+                    token_name(tok), token_name(expected));
+    }
+    return false;
+}
+
+static inline bool
+accept(struct descent *p, int tok)
+{
+    if (peek(p) != tok)
+        return false;
+    next(p);
+    return true;
+}
+
+static inline bool
+expect(struct descent *p, int tok)
+{
+    if (peek(p) != tok)
+        return syntax_error(p, tok);
+    next(p);
+    return true;
+}
+
+/* Consume a string literal and intern it */
+static xkb_atom_t
+take_string_atom(struct descent *p)
+{
+    next(p);
+    const xkb_atom_t atom = xkb_atom_intern(p->ctx, p->val.lit.sval.start,
+                                            p->val.lit.sval.len);
+    free(p->val.lit.owned);
+    return atom;
+}
+
+static bool
+parse_string(struct descent *p, xkb_atom_t *out)
+{
+    if (peek(p) != STRING)
+        return syntax_error(p, STRING);
+    *out = take_string_atom(p);
+    return true;
+}
+
+/* Integer: INTEGER or DECIMAL_DIGIT */
+static bool
+parse_integer(struct descent *p, int64_t *out)
+{
+    const int tok = peek(p);
+    if (tok != INTEGER && tok != DECIMAL_DIGIT)
+        return syntax_error(p, INTEGER);
+    next(p);
+    *out = p->val.num;
+    return true;
+}
+
+static inline bool
+is_merge_mode(int tok)
+{
+    return tok == INCLUDE || tok == AUGMENT || tok == OVERRIDE ||
+           tok == REPLACE || tok == ALTERNATE;
+}
+
+static enum merge_mode
+parse_merge_mode(struct descent *p)
+{
+    switch (next(p)) {
+    case AUGMENT: return MERGE_AUGMENT;
+    case OVERRIDE: return MERGE_OVERRIDE;
+    case REPLACE: return MERGE_REPLACE;
+    case ALTERNATE:
+        /*
+         * This used to be MERGE_ALT_FORM. This functionality was
+         * unused and has been removed.
+         */
+        scanner_warn(p->scanner, XKB_LOG_MESSAGE_NO_ID,
+                     "ignored unsupported legacy merge mode \"alternate\"");
+        return MERGE_DEFAULT;
+    default: return MERGE_DEFAULT;
+    }
+}
+
+/* Name of the keywords that can be used as field names */
+static const char *
+element_name(int tok)
+{
+    switch (tok) {
+    case ACTION_TOK: return "action";
+    case INTERPRET: return "interpret";
+    case TYPE: return "type";
+    case KEY: return "key";
+    case GROUP: return "group";
+    case MODIFIER_MAP: return "modifier_map";
+    case INDICATOR: return "indicator";
+    case SHAPE: return "shape";
+    case ROW: return "row";
+    case SECTION: return "section";
+    case TEXT: return "text";
+    default: return NULL;
+    }
+}
+
+static inline bool
+is_ident(int tok)
+{
+    return tok == IDENT || tok == DEFAULT;
+}
+
+static inline bool
+is_field_spec(int tok)
+{
+    return is_ident(tok) || element_name(tok);
+}
+
+/* Tokens that follow a field spec in a left-hand side of an assignment */
+static inline bool
+is_lhs_continuation(int tok)
+{
+    return tok == DOT || tok == OBRACKET || tok == EQUALS;
+}
+
+static inline bool
+is_terminal(int tok)
+{
+    return tok == STRING || tok == INTEGER || tok == DECIMAL_DIGIT ||
+           tok == FLOAT || tok == KEYNAME;
+}
+
+static inline bool
+is_expr_start(int tok)
+{
+    return is_field_spec(tok) || is_terminal(tok) ||
+           tok == MINUS || tok == PLUS || tok == EXCLAM || tok == INVERT ||
+           tok == OPAREN || tok == OBRACE;
+}
+
+static inline bool
+is_keysym_lit(int tok)
+{
+    return tok == IDENT || tok == SECTION ||
+           tok == DECIMAL_DIGIT || tok == INTEGER;
+}
+
+/* Ident: IDENT or DEFAULT */
+static bool
+parse_ident(struct descent *p, xkb_atom_t *out)
+{
+    switch (peek(p)) {
+    case IDENT:
+        next(p);
+        *out = xkb_atom_intern(p->ctx, p->val.sval.start, p->val.sval.len);
+        return true;
+    case DEFAULT:
+        next(p);
+        *out = xkb_atom_intern_literal(p->ctx, "default");
+        return true;
+    default:
+        return syntax_error(p, IDENT);
+    }
+}
+
+/* FieldSpec: Ident or Element */
+static bool
+parse_field_spec(struct descent *p, xkb_atom_t *out)
+{
+    const char *const element = element_name(peek(p));
+    if (!element)
+        return parse_ident(p, out);
+    next(p);
+    *out = xkb_atom_intern(p->ctx, element, strlen(element));
+    return true;
+}
+
+/*
+ * Expressions
+ */
+
+static bool
+parse_expr(struct descent *p, ExprDef **out);
+
+static bool
+parse_term(struct descent *p, bool expr_start, ExprDef **out);
+
+/* ExprList: possibly empty, comma-separated list of expressions */
+static bool
+parse_expr_list(struct descent *p, ExprDef **out)
+{
+    struct stmt_list list = { NULL, NULL };
+    ExprDef *expr;
+
+    /* The grammar allows a leading comma after an empty list */
+    if (is_expr_start(peek(p))) {
+        if (!parse_expr(p, &expr))
+            return false;
+        expr_list_append(&list, expr);
+    }
+    while (accept(p, COMMA)) {
+        if (!parse_expr(p, &expr))
+            goto error;
+        expr_list_append(&list, expr);
+    }
+    *out = (ExprDef *) list.head;
+    return true;
+
+error:
+    FreeStmt(list.head);
+    return false;
+}
+
+/* Action: FieldSpec ( ExprList ), after the field spec */
+static bool
+parse_action_args(struct descent *p, xkb_atom_t name, ExprDef **out)
+{
+    ExprDef *args;
+    if (!expect(p, OPAREN) || !parse_expr_list(p, &args))
+        return false;
+    if (!expect(p, CPAREN)) {
+        FreeStmt((ParseCommon *) args);
+        return false;
+    }
+    if (!(*out = ExprCreateAction(name, args))) {
+        FreeStmt((ParseCommon *) args);
+        return false;
+    }
+    return true;
+}
+
+static bool
+parse_action(struct descent *p, ExprDef **out)
+{
+    xkb_atom_t name;
+    return parse_field_spec(p, &name) && parse_action_args(p, name, out);
+}
+
+/* ActionList }, after the opening brace */
+static bool
+parse_action_list(struct descent *p, ExprDef **out)
+{
+    struct stmt_list list = { NULL, NULL };
+    ExprDef *action;
+    do {
+        if (!parse_action(p, &action))
+            goto error;
+        expr_list_append(&list, action);
+    } while (accept(p, COMMA));
+    if (!expect(p, CBRACE))
+        goto error;
+    if (!(*out = ExprCreateActionList((ExprDef *) list.head)))
+        goto error;
+    return true;
+
+error:
+    FreeStmt(list.head);
+    return false;
+}
+
+/* Actions: { ActionList } or {}, after the opening brace */
+static bool
+parse_actions(struct descent *p, ExprDef **out)
+{
+    if (accept(p, CBRACE))
+        return !!(*out = ExprCreateActionList(NULL));
+    return parse_action_list(p, out);
+}
+
+/* Lhs, after the first field spec */
+static bool
+parse_lhs(struct descent *p, xkb_atom_t field, ExprDef **out)
+{
+    xkb_atom_t element = XKB_ATOM_NONE;
+    ExprDef *entry;
+
+    if (accept(p, DOT)) {
+        element = field;
+        if (!parse_field_spec(p, &field))
+            return false;
+        if (peek(p) != OBRACKET)
+            return !!(*out = ExprCreateFieldRef(element, field));
+    }
+    if (!accept(p, OBRACKET))
+        return !!(*out = ExprCreateIdent(field));
+
+    if (!parse_expr(p, &entry))
+        return false;
+    if (!expect(p, CBRACKET) ||
+        !(*out = ExprCreateArrayRef(element, field, entry))) {
+        FreeStmt((ParseCommon *) entry);
+        return false;
+    }
+    return true;
+}
+
+static bool
+parse_unary(struct descent *p, enum stmt_type op, ExprDef **out)
+{
+    ExprDef *child;
+    next(p);
+    if (!parse_term(p, false, &child))
+        return false;
+    if (!(*out = ExprCreateUnary(op, child))) {
+        FreeStmt((ParseCommon *) child);
+        return false;
+    }
+    return true;
+}
+
+/*
+ * Term
+ *
+ * At the start of an expression, a left-hand side followed by `=` is an
+ * assignment whose right-hand side extends as far as possible, matching the
+ * lowest precedence of `=` in the bison grammar.
+ */
+static bool
+parse_term(struct descent *p, bool expr_start, ExprDef **out)
+{
+    ExprDef *expr;
+    xkb_atom_t field;
+
+    switch (peek(p)) {
+    case MINUS:
+        return parse_unary(p, STMT_EXPR_NEGATE, out);
+    case PLUS:
+        return parse_unary(p, STMT_EXPR_UNARY_PLUS, out);
+    case EXCLAM:
+        return parse_unary(p, STMT_EXPR_NOT, out);
+    case INVERT:
+        return parse_unary(p, STMT_EXPR_INVERT, out);
+    case OPAREN:
+        next(p);
+        if (!parse_expr(p, &expr))
+            return false;
+        if (!expect(p, CPAREN)) {
+            FreeStmt((ParseCommon *) expr);
+            return false;
+        }
+        *out = expr;
+        return true;
+    case OBRACE:
+        next(p);
+        return parse_actions(p, out);
+    case STRING:
+        return !!(*out = ExprCreateString(take_string_atom(p)));
+    case INTEGER:
+    case DECIMAL_DIGIT:
+        next(p);
+        return !!(*out = ExprCreateInteger(p->val.num));
+    case FLOAT:
+        next(p);
+        return !!(*out = ExprCreateFloat(/* Discard value */));
+    case KEYNAME:
+        next(p);
+        return !!(*out = ExprCreateKeyName(p->val.atom));
+    default:
+        if (!is_field_spec(peek(p)))
+            return syntax_error(p, YYEMPTY);
+    }
+
+    if (!parse_field_spec(p, &field))
+        return false;
+    if (peek(p) == OPAREN)
+        return parse_action_args(p, field, out);
+    if (!parse_lhs(p, field, &expr))
+        return false;
+    if (expr_start && accept(p, EQUALS)) {
+        ExprDef *value;
+        if (!parse_expr(p, &value)) {
+            FreeStmt((ParseCommon *) expr);
+            return false;
+        }
+        ExprDef *const assign = ExprCreateBinary(STMT_EXPR_ASSIGN, expr, value);
+        if (!assign) {
+            FreeStmt((ParseCommon *) expr);
+            FreeStmt((ParseCommon *) value);
+            return false;
+        }
+        expr = assign;
+    }
+    *out = expr;
+    return true;
+}
+
+/* Binary operators, using precedence climbing; all are left-associative */
+static bool
+parse_binary(struct descent *p, int min_precedence, ExprDef **out)
+{
+    ExprDef *left, *right;
+    if (!parse_term(p, true, &left))
+        return false;
+
+    for (;;) {
+        enum stmt_type op;
+        int precedence;
+        switch (peek(p)) {
+        case PLUS: op = STMT_EXPR_ADD; precedence = 1; break;
+        case MINUS: op = STMT_EXPR_SUBTRACT; precedence = 1; break;
+        case TIMES: op = STMT_EXPR_MULTIPLY; precedence = 2; break;
+        case DIVIDE: op = STMT_EXPR_DIVIDE; precedence = 2; break;
+        default: goto out;
+        }
+        if (precedence < min_precedence)
+            break;
+        next(p);
+        if (!parse_binary(p, precedence + 1, &right))
+            goto error;
+        ExprDef *const expr = ExprCreateBinary(op, left, right);
+        if (!expr) {
+            FreeStmt((ParseCommon *) right);
+            goto error;
+        }
+        left = expr;
+    }
+
+out:
+    *out = left;
+    return true;
+
+error:
+    FreeStmt((ParseCommon *) left);
+    return false;
+}
+
+static bool
+parse_expr(struct descent *p, ExprDef **out)
+{
+    return parse_binary(p, 1, out);
+}
+
+/*
+ * Keysyms
+ */
+
+/* KeySymLit */
+static xkb_keysym_t
+parse_keysym_lit(struct descent *p)
+{
+    switch (next(p)) {
+    case IDENT:
+        return KeysymParseIdent(p->scanner, p->val.sval);
+    case SECTION:
+        /* Keysym that is also a keyword */
+        return XKB_KEY_section;
+    case DECIMAL_DIGIT:
+        /*
+         * Special case for digits 0..9:
+         * map to XKB_KEY_0 .. XKB_KEY_9, consistent with
+         * other keysym names: <name> → XKB_KEY_<name>.
+         */
+        return XKB_KEY_0 + (xkb_keysym_t) p->val.num;
+    default:
+        return KeysymParseInteger(p->scanner, p->val.num);
+    }
+}
+
+/* KeySym: KeySymLit or a single code point string */
+static bool
+parse_keysym(struct descent *p, xkb_keysym_t *out)
+{
+    const int tok = peek(p);
+    if (tok == STRING) {
+        next(p);
+        *out = KeysymParseString(p->scanner, p->val.lit.sval);
+        free(p->val.lit.owned);
+        return *out != XKB_KEY_NoSymbol;
+    }
+    if (!is_keysym_lit(tok))
+        return syntax_error(p, YYEMPTY);
+    *out = parse_keysym_lit(p);
+    return true;
+}
+
+/* Append a string literal to a keysym list; frees the list on error */
+static ExprDef *
+append_keysyms_string(struct descent *p, ExprDef *expr)
+{
+    next(p);
+    expr = ExprKeySymListAppendString(p->scanner, expr, p->val.lit.sval);
+    free(p->val.lit.owned);
+    return expr;
+}
+
+/* NonEmptyKeySyms: { KeySymList } or a string */
+static bool
+parse_non_empty_keysyms(struct descent *p, ExprDef **out)
+{
+    ExprDef *expr;
+
+    if (peek(p) == STRING) {
+        if (!(expr = ExprCreateKeySymList(XKB_KEY_NoSymbol)))
+            return false;
+        return !!(*out = append_keysyms_string(p, expr));
+    }
+
+    if (!expect(p, OBRACE))
+        return false;
+    expr = NULL;
+    do {
+        const int tok = peek(p);
+        if (tok == STRING) {
+            if (!expr && !(expr = ExprCreateKeySymList(XKB_KEY_NoSymbol)))
+                return false;
+            if (!(expr = append_keysyms_string(p, expr)))
+                return false;
+        } else if (is_keysym_lit(tok)) {
+            const xkb_keysym_t sym = parse_keysym_lit(p);
+            if (expr) {
+                expr = ExprAppendKeySymList(expr, sym);
+            } else if (!(expr = ExprCreateKeySymList(sym))) {
+                return false;
+            }
+        } else {
+            FreeStmt((ParseCommon *) expr);
+            return syntax_error(p, YYEMPTY);
+        }
+    } while (accept(p, COMMA));
+
+    if (!expect(p, CBRACE)) {
+        FreeStmt((ParseCommon *) expr);
+        return false;
+    }
+    *out = expr;
+    return true;
+}
+
+/* Whether the next tokens start an action rather than keysyms */
+static bool
+is_action_start(struct descent *p, unsigned int idx)
+{
+    const int tok = peek_at(p, idx);
+    if (tok == IDENT || tok == SECTION)
+        return peek_at(p, idx + 1) == OPAREN;
+    return is_field_spec(tok);
+}
+
+/*
+ * MultiKeySymList or MultiActionList item.
+ *
+ * Every item is a list; the first item cannot be empty.
+ */
+static bool
+parse_multi_list_item(struct descent *p, bool actions, bool first,
+                      ExprDef **out)
+{
+    ExprDef *expr;
+    const int tok = peek(p);
+
+    if (!actions) {
+        if (is_keysym_lit(tok))
+            return !!(*out = ExprCreateKeySymList(parse_keysym_lit(p)));
+        if (!first && tok == OBRACE && peek_at(p, 1) == CBRACE) {
+            next(p);
+            next(p);
+            return !!(*out = ExprCreateKeySymList(XKB_KEY_NoSymbol));
+        }
+        return parse_non_empty_keysyms(p, out);
+    }
+
+    if (tok == OBRACE) {
+        next(p);
+        if (first)
+            return parse_action_list(p, out);
+        return parse_actions(p, out);
+    }
+    if (!parse_action(p, &expr))
+        return false;
+    if (!(*out = ExprCreateActionList(expr))) {
+        FreeStmt((ParseCommon *) expr);
+        return false;
+    }
+    return true;
+}
+
+/*
+ * MultiKeySymOrActionList: list of keysyms lists or actions lists
+ *
+ * There is some ambiguity because we use `{}` to denote both an empty list of
+ * keysyms and an empty list of actions. So we count the `{}` at the beginning,
+ * then prepend the relevant count of `NoSymbol` or `NoAction()` once the first
+ * non-empty item resolves the ambiguity. If there is no such item, this is a
+ * list of empties of *some* type: we drop those empties and delegate the type
+ * resolution using `ExprEmptyList()`.
+ */
+static bool
+parse_multi_keysyms_or_actions(struct descent *p, ExprDef **out)
+{
+    struct stmt_list list = { NULL, NULL };
+    uint32_t empties = 0;
+    ExprDef *expr;
+
+    if (!expect(p, OBRACKET))
+        return false;
+
+    if (is_expr_start(peek(p)) &&
+        !(peek(p) == OBRACE && peek_at(p, 1) == CBRACE)) {
+        /* No empty prefix */
+    } else {
+        if (peek(p) == OBRACE) {
+            next(p);
+            next(p);
+            empties++;
+        }
+        for (;;) {
+            if (accept(p, CBRACKET))
+                return !!(*out = ExprEmptyList());
+            if (!expect(p, COMMA))
+                return false;
+            if (peek(p) == OBRACE && peek_at(p, 1) == CBRACE) {
+                next(p);
+                next(p);
+                empties++;
+            } else {
+                break;
+            }
+        }
+    }
+
+    /* The first non-empty item selects keysyms or actions */
+    const bool actions = (peek(p) == OBRACE)
+        ? is_action_start(p, 1)
+        : is_action_start(p, 0);
+    if (!parse_multi_list_item(p, actions, true, &expr))
+        return false;
+    expr_list_append(&list, expr);
+    while (accept(p, COMMA)) {
+        if (!parse_multi_list_item(p, actions, false, &expr))
+            goto error;
+        expr_list_append(&list, expr);
+    }
+    if (!expect(p, CBRACKET))
+        goto error;
+
+    /* Prepend the empties */
+    for (uint32_t k = 0; k < empties; k++) {
+        expr = (actions)
+            ? ExprCreateActionList(NULL)
+            : ExprCreateKeySymList(XKB_KEY_NoSymbol);
+        if (!expr)
+            goto error;
+        expr->common.next = list.head;
+        list.head = &expr->common;
+    }
+    *out = (ExprDef *) list.head;
+    return true;
+
+error:
+    FreeStmt(list.head);
+    return false;
+}
+
+/*
+ * Declarations
+ */
+
+/* VarDecl: Lhs = Expr ; | Ident ; | ! Ident ; */
+static bool
+parse_var_decl(struct descent *p, VarDef **out)
+{
+    xkb_atom_t field;
+    ExprDef *name, *value;
+
+    if (accept(p, EXCLAM)) {
+        if (!parse_ident(p, &field) || !expect(p, SEMI))
+            return false;
+        return !!(*out = BoolVarCreate(field, false));
+    }
+    if (is_ident(peek(p)) && peek_at(p, 1) == SEMI) {
+        if (!parse_ident(p, &field))
+            return false;
+        next(p);
+        return !!(*out = BoolVarCreate(field, true));
+    }
+
+    if (!parse_field_spec(p, &field) || !parse_lhs(p, field, &name))
+        return false;
+    if (!expect(p, EQUALS) || !parse_expr(p, &value)) {
+        FreeStmt((ParseCommon *) name);
+        return false;
+    }
+    if (!expect(p, SEMI) || !(*out = VarCreate(name, value))) {
+        FreeStmt((ParseCommon *) name);
+        FreeStmt((ParseCommon *) value);
+        return false;
+    }
+    return true;
+}
+
+/* VarDeclList }, after the opening brace */
+static bool
+parse_var_decl_list(struct descent *p, VarDef **out)
+{
+    struct stmt_list list = { NULL, NULL };
+    VarDef *var;
+    while (!accept(p, CBRACE)) {
+        if (!parse_var_decl(p, &var)) {
+            FreeStmt(list.head);
+            return false;
+        }
+        stmt_list_append(&list, &var->common);
+    }
+    *out = (VarDef *) list.head;
+    return true;
+}
+
+/* { VarDeclList } ; */
+static bool
+parse_var_decl_block(struct descent *p, VarDef **out)
+{
+    if (!expect(p, OBRACE) || !parse_var_decl_list(p, out))
+        return false;
+    if (!expect(p, SEMI)) {
+        FreeStmt((ParseCommon *) *out);
+        return false;
+    }
+    return true;
+}
+
+/* SymbolsVarDecl */
+static bool
+parse_symbols_var_decl(struct descent *p, VarDef **out)
+{
+    xkb_atom_t field;
+    ExprDef *name = NULL, *value;
+
+    if (peek(p) == OBRACKET) {
+        if (!parse_multi_keysyms_or_actions(p, &value))
+            return false;
+        goto create;
+    }
+    if (accept(p, EXCLAM)) {
+        if (!parse_ident(p, &field))
+            return false;
+        return !!(*out = BoolVarCreate(field, false));
+    }
+    if (is_ident(peek(p)) &&
+        (peek_at(p, 1) == COMMA || peek_at(p, 1) == CBRACE)) {
+        if (!parse_ident(p, &field))
+            return false;
+        return !!(*out = BoolVarCreate(field, true));
+    }
+
+    if (!parse_field_spec(p, &field) || !parse_lhs(p, field, &name))
+        return false;
+    if (!expect(p, EQUALS)) {
+        FreeStmt((ParseCommon *) name);
+        return false;
+    }
+    if (!((peek(p) == OBRACKET)
+            ? parse_multi_keysyms_or_actions(p, &value)
+            : parse_expr(p, &value))) {
+        FreeStmt((ParseCommon *) name);
+        return false;
+    }
+
+create:
+    if (!(*out = VarCreate(name, value))) {
+        FreeStmt((ParseCommon *) name);
+        FreeStmt((ParseCommon *) value);
+        return false;
+    }
+    return true;
+}
+
+/* key <name> { OptSymbolsBody } ; */
+static bool
+parse_symbols_decl(struct descent *p, SymbolsDef **out)
+{
+    struct stmt_list list = { NULL, NULL };
+    VarDef *var;
+
+    next(p);
+    if (!expect(p, KEYNAME))
+        return false;
+    const xkb_atom_t key_name = p->val.atom;
+    if (!expect(p, OBRACE))
+        return false;
+    if (peek(p) != CBRACE) {
+        do {
+            if (!parse_symbols_var_decl(p, &var))
+                goto error;
+            stmt_list_append(&list, &var->common);
+        } while (accept(p, COMMA));
+    }
+    if (!expect(p, CBRACE) || !expect(p, SEMI))
+        goto error;
+    if (!(*out = SymbolsCreate(key_name, (VarDef *) list.head)))
+        goto error;
+    return true;
+
+error:
+    FreeStmt(list.head);
+    return false;
+}
+
+/* virtual_modifiers VModDefList ; */
+static bool
+parse_vmod_decl(struct descent *p, enum merge_mode merge, ParseCommon **out)
+{
+    struct stmt_list list = { NULL, NULL };
+    xkb_atom_t name;
+    ExprDef *value;
+
+    next(p);
+    do {
+        value = NULL;
+        if (!parse_ident(p, &name) ||
+            (accept(p, EQUALS) && !parse_expr(p, &value)))
+            goto error;
+        VModDef *const vmod = VModCreate(name, value);
+        if (!vmod) {
+            FreeStmt((ParseCommon *) value);
+            goto error;
+        }
+        vmod->merge = merge;
+        stmt_list_append(&list, &vmod->common);
+    } while (accept(p, COMMA));
+    if (!expect(p, SEMI))
+        goto error;
+    *out = list.head;
+    return true;
+
+error:
+    FreeStmt(list.head);
+    return false;
+}
+
+/* interpret KeySym [+ Expr] { VarDeclList } ; */
+static bool
+parse_interpret_decl(struct descent *p, InterpDef **out)
+{
+    xkb_keysym_t sym;
+    ExprDef *match = NULL;
+    VarDef *def;
+
+    next(p);
+    if (!parse_keysym(p, &sym))
+        return false;
+    if (accept(p, PLUS) && !parse_expr(p, &match))
+        return false;
+    if (!parse_var_decl_block(p, &def)) {
+        FreeStmt((ParseCommon *) match);
+        return false;
+    }
+    if (!(*out = InterpCreate(sym, match))) {
+        FreeStmt((ParseCommon *) match);
+        FreeStmt((ParseCommon *) def);
+        return false;
+    }
+    (*out)->def = def;
+    return true;
+}
+
+/* modifier_map Expr { KeyOrKeySymList } ; */
+static bool
+parse_modmap_decl(struct descent *p, ModMapDef **out)
+{
+    struct stmt_list list = { NULL, NULL };
+    ExprDef *modifiers, *key;
+
+    next(p);
+    if (!parse_expr(p, &modifiers))
+        return false;
+    if (!expect(p, OBRACE))
+        goto error;
+    do {
+        if (accept(p, KEYNAME)) {
+            key = ExprCreateKeyName(p->val.atom);
+        } else {
+            xkb_keysym_t sym;
+            if (!parse_keysym(p, &sym))
+                goto error;
+            key = ExprCreateKeySym(sym);
+        }
+        if (!key)
+            goto error;
+        expr_list_append(&list, key);
+    } while (accept(p, COMMA));
+    if (!expect(p, CBRACE) || !expect(p, SEMI))
+        goto error;
+
+    if (p->config->format == XKB_KEYMAP_FORMAT_TEXT_V1 &&
+        modifiers->common.type != STMT_EXPR_IDENT) {
+        scanner_err(p->scanner, XKB_ERROR_INVALID_MODIFIER_MAP_MASK,
+                    "Invalid real modifier mask in modifier "
+                    "map definition: expected identifier");
+        goto error;
+    }
+    if (!(*out = ModMapCreate(modifiers, (ExprDef *) list.head)))
+        goto error;
+    return true;
+
+error:
+    FreeStmt((ParseCommon *) modifiers);
+    FreeStmt(list.head);
+    return false;
+}
+
+/* Keyword Integer = Expr ; */
+static bool
+parse_indexed_expr(struct descent *p, int64_t *index, ExprDef **out)
+{
+    if (!parse_integer(p, index) || !expect(p, EQUALS) ||
+        !parse_expr(p, out))
+        return false;
+    if (!expect(p, SEMI)) {
+        FreeStmt((ParseCommon *) *out);
+        return false;
+    }
+    return true;
+}
+
+/* Terminal */
+static bool
+parse_terminal(struct descent *p, ExprDef **out)
+{
+    if (!is_terminal(peek(p)))
+        return syntax_error(p, YYEMPTY);
+    return parse_term(p, false, out);
+}
+
+/* Unknown declarations and compound statements, after the identifier */
+static bool
+parse_unknown_decl(struct descent *p, UnknownStatement **out)
+{
+    next(p);
+    const struct sval name = p->val.sval;
+    ExprDef *terminal = NULL, *value;
+    VarDef *body;
+
+    if (peek(p) != OBRACE) {
+        if (!parse_terminal(p, &terminal))
+            return false;
+        if (accept(p, EQUALS)) {
+            const bool ok = parse_expr(p, &value);
+            FreeStmt((ParseCommon *) terminal);
+            if (!ok)
+                return false;
+            FreeStmt((ParseCommon *) value);
+            if (!expect(p, SEMI))
+                return false;
+            return !!(*out = UnknownStatementCreate(STMT_UNKNOWN_DECLARATION,
+                                                    name));
+        }
+    }
+    FreeStmt((ParseCommon *) terminal);
+    if (!parse_var_decl_block(p, &body))
+        return false;
+    FreeStmt((ParseCommon *) body);
+    return !!(*out = UnknownStatementCreate(STMT_UNKNOWN_COMPOUND, name));
+}
+
+/*
+ * Geometry declarations: parsed for validation, then discarded
+ */
+
+/* SignedNumber */
+static bool
+parse_signed_number(struct descent *p)
+{
+    accept(p, MINUS);
+    const int tok = peek(p);
+    if (tok != FLOAT && tok != INTEGER && tok != DECIMAL_DIGIT)
+        return syntax_error(p, YYEMPTY);
+    next(p);
+    return true;
+}
+
+/* CoordList }, after the opening brace */
+static bool
+parse_coord_list(struct descent *p)
+{
+    do {
+        if (!expect(p, OBRACKET) || !parse_signed_number(p) ||
+            !expect(p, COMMA) || !parse_signed_number(p) ||
+            !expect(p, CBRACKET))
+            return false;
+    } while (accept(p, COMMA));
+    return expect(p, CBRACE);
+}
+
+/* shape String { OutlineList | CoordList } ; */
+static bool
+parse_shape_decl(struct descent *p)
+{
+    xkb_atom_t name;
+    next(p);
+    if (!parse_string(p, &name) || !expect(p, OBRACE))
+        return false;
+    if (peek(p) == OBRACKET) {
+        if (!parse_coord_list(p))
+            return false;
+        return expect(p, SEMI);
+    }
+    do {
+        if (accept(p, OBRACE)) {
+            if (!parse_coord_list(p))
+                return false;
+            continue;
+        }
+        if (!parse_ident(p, &name) || !expect(p, EQUALS))
+            return false;
+        if (peek(p) == OBRACE && peek_at(p, 1) == OBRACKET) {
+            next(p);
+            if (!parse_coord_list(p))
+                return false;
+        } else {
+            ExprDef *expr;
+            if (!parse_expr(p, &expr))
+                return false;
+            FreeStmt((ParseCommon *) expr);
+        }
+    } while (accept(p, COMMA));
+    return expect(p, CBRACE) && expect(p, SEMI);
+}
+
+/* DoodadType String { VarDeclList } ; */
+static bool
+parse_doodad_decl(struct descent *p)
+{
+    xkb_atom_t name;
+    VarDef *body;
+    next(p);
+    if (!parse_string(p, &name) || !parse_var_decl_block(p, &body))
+        return false;
+    FreeStmt((ParseCommon *) body);
+    return true;
+}
+
+static inline bool
+is_doodad_type(struct descent *p)
+{
+    const int tok = peek(p);
+    return tok == OUTLINE || tok == SOLID || tok == LOGO ||
+           (tok == TEXT && peek_at(p, 1) == STRING);
+}
+
+/* Discard a variable declaration */
+static bool
+skip_var_decl(struct descent *p)
+{
+    VarDef *var;
+    if (!parse_var_decl(p, &var))
+        return false;
+    FreeStmt((ParseCommon *) var);
+    return true;
+}
+
+/* row { RowBody } ; */
+static bool
+parse_row(struct descent *p)
+{
+    next(p);
+    if (!expect(p, OBRACE))
+        return false;
+    do {
+        if (!accept(p, KEYS)) {
+            if (!skip_var_decl(p))
+                return false;
+            continue;
+        }
+        if (!expect(p, OBRACE))
+            return false;
+        do {
+            if (accept(p, KEYNAME))
+                continue;
+            ExprDef *exprs;
+            if (!expect(p, OBRACE) || !parse_expr_list(p, &exprs))
+                return false;
+            FreeStmt((ParseCommon *) exprs);
+            if (!expect(p, CBRACE))
+                return false;
+        } while (accept(p, COMMA));
+        if (!expect(p, CBRACE) || !expect(p, SEMI))
+            return false;
+    } while (peek(p) != CBRACE);
+    next(p);
+    return expect(p, SEMI);
+}
+
+/* overlay String { OverlayKeyList } ; */
+static bool
+parse_overlay(struct descent *p)
+{
+    xkb_atom_t name;
+    next(p);
+    if (!parse_string(p, &name) || !expect(p, OBRACE))
+        return false;
+    do {
+        if (!expect(p, KEYNAME) || !expect(p, EQUALS) || !expect(p, KEYNAME))
+            return false;
+    } while (accept(p, COMMA));
+    return expect(p, CBRACE) && expect(p, SEMI);
+}
+
+/* section String { SectionBody } ; */
+static bool
+parse_section_decl(struct descent *p)
+{
+    xkb_atom_t name;
+    next(p);
+    if (!parse_string(p, &name) || !expect(p, OBRACE))
+        return false;
+    do {
+        bool ok;
+        if (peek(p) == ROW && peek_at(p, 1) == OBRACE) {
+            ok = parse_row(p);
+        } else if (peek(p) == OVERLAY) {
+            ok = parse_overlay(p);
+        } else if (is_doodad_type(p)) {
+            ok = parse_doodad_decl(p);
+        } else if (peek(p) == INDICATOR && peek_at(p, 1) == STRING) {
+            VarDef *body;
+            next(p);
+            ok = parse_string(p, &name) && parse_var_decl_block(p, &body);
+            if (ok)
+                FreeStmt((ParseCommon *) body);
+        } else {
+            ok = skip_var_decl(p);
+        }
+        if (!ok)
+            return false;
+    } while (peek(p) != CBRACE);
+    next(p);
+    return expect(p, SEMI);
+}
+
+/*
+ * Decl
+ *
+ * Sets `out` to NULL for ignored declarations, and to a list for the virtual
+ * modifiers declarations.
+ */
+static bool
+parse_decl(struct descent *p, ParseCommon **out)
+{
+    enum merge_mode merge = MERGE_DEFAULT;
+    int64_t index;
+    ExprDef *expr;
+    VarDef *var;
+    xkb_atom_t name;
+
+    *out = NULL;
+
+    if (is_merge_mode(peek(p))) {
+        merge = parse_merge_mode(p);
+        if (peek(p) == STRING) {
+            /* Include statement */
+            next(p);
+            char *const str = strndup(p->val.lit.sval.start,
+                                      p->val.lit.sval.len);
+            free(p->val.lit.owned);
+            if (!str)
+                return false;
+            *out = (ParseCommon *) IncludeCreate(p->ctx, str, merge);
+            free(str);
+            return true;
+        }
+    }
+
+    const int tok = peek(p);
+
+    /* Keywords that are also field names, used as a left-hand side */
+    if (element_name(tok) && is_lhs_continuation(peek_at(p, 1)))
+        goto var_decl;
+
+    switch (tok) {
+    case VIRTUAL_MODS:
+        return parse_vmod_decl(p, merge, out);
+    case INTERPRET: {
+        InterpDef *interp;
+        if (!parse_interpret_decl(p, &interp))
+            return false;
+        interp->merge = merge;
+        *out = &interp->common;
+        return true;
+    }
+    case KEYNAME: {
+        next(p);
+        name = p->val.atom;
+        if (!expect(p, EQUALS) || !parse_integer(p, &index) ||
+            !expect(p, SEMI))
+            return false;
+        KeycodeDef *const keycode = KeycodeCreate(name, index);
+        if (!keycode)
+            return false;
+        keycode->merge = merge;
+        *out = &keycode->common;
+        return true;
+    }
+    case ALIAS: {
+        next(p);
+        if (!expect(p, KEYNAME))
+            return false;
+        name = p->val.atom;
+        if (!expect(p, EQUALS) || !expect(p, KEYNAME))
+            return false;
+        const xkb_atom_t real = p->val.atom;
+        if (!expect(p, SEMI))
+            return false;
+        KeyAliasDef *const alias = KeyAliasCreate(name, real);
+        if (!alias)
+            return false;
+        alias->merge = merge;
+        *out = &alias->common;
+        return true;
+    }
+    case TYPE: {
+        next(p);
+        if (!parse_string(p, &name) || !parse_var_decl_block(p, &var))
+            return false;
+        KeyTypeDef *const type = KeyTypeCreate(name, var);
+        if (!type) {
+            FreeStmt((ParseCommon *) var);
+            return false;
+        }
+        type->merge = merge;
+        *out = &type->common;
+        return true;
+    }
+    case KEY: {
+        SymbolsDef *symbols;
+        if (!parse_symbols_decl(p, &symbols))
+            return false;
+        symbols->merge = merge;
+        *out = &symbols->common;
+        return true;
+    }
+    case MODIFIER_MAP: {
+        ModMapDef *modmap;
+        if (!parse_modmap_decl(p, &modmap))
+            return false;
+        modmap->merge = merge;
+        *out = &modmap->common;
+        return true;
+    }
+    case GROUP: {
+        next(p);
+        if (!parse_indexed_expr(p, &index, &expr))
+            return false;
+        GroupCompatDef *const group = GroupCompatCreate(index, expr);
+        if (!group) {
+            FreeStmt((ParseCommon *) expr);
+            return false;
+        }
+        group->merge = merge;
+        *out = &group->common;
+        return true;
+    }
+    case VIRTUAL:
+    case INDICATOR: {
+        const bool virtual = accept(p, VIRTUAL);
+        if (!expect(p, INDICATOR))
+            return false;
+        if (!virtual && peek(p) == STRING) {
+            if (!parse_string(p, &name) || !parse_var_decl_block(p, &var))
+                return false;
+            LedMapDef *const led = LedMapCreate(name, var);
+            if (!led) {
+                FreeStmt((ParseCommon *) var);
+                return false;
+            }
+            led->merge = merge;
+            *out = &led->common;
+            return true;
+        }
+        if (!parse_indexed_expr(p, &index, &expr))
+            return false;
+        LedNameDef *const led = LedNameCreate(index, expr, virtual);
+        if (!led) {
+            FreeStmt((ParseCommon *) expr);
+            return false;
+        }
+        led->merge = merge;
+        *out = &led->common;
+        return true;
+    }
+    case SHAPE:
+        return parse_shape_decl(p);
+    case SECTION:
+        return parse_section_decl(p);
+    case TEXT:
+    case OUTLINE:
+    case SOLID:
+    case LOGO:
+        return parse_doodad_decl(p);
+    case IDENT:
+        if (peek_at(p, 1) == OBRACE || is_terminal(peek_at(p, 1))) {
+            UnknownStatement *unknown;
+            if (!parse_unknown_decl(p, &unknown))
+                return false;
+            *out = &unknown->common;
+            return true;
+        }
+        break;
+    case DEFAULT:
+    case EXCLAM:
+    case ACTION_TOK:
+    case ROW:
+        break;
+    default:
+        return syntax_error(p, YYEMPTY);
+    }
+
+var_decl:
+    if (!parse_var_decl(p, &var))
+        return false;
+    var->merge = merge;
+    *out = &var->common;
+    return true;
+}
+
+/* DeclList }, after the opening brace */
+static bool
+parse_decl_list(struct descent *p, ParseCommon **out)
+{
+    struct stmt_list list = { NULL, NULL };
+    ParseCommon *decl;
+    while (!accept(p, CBRACE)) {
+        if (!parse_decl(p, &decl)) {
+            FreeStmt(list.head);
+            return false;
+        }
+        if (decl)
+            stmt_list_append_all(&list, decl);
+    }
+    *out = list.head;
+    return true;
+}
+
+/*
+ * DeclList }, after the opening brace, discarding every declaration as soon as
+ * it is parsed. The syntax is still checked, so that both parsers accept the
+ * same language.
+ */
+static bool
+skip_decl_list(struct descent *p)
+{
+    ParseCommon *decl;
+    while (!accept(p, CBRACE)) {
+        if (!parse_decl(p, &decl))
+            return false;
+        FreeStmt(decl);
+    }
+    return true;
+}
+
+/*
+ * Files
+ */
+
+/* OptFlags */
+static bool
+parse_flags(struct descent *p, enum xkb_map_flags *out)
+{
+    enum xkb_map_flags flags = 0;
+    for (;;) {
+        switch (peek(p)) {
+        case PARTIAL: flags |= MAP_IS_PARTIAL; break;
+        case DEFAULT: flags |= MAP_IS_DEFAULT; break;
+        case HIDDEN: flags |= MAP_IS_HIDDEN; break;
+        case ALPHANUMERIC_KEYS: flags |= MAP_HAS_ALPHANUMERIC; break;
+        case MODIFIER_KEYS: flags |= MAP_HAS_MODIFIER; break;
+        case KEYPAD_KEYS: flags |= MAP_HAS_KEYPAD; break;
+        case FUNCTION_KEYS: flags |= MAP_HAS_FN; break;
+        case ALTERNATE_GROUP: flags |= MAP_IS_ALTGR; break;
+        case DEPRECATED: flags |= MAP_IS_DEPRECATED; break;
+        case IDENT: {
+            const bool error =
+                (p->config->strict & PARSER_NO_UNKNOWN_SECTION_FLAGS);
+            const struct sval name = p->vals[0].sval;
+            scanner_log_with_code(
+                p->scanner,
+                (error ? XKB_LOG_LEVEL_ERROR : XKB_LOG_LEVEL_WARNING),
+                XKB_LOG_VERBOSITY_MINIMAL, XKB_ERROR_UNKNOWN_SECTION_FLAG,
+                "Unknown section flag \"%.*s\"%s",
+                (unsigned) name.len, name.start,
+                (error ? "" : "; ignored")
+            );
+            if (error)
+                return false;
+            break;
+        }
+        default:
+            *out = flags;
+            return true;
+        }
+        next(p);
+    }
+}
+
+/* OptMapName */
+static bool
+parse_map_name(struct descent *p, char **out)
+{
+    *out = NULL;
+    if (!accept(p, STRING))
+        return true;
+    *out = strndup(p->val.lit.sval.start, p->val.lit.sval.len);
+    free(p->val.lit.owned);
+    return !!*out;
+}
+
+/* XkbMapConfig, after the flags */
+static bool
+parse_map_config(struct descent *p, enum xkb_map_flags flags, XkbFile **out)
+{
+    enum xkb_file_type type;
+    ParseCommon *defs = NULL;
+    char *name;
+
+    switch (peek(p)) {
+    case XKB_KEYCODES: type = FILE_TYPE_KEYCODES; break;
+    case XKB_TYPES: type = FILE_TYPE_TYPES; break;
+    case XKB_COMPATMAP: type = FILE_TYPE_COMPAT; break;
+    case XKB_SYMBOLS: type = FILE_TYPE_SYMBOLS; break;
+    case XKB_GEOMETRY: type = FILE_TYPE_GEOMETRY; break;
+    default: return syntax_error(p, YYEMPTY);
+    }
+    next(p);
+
+    if (!parse_map_name(p, &name))
+        return false;
+    if (!expect(p, OBRACE))
+        goto error;
+    if (type == FILE_TYPE_GEOMETRY && p->config->skip_geometry) {
+        if (!skip_decl_list(p))
+            goto error;
+    } else if (!parse_decl_list(p, &defs)) {
+        goto error;
+    }
+    if (!expect(p, SEMI))
+        goto error;
+
+    if (flags & MAP_IS_DEPRECATED) {
+        scanner_warn(p->scanner, XKB_WARNING_DEPRECATED_SECTION,
+                     "deprecated section: \"%s\"", safe_map_name(name));
+    }
+    if (!(*out = XkbFileCreate(type, name, defs, flags)))
+        goto error;
+    return true;
+
+error:
+    FreeStmt(defs);
+    free(name);
+    return false;
+}
+
+/* XkbCompositeMap, after the flags */
+static bool
+parse_composite_map(struct descent *p, enum xkb_map_flags flags,
+                    XkbFile **out)
+{
+    struct stmt_list list = { NULL, NULL };
+    enum xkb_map_flags section_flags;
+    XkbFile *section;
+    char *name;
+
+    next(p);
+    if (!parse_map_name(p, &name))
+        return false;
+    if (!expect(p, OBRACE))
+        goto error;
+    while (!accept(p, CBRACE)) {
+        if (!parse_flags(p, &section_flags) ||
+            !parse_map_config(p, section_flags, &section))
+            goto error;
+        stmt_list_append(&list, &section->common);
+    }
+    /* A keymap must be the only map of the file */
+    if (!expect(p, SEMI) || !expect(p, END_OF_FILE))
+        goto error;
+    if (!(*out = XkbFileCreate(FILE_TYPE_KEYMAP, name, list.head, flags)))
+        goto error;
+    return true;
+
+error:
+    FreeXkbFile((XkbFile *) list.head);
+    free(name);
+    return false;
+}
+
+/* XkbFile */
+static bool
+parse_file(struct descent *p, XkbFile **out)
+{
+    enum xkb_map_flags flags;
+
+    *out = NULL;
+    if (accept(p, END_OF_FILE))
+        return true;
+    if (!parse_flags(p, &flags))
+        return false;
+
+    switch (peek(p)) {
+    case XKB_KEYMAP:
+    case XKB_SEMANTICS:
+    case XKB_LAYOUT:
+        return parse_composite_map(p, flags, out);
+    default:
+        return parse_map_config(p, flags, out);
+    }
+}
+
+bool
+parse_next_descent(struct xkb_context *ctx,
+                   const struct parser_keymap_config *config,
+                   struct scanner *scanner, XkbFile **xkb_file)
+{
+    struct descent p = {
+        .ctx = ctx,
+        .scanner = scanner,
+        .config = config,
+        .num_toks = 0,
+    };
+
+    const bool ok = parse_file(&p, xkb_file);
+    /* A successful parse does not read past the end of the section */
+    assert(!ok || p.num_toks == 0);
+    drop_lookahead(&p);
+    return ok;
+}
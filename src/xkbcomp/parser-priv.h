@@ -17,14 +17,22 @@ struct scanner;
 int
 _xkbcommon_lex(YYSTYPE *yylval, struct scanner *scanner);
 
-XkbFile *
-parse(struct xkb_context *ctx, const struct parser_keymap_config *config,
-      struct scanner *scanner, const char *map);
-
+/*
+ * Parse the next section of a file.
+ *
+ * Returns false on error. Otherwise returns true and sets `xkb_file` to the
+ * parsed section, or to NULL if there are no more sections.
+ */
 bool
 parse_next(struct xkb_context *ctx,
            const struct parser_keymap_config *config,
            struct scanner *scanner, XkbFile **xkb_file);
 
+/* Same as parse_next(), using the hand-written recursive descent parser */
+bool
+parse_next_descent(struct xkb_context *ctx,
+                   const struct parser_keymap_config *config,
+                   struct scanner *scanner, XkbFile **xkb_file);
+
 int
 keyword_to_token(const char *string, size_t len);
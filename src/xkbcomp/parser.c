@@ -117,43 +117,9 @@ _xkbcommon_error(struct parser_param *param, const char *msg)
     parser_err(param, XKB_ERROR_INVALID_XKB_SYNTAX, "%s", msg);
 }
 
-static bool
-resolve_keysym(struct parser_param *param, struct sval name, xkb_keysym_t *sym_rtrn)
-{
-    xkb_keysym_t sym;
-
-    if (isvaleq(name, SVAL_LIT("any")) || isvaleq(name, SVAL_LIT("nosymbol"))) {
-        *sym_rtrn = XKB_KEY_NoSymbol;
-        return true;
-    }
-
-    if (isvaleq(name, SVAL_LIT("none")) || isvaleq(name, SVAL_LIT("voidsymbol"))) {
-        *sym_rtrn = XKB_KEY_VoidSymbol;
-        return true;
-    }
-
-    /* xkb_keysym_from_name needs a C string. */
-    char buf[XKB_KEYSYM_NAME_MAX_SIZE];
-    if (name.len >= sizeof(buf)) {
-        return false;
-    }
-    memcpy(buf, name.start, name.len);
-    buf[name.len] = '\0';
-
-    sym = xkb_keysym_from_name(buf, XKB_KEYSYM_NO_FLAGS);
-    if (sym != XKB_KEY_NoSymbol) {
-        *sym_rtrn = sym;
-        check_deprecated_keysyms(parser_warn, param, param->ctx,
-                                 sym, buf, buf, "%s", "");
-        return true;
-    }
-
-    return false;
-}
-
 #define param_scanner param->scanner
 
-#line 150 "src/xkbcomp/parser.c"
+#line 116 "src/xkbcomp/parser.c"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -716,29 +682,29 @@ static const yytype_int8 yytranslate[] =
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   275,   275,   277,   279,   283,   289,   290,   291,   297,
-     309,   312,   325,   326,   327,   328,   329,   332,   333,   336,
-     337,   340,   341,   342,   343,   344,   345,   346,   347,   348,
-     349,   366,   381,   391,   394,   400,   405,   410,   415,   420,
-     425,   430,   435,   440,   445,   446,   447,   448,   450,   452,
-     459,   461,   463,   467,   471,   475,   479,   481,   485,   487,
-     491,   497,   499,   503,   515,   518,   524,   530,   531,   534,
-     536,   540,   541,   542,   543,   544,   559,   561,   579,   581,
-     603,   609,   611,   613,   616,   620,   637,   639,   643,   645,
-     649,   653,   655,   659,   668,   676,   678,   682,   686,   687,
-     690,   692,   694,   696,   698,   702,   703,   706,   707,   711,
-     712,   715,   717,   721,   725,   726,   729,   732,   734,   738,
-     740,   742,   746,   748,   752,   756,   760,   761,   762,   763,
-     766,   767,   770,   772,   774,   776,   778,   780,   782,   784,
-     786,   788,   790,   794,   795,   798,   799,   800,   801,   802,
-     814,   826,   828,   831,   833,   835,   837,   839,   841,   845,
-     847,   849,   851,   853,   855,   857,   859,   861,   865,   871,
-     873,   875,   879,   881,   885,   889,   891,   895,   899,   901,
-     903,   905,   909,   911,   914,   916,   918,   920,   924,   930,
-     932,   934,   938,   940,   947,   953,   965,   967,   979,   981,
-     985,   987,   996,  1009,  1010,  1019,  1079,  1080,  1083,  1084,
-    1085,  1088,  1091,  1092,  1095,  1096,  1099,  1100,  1103,  1106,
-    1107,  1110
+       0,   243,   243,   245,   247,   251,   257,   258,   259,   265,
+     277,   280,   293,   294,   295,   296,   297,   300,   301,   304,
+     305,   308,   309,   310,   311,   312,   313,   314,   315,   316,
+     317,   334,   349,   359,   362,   368,   373,   378,   383,   388,
+     393,   398,   403,   408,   413,   414,   415,   416,   418,   420,
+     431,   433,   435,   439,   443,   447,   451,   453,   457,   459,
+     463,   469,   471,   475,   487,   490,   496,   502,   503,   506,
+     508,   512,   513,   514,   515,   516,   531,   533,   551,   553,
+     575,   581,   583,   585,   588,   592,   609,   611,   615,   617,
+     621,   625,   627,   631,   640,   648,   650,   654,   658,   659,
+     662,   664,   666,   668,   670,   674,   675,   678,   679,   683,
+     684,   687,   689,   693,   697,   698,   701,   704,   706,   710,
+     712,   714,   718,   720,   724,   728,   732,   733,   734,   735,
+     738,   739,   742,   744,   746,   748,   750,   752,   754,   756,
+     758,   760,   762,   766,   767,   770,   771,   772,   773,   774,
+     786,   798,   800,   803,   805,   807,   809,   811,   813,   817,
+     819,   821,   823,   825,   827,   829,   831,   833,   837,   843,
+     845,   847,   851,   853,   857,   861,   863,   867,   871,   873,
+     875,   877,   881,   883,   886,   888,   890,   892,   896,   902,
+     904,   906,   910,   912,   919,   925,   937,   939,   951,   953,
+     957,   959,   968,   971,   972,   981,   985,   986,   989,   990,
+     991,   994,   997,   998,  1001,  1002,  1005,  1006,  1009,  1016,
+    1017,  1020
 };
 #endif
 
@@ -1641,285 +1607,285 @@ yydestruct (const char *yymsg,
   switch (yykind)
     {
     case YYSYMBOL_STRING: /* "string literal"  */
-#line 259 "src/xkbcomp/parser.y"
-            { free(((*yyvaluep).str)); }
-#line 1640 "src/xkbcomp/parser.c"
+#line 227 "src/xkbcomp/parser.y"
+            { free(((*yyvaluep).lit).owned); }
+#line 1606 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_XkbFile: /* XkbFile  */
-#line 257 "src/xkbcomp/parser.y"
+#line 224 "src/xkbcomp/parser.y"
             { if (!param->rtrn) FreeXkbFile(((*yyvaluep).file)); }
-#line 1646 "src/xkbcomp/parser.c"
+#line 1612 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_XkbCompositeMap: /* XkbCompositeMap  */
-#line 257 "src/xkbcomp/parser.y"
+#line 224 "src/xkbcomp/parser.y"
             { if (!param->rtrn) FreeXkbFile(((*yyvaluep).file)); }
-#line 1652 "src/xkbcomp/parser.c"
+#line 1618 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_XkbMapConfigList: /* XkbMapConfigList  */
-#line 258 "src/xkbcomp/parser.y"
+#line 225 "src/xkbcomp/parser.y"
             { FreeXkbFile(((*yyvaluep).fileList).head); }
-#line 1658 "src/xkbcomp/parser.c"
+#line 1624 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_XkbMapConfig: /* XkbMapConfig  */
-#line 257 "src/xkbcomp/parser.y"
+#line 224 "src/xkbcomp/parser.y"
             { if (!param->rtrn) FreeXkbFile(((*yyvaluep).file)); }
-#line 1664 "src/xkbcomp/parser.c"
+#line 1630 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_DeclList: /* DeclList  */
-#line 253 "src/xkbcomp/parser.y"
+#line 220 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).anyList).head); }
-#line 1670 "src/xkbcomp/parser.c"
+#line 1636 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_Decl: /* Decl  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).any)); }
-#line 1676 "src/xkbcomp/parser.c"
+#line 1642 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_VarDecl: /* VarDecl  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).var)); }
-#line 1682 "src/xkbcomp/parser.c"
+#line 1648 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_KeyNameDecl: /* KeyNameDecl  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).keyCode)); }
-#line 1688 "src/xkbcomp/parser.c"
+#line 1654 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_KeyAliasDecl: /* KeyAliasDecl  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).keyAlias)); }
-#line 1694 "src/xkbcomp/parser.c"
+#line 1660 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_VModDecl: /* VModDecl  */
-#line 253 "src/xkbcomp/parser.y"
+#line 220 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).vmodList).head); }
-#line 1700 "src/xkbcomp/parser.c"
+#line 1666 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_VModDefList: /* VModDefList  */
-#line 253 "src/xkbcomp/parser.y"
+#line 220 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).vmodList).head); }
-#line 1706 "src/xkbcomp/parser.c"
+#line 1672 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_VModDef: /* VModDef  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).vmod)); }
-#line 1712 "src/xkbcomp/parser.c"
+#line 1678 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_InterpretDecl: /* InterpretDecl  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).interp)); }
-#line 1718 "src/xkbcomp/parser.c"
+#line 1684 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_InterpretMatch: /* InterpretMatch  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).interp)); }
-#line 1724 "src/xkbcomp/parser.c"
+#line 1690 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_VarDeclList: /* VarDeclList  */
-#line 253 "src/xkbcomp/parser.y"
+#line 220 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).varList).head); }
-#line 1730 "src/xkbcomp/parser.c"
+#line 1696 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_KeyTypeDecl: /* KeyTypeDecl  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).keyType)); }
-#line 1736 "src/xkbcomp/parser.c"
+#line 1702 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_SymbolsDecl: /* SymbolsDecl  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).syms)); }
-#line 1742 "src/xkbcomp/parser.c"
+#line 1708 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_OptSymbolsBody: /* OptSymbolsBody  */
-#line 253 "src/xkbcomp/parser.y"
+#line 220 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).varList).head); }
-#line 1748 "src/xkbcomp/parser.c"
+#line 1714 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_SymbolsBody: /* SymbolsBody  */
-#line 253 "src/xkbcomp/parser.y"
+#line 220 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).varList).head); }
-#line 1754 "src/xkbcomp/parser.c"
+#line 1720 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_SymbolsVarDecl: /* SymbolsVarDecl  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).var)); }
-#line 1760 "src/xkbcomp/parser.c"
+#line 1726 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_MultiKeySymOrActionList: /* MultiKeySymOrActionList  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).expr)); }
-#line 1766 "src/xkbcomp/parser.c"
+#line 1732 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_GroupCompatDecl: /* GroupCompatDecl  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).groupCompat)); }
-#line 1772 "src/xkbcomp/parser.c"
+#line 1738 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_ModMapDecl: /* ModMapDecl  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).modMask)); }
-#line 1778 "src/xkbcomp/parser.c"
+#line 1744 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_KeyOrKeySymList: /* KeyOrKeySymList  */
-#line 253 "src/xkbcomp/parser.y"
+#line 220 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).exprList).head); }
-#line 1784 "src/xkbcomp/parser.c"
+#line 1750 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_KeyOrKeySym: /* KeyOrKeySym  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).expr)); }
-#line 1790 "src/xkbcomp/parser.c"
+#line 1756 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_LedMapDecl: /* LedMapDecl  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).ledMap)); }
-#line 1796 "src/xkbcomp/parser.c"
+#line 1762 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_LedNameDecl: /* LedNameDecl  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).ledName)); }
-#line 1802 "src/xkbcomp/parser.c"
+#line 1768 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_CoordList: /* CoordList  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).expr)); }
-#line 1808 "src/xkbcomp/parser.c"
+#line 1774 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_Coord: /* Coord  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).expr)); }
-#line 1814 "src/xkbcomp/parser.c"
+#line 1780 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_ExprList: /* ExprList  */
-#line 253 "src/xkbcomp/parser.y"
+#line 220 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).exprList).head); }
-#line 1820 "src/xkbcomp/parser.c"
+#line 1786 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_Expr: /* Expr  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).expr)); }
-#line 1826 "src/xkbcomp/parser.c"
+#line 1792 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_Term: /* Term  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).expr)); }
-#line 1832 "src/xkbcomp/parser.c"
+#line 1798 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_MultiActionList: /* MultiActionList  */
-#line 253 "src/xkbcomp/parser.y"
+#line 220 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).exprList).head); }
-#line 1838 "src/xkbcomp/parser.c"
+#line 1804 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_ActionList: /* ActionList  */
-#line 253 "src/xkbcomp/parser.y"
+#line 220 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).exprList).head); }
-#line 1844 "src/xkbcomp/parser.c"
+#line 1810 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_NonEmptyActions: /* NonEmptyActions  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).expr)); }
-#line 1850 "src/xkbcomp/parser.c"
+#line 1816 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_Actions: /* Actions  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).expr)); }
-#line 1856 "src/xkbcomp/parser.c"
+#line 1822 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_Action: /* Action  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).expr)); }
-#line 1862 "src/xkbcomp/parser.c"
+#line 1828 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_Lhs: /* Lhs  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).expr)); }
-#line 1868 "src/xkbcomp/parser.c"
+#line 1834 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_OptTerminal: /* OptTerminal  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).expr)); }
-#line 1874 "src/xkbcomp/parser.c"
+#line 1840 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_Terminal: /* Terminal  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).expr)); }
-#line 1880 "src/xkbcomp/parser.c"
+#line 1846 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_MultiKeySymList: /* MultiKeySymList  */
-#line 253 "src/xkbcomp/parser.y"
+#line 220 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).exprList).head); }
-#line 1886 "src/xkbcomp/parser.c"
+#line 1852 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_KeySymList: /* KeySymList  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).expr)); }
-#line 1892 "src/xkbcomp/parser.c"
+#line 1858 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_NonEmptyKeySyms: /* NonEmptyKeySyms  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).expr)); }
-#line 1898 "src/xkbcomp/parser.c"
+#line 1864 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_KeySyms: /* KeySyms  */
-#line 250 "src/xkbcomp/parser.y"
+#line 217 "src/xkbcomp/parser.y"
             { FreeStmt((ParseCommon *) ((*yyvaluep).expr)); }
-#line 1904 "src/xkbcomp/parser.c"
+#line 1870 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_OptMapName: /* OptMapName  */
-#line 259 "src/xkbcomp/parser.y"
+#line 226 "src/xkbcomp/parser.y"
             { free(((*yyvaluep).str)); }
-#line 1910 "src/xkbcomp/parser.c"
+#line 1876 "src/xkbcomp/parser.c"
         break;
 
     case YYSYMBOL_MapName: /* MapName  */
-#line 259 "src/xkbcomp/parser.y"
+#line 226 "src/xkbcomp/parser.y"
             { free(((*yyvaluep).str)); }
-#line 1916 "src/xkbcomp/parser.c"
+#line 1882 "src/xkbcomp/parser.c"
         break;
 
       default:
@@ -2196,49 +2162,49 @@ yyreduce:
   switch (yyn)
     {
   case 2: /* XkbFile: XkbCompositeMap  */
-#line 276 "src/xkbcomp/parser.y"
+#line 244 "src/xkbcomp/parser.y"
                         { (yyval.file) = param->rtrn = (yyvsp[0].file); param->more_maps = !!param->rtrn; (void) yynerrs; }
-#line 2195 "src/xkbcomp/parser.c"
+#line 2161 "src/xkbcomp/parser.c"
     break;
 
   case 3: /* XkbFile: XkbMapConfig  */
-#line 278 "src/xkbcomp/parser.y"
+#line 246 "src/xkbcomp/parser.y"
                         { (yyval.file) = param->rtrn = (yyvsp[0].file); param->more_maps = !!param->rtrn; YYACCEPT; }
-#line 2201 "src/xkbcomp/parser.c"
+#line 2167 "src/xkbcomp/parser.c"
     break;
 
   case 4: /* XkbFile: "end of file"  */
-#line 280 "src/xkbcomp/parser.y"
+#line 248 "src/xkbcomp/parser.y"
                         { (yyval.file) = param->rtrn = NULL; param->more_maps = false; }
-#line 2207 "src/xkbcomp/parser.c"
+#line 2173 "src/xkbcomp/parser.c"
     break;
 
   case 5: /* XkbCompositeMap: OptFlags XkbCompositeType OptMapName "{" XkbMapConfigList "}" ";"  */
-#line 286 "src/xkbcomp/parser.y"
+#line 254 "src/xkbcomp/parser.y"
                         { (yyval.file) = XkbFileCreate((yyvsp[-5].file_type), (yyvsp[-4].str), (ParseCommon *) (yyvsp[-2].fileList).head, (yyvsp[-6].mapFlags)); }
-#line 2213 "src/xkbcomp/parser.c"
+#line 2179 "src/xkbcomp/parser.c"
     break;
 
   case 6: /* XkbCompositeType: "xkb_keymap"  */
-#line 289 "src/xkbcomp/parser.y"
+#line 257 "src/xkbcomp/parser.y"
                                         { (yyval.file_type) = FILE_TYPE_KEYMAP; }
-#line 2219 "src/xkbcomp/parser.c"
+#line 2185 "src/xkbcomp/parser.c"
     break;
 
   case 7: /* XkbCompositeType: "xkb_semantics"  */
-#line 290 "src/xkbcomp/parser.y"
+#line 258 "src/xkbcomp/parser.y"
                                         { (yyval.file_type) = FILE_TYPE_KEYMAP; }
-#line 2225 "src/xkbcomp/parser.c"
+#line 2191 "src/xkbcomp/parser.c"
     break;
 
   case 8: /* XkbCompositeType: "xkb_layout"  */
-#line 291 "src/xkbcomp/parser.y"
+#line 259 "src/xkbcomp/parser.y"
                                         { (yyval.file_type) = FILE_TYPE_KEYMAP; }
-#line 2231 "src/xkbcomp/parser.c"
+#line 2197 "src/xkbcomp/parser.c"
     break;
 
   case 9: /* XkbMapConfigList: XkbMapConfigList XkbMapConfig  */
-#line 298 "src/xkbcomp/parser.y"
+#line 266 "src/xkbcomp/parser.y"
                         {
                             if ((yyvsp[0].file)) {
                                 if ((yyvsp[-1].fileList).head) {
@@ -2250,17 +2216,17 @@ yyreduce:
                                 }
                             }
                         }
-#line 2247 "src/xkbcomp/parser.c"
+#line 2213 "src/xkbcomp/parser.c"
     break;
 
   case 10: /* XkbMapConfigList: %empty  */
-#line 309 "src/xkbcomp/parser.y"
+#line 277 "src/xkbcomp/parser.y"
                         { (yyval.fileList).head = (yyval.fileList).last = NULL; }
-#line 2253 "src/xkbcomp/parser.c"
+#line 2219 "src/xkbcomp/parser.c"
     break;
 
   case 11: /* XkbMapConfig: OptFlags FileType OptMapName "{" DeclList "}" ";"  */
-#line 315 "src/xkbcomp/parser.y"
+#line 283 "src/xkbcomp/parser.y"
                         {
                             if ((yyvsp[-6].mapFlags) & MAP_IS_DEPRECATED) {
                                 parser_warn(param, XKB_WARNING_DEPRECATED_SECTION,
@@ -2269,119 +2235,119 @@ yyreduce:
                             }
                             (yyval.file) = XkbFileCreate((yyvsp[-5].file_type), (yyvsp[-4].str), (yyvsp[-2].anyList).head, (yyvsp[-6].mapFlags));
                         }
-#line 2266 "src/xkbcomp/parser.c"
+#line 2232 "src/xkbcomp/parser.c"
     break;
 
   case 12: /* FileType: "xkb_keycodes"  */
-#line 325 "src/xkbcomp/parser.y"
+#line 293 "src/xkbcomp/parser.y"
                                                 { (yyval.file_type) = FILE_TYPE_KEYCODES; }
-#line 2272 "src/xkbcomp/parser.c"
+#line 2238 "src/xkbcomp/parser.c"
     break;
 
   case 13: /* FileType: "xkb_types"  */
-#line 326 "src/xkbcomp/parser.y"
+#line 294 "src/xkbcomp/parser.y"
                                                 { (yyval.file_type) = FILE_TYPE_TYPES; }
-#line 2278 "src/xkbcomp/parser.c"
+#line 2244 "src/xkbcomp/parser.c"
     break;
 
   case 14: /* FileType: "xkb_compatibility"  */
-#line 327 "src/xkbcomp/parser.y"
+#line 295 "src/xkbcomp/parser.y"
                                                 { (yyval.file_type) = FILE_TYPE_COMPAT; }
-#line 2284 "src/xkbcomp/parser.c"
+#line 2250 "src/xkbcomp/parser.c"
     break;
 
   case 15: /* FileType: "xkb_symbols"  */
-#line 328 "src/xkbcomp/parser.y"
+#line 296 "src/xkbcomp/parser.y"
                                                 { (yyval.file_type) = FILE_TYPE_SYMBOLS; }
-#line 2290 "src/xkbcomp/parser.c"
+#line 2256 "src/xkbcomp/parser.c"
     break;
 
   case 16: /* FileType: "xkb_geometry"  */
-#line 329 "src/xkbcomp/parser.y"
+#line 297 "src/xkbcomp/parser.y"
                                                 { (yyval.file_type) = FILE_TYPE_GEOMETRY; }
-#line 2296 "src/xkbcomp/parser.c"
+#line 2262 "src/xkbcomp/parser.c"
     break;
 
   case 17: /* OptFlags: Flags  */
-#line 332 "src/xkbcomp/parser.y"
+#line 300 "src/xkbcomp/parser.y"
                                                 { (yyval.mapFlags) = (yyvsp[0].mapFlags); }
-#line 2302 "src/xkbcomp/parser.c"
+#line 2268 "src/xkbcomp/parser.c"
     break;
 
   case 18: /* OptFlags: %empty  */
-#line 333 "src/xkbcomp/parser.y"
+#line 301 "src/xkbcomp/parser.y"
                                                 { (yyval.mapFlags) = 0; }
-#line 2308 "src/xkbcomp/parser.c"
+#line 2274 "src/xkbcomp/parser.c"
     break;
 
   case 19: /* Flags: Flags Flag  */
-#line 336 "src/xkbcomp/parser.y"
+#line 304 "src/xkbcomp/parser.y"
                                                 { (yyval.mapFlags) = ((yyvsp[-1].mapFlags) | (yyvsp[0].mapFlags)); }
-#line 2314 "src/xkbcomp/parser.c"
+#line 2280 "src/xkbcomp/parser.c"
     break;
 
   case 20: /* Flags: Flag  */
-#line 337 "src/xkbcomp/parser.y"
+#line 305 "src/xkbcomp/parser.y"
                                                 { (yyval.mapFlags) = (yyvsp[0].mapFlags); }
-#line 2320 "src/xkbcomp/parser.c"
+#line 2286 "src/xkbcomp/parser.c"
     break;
 
   case 21: /* Flag: "partial"  */
-#line 340 "src/xkbcomp/parser.y"
+#line 308 "src/xkbcomp/parser.y"
                                                 { (yyval.mapFlags) = MAP_IS_PARTIAL; }
-#line 2326 "src/xkbcomp/parser.c"
+#line 2292 "src/xkbcomp/parser.c"
     break;
 
   case 22: /* Flag: "default"  */
-#line 341 "src/xkbcomp/parser.y"
+#line 309 "src/xkbcomp/parser.y"
                                                 { (yyval.mapFlags) = MAP_IS_DEFAULT; }
-#line 2332 "src/xkbcomp/parser.c"
+#line 2298 "src/xkbcomp/parser.c"
     break;
 
   case 23: /* Flag: "hidden"  */
-#line 342 "src/xkbcomp/parser.y"
+#line 310 "src/xkbcomp/parser.y"
                                                 { (yyval.mapFlags) = MAP_IS_HIDDEN; }
-#line 2338 "src/xkbcomp/parser.c"
+#line 2304 "src/xkbcomp/parser.c"
     break;
 
   case 24: /* Flag: "alphanumeric_keys"  */
-#line 343 "src/xkbcomp/parser.y"
+#line 311 "src/xkbcomp/parser.y"
                                                 { (yyval.mapFlags) = MAP_HAS_ALPHANUMERIC; }
-#line 2344 "src/xkbcomp/parser.c"
+#line 2310 "src/xkbcomp/parser.c"
     break;
 
   case 25: /* Flag: "modifier_keys"  */
-#line 344 "src/xkbcomp/parser.y"
+#line 312 "src/xkbcomp/parser.y"
                                                 { (yyval.mapFlags) = MAP_HAS_MODIFIER; }
-#line 2350 "src/xkbcomp/parser.c"
+#line 2316 "src/xkbcomp/parser.c"
     break;
 
   case 26: /* Flag: "keypad_keys"  */
-#line 345 "src/xkbcomp/parser.y"
+#line 313 "src/xkbcomp/parser.y"
                                                 { (yyval.mapFlags) = MAP_HAS_KEYPAD; }
-#line 2356 "src/xkbcomp/parser.c"
+#line 2322 "src/xkbcomp/parser.c"
     break;
 
   case 27: /* Flag: "function_keys"  */
-#line 346 "src/xkbcomp/parser.y"
+#line 314 "src/xkbcomp/parser.y"
                                                 { (yyval.mapFlags) = MAP_HAS_FN; }
-#line 2362 "src/xkbcomp/parser.c"
+#line 2328 "src/xkbcomp/parser.c"
     break;
 
   case 28: /* Flag: "alternate_group"  */
-#line 347 "src/xkbcomp/parser.y"
+#line 315 "src/xkbcomp/parser.y"
                                                 { (yyval.mapFlags) = MAP_IS_ALTGR; }
-#line 2368 "src/xkbcomp/parser.c"
+#line 2334 "src/xkbcomp/parser.c"
     break;
 
   case 29: /* Flag: "deprecated"  */
-#line 348 "src/xkbcomp/parser.y"
+#line 316 "src/xkbcomp/parser.y"
                                                 { (yyval.mapFlags) = MAP_IS_DEPRECATED; }
-#line 2374 "src/xkbcomp/parser.c"
+#line 2340 "src/xkbcomp/parser.c"
     break;
 
   case 30: /* Flag: "identifier"  */
-#line 350 "src/xkbcomp/parser.y"
+#line 318 "src/xkbcomp/parser.y"
                         {
                             const bool error = (param->config.strict & PARSER_NO_UNKNOWN_SECTION_FLAGS);
                             parser_log_with_code(
@@ -2396,11 +2362,11 @@ yyreduce:
                                 YYABORT;
                             (yyval.mapFlags) = 0;
                         }
-#line 2393 "src/xkbcomp/parser.c"
+#line 2359 "src/xkbcomp/parser.c"
     break;
 
   case 31: /* DeclList: DeclList Decl  */
-#line 367 "src/xkbcomp/parser.y"
+#line 335 "src/xkbcomp/parser.y"
                         {
                             if ((yyvsp[0].any)) {
                                 if ((yyvsp[-1].anyList).head) {
@@ -2410,11 +2376,11 @@ yyreduce:
                                 }
                             }
                         }
-#line 2407 "src/xkbcomp/parser.c"
+#line 2373 "src/xkbcomp/parser.c"
     break;
 
   case 32: /* DeclList: DeclList OptMergeMode VModDecl  */
-#line 382 "src/xkbcomp/parser.y"
+#line 350 "src/xkbcomp/parser.y"
                         {
                             for (VModDef *vmod = (yyvsp[0].vmodList).head; vmod; vmod = (VModDef *) vmod->common.next)
                                 vmod->merge = (yyvsp[-1].merge);
@@ -2424,224 +2390,228 @@ yyreduce:
                                 (yyval.anyList).head = &(yyvsp[0].vmodList).head->common; (yyval.anyList).last = &(yyvsp[0].vmodList).last->common;
                             }
                         }
-#line 2421 "src/xkbcomp/parser.c"
+#line 2387 "src/xkbcomp/parser.c"
     break;
 
   case 33: /* DeclList: %empty  */
-#line 391 "src/xkbcomp/parser.y"
+#line 359 "src/xkbcomp/parser.y"
                         { (yyval.anyList).head = (yyval.anyList).last = NULL; }
-#line 2427 "src/xkbcomp/parser.c"
+#line 2393 "src/xkbcomp/parser.c"
     break;
 
   case 34: /* Decl: OptMergeMode VarDecl  */
-#line 395 "src/xkbcomp/parser.y"
+#line 363 "src/xkbcomp/parser.y"
                         {
                             (yyvsp[0].var)->merge = (yyvsp[-1].merge);
                             (yyval.any) = (ParseCommon *) (yyvsp[0].var);
                         }
-#line 2436 "src/xkbcomp/parser.c"
+#line 2402 "src/xkbcomp/parser.c"
     break;
 
   case 35: /* Decl: OptMergeMode InterpretDecl  */
-#line 401 "src/xkbcomp/parser.y"
+#line 369 "src/xkbcomp/parser.y"
                         {
                             (yyvsp[0].interp)->merge = (yyvsp[-1].merge);
                             (yyval.any) = (ParseCommon *) (yyvsp[0].interp);
                         }
-#line 2445 "src/xkbcomp/parser.c"
+#line 2411 "src/xkbcomp/parser.c"
     break;
 
   case 36: /* Decl: OptMergeMode KeyNameDecl  */
-#line 406 "src/xkbcomp/parser.y"
+#line 374 "src/xkbcomp/parser.y"
                         {
                             (yyvsp[0].keyCode)->merge = (yyvsp[-1].merge);
                             (yyval.any) = (ParseCommon *) (yyvsp[0].keyCode);
                         }
-#line 2454 "src/xkbcomp/parser.c"
+#line 2420 "src/xkbcomp/parser.c"
     break;
 
   case 37: /* Decl: OptMergeMode KeyAliasDecl  */
-#line 411 "src/xkbcomp/parser.y"
+#line 379 "src/xkbcomp/parser.y"
                         {
                             (yyvsp[0].keyAlias)->merge = (yyvsp[-1].merge);
                             (yyval.any) = (ParseCommon *) (yyvsp[0].keyAlias);
                         }
-#line 2463 "src/xkbcomp/parser.c"
+#line 2429 "src/xkbcomp/parser.c"
     break;
 
   case 38: /* Decl: OptMergeMode KeyTypeDecl  */
-#line 416 "src/xkbcomp/parser.y"
+#line 384 "src/xkbcomp/parser.y"
                         {
                             (yyvsp[0].keyType)->merge = (yyvsp[-1].merge);
                             (yyval.any) = (ParseCommon *) (yyvsp[0].keyType);
                         }
-#line 2472 "src/xkbcomp/parser.c"
+#line 2438 "src/xkbcomp/parser.c"
     break;
 
   case 39: /* Decl: OptMergeMode SymbolsDecl  */
-#line 421 "src/xkbcomp/parser.y"
+#line 389 "src/xkbcomp/parser.y"
                         {
                             (yyvsp[0].syms)->merge = (yyvsp[-1].merge);
                             (yyval.any) = (ParseCommon *) (yyvsp[0].syms);
                         }
-#line 2481 "src/xkbcomp/parser.c"
+#line 2447 "src/xkbcomp/parser.c"
     break;
 
   case 40: /* Decl: OptMergeMode ModMapDecl  */
-#line 426 "src/xkbcomp/parser.y"
+#line 394 "src/xkbcomp/parser.y"
                         {
                             (yyvsp[0].modMask)->merge = (yyvsp[-1].merge);
                             (yyval.any) = (ParseCommon *) (yyvsp[0].modMask);
                         }
-#line 2490 "src/xkbcomp/parser.c"
+#line 2456 "src/xkbcomp/parser.c"
     break;
 
   case 41: /* Decl: OptMergeMode GroupCompatDecl  */
-#line 431 "src/xkbcomp/parser.y"
+#line 399 "src/xkbcomp/parser.y"
                         {
                             (yyvsp[0].groupCompat)->merge = (yyvsp[-1].merge);
                             (yyval.any) = (ParseCommon *) (yyvsp[0].groupCompat);
                         }
-#line 2499 "src/xkbcomp/parser.c"
+#line 2465 "src/xkbcomp/parser.c"
     break;
 
   case 42: /* Decl: OptMergeMode LedMapDecl  */
-#line 436 "src/xkbcomp/parser.y"
+#line 404 "src/xkbcomp/parser.y"
                         {
                             (yyvsp[0].ledMap)->merge = (yyvsp[-1].merge);
                             (yyval.any) = (ParseCommon *) (yyvsp[0].ledMap);
                         }
-#line 2508 "src/xkbcomp/parser.c"
+#line 2474 "src/xkbcomp/parser.c"
     break;
 
   case 43: /* Decl: OptMergeMode LedNameDecl  */
-#line 441 "src/xkbcomp/parser.y"
+#line 409 "src/xkbcomp/parser.y"
                         {
                             (yyvsp[0].ledName)->merge = (yyvsp[-1].merge);
                             (yyval.any) = (ParseCommon *) (yyvsp[0].ledName);
                         }
-#line 2517 "src/xkbcomp/parser.c"
+#line 2483 "src/xkbcomp/parser.c"
     break;
 
   case 44: /* Decl: OptMergeMode ShapeDecl  */
-#line 445 "src/xkbcomp/parser.y"
+#line 413 "src/xkbcomp/parser.y"
                                                         { (yyval.any) = NULL; }
-#line 2523 "src/xkbcomp/parser.c"
+#line 2489 "src/xkbcomp/parser.c"
     break;
 
   case 45: /* Decl: OptMergeMode SectionDecl  */
-#line 446 "src/xkbcomp/parser.y"
+#line 414 "src/xkbcomp/parser.y"
                                                         { (yyval.any) = NULL; }
-#line 2529 "src/xkbcomp/parser.c"
+#line 2495 "src/xkbcomp/parser.c"
     break;
 
   case 46: /* Decl: OptMergeMode DoodadDecl  */
-#line 447 "src/xkbcomp/parser.y"
+#line 415 "src/xkbcomp/parser.y"
                                                         { (yyval.any) = NULL; }
-#line 2535 "src/xkbcomp/parser.c"
+#line 2501 "src/xkbcomp/parser.c"
     break;
 
   case 47: /* Decl: OptMergeMode UnknownDecl  */
-#line 449 "src/xkbcomp/parser.y"
+#line 417 "src/xkbcomp/parser.y"
                             { (yyval.any) = (ParseCommon *) (yyvsp[0].unknown); }
-#line 2541 "src/xkbcomp/parser.c"
+#line 2507 "src/xkbcomp/parser.c"
     break;
 
   case 48: /* Decl: OptMergeMode UnknownCompoundStatementDecl  */
-#line 451 "src/xkbcomp/parser.y"
+#line 419 "src/xkbcomp/parser.y"
                             { (yyval.any) = (ParseCommon *) (yyvsp[0].unknown); }
-#line 2547 "src/xkbcomp/parser.c"
+#line 2513 "src/xkbcomp/parser.c"
     break;
 
   case 49: /* Decl: MergeMode "string literal"  */
-#line 453 "src/xkbcomp/parser.y"
+#line 421 "src/xkbcomp/parser.y"
                         {
-                            (yyval.any) = (ParseCommon *) IncludeCreate(param->ctx, (yyvsp[0].str), (yyvsp[-1].merge));
-                            free((yyvsp[0].str));
+                            char *const str = strndup((yyvsp[0].lit).sval.start, (yyvsp[0].lit).sval.len);
+                            free((yyvsp[0].lit).owned);
+                            if (!str)
+                                YYABORT;
+                            (yyval.any) = (ParseCommon *) IncludeCreate(param->ctx, str, (yyvsp[-1].merge));
+                            free(str);
                         }
-#line 2556 "src/xkbcomp/parser.c"
+#line 2526 "src/xkbcomp/parser.c"
     break;
 
   case 50: /* VarDecl: Lhs "=" Expr ";"  */
-#line 460 "src/xkbcomp/parser.y"
+#line 432 "src/xkbcomp/parser.y"
                         { (yyval.var) = VarCreate((yyvsp[-3].expr), (yyvsp[-1].expr)); }
-#line 2562 "src/xkbcomp/parser.c"
+#line 2532 "src/xkbcomp/parser.c"
     break;
 
   case 51: /* VarDecl: Ident ";"  */
-#line 462 "src/xkbcomp/parser.y"
+#line 434 "src/xkbcomp/parser.y"
                         { (yyval.var) = BoolVarCreate((yyvsp[-1].atom), true); }
-#line 2568 "src/xkbcomp/parser.c"
+#line 2538 "src/xkbcomp/parser.c"
     break;
 
   case 52: /* VarDecl: "!" Ident ";"  */
-#line 464 "src/xkbcomp/parser.y"
+#line 436 "src/xkbcomp/parser.y"
                         { (yyval.var) = BoolVarCreate((yyvsp[-1].atom), false); }
-#line 2574 "src/xkbcomp/parser.c"
+#line 2544 "src/xkbcomp/parser.c"
     break;
 
   case 53: /* KeyNameDecl: "key name" "=" KeyCode ";"  */
-#line 468 "src/xkbcomp/parser.y"
+#line 440 "src/xkbcomp/parser.y"
                         { (yyval.keyCode) = KeycodeCreate((yyvsp[-3].atom), (yyvsp[-1].num)); }
-#line 2580 "src/xkbcomp/parser.c"
+#line 2550 "src/xkbcomp/parser.c"
     break;
 
   case 54: /* KeyAliasDecl: "alias" "key name" "=" "key name" ";"  */
-#line 472 "src/xkbcomp/parser.y"
+#line 444 "src/xkbcomp/parser.y"
                         { (yyval.keyAlias) = KeyAliasCreate((yyvsp[-3].atom), (yyvsp[-1].atom)); }
-#line 2586 "src/xkbcomp/parser.c"
+#line 2556 "src/xkbcomp/parser.c"
     break;
 
   case 55: /* VModDecl: "virtual_modifiers" VModDefList ";"  */
-#line 476 "src/xkbcomp/parser.y"
+#line 448 "src/xkbcomp/parser.y"
                         { (yyval.vmodList) = (yyvsp[-1].vmodList); }
-#line 2592 "src/xkbcomp/parser.c"
+#line 2562 "src/xkbcomp/parser.c"
     break;
 
   case 56: /* VModDefList: VModDefList "," VModDef  */
-#line 480 "src/xkbcomp/parser.y"
+#line 452 "src/xkbcomp/parser.y"
                         { (yyval.vmodList).head = (yyvsp[-2].vmodList).head; (yyval.vmodList).last->common.next = &(yyvsp[0].vmod)->common; (yyval.vmodList).last = (yyvsp[0].vmod); }
-#line 2598 "src/xkbcomp/parser.c"
+#line 2568 "src/xkbcomp/parser.c"
     break;
 
   case 57: /* VModDefList: VModDef  */
-#line 482 "src/xkbcomp/parser.y"
+#line 454 "src/xkbcomp/parser.y"
                         { (yyval.vmodList).head = (yyval.vmodList).last = (yyvsp[0].vmod); }
-#line 2604 "src/xkbcomp/parser.c"
+#line 2574 "src/xkbcomp/parser.c"
     break;
 
   case 58: /* VModDef: Ident  */
-#line 486 "src/xkbcomp/parser.y"
+#line 458 "src/xkbcomp/parser.y"
                         { (yyval.vmod) = VModCreate((yyvsp[0].atom), NULL); }
-#line 2610 "src/xkbcomp/parser.c"
+#line 2580 "src/xkbcomp/parser.c"
     break;
 
   case 59: /* VModDef: Ident "=" Expr  */
-#line 488 "src/xkbcomp/parser.y"
+#line 460 "src/xkbcomp/parser.y"
                         { (yyval.vmod) = VModCreate((yyvsp[-2].atom), (yyvsp[0].expr)); }
-#line 2616 "src/xkbcomp/parser.c"
+#line 2586 "src/xkbcomp/parser.c"
     break;
 
   case 60: /* InterpretDecl: "interpret" InterpretMatch "{" VarDeclList "}" ";"  */
-#line 494 "src/xkbcomp/parser.y"
+#line 466 "src/xkbcomp/parser.y"
                         { (yyvsp[-4].interp)->def = (yyvsp[-2].varList).head; (yyval.interp) = (yyvsp[-4].interp); }
-#line 2622 "src/xkbcomp/parser.c"
+#line 2592 "src/xkbcomp/parser.c"
     break;
 
   case 61: /* InterpretMatch: KeySym "+" Expr  */
-#line 498 "src/xkbcomp/parser.y"
+#line 470 "src/xkbcomp/parser.y"
                         { (yyval.interp) = InterpCreate((yyvsp[-2].keysym), (yyvsp[0].expr)); }
-#line 2628 "src/xkbcomp/parser.c"
+#line 2598 "src/xkbcomp/parser.c"
     break;
 
   case 62: /* InterpretMatch: KeySym  */
-#line 500 "src/xkbcomp/parser.y"
+#line 472 "src/xkbcomp/parser.y"
                         { (yyval.interp) = InterpCreate((yyvsp[0].keysym), NULL); }
-#line 2634 "src/xkbcomp/parser.c"
+#line 2604 "src/xkbcomp/parser.c"
     break;
 
   case 63: /* VarDeclList: VarDeclList VarDecl  */
-#line 504 "src/xkbcomp/parser.y"
+#line 476 "src/xkbcomp/parser.y"
                         {
                             if ((yyvsp[0].var)) {
                                 if ((yyvsp[-1].varList).head) {
@@ -2653,89 +2623,89 @@ yyreduce:
                                 }
                             }
                         }
-#line 2650 "src/xkbcomp/parser.c"
+#line 2620 "src/xkbcomp/parser.c"
     break;
 
   case 64: /* VarDeclList: %empty  */
-#line 515 "src/xkbcomp/parser.y"
+#line 487 "src/xkbcomp/parser.y"
                         { (yyval.varList).head = (yyval.varList).last = NULL; }
-#line 2656 "src/xkbcomp/parser.c"
+#line 2626 "src/xkbcomp/parser.c"
     break;
 
   case 65: /* KeyTypeDecl: "type" String "{" VarDeclList "}" ";"  */
-#line 521 "src/xkbcomp/parser.y"
+#line 493 "src/xkbcomp/parser.y"
                         { (yyval.keyType) = KeyTypeCreate((yyvsp[-4].atom), (yyvsp[-2].varList).head); }
-#line 2662 "src/xkbcomp/parser.c"
+#line 2632 "src/xkbcomp/parser.c"
     break;
 
   case 66: /* SymbolsDecl: "key" "key name" "{" OptSymbolsBody "}" ";"  */
-#line 527 "src/xkbcomp/parser.y"
+#line 499 "src/xkbcomp/parser.y"
                         { (yyval.syms) = SymbolsCreate((yyvsp[-4].atom), (yyvsp[-2].varList).head); }
-#line 2668 "src/xkbcomp/parser.c"
+#line 2638 "src/xkbcomp/parser.c"
     break;
 
   case 67: /* OptSymbolsBody: SymbolsBody  */
-#line 530 "src/xkbcomp/parser.y"
+#line 502 "src/xkbcomp/parser.y"
                                     { (yyval.varList) = (yyvsp[0].varList); }
-#line 2674 "src/xkbcomp/parser.c"
+#line 2644 "src/xkbcomp/parser.c"
     break;
 
   case 68: /* OptSymbolsBody: %empty  */
-#line 531 "src/xkbcomp/parser.y"
+#line 503 "src/xkbcomp/parser.y"
                                     { (yyval.varList).head = (yyval.varList).last = NULL; }
-#line 2680 "src/xkbcomp/parser.c"
+#line 2650 "src/xkbcomp/parser.c"
     break;
 
   case 69: /* SymbolsBody: SymbolsBody "," SymbolsVarDecl  */
-#line 535 "src/xkbcomp/parser.y"
+#line 507 "src/xkbcomp/parser.y"
                         { (yyval.varList).head = (yyvsp[-2].varList).head; (yyval.varList).last->common.next = &(yyvsp[0].var)->common; (yyval.varList).last = (yyvsp[0].var); }
-#line 2686 "src/xkbcomp/parser.c"
+#line 2656 "src/xkbcomp/parser.c"
     break;
 
   case 70: /* SymbolsBody: SymbolsVarDecl  */
-#line 537 "src/xkbcomp/parser.y"
+#line 509 "src/xkbcomp/parser.y"
                         { (yyval.varList).head = (yyval.varList).last = (yyvsp[0].var); }
-#line 2692 "src/xkbcomp/parser.c"
+#line 2662 "src/xkbcomp/parser.c"
     break;
 
   case 71: /* SymbolsVarDecl: Lhs "=" Expr  */
-#line 540 "src/xkbcomp/parser.y"
+#line 512 "src/xkbcomp/parser.y"
                                                 { (yyval.var) = VarCreate((yyvsp[-2].expr), (yyvsp[0].expr)); }
-#line 2698 "src/xkbcomp/parser.c"
+#line 2668 "src/xkbcomp/parser.c"
     break;
 
   case 72: /* SymbolsVarDecl: Lhs "=" MultiKeySymOrActionList  */
-#line 541 "src/xkbcomp/parser.y"
+#line 513 "src/xkbcomp/parser.y"
                                                            { (yyval.var) = VarCreate((yyvsp[-2].expr), (yyvsp[0].expr)); }
-#line 2704 "src/xkbcomp/parser.c"
+#line 2674 "src/xkbcomp/parser.c"
     break;
 
   case 73: /* SymbolsVarDecl: Ident  */
-#line 542 "src/xkbcomp/parser.y"
+#line 514 "src/xkbcomp/parser.y"
                                                 { (yyval.var) = BoolVarCreate((yyvsp[0].atom), true); }
-#line 2710 "src/xkbcomp/parser.c"
+#line 2680 "src/xkbcomp/parser.c"
     break;
 
   case 74: /* SymbolsVarDecl: "!" Ident  */
-#line 543 "src/xkbcomp/parser.y"
+#line 515 "src/xkbcomp/parser.y"
                                                 { (yyval.var) = BoolVarCreate((yyvsp[0].atom), false); }
-#line 2716 "src/xkbcomp/parser.c"
+#line 2686 "src/xkbcomp/parser.c"
     break;
 
   case 75: /* SymbolsVarDecl: MultiKeySymOrActionList  */
-#line 544 "src/xkbcomp/parser.y"
+#line 516 "src/xkbcomp/parser.y"
                                                 { (yyval.var) = VarCreate(NULL, (yyvsp[0].expr)); }
-#line 2722 "src/xkbcomp/parser.c"
+#line 2692 "src/xkbcomp/parser.c"
     break;
 
   case 76: /* MultiKeySymOrActionList: "[" MultiKeySymList "]"  */
-#line 560 "src/xkbcomp/parser.y"
+#line 532 "src/xkbcomp/parser.y"
                         { (yyval.expr) = (yyvsp[-1].exprList).head; }
-#line 2728 "src/xkbcomp/parser.c"
+#line 2698 "src/xkbcomp/parser.c"
     break;
 
   case 77: /* MultiKeySymOrActionList: "[" NoSymbolOrActionList "," MultiKeySymList "]"  */
-#line 562 "src/xkbcomp/parser.y"
+#line 534 "src/xkbcomp/parser.y"
                         {
                             /* Prepend n times NoSymbol */
                             struct {ExprDef *head; ExprDef *last;} list = {
@@ -2753,17 +2723,17 @@ yyreduce:
                             }
                             (yyval.expr) = list.head;
                         }
-#line 2750 "src/xkbcomp/parser.c"
+#line 2720 "src/xkbcomp/parser.c"
     break;
 
   case 78: /* MultiKeySymOrActionList: "[" MultiActionList "]"  */
-#line 580 "src/xkbcomp/parser.y"
+#line 552 "src/xkbcomp/parser.y"
                         { (yyval.expr) = (yyvsp[-1].exprList).head; }
-#line 2756 "src/xkbcomp/parser.c"
+#line 2726 "src/xkbcomp/parser.c"
     break;
 
   case 79: /* MultiKeySymOrActionList: "[" NoSymbolOrActionList "," MultiActionList "]"  */
-#line 582 "src/xkbcomp/parser.y"
+#line 554 "src/xkbcomp/parser.y"
                         {
                             /* Prepend n times NoAction() */
                             struct {ExprDef *head; ExprDef *last;} list = {
@@ -2780,41 +2750,41 @@ yyreduce:
                             }
                             (yyval.expr) = list.head;
                         }
-#line 2777 "src/xkbcomp/parser.c"
+#line 2747 "src/xkbcomp/parser.c"
     break;
 
   case 80: /* MultiKeySymOrActionList: "[" NoSymbolOrActionList "]"  */
-#line 604 "src/xkbcomp/parser.y"
+#line 576 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprEmptyList(); }
-#line 2783 "src/xkbcomp/parser.c"
+#line 2753 "src/xkbcomp/parser.c"
     break;
 
   case 81: /* NoSymbolOrActionList: NoSymbolOrActionList "," "{" "}"  */
-#line 610 "src/xkbcomp/parser.y"
+#line 582 "src/xkbcomp/parser.y"
                         { (yyval.noSymbolOrActionList) = (yyvsp[-3].noSymbolOrActionList) + 1; }
-#line 2789 "src/xkbcomp/parser.c"
+#line 2759 "src/xkbcomp/parser.c"
     break;
 
   case 82: /* NoSymbolOrActionList: "{" "}"  */
-#line 612 "src/xkbcomp/parser.y"
+#line 584 "src/xkbcomp/parser.y"
                         { (yyval.noSymbolOrActionList) = 1; }
-#line 2795 "src/xkbcomp/parser.c"
+#line 2765 "src/xkbcomp/parser.c"
     break;
 
   case 83: /* NoSymbolOrActionList: %empty  */
-#line 613 "src/xkbcomp/parser.y"
+#line 585 "src/xkbcomp/parser.y"
                         { (yyval.noSymbolOrActionList) = 0; }
-#line 2801 "src/xkbcomp/parser.c"
+#line 2771 "src/xkbcomp/parser.c"
     break;
 
   case 84: /* GroupCompatDecl: "group" Integer "=" Expr ";"  */
-#line 617 "src/xkbcomp/parser.y"
+#line 589 "src/xkbcomp/parser.y"
                         { (yyval.groupCompat) = GroupCompatCreate((yyvsp[-3].num), (yyvsp[-1].expr)); }
-#line 2807 "src/xkbcomp/parser.c"
+#line 2777 "src/xkbcomp/parser.c"
     break;
 
   case 85: /* ModMapDecl: "modifier_map" Expr "{" KeyOrKeySymList "}" ";"  */
-#line 621 "src/xkbcomp/parser.y"
+#line 593 "src/xkbcomp/parser.y"
                         {
                             if (param->config.format == XKB_KEYMAP_FORMAT_TEXT_V1 &&
                                 (yyvsp[-4].expr)->common.type != STMT_EXPR_IDENT) {
@@ -2829,397 +2799,397 @@ yyreduce:
                             }
                             (yyval.modMask) = ModMapCreate((yyvsp[-4].expr), (yyvsp[-2].exprList).head);
                         }
-#line 2826 "src/xkbcomp/parser.c"
+#line 2796 "src/xkbcomp/parser.c"
     break;
 
   case 86: /* KeyOrKeySymList: KeyOrKeySymList "," KeyOrKeySym  */
-#line 638 "src/xkbcomp/parser.y"
+#line 610 "src/xkbcomp/parser.y"
                         { (yyval.exprList).head = (yyvsp[-2].exprList).head; (yyval.exprList).last->common.next = &(yyvsp[0].expr)->common; (yyval.exprList).last = (yyvsp[0].expr); }
-#line 2832 "src/xkbcomp/parser.c"
+#line 2802 "src/xkbcomp/parser.c"
     break;
 
   case 87: /* KeyOrKeySymList: KeyOrKeySym  */
-#line 640 "src/xkbcomp/parser.y"
+#line 612 "src/xkbcomp/parser.y"
                         { (yyval.exprList).head = (yyval.exprList).last = (yyvsp[0].expr); }
-#line 2838 "src/xkbcomp/parser.c"
+#line 2808 "src/xkbcomp/parser.c"
     break;
 
   case 88: /* KeyOrKeySym: "key name"  */
-#line 644 "src/xkbcomp/parser.y"
+#line 616 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateKeyName((yyvsp[0].atom)); }
-#line 2844 "src/xkbcomp/parser.c"
+#line 2814 "src/xkbcomp/parser.c"
     break;
 
   case 89: /* KeyOrKeySym: KeySym  */
-#line 646 "src/xkbcomp/parser.y"
+#line 618 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateKeySym((yyvsp[0].keysym)); }
-#line 2850 "src/xkbcomp/parser.c"
+#line 2820 "src/xkbcomp/parser.c"
     break;
 
   case 90: /* LedMapDecl: "indicator" String "{" VarDeclList "}" ";"  */
-#line 650 "src/xkbcomp/parser.y"
+#line 622 "src/xkbcomp/parser.y"
                         { (yyval.ledMap) = LedMapCreate((yyvsp[-4].atom), (yyvsp[-2].varList).head); }
-#line 2856 "src/xkbcomp/parser.c"
+#line 2826 "src/xkbcomp/parser.c"
     break;
 
   case 91: /* LedNameDecl: "indicator" Integer "=" Expr ";"  */
-#line 654 "src/xkbcomp/parser.y"
+#line 626 "src/xkbcomp/parser.y"
                         { (yyval.ledName) = LedNameCreate((yyvsp[-3].num), (yyvsp[-1].expr), false); }
-#line 2862 "src/xkbcomp/parser.c"
+#line 2832 "src/xkbcomp/parser.c"
     break;
 
   case 92: /* LedNameDecl: "virtual" "indicator" Integer "=" Expr ";"  */
-#line 656 "src/xkbcomp/parser.y"
+#line 628 "src/xkbcomp/parser.y"
                         { (yyval.ledName) = LedNameCreate((yyvsp[-3].num), (yyvsp[-1].expr), true); }
-#line 2868 "src/xkbcomp/parser.c"
+#line 2838 "src/xkbcomp/parser.c"
     break;
 
   case 93: /* UnknownDecl: "identifier" Terminal "=" Expr ";"  */
-#line 660 "src/xkbcomp/parser.y"
+#line 632 "src/xkbcomp/parser.y"
                         {
                             FreeStmt((ParseCommon *) (yyvsp[-3].expr));
                             FreeStmt((ParseCommon *) (yyvsp[-1].expr));
                             (yyval.unknown) = UnknownStatementCreate(STMT_UNKNOWN_DECLARATION, (yyvsp[-4].sval));
                         }
-#line 2878 "src/xkbcomp/parser.c"
+#line 2848 "src/xkbcomp/parser.c"
     break;
 
   case 94: /* UnknownCompoundStatementDecl: "identifier" OptTerminal "{" VarDeclList "}" ";"  */
-#line 669 "src/xkbcomp/parser.y"
+#line 641 "src/xkbcomp/parser.y"
                         {
                             FreeStmt((ParseCommon *) (yyvsp[-4].expr));
                             FreeStmt((ParseCommon *) (yyvsp[-2].varList).head);
                             (yyval.unknown) = UnknownStatementCreate(STMT_UNKNOWN_COMPOUND, (yyvsp[-5].sval));
                         }
-#line 2888 "src/xkbcomp/parser.c"
+#line 2858 "src/xkbcomp/parser.c"
     break;
 
   case 95: /* ShapeDecl: "shape" String "{" OutlineList "}" ";"  */
-#line 677 "src/xkbcomp/parser.y"
+#line 649 "src/xkbcomp/parser.y"
                         { (yyval.geom) = NULL; }
-#line 2894 "src/xkbcomp/parser.c"
+#line 2864 "src/xkbcomp/parser.c"
     break;
 
   case 96: /* ShapeDecl: "shape" String "{" CoordList "}" ";"  */
-#line 679 "src/xkbcomp/parser.y"
+#line 651 "src/xkbcomp/parser.y"
                         { (void) (yyvsp[-2].expr); (yyval.geom) = NULL; }
-#line 2900 "src/xkbcomp/parser.c"
+#line 2870 "src/xkbcomp/parser.c"
     break;
 
   case 97: /* SectionDecl: "section" String "{" SectionBody "}" ";"  */
-#line 683 "src/xkbcomp/parser.y"
+#line 655 "src/xkbcomp/parser.y"
                         { (yyval.geom) = NULL; }
-#line 2906 "src/xkbcomp/parser.c"
+#line 2876 "src/xkbcomp/parser.c"
     break;
 
   case 98: /* SectionBody: SectionBody SectionBodyItem  */
-#line 686 "src/xkbcomp/parser.y"
+#line 658 "src/xkbcomp/parser.y"
                                                         { (yyval.geom) = NULL;}
-#line 2912 "src/xkbcomp/parser.c"
+#line 2882 "src/xkbcomp/parser.c"
     break;
 
   case 99: /* SectionBody: SectionBodyItem  */
-#line 687 "src/xkbcomp/parser.y"
+#line 659 "src/xkbcomp/parser.y"
                                                         { (yyval.geom) = NULL; }
-#line 2918 "src/xkbcomp/parser.c"
+#line 2888 "src/xkbcomp/parser.c"
     break;
 
   case 100: /* SectionBodyItem: "row" "{" RowBody "}" ";"  */
-#line 691 "src/xkbcomp/parser.y"
+#line 663 "src/xkbcomp/parser.y"
                         { (yyval.geom) = NULL; }
-#line 2924 "src/xkbcomp/parser.c"
+#line 2894 "src/xkbcomp/parser.c"
     break;
 
   case 101: /* SectionBodyItem: VarDecl  */
-#line 693 "src/xkbcomp/parser.y"
+#line 665 "src/xkbcomp/parser.y"
                         { FreeStmt((ParseCommon *) (yyvsp[0].var)); (yyval.geom) = NULL; }
-#line 2930 "src/xkbcomp/parser.c"
+#line 2900 "src/xkbcomp/parser.c"
     break;
 
   case 102: /* SectionBodyItem: DoodadDecl  */
-#line 695 "src/xkbcomp/parser.y"
+#line 667 "src/xkbcomp/parser.y"
                         { (yyval.geom) = NULL; }
-#line 2936 "src/xkbcomp/parser.c"
+#line 2906 "src/xkbcomp/parser.c"
     break;
 
   case 103: /* SectionBodyItem: LedMapDecl  */
-#line 697 "src/xkbcomp/parser.y"
+#line 669 "src/xkbcomp/parser.y"
                         { FreeStmt((ParseCommon *) (yyvsp[0].ledMap)); (yyval.geom) = NULL; }
-#line 2942 "src/xkbcomp/parser.c"
+#line 2912 "src/xkbcomp/parser.c"
     break;
 
   case 104: /* SectionBodyItem: OverlayDecl  */
-#line 699 "src/xkbcomp/parser.y"
+#line 671 "src/xkbcomp/parser.y"
                         { (yyval.geom) = NULL; }
-#line 2948 "src/xkbcomp/parser.c"
+#line 2918 "src/xkbcomp/parser.c"
     break;
 
   case 105: /* RowBody: RowBody RowBodyItem  */
-#line 702 "src/xkbcomp/parser.y"
+#line 674 "src/xkbcomp/parser.y"
                                                 { (yyval.geom) = NULL;}
-#line 2954 "src/xkbcomp/parser.c"
+#line 2924 "src/xkbcomp/parser.c"
     break;
 
   case 106: /* RowBody: RowBodyItem  */
-#line 703 "src/xkbcomp/parser.y"
+#line 675 "src/xkbcomp/parser.y"
                                                 { (yyval.geom) = NULL; }
-#line 2960 "src/xkbcomp/parser.c"
+#line 2930 "src/xkbcomp/parser.c"
     break;
 
   case 107: /* RowBodyItem: "keys" "{" Keys "}" ";"  */
-#line 706 "src/xkbcomp/parser.y"
+#line 678 "src/xkbcomp/parser.y"
                                                      { (yyval.geom) = NULL; }
-#line 2966 "src/xkbcomp/parser.c"
+#line 2936 "src/xkbcomp/parser.c"
     break;
 
   case 108: /* RowBodyItem: VarDecl  */
-#line 708 "src/xkbcomp/parser.y"
+#line 680 "src/xkbcomp/parser.y"
                         { FreeStmt((ParseCommon *) (yyvsp[0].var)); (yyval.geom) = NULL; }
-#line 2972 "src/xkbcomp/parser.c"
+#line 2942 "src/xkbcomp/parser.c"
     break;
 
   case 109: /* Keys: Keys "," Key  */
-#line 711 "src/xkbcomp/parser.y"
+#line 683 "src/xkbcomp/parser.y"
                                                 { (yyval.geom) = NULL; }
-#line 2978 "src/xkbcomp/parser.c"
+#line 2948 "src/xkbcomp/parser.c"
     break;
 
   case 110: /* Keys: Key  */
-#line 712 "src/xkbcomp/parser.y"
+#line 684 "src/xkbcomp/parser.y"
                                                 { (yyval.geom) = NULL; }
-#line 2984 "src/xkbcomp/parser.c"
+#line 2954 "src/xkbcomp/parser.c"
     break;
 
   case 111: /* Key: "key name"  */
-#line 716 "src/xkbcomp/parser.y"
+#line 688 "src/xkbcomp/parser.y"
                         { (yyval.geom) = NULL; }
-#line 2990 "src/xkbcomp/parser.c"
+#line 2960 "src/xkbcomp/parser.c"
     break;
 
   case 112: /* Key: "{" ExprList "}"  */
-#line 718 "src/xkbcomp/parser.y"
+#line 690 "src/xkbcomp/parser.y"
                         { FreeStmt((ParseCommon *) (yyvsp[-1].exprList).head); (yyval.geom) = NULL; }
-#line 2996 "src/xkbcomp/parser.c"
+#line 2966 "src/xkbcomp/parser.c"
     break;
 
   case 113: /* OverlayDecl: "overlay" String "{" OverlayKeyList "}" ";"  */
-#line 722 "src/xkbcomp/parser.y"
+#line 694 "src/xkbcomp/parser.y"
                         { (yyval.geom) = NULL; }
-#line 3002 "src/xkbcomp/parser.c"
+#line 2972 "src/xkbcomp/parser.c"
     break;
 
   case 114: /* OverlayKeyList: OverlayKeyList "," OverlayKey  */
-#line 725 "src/xkbcomp/parser.y"
+#line 697 "src/xkbcomp/parser.y"
                                                         { (yyval.geom) = NULL; }
-#line 3008 "src/xkbcomp/parser.c"
+#line 2978 "src/xkbcomp/parser.c"
     break;
 
   case 115: /* OverlayKeyList: OverlayKey  */
-#line 726 "src/xkbcomp/parser.y"
+#line 698 "src/xkbcomp/parser.y"
                                                         { (yyval.geom) = NULL; }
-#line 3014 "src/xkbcomp/parser.c"
+#line 2984 "src/xkbcomp/parser.c"
     break;
 
   case 116: /* OverlayKey: "key name" "=" "key name"  */
-#line 729 "src/xkbcomp/parser.y"
+#line 701 "src/xkbcomp/parser.y"
                                                         { (yyval.geom) = NULL; }
-#line 3020 "src/xkbcomp/parser.c"
+#line 2990 "src/xkbcomp/parser.c"
     break;
 
   case 117: /* OutlineList: OutlineList "," OutlineInList  */
-#line 733 "src/xkbcomp/parser.y"
+#line 705 "src/xkbcomp/parser.y"
                         { (yyval.geom) = NULL;}
-#line 3026 "src/xkbcomp/parser.c"
+#line 2996 "src/xkbcomp/parser.c"
     break;
 
   case 118: /* OutlineList: OutlineInList  */
-#line 735 "src/xkbcomp/parser.y"
+#line 707 "src/xkbcomp/parser.y"
                         { (yyval.geom) = NULL; }
-#line 3032 "src/xkbcomp/parser.c"
+#line 3002 "src/xkbcomp/parser.c"
     break;
 
   case 119: /* OutlineInList: "{" CoordList "}"  */
-#line 739 "src/xkbcomp/parser.y"
+#line 711 "src/xkbcomp/parser.y"
                         { (void) (yyvsp[-1].expr); (yyval.geom) = NULL; }
-#line 3038 "src/xkbcomp/parser.c"
+#line 3008 "src/xkbcomp/parser.c"
     break;
 
   case 120: /* OutlineInList: Ident "=" "{" CoordList "}"  */
-#line 741 "src/xkbcomp/parser.y"
+#line 713 "src/xkbcomp/parser.y"
                         { (void) (yyvsp[-1].expr); (yyval.geom) = NULL; }
-#line 3044 "src/xkbcomp/parser.c"
+#line 3014 "src/xkbcomp/parser.c"
     break;
 
   case 121: /* OutlineInList: Ident "=" Expr  */
-#line 743 "src/xkbcomp/parser.y"
+#line 715 "src/xkbcomp/parser.y"
                         { FreeStmt((ParseCommon *) (yyvsp[0].expr)); (yyval.geom) = NULL; }
-#line 3050 "src/xkbcomp/parser.c"
+#line 3020 "src/xkbcomp/parser.c"
     break;
 
   case 122: /* CoordList: CoordList "," Coord  */
-#line 747 "src/xkbcomp/parser.y"
+#line 719 "src/xkbcomp/parser.y"
                         { (void) (yyvsp[-2].expr); (void) (yyvsp[0].expr); (yyval.expr) = NULL; }
-#line 3056 "src/xkbcomp/parser.c"
+#line 3026 "src/xkbcomp/parser.c"
     break;
 
   case 123: /* CoordList: Coord  */
-#line 749 "src/xkbcomp/parser.y"
+#line 721 "src/xkbcomp/parser.y"
                         { (void) (yyvsp[0].expr); (yyval.expr) = NULL; }
-#line 3062 "src/xkbcomp/parser.c"
+#line 3032 "src/xkbcomp/parser.c"
     break;
 
   case 124: /* Coord: "[" SignedNumber "," SignedNumber "]"  */
-#line 753 "src/xkbcomp/parser.y"
+#line 725 "src/xkbcomp/parser.y"
                         { (yyval.expr) = NULL; }
-#line 3068 "src/xkbcomp/parser.c"
+#line 3038 "src/xkbcomp/parser.c"
     break;
 
   case 125: /* DoodadDecl: DoodadType String "{" VarDeclList "}" ";"  */
-#line 757 "src/xkbcomp/parser.y"
+#line 729 "src/xkbcomp/parser.y"
                         { FreeStmt((ParseCommon *) (yyvsp[-2].varList).head); (yyval.geom) = NULL; }
-#line 3074 "src/xkbcomp/parser.c"
+#line 3044 "src/xkbcomp/parser.c"
     break;
 
   case 126: /* DoodadType: "text"  */
-#line 760 "src/xkbcomp/parser.y"
+#line 732 "src/xkbcomp/parser.y"
                                 { (yyval.num) = 0; }
-#line 3080 "src/xkbcomp/parser.c"
+#line 3050 "src/xkbcomp/parser.c"
     break;
 
   case 127: /* DoodadType: "outline"  */
-#line 761 "src/xkbcomp/parser.y"
+#line 733 "src/xkbcomp/parser.y"
                                 { (yyval.num) = 0; }
-#line 3086 "src/xkbcomp/parser.c"
+#line 3056 "src/xkbcomp/parser.c"
     break;
 
   case 128: /* DoodadType: "solid"  */
-#line 762 "src/xkbcomp/parser.y"
+#line 734 "src/xkbcomp/parser.y"
                                 { (yyval.num) = 0; }
-#line 3092 "src/xkbcomp/parser.c"
+#line 3062 "src/xkbcomp/parser.c"
     break;
 
   case 129: /* DoodadType: "logo"  */
-#line 763 "src/xkbcomp/parser.y"
+#line 735 "src/xkbcomp/parser.y"
                                 { (yyval.num) = 0; }
-#line 3098 "src/xkbcomp/parser.c"
+#line 3068 "src/xkbcomp/parser.c"
     break;
 
   case 130: /* FieldSpec: Ident  */
-#line 766 "src/xkbcomp/parser.y"
+#line 738 "src/xkbcomp/parser.y"
                                 { (yyval.atom) = (yyvsp[0].atom); }
-#line 3104 "src/xkbcomp/parser.c"
+#line 3074 "src/xkbcomp/parser.c"
     break;
 
   case 131: /* FieldSpec: Element  */
-#line 767 "src/xkbcomp/parser.y"
+#line 739 "src/xkbcomp/parser.y"
                                 { (yyval.atom) = (yyvsp[0].atom); }
-#line 3110 "src/xkbcomp/parser.c"
+#line 3080 "src/xkbcomp/parser.c"
     break;
 
   case 132: /* Element: "action"  */
-#line 771 "src/xkbcomp/parser.y"
+#line 743 "src/xkbcomp/parser.y"
                         { (yyval.atom) = xkb_atom_intern_literal(param->ctx, "action"); }
-#line 3116 "src/xkbcomp/parser.c"
+#line 3086 "src/xkbcomp/parser.c"
     break;
 
   case 133: /* Element: "interpret"  */
-#line 773 "src/xkbcomp/parser.y"
+#line 745 "src/xkbcomp/parser.y"
                         { (yyval.atom) = xkb_atom_intern_literal(param->ctx, "interpret"); }
-#line 3122 "src/xkbcomp/parser.c"
+#line 3092 "src/xkbcomp/parser.c"
     break;
 
   case 134: /* Element: "type"  */
-#line 775 "src/xkbcomp/parser.y"
+#line 747 "src/xkbcomp/parser.y"
                         { (yyval.atom) = xkb_atom_intern_literal(param->ctx, "type"); }
-#line 3128 "src/xkbcomp/parser.c"
+#line 3098 "src/xkbcomp/parser.c"
     break;
 
   case 135: /* Element: "key"  */
-#line 777 "src/xkbcomp/parser.y"
+#line 749 "src/xkbcomp/parser.y"
                         { (yyval.atom) = xkb_atom_intern_literal(param->ctx, "key"); }
-#line 3134 "src/xkbcomp/parser.c"
+#line 3104 "src/xkbcomp/parser.c"
     break;
 
   case 136: /* Element: "group"  */
-#line 779 "src/xkbcomp/parser.y"
+#line 751 "src/xkbcomp/parser.y"
                         { (yyval.atom) = xkb_atom_intern_literal(param->ctx, "group"); }
-#line 3140 "src/xkbcomp/parser.c"
+#line 3110 "src/xkbcomp/parser.c"
     break;
 
   case 137: /* Element: "modifier_map"  */
-#line 781 "src/xkbcomp/parser.y"
+#line 753 "src/xkbcomp/parser.y"
                         {(yyval.atom) = xkb_atom_intern_literal(param->ctx, "modifier_map");}
-#line 3146 "src/xkbcomp/parser.c"
+#line 3116 "src/xkbcomp/parser.c"
     break;
 
   case 138: /* Element: "indicator"  */
-#line 783 "src/xkbcomp/parser.y"
+#line 755 "src/xkbcomp/parser.y"
                         { (yyval.atom) = xkb_atom_intern_literal(param->ctx, "indicator"); }
-#line 3152 "src/xkbcomp/parser.c"
+#line 3122 "src/xkbcomp/parser.c"
     break;
 
   case 139: /* Element: "shape"  */
-#line 785 "src/xkbcomp/parser.y"
+#line 757 "src/xkbcomp/parser.y"
                         { (yyval.atom) = xkb_atom_intern_literal(param->ctx, "shape"); }
-#line 3158 "src/xkbcomp/parser.c"
+#line 3128 "src/xkbcomp/parser.c"
     break;
 
   case 140: /* Element: "row"  */
-#line 787 "src/xkbcomp/parser.y"
+#line 759 "src/xkbcomp/parser.y"
                         { (yyval.atom) = xkb_atom_intern_literal(param->ctx, "row"); }
-#line 3164 "src/xkbcomp/parser.c"
+#line 3134 "src/xkbcomp/parser.c"
     break;
 
   case 141: /* Element: "section"  */
-#line 789 "src/xkbcomp/parser.y"
+#line 761 "src/xkbcomp/parser.y"
                         { (yyval.atom) = xkb_atom_intern_literal(param->ctx, "section"); }
-#line 3170 "src/xkbcomp/parser.c"
+#line 3140 "src/xkbcomp/parser.c"
     break;
 
   case 142: /* Element: "text"  */
-#line 791 "src/xkbcomp/parser.y"
+#line 763 "src/xkbcomp/parser.y"
                         { (yyval.atom) = xkb_atom_intern_literal(param->ctx, "text"); }
-#line 3176 "src/xkbcomp/parser.c"
+#line 3146 "src/xkbcomp/parser.c"
     break;
 
   case 143: /* OptMergeMode: MergeMode  */
-#line 794 "src/xkbcomp/parser.y"
+#line 766 "src/xkbcomp/parser.y"
                                         { (yyval.merge) = (yyvsp[0].merge); }
-#line 3182 "src/xkbcomp/parser.c"
+#line 3152 "src/xkbcomp/parser.c"
     break;
 
   case 144: /* OptMergeMode: %empty  */
-#line 795 "src/xkbcomp/parser.y"
+#line 767 "src/xkbcomp/parser.y"
                                         { (yyval.merge) = MERGE_DEFAULT; }
-#line 3188 "src/xkbcomp/parser.c"
+#line 3158 "src/xkbcomp/parser.c"
     break;
 
   case 145: /* MergeMode: "include"  */
-#line 798 "src/xkbcomp/parser.y"
+#line 770 "src/xkbcomp/parser.y"
                                         { (yyval.merge) = MERGE_DEFAULT; }
-#line 3194 "src/xkbcomp/parser.c"
+#line 3164 "src/xkbcomp/parser.c"
     break;
 
   case 146: /* MergeMode: "augment"  */
-#line 799 "src/xkbcomp/parser.y"
+#line 771 "src/xkbcomp/parser.y"
                                         { (yyval.merge) = MERGE_AUGMENT; }
-#line 3200 "src/xkbcomp/parser.c"
+#line 3170 "src/xkbcomp/parser.c"
     break;
 
   case 147: /* MergeMode: "override"  */
-#line 800 "src/xkbcomp/parser.y"
+#line 772 "src/xkbcomp/parser.y"
                                         { (yyval.merge) = MERGE_OVERRIDE; }
-#line 3206 "src/xkbcomp/parser.c"
+#line 3176 "src/xkbcomp/parser.c"
     break;
 
   case 148: /* MergeMode: "replace"  */
-#line 801 "src/xkbcomp/parser.y"
+#line 773 "src/xkbcomp/parser.y"
                                         { (yyval.merge) = MERGE_REPLACE; }
-#line 3212 "src/xkbcomp/parser.c"
+#line 3182 "src/xkbcomp/parser.c"
     break;
 
   case 149: /* MergeMode: "alternate"  */
-#line 803 "src/xkbcomp/parser.y"
+#line 775 "src/xkbcomp/parser.y"
                 {
                     /*
                      * This used to be MERGE_ALT_FORM. This functionality was
@@ -3229,11 +3199,11 @@ yyreduce:
                                 "ignored unsupported legacy merge mode \"alternate\"");
                     (yyval.merge) = MERGE_DEFAULT;
                 }
-#line 3226 "src/xkbcomp/parser.c"
+#line 3196 "src/xkbcomp/parser.c"
     break;
 
   case 150: /* ExprList: ExprList "," Expr  */
-#line 815 "src/xkbcomp/parser.y"
+#line 787 "src/xkbcomp/parser.y"
                         {
                             if ((yyvsp[0].expr)) {
                                 if ((yyvsp[-2].exprList).head) {
@@ -3245,377 +3215,367 @@ yyreduce:
                                 }
                             }
                         }
-#line 3242 "src/xkbcomp/parser.c"
+#line 3212 "src/xkbcomp/parser.c"
     break;
 
   case 151: /* ExprList: Expr  */
-#line 827 "src/xkbcomp/parser.y"
+#line 799 "src/xkbcomp/parser.y"
                         { (yyval.exprList).head = (yyval.exprList).last = (yyvsp[0].expr); }
-#line 3248 "src/xkbcomp/parser.c"
+#line 3218 "src/xkbcomp/parser.c"
     break;
 
   case 152: /* ExprList: %empty  */
-#line 828 "src/xkbcomp/parser.y"
+#line 800 "src/xkbcomp/parser.y"
                         { (yyval.exprList).head = (yyval.exprList).last = NULL; }
-#line 3254 "src/xkbcomp/parser.c"
+#line 3224 "src/xkbcomp/parser.c"
     break;
 
   case 153: /* Expr: Expr "/" Expr  */
-#line 832 "src/xkbcomp/parser.y"
+#line 804 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateBinary(STMT_EXPR_DIVIDE, (yyvsp[-2].expr), (yyvsp[0].expr)); }
-#line 3260 "src/xkbcomp/parser.c"
+#line 3230 "src/xkbcomp/parser.c"
     break;
 
   case 154: /* Expr: Expr "+" Expr  */
-#line 834 "src/xkbcomp/parser.y"
+#line 806 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateBinary(STMT_EXPR_ADD, (yyvsp[-2].expr), (yyvsp[0].expr)); }
-#line 3266 "src/xkbcomp/parser.c"
+#line 3236 "src/xkbcomp/parser.c"
     break;
 
   case 155: /* Expr: Expr "-" Expr  */
-#line 836 "src/xkbcomp/parser.y"
+#line 808 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateBinary(STMT_EXPR_SUBTRACT, (yyvsp[-2].expr), (yyvsp[0].expr)); }
-#line 3272 "src/xkbcomp/parser.c"
+#line 3242 "src/xkbcomp/parser.c"
     break;
 
   case 156: /* Expr: Expr "*" Expr  */
-#line 838 "src/xkbcomp/parser.y"
+#line 810 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateBinary(STMT_EXPR_MULTIPLY, (yyvsp[-2].expr), (yyvsp[0].expr)); }
-#line 3278 "src/xkbcomp/parser.c"
+#line 3248 "src/xkbcomp/parser.c"
     break;
 
   case 157: /* Expr: Lhs "=" Expr  */
-#line 840 "src/xkbcomp/parser.y"
+#line 812 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateBinary(STMT_EXPR_ASSIGN, (yyvsp[-2].expr), (yyvsp[0].expr)); }
-#line 3284 "src/xkbcomp/parser.c"
+#line 3254 "src/xkbcomp/parser.c"
     break;
 
   case 158: /* Expr: Term  */
-#line 842 "src/xkbcomp/parser.y"
+#line 814 "src/xkbcomp/parser.y"
                         { (yyval.expr) = (yyvsp[0].expr); }
-#line 3290 "src/xkbcomp/parser.c"
+#line 3260 "src/xkbcomp/parser.c"
     break;
 
   case 159: /* Term: "-" Term  */
-#line 846 "src/xkbcomp/parser.y"
+#line 818 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateUnary(STMT_EXPR_NEGATE, (yyvsp[0].expr)); }
-#line 3296 "src/xkbcomp/parser.c"
+#line 3266 "src/xkbcomp/parser.c"
     break;
 
   case 160: /* Term: "+" Term  */
-#line 848 "src/xkbcomp/parser.y"
+#line 820 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateUnary(STMT_EXPR_UNARY_PLUS, (yyvsp[0].expr)); }
-#line 3302 "src/xkbcomp/parser.c"
+#line 3272 "src/xkbcomp/parser.c"
     break;
 
   case 161: /* Term: "!" Term  */
-#line 850 "src/xkbcomp/parser.y"
+#line 822 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateUnary(STMT_EXPR_NOT, (yyvsp[0].expr)); }
-#line 3308 "src/xkbcomp/parser.c"
+#line 3278 "src/xkbcomp/parser.c"
     break;
 
   case 162: /* Term: "~" Term  */
-#line 852 "src/xkbcomp/parser.y"
+#line 824 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateUnary(STMT_EXPR_INVERT, (yyvsp[0].expr)); }
-#line 3314 "src/xkbcomp/parser.c"
+#line 3284 "src/xkbcomp/parser.c"
     break;
 
   case 163: /* Term: Lhs  */
-#line 854 "src/xkbcomp/parser.y"
+#line 826 "src/xkbcomp/parser.y"
                         { (yyval.expr) = (yyvsp[0].expr); }
-#line 3320 "src/xkbcomp/parser.c"
+#line 3290 "src/xkbcomp/parser.c"
     break;
 
   case 164: /* Term: FieldSpec "(" ExprList ")"  */
-#line 856 "src/xkbcomp/parser.y"
+#line 828 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateAction((yyvsp[-3].atom), (yyvsp[-1].exprList).head); }
-#line 3326 "src/xkbcomp/parser.c"
+#line 3296 "src/xkbcomp/parser.c"
     break;
 
   case 165: /* Term: Actions  */
-#line 858 "src/xkbcomp/parser.y"
+#line 830 "src/xkbcomp/parser.y"
                         { (yyval.expr) = (yyvsp[0].expr); }
-#line 3332 "src/xkbcomp/parser.c"
+#line 3302 "src/xkbcomp/parser.c"
     break;
 
   case 166: /* Term: Terminal  */
-#line 860 "src/xkbcomp/parser.y"
+#line 832 "src/xkbcomp/parser.y"
                         { (yyval.expr) = (yyvsp[0].expr); }
-#line 3338 "src/xkbcomp/parser.c"
+#line 3308 "src/xkbcomp/parser.c"
     break;
 
   case 167: /* Term: "(" Expr ")"  */
-#line 862 "src/xkbcomp/parser.y"
+#line 834 "src/xkbcomp/parser.y"
                         { (yyval.expr) = (yyvsp[-1].expr); }
-#line 3344 "src/xkbcomp/parser.c"
+#line 3314 "src/xkbcomp/parser.c"
     break;
 
   case 168: /* MultiActionList: MultiActionList "," Action  */
-#line 866 "src/xkbcomp/parser.y"
+#line 838 "src/xkbcomp/parser.y"
                         {
                             ExprDef *expr = ExprCreateActionList((yyvsp[0].expr));
                             (yyval.exprList) = (yyvsp[-2].exprList);
                             (yyval.exprList).last->common.next = &expr->common; (yyval.exprList).last = expr;
                         }
-#line 3354 "src/xkbcomp/parser.c"
+#line 3324 "src/xkbcomp/parser.c"
     break;
 
   case 169: /* MultiActionList: MultiActionList "," Actions  */
-#line 872 "src/xkbcomp/parser.y"
+#line 844 "src/xkbcomp/parser.y"
                         { (yyval.exprList) = (yyvsp[-2].exprList); (yyval.exprList).last->common.next = &(yyvsp[0].expr)->common; (yyval.exprList).last = (yyvsp[0].expr); }
-#line 3360 "src/xkbcomp/parser.c"
+#line 3330 "src/xkbcomp/parser.c"
     break;
 
   case 170: /* MultiActionList: Action  */
-#line 874 "src/xkbcomp/parser.y"
+#line 846 "src/xkbcomp/parser.y"
                         { (yyval.exprList).head = (yyval.exprList).last = ExprCreateActionList((yyvsp[0].expr)); }
-#line 3366 "src/xkbcomp/parser.c"
+#line 3336 "src/xkbcomp/parser.c"
     break;
 
   case 171: /* MultiActionList: NonEmptyActions  */
-#line 876 "src/xkbcomp/parser.y"
+#line 848 "src/xkbcomp/parser.y"
                         { (yyval.exprList).head = (yyval.exprList).last = (yyvsp[0].expr); }
-#line 3372 "src/xkbcomp/parser.c"
+#line 3342 "src/xkbcomp/parser.c"
     break;
 
   case 172: /* ActionList: ActionList "," Action  */
-#line 880 "src/xkbcomp/parser.y"
+#line 852 "src/xkbcomp/parser.y"
                         { (yyval.exprList) = (yyvsp[-2].exprList); (yyval.exprList).last->common.next = &(yyvsp[0].expr)->common; (yyval.exprList).last = (yyvsp[0].expr); }
-#line 3378 "src/xkbcomp/parser.c"
+#line 3348 "src/xkbcomp/parser.c"
     break;
 
   case 173: /* ActionList: Action  */
-#line 882 "src/xkbcomp/parser.y"
+#line 854 "src/xkbcomp/parser.y"
                         { (yyval.exprList).head = (yyval.exprList).last = (yyvsp[0].expr); }
-#line 3384 "src/xkbcomp/parser.c"
+#line 3354 "src/xkbcomp/parser.c"
     break;
 
   case 174: /* NonEmptyActions: "{" ActionList "}"  */
-#line 886 "src/xkbcomp/parser.y"
+#line 858 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateActionList((yyvsp[-1].exprList).head); }
-#line 3390 "src/xkbcomp/parser.c"
+#line 3360 "src/xkbcomp/parser.c"
     break;
 
   case 175: /* Actions: NonEmptyActions  */
-#line 890 "src/xkbcomp/parser.y"
+#line 862 "src/xkbcomp/parser.y"
                         { (yyval.expr) = (yyvsp[0].expr); }
-#line 3396 "src/xkbcomp/parser.c"
+#line 3366 "src/xkbcomp/parser.c"
     break;
 
   case 176: /* Actions: "{" "}"  */
-#line 892 "src/xkbcomp/parser.y"
+#line 864 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateActionList(NULL); }
-#line 3402 "src/xkbcomp/parser.c"
+#line 3372 "src/xkbcomp/parser.c"
     break;
 
   case 177: /* Action: FieldSpec "(" ExprList ")"  */
-#line 896 "src/xkbcomp/parser.y"
+#line 868 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateAction((yyvsp[-3].atom), (yyvsp[-1].exprList).head); }
-#line 3408 "src/xkbcomp/parser.c"
+#line 3378 "src/xkbcomp/parser.c"
     break;
 
   case 178: /* Lhs: FieldSpec  */
-#line 900 "src/xkbcomp/parser.y"
+#line 872 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateIdent((yyvsp[0].atom)); }
-#line 3414 "src/xkbcomp/parser.c"
+#line 3384 "src/xkbcomp/parser.c"
     break;
 
   case 179: /* Lhs: FieldSpec "." FieldSpec  */
-#line 902 "src/xkbcomp/parser.y"
+#line 874 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateFieldRef((yyvsp[-2].atom), (yyvsp[0].atom)); }
-#line 3420 "src/xkbcomp/parser.c"
+#line 3390 "src/xkbcomp/parser.c"
     break;
 
   case 180: /* Lhs: FieldSpec "[" Expr "]"  */
-#line 904 "src/xkbcomp/parser.y"
+#line 876 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateArrayRef(XKB_ATOM_NONE, (yyvsp[-3].atom), (yyvsp[-1].expr)); }
-#line 3426 "src/xkbcomp/parser.c"
+#line 3396 "src/xkbcomp/parser.c"
     break;
 
   case 181: /* Lhs: FieldSpec "." FieldSpec "[" Expr "]"  */
-#line 906 "src/xkbcomp/parser.y"
+#line 878 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateArrayRef((yyvsp[-5].atom), (yyvsp[-3].atom), (yyvsp[-1].expr)); }
-#line 3432 "src/xkbcomp/parser.c"
+#line 3402 "src/xkbcomp/parser.c"
     break;
 
   case 182: /* OptTerminal: Terminal  */
-#line 910 "src/xkbcomp/parser.y"
+#line 882 "src/xkbcomp/parser.y"
                         { (yyval.expr) = (yyvsp[0].expr); }
-#line 3438 "src/xkbcomp/parser.c"
+#line 3408 "src/xkbcomp/parser.c"
     break;
 
   case 183: /* OptTerminal: %empty  */
-#line 911 "src/xkbcomp/parser.y"
+#line 883 "src/xkbcomp/parser.y"
                         { (yyval.expr) = NULL; }
-#line 3444 "src/xkbcomp/parser.c"
+#line 3414 "src/xkbcomp/parser.c"
     break;
 
   case 184: /* Terminal: String  */
-#line 915 "src/xkbcomp/parser.y"
+#line 887 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateString((yyvsp[0].atom)); }
-#line 3450 "src/xkbcomp/parser.c"
+#line 3420 "src/xkbcomp/parser.c"
     break;
 
   case 185: /* Terminal: Integer  */
-#line 917 "src/xkbcomp/parser.y"
+#line 889 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateInteger((yyvsp[0].num)); }
-#line 3456 "src/xkbcomp/parser.c"
+#line 3426 "src/xkbcomp/parser.c"
     break;
 
   case 186: /* Terminal: Float  */
-#line 919 "src/xkbcomp/parser.y"
+#line 891 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateFloat(/* Discard $1 */); }
-#line 3462 "src/xkbcomp/parser.c"
+#line 3432 "src/xkbcomp/parser.c"
     break;
 
   case 187: /* Terminal: "key name"  */
-#line 921 "src/xkbcomp/parser.y"
+#line 893 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateKeyName((yyvsp[0].atom)); }
-#line 3468 "src/xkbcomp/parser.c"
+#line 3438 "src/xkbcomp/parser.c"
     break;
 
   case 188: /* MultiKeySymList: MultiKeySymList "," KeySymLit  */
-#line 925 "src/xkbcomp/parser.y"
+#line 897 "src/xkbcomp/parser.y"
                         {
                             ExprDef *expr = ExprCreateKeySymList((yyvsp[0].keysym));
                             (yyval.exprList) = (yyvsp[-2].exprList);
                             (yyval.exprList).last->common.next = &expr->common; (yyval.exprList).last = expr;
                         }
-#line 3478 "src/xkbcomp/parser.c"
+#line 3448 "src/xkbcomp/parser.c"
     break;
 
   case 189: /* MultiKeySymList: MultiKeySymList "," KeySyms  */
-#line 931 "src/xkbcomp/parser.y"
+#line 903 "src/xkbcomp/parser.y"
                         { (yyval.exprList) = (yyvsp[-2].exprList); (yyval.exprList).last->common.next = &(yyvsp[0].expr)->common; (yyval.exprList).last = (yyvsp[0].expr); }
-#line 3484 "src/xkbcomp/parser.c"
+#line 3454 "src/xkbcomp/parser.c"
     break;
 
   case 190: /* MultiKeySymList: KeySymLit  */
-#line 933 "src/xkbcomp/parser.y"
+#line 905 "src/xkbcomp/parser.y"
                         { (yyval.exprList).head = (yyval.exprList).last = ExprCreateKeySymList((yyvsp[0].keysym)); }
-#line 3490 "src/xkbcomp/parser.c"
+#line 3460 "src/xkbcomp/parser.c"
     break;
 
   case 191: /* MultiKeySymList: NonEmptyKeySyms  */
-#line 935 "src/xkbcomp/parser.y"
+#line 907 "src/xkbcomp/parser.y"
                         { (yyval.exprList).head = (yyval.exprList).last = (yyvsp[0].expr); }
-#line 3496 "src/xkbcomp/parser.c"
+#line 3466 "src/xkbcomp/parser.c"
     break;
 
   case 192: /* KeySymList: KeySymList "," KeySymLit  */
-#line 939 "src/xkbcomp/parser.y"
+#line 911 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprAppendKeySymList((yyvsp[-2].expr), (yyvsp[0].keysym)); }
-#line 3502 "src/xkbcomp/parser.c"
+#line 3472 "src/xkbcomp/parser.c"
     break;
 
   case 193: /* KeySymList: KeySymList "," "string literal"  */
-#line 941 "src/xkbcomp/parser.y"
+#line 913 "src/xkbcomp/parser.y"
                         {
-                            (yyval.expr) = ExprKeySymListAppendString(param->scanner, (yyvsp[-2].expr), (yyvsp[0].str));
-                            free((yyvsp[0].str));
+                            (yyval.expr) = ExprKeySymListAppendString(param->scanner, (yyvsp[-2].expr), (yyvsp[0].lit).sval);
+                            free((yyvsp[0].lit).owned);
                             if (!(yyval.expr))
                                 YYERROR;
                         }
-#line 3513 "src/xkbcomp/parser.c"
+#line 3483 "src/xkbcomp/parser.c"
     break;
 
   case 194: /* KeySymList: KeySymLit  */
-#line 948 "src/xkbcomp/parser.y"
+#line 920 "src/xkbcomp/parser.y"
                         {
                             (yyval.expr) = ExprCreateKeySymList((yyvsp[0].keysym));
                             if (!(yyval.expr))
                                 YYERROR;
                         }
-#line 3523 "src/xkbcomp/parser.c"
+#line 3493 "src/xkbcomp/parser.c"
     break;
 
   case 195: /* KeySymList: "string literal"  */
-#line 954 "src/xkbcomp/parser.y"
+#line 926 "src/xkbcomp/parser.y"
                         {
                             (yyval.expr) = ExprCreateKeySymList(XKB_KEY_NoSymbol);
                             if (!(yyval.expr))
                                 YYERROR;
-                            (yyval.expr) = ExprKeySymListAppendString(param->scanner, (yyval.expr), (yyvsp[0].str));
-                            free((yyvsp[0].str));
+                            (yyval.expr) = ExprKeySymListAppendString(param->scanner, (yyval.expr), (yyvsp[0].lit).sval);
+                            free((yyvsp[0].lit).owned);
                             if (!(yyval.expr))
                                 YYERROR;
                         }
-#line 3537 "src/xkbcomp/parser.c"
+#line 3507 "src/xkbcomp/parser.c"
     break;
 
   case 196: /* NonEmptyKeySyms: "{" KeySymList "}"  */
-#line 966 "src/xkbcomp/parser.y"
+#line 938 "src/xkbcomp/parser.y"
                         { (yyval.expr) = (yyvsp[-1].expr); }
-#line 3543 "src/xkbcomp/parser.c"
+#line 3513 "src/xkbcomp/parser.c"
     break;
 
   case 197: /* NonEmptyKeySyms: "string literal"  */
-#line 968 "src/xkbcomp/parser.y"
+#line 940 "src/xkbcomp/parser.y"
                         {
                             (yyval.expr) = ExprCreateKeySymList(XKB_KEY_NoSymbol);
                             if (!(yyval.expr))
                                 YYERROR;
-                            (yyval.expr) = ExprKeySymListAppendString(param->scanner, (yyval.expr), (yyvsp[0].str));
-                            free((yyvsp[0].str));
+                            (yyval.expr) = ExprKeySymListAppendString(param->scanner, (yyval.expr), (yyvsp[0].lit).sval);
+                            free((yyvsp[0].lit).owned);
                             if (!(yyval.expr))
                                 YYERROR;
                         }
-#line 3557 "src/xkbcomp/parser.c"
+#line 3527 "src/xkbcomp/parser.c"
     break;
 
   case 198: /* KeySyms: NonEmptyKeySyms  */
-#line 980 "src/xkbcomp/parser.y"
+#line 952 "src/xkbcomp/parser.y"
                         { (yyval.expr) = (yyvsp[0].expr); }
-#line 3563 "src/xkbcomp/parser.c"
+#line 3533 "src/xkbcomp/parser.c"
     break;
 
   case 199: /* KeySyms: "{" "}"  */
-#line 982 "src/xkbcomp/parser.y"
+#line 954 "src/xkbcomp/parser.y"
                         { (yyval.expr) = ExprCreateKeySymList(XKB_KEY_NoSymbol); }
-#line 3569 "src/xkbcomp/parser.c"
+#line 3539 "src/xkbcomp/parser.c"
     break;
 
   case 200: /* KeySym: KeySymLit  */
-#line 986 "src/xkbcomp/parser.y"
+#line 958 "src/xkbcomp/parser.y"
                         { (yyval.keysym) = (yyvsp[0].keysym); }
-#line 3575 "src/xkbcomp/parser.c"
+#line 3545 "src/xkbcomp/parser.c"
     break;
 
   case 201: /* KeySym: "string literal"  */
-#line 988 "src/xkbcomp/parser.y"
+#line 960 "src/xkbcomp/parser.y"
                         {
-                            (yyval.keysym) = KeysymParseString(param->scanner, (yyvsp[0].str));
-                            free((yyvsp[0].str));
+                            (yyval.keysym) = KeysymParseString(param->scanner, (yyvsp[0].lit).sval);
+                            free((yyvsp[0].lit).owned);
                             if ((yyval.keysym) == XKB_KEY_NoSymbol)
                                 YYERROR;
                         }
-#line 3586 "src/xkbcomp/parser.c"
+#line 3556 "src/xkbcomp/parser.c"
     break;
 
   case 202: /* KeySymLit: "identifier"  */
-#line 997 "src/xkbcomp/parser.y"
-                        {
-                            if (!resolve_keysym(param, (yyvsp[0].sval), &(yyval.keysym))) {
-                                parser_warn(
-                                    param,
-                                    XKB_WARNING_UNRECOGNIZED_KEYSYM,
-                                    "unrecognized keysym \"%.*s\"",
-                                    (unsigned int) (yyvsp[0].sval).len, (yyvsp[0].sval).start
-                                );
-                                (yyval.keysym) = XKB_KEY_NoSymbol;
-                            }
-                        }
-#line 3602 "src/xkbcomp/parser.c"
+#line 969 "src/xkbcomp/parser.y"
+                        { (yyval.keysym) = KeysymParseIdent(param->scanner, (yyvsp[0].sval)); }
+#line 3562 "src/xkbcomp/parser.c"
     break;
 
   case 203: /* KeySymLit: "section"  */
-#line 1009 "src/xkbcomp/parser.y"
+#line 971 "src/xkbcomp/parser.y"
                                 { (yyval.keysym) = XKB_KEY_section; }
-#line 3608 "src/xkbcomp/parser.c"
+#line 3568 "src/xkbcomp/parser.c"
     break;
 
   case 204: /* KeySymLit: "decimal digit"  */
-#line 1011 "src/xkbcomp/parser.y"
+#line 973 "src/xkbcomp/parser.y"
                         {
                             /*
                              * Special case for digits 0..9:
@@ -3624,169 +3584,121 @@ yyreduce:
                              */
                             (yyval.keysym) = XKB_KEY_0 + (xkb_keysym_t) (yyvsp[0].num);
                         }
-#line 3621 "src/xkbcomp/parser.c"
+#line 3581 "src/xkbcomp/parser.c"
     break;
 
   case 205: /* KeySymLit: "integer literal"  */
-#line 1020 "src/xkbcomp/parser.y"
-                        {
-                            if ((yyvsp[0].num) < XKB_KEYSYM_MIN) {
-                                /* Negative value */
-                                static_assert(XKB_KEYSYM_MIN == 0,
-                                              "Keysyms are positive");
-                                parser_warn(
-                                    param,
-                                    XKB_ERROR_INVALID_NUMERIC_KEYSYM,
-                                    "unrecognized keysym \"-%#06"PRIx64"\""
-                                    " (%"PRId64")",
-                                    -(yyvsp[0].num), (yyvsp[0].num)
-                                );
-                                (yyval.keysym) = XKB_KEY_NoSymbol;
-                            }
-                            /*
-                             * Integers 0..9 are handled with DECIMAL_DIGIT if
-                             * they were formatted as single characters '0'..'9'.
-                             * Otherwise they are handled here as raw keysyms
-                             * values. E.g. `01` and `0x1` are interpreted as
-                             * the keysym 0x0001, while `1` is interpreted as
-                             * XKB_KEY_1.
-                             */
-                            else {
-                                /* Any other numeric value */
-                                if ((yyvsp[0].num) <= XKB_KEYSYM_MAX) {
-                                    /*
-                                     * Valid keysym
-                                     * No normalization is performed and value
-                                     * is used as is.
-                                     */
-                                    (yyval.keysym) = (xkb_keysym_t) (yyvsp[0].num);
-                                    check_deprecated_keysyms(
-                                        parser_warn, param, param->ctx,
-                                        (yyval.keysym), NULL, (yyval.keysym), "%#06"PRIx32, "");
-                                } else {
-                                    /* Invalid keysym */
-                                    parser_warn(
-                                        param, XKB_ERROR_INVALID_NUMERIC_KEYSYM,
-                                        "unrecognized keysym \"%#06"PRIx64"\" "
-                                        "(%"PRId64")", (yyvsp[0].num), (yyvsp[0].num)
-                                    );
-                                    (yyval.keysym) = XKB_KEY_NoSymbol;
-                                }
-                                parser_vrb(
-                                    /*
-                                     * Require an extra high verbosity, because
-                                     * keysyms are formatted as number unless
-                                     * enabling pretty-pretting for the
-                                     * serialization.
-                                     */
-                                    param, XKB_LOG_VERBOSITY_COMPREHENSIVE,
-                                    XKB_WARNING_NUMERIC_KEYSYM,
-                                    "numeric keysym \"%#06"PRIx64"\" (%"PRId64")",
-                                    (yyvsp[0].num), (yyvsp[0].num)
-                                );
-                            }
-                        }
-#line 3683 "src/xkbcomp/parser.c"
+#line 982 "src/xkbcomp/parser.y"
+                        { (yyval.keysym) = KeysymParseInteger(param->scanner, (yyvsp[0].num)); }
+#line 3587 "src/xkbcomp/parser.c"
     break;
 
   case 206: /* SignedNumber: "-" Number  */
-#line 1079 "src/xkbcomp/parser.y"
+#line 985 "src/xkbcomp/parser.y"
                                         { (yyval.num) = -(yyvsp[0].num); }
-#line 3689 "src/xkbcomp/parser.c"
+#line 3593 "src/xkbcomp/parser.c"
     break;
 
   case 207: /* SignedNumber: Number  */
-#line 1080 "src/xkbcomp/parser.y"
+#line 986 "src/xkbcomp/parser.y"
                                         { (yyval.num) = (yyvsp[0].num); }
-#line 3695 "src/xkbcomp/parser.c"
+#line 3599 "src/xkbcomp/parser.c"
     break;
 
   case 208: /* Number: "float literal"  */
-#line 1083 "src/xkbcomp/parser.y"
+#line 989 "src/xkbcomp/parser.y"
                                       { (yyval.num) = (yyvsp[0].num); }
-#line 3701 "src/xkbcomp/parser.c"
+#line 3605 "src/xkbcomp/parser.c"
     break;
 
   case 209: /* Number: "decimal digit"  */
-#line 1084 "src/xkbcomp/parser.y"
+#line 990 "src/xkbcomp/parser.y"
                                       { (yyval.num) = (yyvsp[0].num); }
-#line 3707 "src/xkbcomp/parser.c"
+#line 3611 "src/xkbcomp/parser.c"
     break;
 
   case 210: /* Number: "integer literal"  */
-#line 1085 "src/xkbcomp/parser.y"
+#line 991 "src/xkbcomp/parser.y"
                                       { (yyval.num) = (yyvsp[0].num); }
-#line 3713 "src/xkbcomp/parser.c"
+#line 3617 "src/xkbcomp/parser.c"
     break;
 
   case 211: /* Float: "float literal"  */
-#line 1088 "src/xkbcomp/parser.y"
+#line 994 "src/xkbcomp/parser.y"
                                 { (yyval.num) = 0; }
-#line 3719 "src/xkbcomp/parser.c"
+#line 3623 "src/xkbcomp/parser.c"
     break;
 
   case 212: /* Integer: "integer literal"  */
-#line 1091 "src/xkbcomp/parser.y"
+#line 997 "src/xkbcomp/parser.y"
                                       { (yyval.num) = (yyvsp[0].num); }
-#line 3725 "src/xkbcomp/parser.c"
+#line 3629 "src/xkbcomp/parser.c"
     break;
 
   case 213: /* Integer: "decimal digit"  */
-#line 1092 "src/xkbcomp/parser.y"
+#line 998 "src/xkbcomp/parser.y"
                                       { (yyval.num) = (yyvsp[0].num); }
-#line 3731 "src/xkbcomp/parser.c"
+#line 3635 "src/xkbcomp/parser.c"
     break;
 
   case 214: /* KeyCode: "integer literal"  */
-#line 1095 "src/xkbcomp/parser.y"
+#line 1001 "src/xkbcomp/parser.y"
                                       { (yyval.num) = (yyvsp[0].num); }
-#line 3737 "src/xkbcomp/parser.c"
+#line 3641 "src/xkbcomp/parser.c"
     break;
 
   case 215: /* KeyCode: "decimal digit"  */
-#line 1096 "src/xkbcomp/parser.y"
+#line 1002 "src/xkbcomp/parser.y"
                                       { (yyval.num) = (yyvsp[0].num); }
-#line 3743 "src/xkbcomp/parser.c"
+#line 3647 "src/xkbcomp/parser.c"
     break;
 
   case 216: /* Ident: "identifier"  */
-#line 1099 "src/xkbcomp/parser.y"
+#line 1005 "src/xkbcomp/parser.y"
                                 { (yyval.atom) = xkb_atom_intern(param->ctx, (yyvsp[0].sval).start, (yyvsp[0].sval).len); }
-#line 3749 "src/xkbcomp/parser.c"
+#line 3653 "src/xkbcomp/parser.c"
     break;
 
   case 217: /* Ident: "default"  */
-#line 1100 "src/xkbcomp/parser.y"
+#line 1006 "src/xkbcomp/parser.y"
                                 { (yyval.atom) = xkb_atom_intern_literal(param->ctx, "default"); }
-#line 3755 "src/xkbcomp/parser.c"
+#line 3659 "src/xkbcomp/parser.c"
     break;
 
   case 218: /* String: "string literal"  */
-#line 1103 "src/xkbcomp/parser.y"
-                                { (yyval.atom) = xkb_atom_intern(param->ctx, (yyvsp[0].str), strlen((yyvsp[0].str))); free((yyvsp[0].str)); }
-#line 3761 "src/xkbcomp/parser.c"
+#line 1010 "src/xkbcomp/parser.y"
+                        {
+                            (yyval.atom) = xkb_atom_intern(param->ctx, (yyvsp[0].lit).sval.start, (yyvsp[0].lit).sval.len);
+                            free((yyvsp[0].lit).owned);
+                        }
+#line 3668 "src/xkbcomp/parser.c"
     break;
 
   case 219: /* OptMapName: MapName  */
-#line 1106 "src/xkbcomp/parser.y"
+#line 1016 "src/xkbcomp/parser.y"
                                 { (yyval.str) = (yyvsp[0].str); }
-#line 3767 "src/xkbcomp/parser.c"
+#line 3674 "src/xkbcomp/parser.c"
     break;
 
   case 220: /* OptMapName: %empty  */
-#line 1107 "src/xkbcomp/parser.y"
+#line 1017 "src/xkbcomp/parser.y"
                                 { (yyval.str) = NULL; }
-#line 3773 "src/xkbcomp/parser.c"
+#line 3680 "src/xkbcomp/parser.c"
     break;
 
   case 221: /* MapName: "string literal"  */
-#line 1110 "src/xkbcomp/parser.y"
-                                { (yyval.str) = (yyvsp[0].str); }
-#line 3779 "src/xkbcomp/parser.c"
+#line 1021 "src/xkbcomp/parser.y"
+                        {
+                            (yyval.str) = strndup((yyvsp[0].lit).sval.start, (yyvsp[0].lit).sval.len);
+                            free((yyvsp[0].lit).owned);
+                            if (!(yyval.str))
+                                YYABORT;
+                        }
+#line 3691 "src/xkbcomp/parser.c"
     break;
 
 
-#line 3783 "src/xkbcomp/parser.c"
+#line 3695 "src/xkbcomp/parser.c"
 
       default: break;
     }
@@ -4010,74 +3922,8 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 1113 "src/xkbcomp/parser.y"
-
-
-/* Parse a specific section */
-XkbFile *
-parse(struct xkb_context *ctx, const struct parser_keymap_config *config,
-      struct scanner *scanner, const char *map)
-{
-    int ret;
-    XkbFile *first = NULL;
-    struct parser_param param = {
-        .scanner = scanner,
-        .ctx = ctx,
-        .rtrn = NULL,
-        .config = *config,
-        .more_maps = false,
-    };
-
-    /*
-     * If we got a specific map, we look for it exclusively and return
-     * immediately upon finding it. Otherwise, we need to get the
-     * default map. If we find a map marked as default, we return it
-     * immediately. If there are no maps marked as default, we return
-     * the first map in the file.
-     */
-
-    while ((ret = yyparse(&param)) == 0 && param.more_maps) {
-        if (map) {
-            if (streq_not_null(map, param.rtrn->name))
-                return param.rtrn;
-            else
-                FreeXkbFile(param.rtrn);
-        }
-        else {
-            if (param.rtrn->flags & MAP_IS_DEFAULT) {
-                FreeXkbFile(first);
-                return param.rtrn;
-            }
-            else if (!first) {
-                first = param.rtrn;
-            }
-            else {
-                FreeXkbFile(param.rtrn);
-            }
-        }
-        param.rtrn = NULL;
-    }
-
-    if (ret != 0) {
-        /* Some error happend; clear the Xkbfiles parsed so far */
-        FreeXkbFile(first);
-        FreeXkbFile(param.rtrn);
-        return NULL;
-    }
+#line 1029 "src/xkbcomp/parser.y"
 
-    /*
-     * Warn about implicit default section,
-     * but only if not a keymap: multiple keymaps per file not supported
-     */
-    if (first && first->file_type != FILE_TYPE_KEYMAP)
-        log_vrb(ctx, XKB_LOG_VERBOSITY_DETAILED,
-                XKB_WARNING_MISSING_DEFAULT_SECTION,
-                "No section name in include statement, but \"%s\" contains several; "
-                "Using first defined section, \"%s\"\n",
-                scanner->file_name, safe_map_name(first->name));
-
-    return first;
-}
 
 /* Parse the next section */
 bool
@@ -143,11 +143,12 @@ extern int _xkbcommon_debug;
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 union YYSTYPE
 {
-#line 177 "src/xkbcomp/parser.y"
+#line 143 "src/xkbcomp/parser.y"
 
         int64_t          num;
         enum xkb_file_type file_type;
         char            *str;
+        struct string_literal lit;
         struct sval     sval;
         xkb_atom_t      atom;
         enum merge_mode merge;
@@ -176,7 +177,7 @@ union YYSTYPE
         XkbFile         *file;
         struct { XkbFile *head; XkbFile *last; } fileList;
 
-#line 173 "src/xkbcomp/parser.h"
+#line 174 "src/xkbcomp/parser.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -56,40 +56,6 @@ _xkbcommon_error(struct parser_param *param, const char *msg)
     parser_err(param, XKB_ERROR_INVALID_XKB_SYNTAX, "%s", msg);
 }
 
-static bool
-resolve_keysym(struct parser_param *param, struct sval name, xkb_keysym_t *sym_rtrn)
-{
-    xkb_keysym_t sym;
-
-    if (isvaleq(name, SVAL_LIT("any")) || isvaleq(name, SVAL_LIT("nosymbol"))) {
-        *sym_rtrn = XKB_KEY_NoSymbol;
-        return true;
-    }
-
-    if (isvaleq(name, SVAL_LIT("none")) || isvaleq(name, SVAL_LIT("voidsymbol"))) {
-        *sym_rtrn = XKB_KEY_VoidSymbol;
-        return true;
-    }
-
-    /* xkb_keysym_from_name needs a C string. */
-    char buf[XKB_KEYSYM_NAME_MAX_SIZE];
-    if (name.len >= sizeof(buf)) {
-        return false;
-    }
-    memcpy(buf, name.start, name.len);
-    buf[name.len] = '\0';
-
-    sym = xkb_keysym_from_name(buf, XKB_KEYSYM_NO_FLAGS);
-    if (sym != XKB_KEY_NoSymbol) {
-        *sym_rtrn = sym;
-        check_deprecated_keysyms(parser_warn, param, param->ctx,
-                                 sym, buf, buf, "%s", "");
-        return true;
-    }
-
-    return false;
-}
-
 #define param_scanner param->scanner
 %}
 
@@ -178,6 +144,7 @@ resolve_keysym(struct parser_param *param, struct sval name, xkb_keysym_t *sym_r
         int64_t          num;
         enum xkb_file_type file_type;
         char            *str;
+        struct string_literal lit;
         struct sval     sval;
         xkb_atom_t      atom;
         enum merge_mode merge;
@@ -208,7 +175,7 @@ resolve_keysym(struct parser_param *param, struct sval name, xkb_keysym_t *sym_r
 }
 
 %type <num>     DECIMAL_DIGIT INTEGER FLOAT
-%type <str>     STRING
+%type <lit>     STRING
 %type <sval>    IDENT
 %type <atom>    KEYNAME
 %type <num>     KeyCode Number Integer Float SignedNumber DoodadType
@@ -257,6 +224,7 @@ resolve_keysym(struct parser_param *param, struct sval name, xkb_keysym_t *sym_r
 %destructor { if (!param->rtrn) FreeXkbFile($$); } <file>
 %destructor { FreeXkbFile($$.head); } <fileList>
 %destructor { free($$); } <str>
+%destructor { free($$.owned); } <lit>
 
 %%
 
@@ -451,8 +419,12 @@ Decl            :       OptMergeMode VarDecl
                             { $$ = (ParseCommon *) $2; }
                 |       MergeMode STRING
                         {
-                            $$ = (ParseCommon *) IncludeCreate(param->ctx, $2, $1);
-                            free($2);
+                            char *const str = strndup($2.sval.start, $2.sval.len);
+                            free($2.owned);
+                            if (!str)
+                                YYABORT;
+                            $$ = (ParseCommon *) IncludeCreate(param->ctx, str, $1);
+                            free(str);
                         }
                 ;
 
@@ -939,8 +911,8 @@ KeySymList      :       KeySymList COMMA KeySymLit
                         { $$ = ExprAppendKeySymList($1, $3); }
                 |       KeySymList COMMA STRING
                         {
-                            $$ = ExprKeySymListAppendString(param->scanner, $1, $3);
-                            free($3);
+                            $$ = ExprKeySymListAppendString(param->scanner, $1, $3.sval);
+                            free($3.owned);
                             if (!$$)
                                 YYERROR;
                         }
@@ -955,8 +927,8 @@ KeySymList      :       KeySymList COMMA KeySymLit
                             $$ = ExprCreateKeySymList(XKB_KEY_NoSymbol);
                             if (!$$)
                                 YYERROR;
-                            $$ = ExprKeySymListAppendString(param->scanner, $$, $1);
-                            free($1);
+                            $$ = ExprKeySymListAppendString(param->scanner, $$, $1.sval);
+                            free($1.owned);
                             if (!$$)
                                 YYERROR;
                         }
@@ -969,8 +941,8 @@ NonEmptyKeySyms :       OBRACE KeySymList CBRACE
                             $$ = ExprCreateKeySymList(XKB_KEY_NoSymbol);
                             if (!$$)
                                 YYERROR;
-                            $$ = ExprKeySymListAppendString(param->scanner, $$, $1);
-                            free($1);
+                            $$ = ExprKeySymListAppendString(param->scanner, $$, $1.sval);
+                            free($1.owned);
                             if (!$$)
                                 YYERROR;
                         }
@@ -986,25 +958,15 @@ KeySym          :       KeySymLit
                         { $$ = $1; }
                 |       STRING
                         {
-                            $$ = KeysymParseString(param->scanner, $1);
-                            free($1);
+                            $$ = KeysymParseString(param->scanner, $1.sval);
+                            free($1.owned);
                             if ($$ == XKB_KEY_NoSymbol)
                                 YYERROR;
                         }
                 ;
 
 KeySymLit       :       IDENT
-                        {
-                            if (!resolve_keysym(param, $1, &$$)) {
-                                parser_warn(
-                                    param,
-                                    XKB_WARNING_UNRECOGNIZED_KEYSYM,
-                                    "unrecognized keysym \"%.*s\"",
-                                    (unsigned int) $1.len, $1.start
-                                );
-                                $$ = XKB_KEY_NoSymbol;
-                            }
-                        }
+                        { $$ = KeysymParseIdent(param->scanner, $1); }
                         /* Handle keysym that is also a keyword  */
                 |       SECTION { $$ = XKB_KEY_section; }
                 |       DECIMAL_DIGIT
@@ -1017,63 +979,7 @@ KeySymLit       :       IDENT
                             $$ = XKB_KEY_0 + (xkb_keysym_t) $1;
                         }
                 |       INTEGER
-                        {
-                            if ($1 < XKB_KEYSYM_MIN) {
-                                /* Negative value */
-                                static_assert(XKB_KEYSYM_MIN == 0,
-                                              "Keysyms are positive");
-                                parser_warn(
-                                    param,
-                                    XKB_ERROR_INVALID_NUMERIC_KEYSYM,
-                                    "unrecognized keysym \"-%#06"PRIx64"\""
-                                    " (%"PRId64")",
-                                    -$1, $1
-                                );
-                                $$ = XKB_KEY_NoSymbol;
-                            }
-                            /*
-                             * Integers 0..9 are handled with DECIMAL_DIGIT if
-                             * they were formatted as single characters '0'..'9'.
-                             * Otherwise they are handled here as raw keysyms
-                             * values. E.g. `01` and `0x1` are interpreted as
-                             * the keysym 0x0001, while `1` is interpreted as
-                             * XKB_KEY_1.
-                             */
-                            else {
-                                /* Any other numeric value */
-                                if ($1 <= XKB_KEYSYM_MAX) {
-                                    /*
-                                     * Valid keysym
-                                     * No normalization is performed and value
-                                     * is used as is.
-                                     */
-                                    $$ = (xkb_keysym_t) $1;
-                                    check_deprecated_keysyms(
-                                        parser_warn, param, param->ctx,
-                                        $$, NULL, $$, "%#06"PRIx32, "");
-                                } else {
-                                    /* Invalid keysym */
-                                    parser_warn(
-                                        param, XKB_ERROR_INVALID_NUMERIC_KEYSYM,
-                                        "unrecognized keysym \"%#06"PRIx64"\" "
-                                        "(%"PRId64")", $1, $1
-                                    );
-                                    $$ = XKB_KEY_NoSymbol;
-                                }
-                                parser_vrb(
-                                    /*
-                                     * Require an extra high verbosity, because
-                                     * keysyms are formatted as number unless
-                                     * enabling pretty-pretting for the
-                                     * serialization.
-                                     */
-                                    param, XKB_LOG_VERBOSITY_COMPREHENSIVE,
-                                    XKB_WARNING_NUMERIC_KEYSYM,
-                                    "numeric keysym \"%#06"PRIx64"\" (%"PRId64")",
-                                    $1, $1
-                                );
-                            }
-                        }
+                        { $$ = KeysymParseInteger(param->scanner, $1); }
                 ;
 
 SignedNumber    :       MINUS Number    { $$ = -$2; }
@@ -1100,84 +1006,28 @@ Ident           :       IDENT   { $$ = xkb_atom_intern(param->ctx, $1.start, $1.
                 |       DEFAULT { $$ = xkb_atom_intern_literal(param->ctx, "default"); }
                 ;
 
-String          :       STRING  { $$ = xkb_atom_intern(param->ctx, $1, strlen($1)); free($1); }
+String          :       STRING
+                        {
+                            $$ = xkb_atom_intern(param->ctx, $1.sval.start, $1.sval.len);
+                            free($1.owned);
+                        }
                 ;
 
 OptMapName      :       MapName { $$ = $1; }
                 |               { $$ = NULL; }
                 ;
 
-MapName         :       STRING  { $$ = $1; }
+MapName         :       STRING
+                        {
+                            $$ = strndup($1.sval.start, $1.sval.len);
+                            free($1.owned);
+                            if (!$$)
+                                YYABORT;
+                        }
                 ;
 
 %%
 
-/* Parse a specific section */
-XkbFile *
-parse(struct xkb_context *ctx, const struct parser_keymap_config *config,
-      struct scanner *scanner, const char *map)
-{
-    int ret;
-    XkbFile *first = NULL;
-    struct parser_param param = {
-        .scanner = scanner,
-        .ctx = ctx,
-        .rtrn = NULL,
-        .config = *config,
-        .more_maps = false,
-    };
-
-    /*
-     * If we got a specific map, we look for it exclusively and return
-     * immediately upon finding it. Otherwise, we need to get the
-     * default map. If we find a map marked as default, we return it
-     * immediately. If there are no maps marked as default, we return
-     * the first map in the file.
-     */
-
-    while ((ret = yyparse(&param)) == 0 && param.more_maps) {
-        if (map) {
-            if (streq_not_null(map, param.rtrn->name))
-                return param.rtrn;
-            else
-                FreeXkbFile(param.rtrn);
-        }
-        else {
-            if (param.rtrn->flags & MAP_IS_DEFAULT) {
-                FreeXkbFile(first);
-                return param.rtrn;
-            }
-            else if (!first) {
-                first = param.rtrn;
-            }
-            else {
-                FreeXkbFile(param.rtrn);
-            }
-        }
-        param.rtrn = NULL;
-    }
-
-    if (ret != 0) {
-        /* Some error happend; clear the Xkbfiles parsed so far */
-        FreeXkbFile(first);
-        FreeXkbFile(param.rtrn);
-        return NULL;
-    }
-
-    /*
-     * Warn about implicit default section,
-     * but only if not a keymap: multiple keymaps per file not supported
-     */
-    if (first && first->file_type != FILE_TYPE_KEYMAP)
-        log_vrb(ctx, XKB_LOG_VERBOSITY_DETAILED,
-                XKB_WARNING_MISSING_DEFAULT_SECTION,
-                "No section name in include statement, but \"%s\" contains several; "
-                "Using first defined section, \"%s\"\n",
-                scanner->file_name, safe_map_name(first->name));
-
-    return first;
-}
-
 /* Parse the next section */
 bool
 parse_next(struct xkb_context *ctx,
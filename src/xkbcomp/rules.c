@@ -63,7 +63,7 @@ lex(struct scanner *s, union lvalue *val)
 {
 skip_more_whitespace_and_comments:
     /* Skip spaces. */
-    while (scanner_chr(s, ' ') || scanner_chr(s, '\t') || scanner_chr(s, '\r'));
+    scanner_skip_chars(s, SCANNER_CHARS_SPACE_TAB_CR);
 
     /* Skip comments. */
     if (scanner_lit(s, "//")) {
@@ -108,11 +108,8 @@ skip_more_whitespace_and_comments:
     /* Group name. */
     if (scanner_chr(s, '$')) {
         val->string.start = s->s + s->pos;
-        val->string.len = 0;
-        while (is_ident(scanner_peek(s))) {
-            scanner_next(s);
-            val->string.len++;
-        }
+        val->string.len =
+            scanner_skip_chars(s, SCANNER_CHARS_GRAPH_NO_BACKSLASH);
         if (val->string.len == 0) {
             scanner_err(s, XKB_ERROR_INVALID_RULES_SYNTAX,
                         "unexpected character after \'$\'; expected name");
@@ -132,11 +129,8 @@ skip_more_whitespace_and_comments:
     assert(is_ident(MERGE_REPLACE_PREFIX));
     if (is_ident(scanner_peek(s))) {
         val->string.start = s->s + s->pos;
-        val->string.len = 0;
-        while (is_ident(scanner_peek(s))) {
-            scanner_next(s);
-            val->string.len++;
-        }
+        val->string.len =
+            scanner_skip_chars(s, SCANNER_CHARS_GRAPH_NO_BACKSLASH);
         return TOK_IDENTIFIER;
     }
 
@@ -8,7 +8,10 @@
 #include <assert.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
+#include <sys/stat.h>
 
+#include "darray.h"
 #include "scanner-utils.h"
 #include "xkbcomp-priv.h"
 #include "parser-priv.h"
@@ -75,14 +78,15 @@ _xkbcommon_lex(YYSTYPE *yylval, struct scanner *s)
 {
 skip_more_whitespace_and_comments:
     /* Skip spaces. */
-    while (is_space(scanner_peek(s))) scanner_next(s);
+    scanner_skip_chars(s, SCANNER_CHARS_SPACE);
 
     /*
      * Skip U+200E LEFT-TO-RIGHT MARK and U+200F RIGHT-TO-LEFT MARK, assuming
      * UTF-8 encoding. These Unicode code points are useful for forcing the text
      * directionality when displaying/editing an XKB file.
      */
-    if (scanner_lit(s, u8"\u200E") || scanner_lit(s, u8"\u200F"))
+    if (unlikely(scanner_peek(s) == '\xe2') &&
+        (scanner_lit(s, u8"\u200E") || scanner_lit(s, u8"\u200F")))
         goto skip_more_whitespace_and_comments;
 
     /* Skip comments. */
@@ -100,6 +104,25 @@ skip_more_whitespace_and_comments:
 
     /* String literal. */
     if (scanner_chr(s, '\"')) {
+        /*
+         * Fast path: literals without escape sequences are returned as
+         * slices of the input, without copying.
+         */
+        const size_t literal_pos = s->pos;
+        scanner_skip_chars(s, SCANNER_CHARS_STRING);
+        if (scanner_chr(s, '\"')) {
+            /* Truncate at the first NUL byte, as C strings */
+            const char * const start = s->s + literal_pos;
+            const char * const nul = memchr(start, '\0',
+                                            s->pos - literal_pos - 1);
+            yylval->lit.sval = SVAL(start, (nul)
+                                           ? (size_t) (nul - start)
+                                           : s->pos - literal_pos - 1);
+            yylval->lit.owned = NULL;
+            return STRING;
+        }
+        /* Slow path: unescape into the buffer */
+        scanner_buf_appendn(s, s->s + literal_pos, s->pos - literal_pos);
         while (!scanner_eof(s) && !scanner_eol(s) && scanner_peek(s) != '\"') {
             if (scanner_chr(s, '\\')) {
                 uint8_t o;
@@ -149,7 +172,12 @@ skip_more_whitespace_and_comments:
                     /* Ignore. */
                 }
             } else {
-                scanner_buf_append(s, scanner_next(s));
+                /* Copy the run of regular characters at once */
+                const size_t count = scanner_span(s->s + s->pos,
+                                                  s->len - s->pos,
+                                                  SCANNER_CHARS_STRING);
+                scanner_buf_appendn(s, s->s + s->pos, count);
+                s->pos += count;
             }
         }
         if (!scanner_buf_append(s, '\0') || !scanner_chr(s, '\"')) {
@@ -157,9 +185,12 @@ skip_more_whitespace_and_comments:
                         "unterminated string literal");
             return ERROR_TOK;
         }
-        yylval->str = strdup(s->buf);
-        if (!yylval->str)
+        char *const owned = strdup(s->buf);
+        if (!owned)
             return ERROR_TOK;
+        /* strdup() truncates at the first NUL byte: use its actual length */
+        yylval->lit.sval = SVAL(owned, strlen(owned));
+        yylval->lit.owned = owned;
         return STRING;
     }
 
@@ -201,8 +232,7 @@ skip_more_whitespace_and_comments:
 
     /* Identifier. */
     if (is_alpha(scanner_peek(s)) || scanner_peek(s) == '_') {
-        while (is_alnum(scanner_peek(s)) || scanner_peek(s) == '_')
-            scanner_next(s);
+        scanner_skip_chars(s, SCANNER_CHARS_IDENT);
 
         const char *start = s->s + s->token_pos;
         const size_t len = s->pos - s->token_pos;
@@ -230,6 +260,339 @@ skip_more_whitespace_and_comments:
     return ERROR_TOK;
 }
 
+/* Parse the next section, using the parser selected by the context */
+static bool
+parse_next_section(struct xkb_context *ctx,
+                   const struct parser_keymap_config *config,
+                   struct scanner *scanner, XkbFile **xkb_file)
+{
+    if (ctx->parser == XKB_PARSER_DESCENT)
+        return parse_next_descent(ctx, config, scanner, xkb_file);
+    else
+        return parse_next(ctx, config, scanner, xkb_file);
+}
+
+/* Parse a specific section */
+static XkbFile *
+parse(struct xkb_context *ctx, const struct parser_keymap_config *config,
+      struct scanner *scanner, const char *map)
+{
+    XkbFile *first = NULL;
+    XkbFile *xkb_file = NULL;
+
+    /*
+     * If we got a specific map, we look for it exclusively and return
+     * immediately upon finding it. Otherwise, we need to get the
+     * default map. If we find a map marked as default, we return it
+     * immediately. If there are no maps marked as default, we return
+     * the first map in the file.
+     */
+
+    bool ok;
+    while ((ok = parse_next_section(ctx, config, scanner, &xkb_file)) &&
+           xkb_file) {
+        if (map) {
+            if (streq_not_null(map, xkb_file->name))
+                return xkb_file;
+            else
+                FreeXkbFile(xkb_file);
+        }
+        else {
+            if (xkb_file->flags & MAP_IS_DEFAULT) {
+                FreeXkbFile(first);
+                return xkb_file;
+            }
+            else if (!first) {
+                first = xkb_file;
+            }
+            else {
+                FreeXkbFile(xkb_file);
+            }
+        }
+    }
+
+    if (!ok) {
+        /* Some error happend; clear the Xkbfiles parsed so far */
+        FreeXkbFile(first);
+        return NULL;
+    }
+
+    /*
+     * Warn about implicit default section,
+     * but only if not a keymap: multiple keymaps per file not supported
+     */
+    if (first && first->file_type != FILE_TYPE_KEYMAP)
+        log_vrb(ctx, XKB_LOG_VERBOSITY_DETAILED,
+                XKB_WARNING_MISSING_DEFAULT_SECTION,
+                "No section name in include statement, but \"%s\" contains several; "
+                "Using first defined section, \"%s\"\n",
+                scanner->file_name, safe_map_name(first->name));
+
+    return first;
+}
+
+/*
+ * Sections index
+ *
+ * Including a specific section of a file, e.g. `include "us(intl)"`, only
+ * requires to parse this section. The sections are located with a pre-scan
+ * that only matches the braces, skipping the comments, the string literals and
+ * the key names. The pre-scan gives up on any unexpected input, so that the
+ * full parse reports the error.
+ */
+
+/* Skip spaces and comments */
+static void
+prescan_skip_spaces(struct scanner *s)
+{
+    for (;;) {
+        scanner_skip_chars(s, SCANNER_CHARS_SPACE);
+        if (unlikely(scanner_peek(s) == '\xe2') &&
+            (scanner_lit(s, u8"\u200E") || scanner_lit(s, u8"\u200F")))
+            continue;
+        if (scanner_lit(s, "//") || scanner_chr(s, '#')) {
+            scanner_skip_to_eol(s);
+            continue;
+        }
+        return;
+    }
+}
+
+/* Skip a string literal, after the opening quote */
+static bool
+prescan_skip_string(struct scanner *s, bool *has_escapes)
+{
+    for (;;) {
+        scanner_skip_chars(s, SCANNER_CHARS_STRING);
+        if (scanner_chr(s, '"'))
+            return true;
+        if (!scanner_chr(s, '\\') || scanner_eof(s) || scanner_eol(s))
+            return false;
+        /* Skip the escaped character, which may be a quote */
+        scanner_next(s);
+        *has_escapes = true;
+    }
+}
+
+/* Skip a block, after the opening brace */
+static bool
+prescan_skip_block(struct scanner *s)
+{
+    unsigned int depth = 1;
+    bool has_escapes;
+    while (depth > 0) {
+        scanner_skip_chars(s, SCANNER_CHARS_BLOCK);
+        switch (scanner_peek(s)) {
+        case '{':
+            depth++;
+            break;
+        case '}':
+            depth--;
+            break;
+        case '"':
+            scanner_next(s);
+            if (!prescan_skip_string(s, &has_escapes))
+                return false;
+            continue;
+        case '<':
+            /* Key name literal */
+            scanner_next(s);
+            while (is_graph(scanner_peek(s)) && scanner_peek(s) != '>')
+                scanner_next(s);
+            if (!scanner_chr(s, '>'))
+                return false;
+            continue;
+        case '#':
+            scanner_skip_to_eol(s);
+            continue;
+        case '/':
+            if (scanner_lit(s, "//"))
+                scanner_skip_to_eol(s);
+            else
+                scanner_next(s);
+            continue;
+        default:
+            /* End of input or NULL character */
+            return false;
+        }
+        scanner_next(s);
+    }
+    return true;
+}
+
+/* Locate the sections of a file; returns false on unexpected input */
+static bool
+prescan_sections(struct scanner *s, darray_section_offset *sections)
+{
+    for (prescan_skip_spaces(s); !scanner_eof(s); prescan_skip_spaces(s)) {
+        struct section_offset section = { .offset = s->pos };
+
+        /* Flags and section type */
+        bool has_type = false;
+        while (!has_type && (is_alpha(scanner_peek(s)) ||
+                             scanner_peek(s) == '_')) {
+            const size_t start = s->pos;
+            scanner_skip_chars(s, SCANNER_CHARS_IDENT);
+            switch (keyword_to_token(s->s + start, s->pos - start)) {
+            case XKB_KEYCODES:
+            case XKB_TYPES:
+            case XKB_COMPATMAP:
+            case XKB_SYMBOLS:
+            case XKB_GEOMETRY:
+                has_type = true;
+                break;
+            case -1: /* Unknown flag */
+            case PARTIAL:
+            case DEFAULT:
+            case HIDDEN:
+            case ALPHANUMERIC_KEYS:
+            case MODIFIER_KEYS:
+            case KEYPAD_KEYS:
+            case FUNCTION_KEYS:
+            case ALTERNATE_GROUP:
+            case DEPRECATED:
+                break;
+            default:
+                /* Keymaps are not supported */
+                return false;
+            }
+            prescan_skip_spaces(s);
+        }
+        if (!has_type)
+            return false;
+
+        /* Optional name; names with escape sequences are not supported */
+        size_t name_len = 0;
+        const bool has_name = scanner_chr(s, '"');
+        if (has_name) {
+            bool has_escapes = false;
+            section.name_offset = s->pos;
+            if (!prescan_skip_string(s, &has_escapes) || has_escapes)
+                return false;
+            name_len = s->pos - section.name_offset - 1;
+            prescan_skip_spaces(s);
+        }
+
+        if (!scanner_chr(s, '{') || !prescan_skip_block(s))
+            return false;
+        prescan_skip_spaces(s);
+        if (!scanner_chr(s, ';'))
+            return false;
+
+        if (has_name &&
+            !(section.name = strndup(s->s + section.name_offset, name_len)))
+            return false;
+        darray_append(*sections, section);
+    }
+    return true;
+}
+
+static void
+section_offsets_free(darray_section_offset *sections)
+{
+    struct section_offset *section;
+    darray_foreach(section, *sections)
+        free(section->name);
+    darray_free(*sections);
+}
+
+/*
+ * Get the sections index of a file, from the cache if possible.
+ *
+ * The cached index is checked against the section names, in case the file
+ * changed without changing its size nor its modification time.
+ */
+static struct section_index *
+get_section_index(struct xkb_context *ctx, struct scanner *scanner,
+                  FILE *file, struct section_index *index)
+{
+    struct stat stat_buf;
+    const bool cacheable = ctx->use_include_cache &&
+                           fstat(fileno(file), &stat_buf) == 0 &&
+                           S_ISREG(stat_buf.st_mode) && stat_buf.st_ino != 0;
+
+    if (cacheable) {
+        struct section_index *cached;
+        darray_foreach(cached, ctx->include_cache.section_indexes) {
+            if (cached->dev != (uint64_t) stat_buf.st_dev ||
+                cached->ino != (uint64_t) stat_buf.st_ino)
+                continue;
+            bool valid = cached->size == (uint64_t) stat_buf.st_size &&
+                         cached->mtime == (int64_t) stat_buf.st_mtime;
+            const struct section_offset *section;
+            darray_foreach(section, cached->sections) {
+                if (!valid)
+                    break;
+                if (section->name) {
+                    const size_t len = strlen(section->name);
+                    valid = section->name_offset + len < scanner->len &&
+                            memcmp(scanner->s + section->name_offset,
+                                   section->name, len) == 0 &&
+                            scanner->s[section->name_offset + len] == '"';
+                }
+            }
+            if (valid)
+                return cached;
+            /* Stale entry: replace it with the last one */
+            section_offsets_free(&cached->sections);
+            *cached = darray_item(ctx->include_cache.section_indexes,
+                                  darray_size(ctx->include_cache.section_indexes) - 1);
+            darray_remove_last(ctx->include_cache.section_indexes);
+            break;
+        }
+    }
+
+    darray_init(index->sections);
+    const size_t pos = scanner->pos;
+    index->indexed = prescan_sections(scanner, &index->sections);
+    scanner->pos = pos;
+    if (!index->indexed)
+        section_offsets_free(&index->sections);
+
+    if (cacheable) {
+        index->dev = (uint64_t) stat_buf.st_dev;
+        index->ino = (uint64_t) stat_buf.st_ino;
+        index->size = (uint64_t) stat_buf.st_size;
+        index->mtime = (int64_t) stat_buf.st_mtime;
+        darray_append(ctx->include_cache.section_indexes, *index);
+        return &darray_item(ctx->include_cache.section_indexes,
+                            darray_size(ctx->include_cache.section_indexes) - 1);
+    }
+    return index;
+}
+
+/* Parse a specific section, using the sections index if possible */
+static XkbFile *
+parse_indexed(struct xkb_context *ctx,
+              const struct parser_keymap_config *config,
+              struct scanner *scanner, FILE *file, const char *map)
+{
+    struct section_index tmp = { .indexed = false };
+    const struct section_index * const index =
+        get_section_index(ctx, scanner, file, &tmp);
+    XkbFile *xkb_file = NULL;
+
+    if (!index->indexed) {
+        xkb_file = parse(ctx, config, scanner, map);
+        goto out;
+    }
+
+    const struct section_offset *section;
+    darray_foreach(section, index->sections) {
+        if (!streq_not_null(map, section->name))
+            continue;
+        scanner->pos = section->offset;
+        if (!parse_next_section(ctx, config, scanner, &xkb_file))
+            xkb_file = NULL;
+        break;
+    }
+
+out:
+    if (index == &tmp)
+        section_offsets_free(&tmp.sections);
+    return xkb_file;
+}
+
 bool
 XkbParseStringInit(struct xkb_context *ctx, struct scanner *scanner,
                    const char *string, size_t len,
@@ -275,7 +638,7 @@ XkbParseStringNext(struct xkb_context *ctx,
         *out = parse(ctx, config, scanner, map);
         return !!(*out);
     } else {
-        return parse_next(ctx, config, scanner, out);
+        return parse_next_section(ctx, config, scanner, out);
     }
 }
 
@@ -297,7 +660,15 @@ XkbParseFile(struct xkb_context *ctx,
         return NULL;
     }
 
-    xkb_file = XkbParseString(ctx, config, string, size, file_name, map);
+    if (map) {
+        struct scanner scanner;
+        xkb_file = XkbParseStringInit(ctx, &scanner, string, size,
+                                      file_name, map)
+            ? parse_indexed(ctx, config, &scanner, file, map)
+            : NULL;
+    } else {
+        xkb_file = XkbParseString(ctx, config, string, size, file_name, map);
+    }
     unmap_file(string, size);
     return xkb_file;
 }
@@ -83,6 +83,12 @@ parser_strict_flags_from_keymap(const struct xkb_keymap *keymap)
 struct parser_keymap_config {
     enum xkb_keymap_format format;
     enum xkb_parser_strict_flags strict;
+    /**
+     * Discard the declarations of the geometry sections while parsing, since
+     * they are unused by the keymap compiler. Only supported by the recursive
+     * descent parser.
+     */
+    bool skip_geometry;
 };
 
 typedef union ExprDef ExprDef;
@@ -93,6 +99,8 @@ struct pending_computation {
 };
 typedef darray(struct pending_computation) pending_computation_array;
 
+typedef darray(xkb_atom_t) darray_atom;
+
 /** Keymap augmented with miscellaneous data used during compilation */
 struct xkb_keymap_info {
     /** The keymap being compiled */
@@ -125,6 +133,12 @@ struct xkb_keymap_info {
 
     /** Pending computations */
     pending_computation_array *pending_computations;
+
+    /**
+     * Key alias names in definition order, set by the keycodes compilation.
+     * Entries are unique but may not be valid aliases: use the key names LUT.
+     */
+    darray_atom key_aliases;
 };
 
 enum xkb_error_code
@@ -134,6 +148,14 @@ text_v1_keymap_serialize(
         struct xkb_keymap_serialize_result *result
 );
 
+enum xkb_error_code
+text_v1_keymap_serialize_stream(
+        const struct xkb_keymap *keymap,
+        const struct xkb_keymap_serialize_config *config,
+        xkb_keymap_serialize_write_fn write, void *user_data,
+        struct xkb_keymap_serialize_result *result
+);
+
 XkbFile *
 XkbParseFile(struct xkb_context *ctx,
              const struct parser_keymap_config *config,
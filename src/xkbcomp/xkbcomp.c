@@ -202,7 +202,8 @@ text_v1_keymap_new_from_string(struct xkb_keymap *keymap,
 
     const struct parser_keymap_config config = {
         .format = keymap->format,
-        .strict = parser_strict_flags_from_keymap(keymap)
+        .strict = parser_strict_flags_from_keymap(keymap),
+        .skip_geometry = true
     };
 
     xkb_file = XkbParseString(keymap->ctx, &config,
@@ -226,7 +227,8 @@ text_v1_keymap_new_from_file(struct xkb_keymap *keymap, FILE *file)
 
     const struct parser_keymap_config config = {
         .format = keymap->format,
-        .strict = parser_strict_flags_from_keymap(keymap)
+        .strict = parser_strict_flags_from_keymap(keymap),
+        .skip_geometry = true
     };
 
     xkb_file = XkbParseFile(keymap->ctx, &config, file, "(unknown file)", NULL);
@@ -247,4 +249,5 @@ const struct xkb_keymap_format_ops text_v1_keymap_format_ops = {
     .keymap_new_from_string = text_v1_keymap_new_from_string,
     .keymap_new_from_file = text_v1_keymap_new_from_file,
     .keymap_serialize = text_v1_keymap_serialize,
+    .keymap_serialize_stream = text_v1_keymap_serialize_stream,
 };
@@ -2680,6 +2680,84 @@ test_escape_sequences(struct xkb_context *ctx, bool update_output_files)
                                expected, update_output_files));
 }
 
+static void
+test_long_string_literals(struct xkb_context *ctx)
+{
+    /* String literals without escape sequences have no length limit */
+    char name[2048];
+    memset(name, 'x', sizeof(name) - 1);
+    name[sizeof(name) - 1] = '\0';
+
+    const char keymap_fmt[] =
+        "xkb_keymap {\n"
+        "  xkb_keycodes { <> = 1; };\n"
+        "  xkb_types { include \"basic\" };\n"
+        "  xkb_compat {};\n"
+        "  xkb_symbols { name[1] = \"%s%s\"; key <> { [a] }; };\n"
+        "};";
+    char buf[sizeof(keymap_fmt) + sizeof(name) + 2];
+    int ret = snprintf(buf, sizeof(buf), keymap_fmt, name, "");
+    assert(ret > 0 && (size_t) ret < sizeof(buf));
+
+    struct xkb_keymap *keymap =
+        test_compile_buffer(ctx, XKB_KEYMAP_FORMAT_TEXT_V1, buf, (size_t) ret);
+    assert(keymap);
+    assert_streq_not_null("long literal",
+                          name, xkb_keymap_layout_get_name(keymap, 0));
+    xkb_keymap_unref(keymap);
+
+    /* Literals with escape sequences are still limited by the scanner buffer */
+    ret = snprintf(buf, sizeof(buf), keymap_fmt, name, "\\n");
+    assert(ret > 0 && (size_t) ret < sizeof(buf));
+    keymap = test_compile_buffer(ctx, XKB_KEYMAP_FORMAT_TEXT_V1,
+                                 buf, (size_t) ret);
+    assert(!keymap);
+}
+
+/* String literals are truncated at their first NUL byte */
+static void
+test_string_literals_nul(struct xkb_context *ctx)
+{
+    static const struct {
+        const char *literal;
+        size_t length;
+    } tests[] = {
+        /* Without escape sequence */
+        { "ab\0cd", 5 },
+        /* With escape sequences */
+        { "ab\0cd\\n", 7 },
+        { "a\\tb\0cd\\n", 9 },
+    };
+    static const char *expected[] = { "ab", "ab", "a\tb" };
+
+    const char prefix[] =
+        "xkb_keymap {\n"
+        "  xkb_keycodes { <> = 1; };\n"
+        "  xkb_types { include \"basic\" };\n"
+        "  xkb_compat {};\n"
+        "  xkb_symbols { name[1] = \"";
+    const char suffix[] = "\"; key <> { [a] }; };\n};";
+
+    for (size_t t = 0; t < ARRAY_SIZE(tests); t++) {
+        char buf[sizeof(prefix) + sizeof(suffix) + 16];
+        size_t len = 0;
+        memcpy(buf, prefix, sizeof(prefix) - 1);
+        len += sizeof(prefix) - 1;
+        memcpy(buf + len, tests[t].literal, tests[t].length);
+        len += tests[t].length;
+        memcpy(buf + len, suffix, sizeof(suffix) - 1);
+        len += sizeof(suffix) - 1;
+
+        struct xkb_keymap * const keymap =
+            test_compile_buffer(ctx, XKB_KEYMAP_FORMAT_TEXT_V1, buf, len);
+        assert(keymap);
+        assert_streq_not_null("literal with NUL byte",
+                              expected[t],
+                              xkb_keymap_layout_get_name(keymap, 0));
+        xkb_keymap_unref(keymap);
+    }
+}
+
 static void
 test_unicode_keysyms(struct xkb_context *ctx, bool update_output_files)
 {
@@ -3520,6 +3598,8 @@ main(int argc, char *argv[])
     test_modifier_maps(ctx, update_output_files);
     test_empty_compound_statements(ctx, update_output_files);
     test_escape_sequences(ctx, update_output_files);
+    test_long_string_literals(ctx);
+    test_string_literals_nul(ctx);
     test_unicode_keysyms(ctx, update_output_files);
     test_no_action_void_action(ctx, update_output_files);
     test_prebuilt_keymap_roundtrip(ctx, update_output_files);
@@ -19,6 +19,7 @@
 #include "test.h"
 #include "src/utf8.h"
 #include "src/keysym.h"
+#include "src/keymap.h"
 #include "src/compose/constants.h"
 #include "src/compose/parser.h"
 #include "src/compose/escape.h"
@@ -1129,6 +1130,158 @@ test_roundtrip(struct xkb_context *ctx)
  *      environment variable is set.
  *    - Use an integer to set it explicitly.
  */
+/* Type the planned key strokes and check that they produce the text */
+static int
+test_plan(struct xkb_text_planner *planner, struct xkb_compose_table *table,
+          struct xkb_state *state, const char *text)
+{
+    struct xkb_key_stroke strokes[128];
+    const int count = xkb_text_planner_plan(planner, state, text, strlen(text),
+                                            strokes, ARRAY_SIZE(strokes));
+    if (count < 0)
+        return count;
+    assert((size_t) count <= ARRAY_SIZE(strokes));
+
+    struct xkb_keymap * const keymap = xkb_state_get_keymap(state);
+    struct xkb_state * const sim = xkb_state_new(keymap);
+    assert(sim);
+    xkb_state_update_mask(sim, 0, 0,
+                          xkb_state_serialize_mods(state, XKB_STATE_MODS_LOCKED),
+                          0, 0,
+                          xkb_state_serialize_layout(state,
+                                                     XKB_STATE_LAYOUT_LOCKED));
+    struct xkb_compose_state * const compose =
+        (table) ? xkb_compose_state_new(table, XKB_COMPOSE_STATE_NO_FLAGS)
+                : NULL;
+
+    char typed[256] = "";
+    size_t length = 0;
+    for (int k = 0; k < count; k++) {
+        const xkb_keycode_t kc = strokes[k].keycode;
+        if (strokes[k].direction == XKB_KEY_DOWN) {
+            const xkb_keysym_t keysym = xkb_state_key_get_one_sym(sim, kc);
+            enum xkb_compose_status status = XKB_COMPOSE_NOTHING;
+            if (compose) {
+                xkb_compose_state_feed(compose, keysym);
+                status = xkb_compose_state_get_status(compose);
+            }
+            char buffer[64];
+            switch (status) {
+            case XKB_COMPOSE_COMPOSED:
+                xkb_compose_state_get_utf8(compose, buffer, sizeof(buffer));
+                xkb_compose_state_reset(compose);
+                break;
+            case XKB_COMPOSE_NOTHING:
+                xkb_state_key_get_utf8(sim, kc, buffer, sizeof(buffer));
+                break;
+            default:
+                buffer[0] = '\0';
+            }
+            length += (size_t) snprintf(typed + length, sizeof(typed) - length,
+                                        "%s", buffer);
+            assert(length < sizeof(typed));
+        }
+        xkb_state_update_key(sim, kc, strokes[k].direction);
+    }
+
+    assert_streq("Typed text", text, typed);
+    /* All the modifiers are released */
+    assert(xkb_state_serialize_mods(sim, XKB_STATE_MODS_DEPRESSED) == 0);
+
+    xkb_compose_state_unref(compose);
+    xkb_state_unref(sim);
+    return count;
+}
+
+static void
+test_text_planner(struct xkb_context *ctx)
+{
+    char *path = test_get_path("locale/en_US.UTF-8/Compose");
+    FILE *file = fopen(path, "rb");
+    assert(file);
+    free(path);
+    struct xkb_compose_table * const table =
+        xkb_compose_table_new_from_file(ctx, file, "",
+                                        XKB_COMPOSE_FORMAT_TEXT_V1,
+                                        XKB_COMPOSE_COMPILE_NO_FLAGS);
+    assert(table);
+    fclose(file);
+
+    struct xkb_keymap * const keymap =
+        test_compile_rules(ctx, XKB_KEYMAP_FORMAT_TEXT_V1, "evdev", "pc104",
+                           "us,ru", NULL, "grp:menu_toggle,compose:ralt");
+    assert(keymap);
+
+    /* Reject unsupported flags */
+    assert(!xkb_text_planner_new(keymap, table, -1));
+    assert(!xkb_text_planner_new(keymap, table, 0xffff));
+
+    struct xkb_text_planner * const planner =
+        xkb_text_planner_new(keymap, table, XKB_TEXT_PLANNER_NO_FLAGS);
+    assert(planner);
+    struct xkb_text_planner * const planner_no_compose =
+        xkb_text_planner_new(keymap, NULL, XKB_TEXT_PLANNER_NO_FLAGS);
+    assert(planner_no_compose);
+    struct xkb_state * const state = xkb_state_new(keymap);
+    assert(state);
+
+    /* Direct keys */
+    assert(test_plan(planner, table, state, "") == 0);
+    assert(test_plan(planner, table, state, "hello") == 10);
+    assert(test_plan(planner, table, state, "Hello, World!\n") > 28);
+    /* Shift is held only once */
+    assert(test_plan(planner, table, state, "ABC") == 8);
+    assert(test_plan(planner, table, state, "aB") == 6);
+
+    /* Layout switch: Menu is pressed only once */
+    assert(test_plan(planner, table, state, "привет") == 14);
+    assert(test_plan(planner, table, state, "Hi Привет!") > 20);
+
+    /* Compose fallback */
+    assert(test_plan(planner, table, state, "é") == 6);
+    assert(test_plan(planner, table, state, "café ÿ") > 0);
+    assert(test_plan(planner_no_compose, NULL, state, "é") == -1);
+
+    /* Truncation */
+    struct xkb_key_stroke strokes[2] = { 0 };
+    assert(xkb_text_planner_plan(planner, state, "A", 1, NULL, 0) == 4);
+    assert(xkb_text_planner_plan(planner, state, "A", 1, strokes, 2) == 4);
+    assert(strokes[0].direction == XKB_KEY_DOWN);
+    assert(strokes[1].direction == XKB_KEY_DOWN);
+    assert(strokes[1].keycode == xkb_keymap_key_by_name(keymap, "AC01"));
+
+    /* Start from the second layout */
+    xkb_state_update_mask(state, 0, 0, 0, 0, 0, 1);
+    assert(test_plan(planner, table, state, "пр") == 4);
+    assert(test_plan(planner, table, state, "hi") == 6);
+
+    /* Caps Lock is taken into account but not changed */
+    const xkb_mod_mask_t caps = UINT32_C(1) << XKB_MOD_INDEX_CAPS;
+    xkb_state_update_mask(state, 0, 0, caps, 0, 0, 0);
+    assert(test_plan(planner, table, state, "Ab") == 6);
+    assert(test_plan(planner, table, state, "1!") == 6);
+    xkb_state_update_mask(state, 0, 0, 0, 0, 0, 0);
+
+    /* Errors */
+    assert(test_plan(planner, table, state, "\xff") == -1);
+    assert(test_plan(planner, table, state, "☃") == -1);
+    struct xkb_keymap * const other =
+        test_compile_rules(ctx, XKB_KEYMAP_FORMAT_TEXT_V1, "evdev", "pc104",
+                           "us", NULL, NULL);
+    assert(other);
+    struct xkb_state * const other_state = xkb_state_new(other);
+    assert(other_state);
+    assert(xkb_text_planner_plan(planner, other_state, "a", 1, NULL, 0) == -1);
+    xkb_state_unref(other_state);
+    xkb_keymap_unref(other);
+
+    xkb_state_unref(state);
+    xkb_text_planner_destroy(planner_no_compose);
+    xkb_text_planner_destroy(planner);
+    xkb_keymap_unref(keymap);
+    xkb_compose_table_unref(table);
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -1206,6 +1359,7 @@ main(int argc, char *argv[])
     test_decode_escape_sequences(ctx);
     test_encode_escape_sequences(ctx);
     test_roundtrip(ctx);
+    test_text_planner(ctx);
 
     xkb_context_unref(ctx);
     return EXIT_SUCCESS;
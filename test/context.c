@@ -366,6 +366,261 @@ test_delayed_includes(void)
     restore_env();
 }
 
+static void
+test_include_cache(void)
+{
+    const char keymap_str[] =
+        "xkb_keymap {\n"
+        "  xkb_keycodes { include \"evdev\" };\n"
+        "  xkb_types { include \"basic\" };\n"
+        "  xkb_compat { include \"basic\" };\n"
+        "  xkb_symbols { include \"pc+cachetest\" };\n"
+        "};";
+    const char symbols_str[] =
+        "xkb_symbols \"basic\" { key <AE01> { [ 1, exclam ] }; };";
+    struct xkb_keymap *keymap;
+    size_t hits, misses, prev_hits, prev_misses;
+
+    const char * const tmpdir = maketmpdir();
+    const char * const symbols_dir = makedir(tmpdir, "symbols");
+    char * const data_path = test_get_path("");
+    assert(data_path);
+
+    struct xkb_context *ctx =
+        xkb_context_new(XKB_CONTEXT_NO_DEFAULT_INCLUDES |
+                        XKB_CONTEXT_NO_ENVIRONMENT_NAMES |
+                        XKB_CONTEXT_CACHE_INCLUDE_LOOKUPS);
+    assert(ctx);
+    assert(xkb_context_include_path_append(ctx, tmpdir));
+    assert(xkb_context_include_path_append(ctx, data_path));
+    xkb_context_include_cache_get_stats(ctx, &hits, &misses);
+    assert(hits == 0 && misses == 0);
+
+    /* Missing file */
+    keymap = xkb_keymap_new_from_string(ctx, keymap_str,
+                                        XKB_KEYMAP_FORMAT_TEXT_V1,
+                                        XKB_KEYMAP_COMPILE_NO_FLAGS);
+    assert(!keymap);
+    xkb_context_include_cache_get_stats(ctx, &prev_hits, &prev_misses);
+    assert(prev_misses > 0);
+
+    /* Add the file: the negative lookup is still cached */
+    char * const symbols_path = asprintf_safe("%s/cachetest", symbols_dir);
+    assert(symbols_path);
+    FILE *file = fopen(symbols_path, "wb");
+    assert(file);
+    assert(fputs(symbols_str, file) >= 0);
+    fclose(file);
+    keymap = xkb_keymap_new_from_string(ctx, keymap_str,
+                                        XKB_KEYMAP_FORMAT_TEXT_V1,
+                                        XKB_KEYMAP_COMPILE_NO_FLAGS);
+    assert(!keymap);
+    xkb_context_include_cache_get_stats(ctx, &hits, &misses);
+    assert(hits > prev_hits);
+    assert(misses == prev_misses);
+
+    /* Invalidate the cache */
+    xkb_context_include_cache_invalidate(ctx);
+    keymap = xkb_keymap_new_from_string(ctx, keymap_str,
+                                        XKB_KEYMAP_FORMAT_TEXT_V1,
+                                        XKB_KEYMAP_COMPILE_NO_FLAGS);
+    assert(keymap);
+    xkb_keymap_unref(keymap);
+    prev_hits = hits;
+    prev_misses = misses;
+    xkb_context_include_cache_get_stats(ctx, &hits, &misses);
+    assert(misses > prev_misses);
+
+    /* Modifying the include paths invalidates the cache */
+    xkb_context_include_path_clear(ctx);
+    assert(xkb_context_include_path_append(ctx, data_path));
+    keymap = xkb_keymap_new_from_string(ctx, keymap_str,
+                                        XKB_KEYMAP_FORMAT_TEXT_V1,
+                                        XKB_KEYMAP_COMPILE_NO_FLAGS);
+    assert(!keymap);
+
+    xkb_context_unref(ctx);
+    remove(symbols_path);
+    free(symbols_path);
+    free(data_path);
+    unmakedirs();
+}
+
+static void
+test_include_snapshot(void)
+{
+    const char keymap_str[] =
+        "xkb_keymap {\n"
+        "  xkb_keycodes { include \"evdev\" };\n"
+        "  xkb_types { include \"basic\" };\n"
+        "  xkb_compat { include \"basic\" };\n"
+        "  xkb_symbols { include \"pc+cachetest\" };\n"
+        "};";
+    const char symbols_str[] =
+        "xkb_symbols \"basic\" { key <AE01> { [ 1, exclam ] }; };";
+    struct xkb_keymap *keymap;
+    size_t hits, misses;
+
+    const char * const tmpdir = maketmpdir();
+    const char * const symbols_dir = makedir(tmpdir, "symbols");
+    char * const data_path = test_get_path("");
+    assert(data_path);
+
+    struct xkb_context *ctx =
+        xkb_context_new(XKB_CONTEXT_NO_DEFAULT_INCLUDES |
+                        XKB_CONTEXT_NO_ENVIRONMENT_NAMES |
+                        XKB_CONTEXT_SNAPSHOT_INCLUDE_PATHS);
+    assert(ctx);
+    assert(xkb_context_include_path_append(ctx, tmpdir));
+    assert(xkb_context_include_path_append(ctx, data_path));
+
+    /* All the lookups are resolved by the snapshot */
+    keymap = xkb_keymap_new_from_string(ctx, keymap_str,
+                                        XKB_KEYMAP_FORMAT_TEXT_V1,
+                                        XKB_KEYMAP_COMPILE_NO_FLAGS);
+    assert(!keymap);
+    xkb_context_include_cache_get_stats(ctx, &hits, &misses);
+    assert(hits > 0);
+    assert(misses == 0);
+
+    /* Add the missing file */
+    char * const symbols_path = asprintf_safe("%s/cachetest", symbols_dir);
+    assert(symbols_path);
+    FILE *file = fopen(symbols_path, "wb");
+    assert(file);
+    assert(fputs(symbols_str, file) >= 0);
+    fclose(file);
+    keymap = xkb_keymap_new_from_string(ctx, keymap_str,
+                                        XKB_KEYMAP_FORMAT_TEXT_V1,
+                                        XKB_KEYMAP_COMPILE_NO_FLAGS);
+#if HAVE_INOTIFY
+    /* Snapshot refreshed automatically */
+    assert(keymap);
+#else
+    assert(!keymap);
+    xkb_context_include_cache_invalidate(ctx);
+    keymap = xkb_keymap_new_from_string(ctx, keymap_str,
+                                        XKB_KEYMAP_FORMAT_TEXT_V1,
+                                        XKB_KEYMAP_COMPILE_NO_FLAGS);
+    assert(keymap);
+#endif
+    xkb_keymap_unref(keymap);
+    xkb_context_include_cache_get_stats(ctx, &hits, &misses);
+    assert(misses == 0);
+
+    xkb_context_unref(ctx);
+    remove(symbols_path);
+    free(symbols_path);
+    free(data_path);
+    unmakedirs();
+}
+
+static void
+write_file(const char *path, const char *content)
+{
+    FILE * const file = fopen(path, "wb");
+    assert(file);
+    assert(fputs(content, file) >= 0);
+    fclose(file);
+}
+
+static xkb_keysym_t
+compile_section_keysym(struct xkb_context *ctx, const char *section)
+{
+    char * const keymap_str = asprintf_safe(
+        "xkb_keymap {\n"
+        "  xkb_keycodes { include \"evdev\" };\n"
+        "  xkb_types { include \"basic\" };\n"
+        "  xkb_compat { include \"basic\" };\n"
+        "  xkb_symbols { include \"pc+sections(%s)\" };\n"
+        "};", section);
+    assert(keymap_str);
+    struct xkb_keymap * const keymap =
+        xkb_keymap_new_from_string(ctx, keymap_str, XKB_KEYMAP_FORMAT_TEXT_V1,
+                                   XKB_KEYMAP_COMPILE_NO_FLAGS);
+    free(keymap_str);
+    if (!keymap)
+        return XKB_KEY_NoSymbol;
+    const xkb_keycode_t keycode = xkb_keymap_key_by_name(keymap, "AE01");
+    const xkb_keysym_t *syms;
+    const int count =
+        xkb_keymap_key_get_syms_by_level(keymap, keycode, 0, 0, &syms);
+    const xkb_keysym_t keysym = (count == 1) ? syms[0] : XKB_KEY_NoSymbol;
+    xkb_keymap_unref(keymap);
+    return keysym;
+}
+
+static void
+test_section_index(void)
+{
+    /* Tricky but valid syntax, followed by an invalid section */
+    const char symbols_str[] =
+        "// xkb_symbols \"commented\" {\n"
+        "default partial alphanumeric_keys\n"
+        "xkb_symbols \"basic\" {\n"
+        "  name[Group1] = \"}{ \\\" // #\"; # }\n"
+        "  key <AE01> { [ 1, exclam ] }; // {\n"
+        "  key <AE02> { [ 2, at ] }; # }\n"
+        "};\n"
+        "xkb_symbols \"broken\" { key <AE01> { [ = ] }; };\n"
+        "hidden xkb_symbols \"target\" {\n"
+        "  include \"sections(basic)\"\n"
+        "  key <AE01> { [ a, A ] };\n"
+        "};\n";
+    const char swapped_str[] =
+        "xkb_symbols \"target\" { key <AE01> { [ b, B ] }; };\n"
+        "xkb_symbols \"basic\" { key <AE01> { [ c, C ] }; };\n";
+    const char escaped_str[] =
+        "xkb_symbols \"basic\\n\" { key <AE01> { [ d, D ] }; };\n"
+        "xkb_symbols \"target\" { key <AE01> { [ e, E ] }; };\n";
+
+    const char * const tmpdir = maketmpdir();
+    const char * const symbols_dir = makedir(tmpdir, "symbols");
+    char * const data_path = test_get_path("");
+    assert(data_path);
+    char * const symbols_path = asprintf_safe("%s/sections", symbols_dir);
+    assert(symbols_path);
+
+    const enum xkb_context_flags flags[] = {
+        XKB_CONTEXT_NO_FLAGS,
+        XKB_CONTEXT_CACHE_INCLUDE_LOOKUPS,
+    };
+    for (size_t f = 0; f < ARRAY_SIZE(flags); f++) {
+        struct xkb_context * const ctx =
+            xkb_context_new(XKB_CONTEXT_NO_DEFAULT_INCLUDES |
+                            XKB_CONTEXT_NO_ENVIRONMENT_NAMES | flags[f]);
+        assert(ctx);
+        assert(xkb_context_include_path_append(ctx, tmpdir));
+        assert(xkb_context_include_path_append(ctx, data_path));
+
+        /* The sections after the selected one are not parsed */
+        write_file(symbols_path, symbols_str);
+        assert(compile_section_keysym(ctx, "basic") == XKB_KEY_1);
+        /* Neither are the sections before it */
+        assert(compile_section_keysym(ctx, "target") == XKB_KEY_a);
+        assert(compile_section_keysym(ctx, "target") == XKB_KEY_a);
+        assert(compile_section_keysym(ctx, "broken") == XKB_KEY_NoSymbol);
+        assert(compile_section_keysym(ctx, "missing") == XKB_KEY_NoSymbol);
+
+        /* Modified file, possibly with the same modification time */
+        write_file(symbols_path, swapped_str);
+        assert(compile_section_keysym(ctx, "basic") == XKB_KEY_c);
+        assert(compile_section_keysym(ctx, "target") == XKB_KEY_b);
+
+        /* Not indexed: fallback to parsing the whole file */
+        write_file(symbols_path, escaped_str);
+        assert(compile_section_keysym(ctx, "target") == XKB_KEY_e);
+        assert(compile_section_keysym(ctx, "target") == XKB_KEY_e);
+
+        xkb_context_unref(ctx);
+    }
+
+    remove(symbols_path);
+    free(symbols_path);
+    free(data_path);
+    unmakedirs();
+}
+
 int
 main(void)
 {
@@ -399,6 +654,9 @@ main(void)
     test_xdg_include_path_fallback();
     test_include_order();
     test_delayed_includes();
+    test_include_cache();
+    test_include_snapshot();
+    test_section_index();
 
     return EXIT_SUCCESS;
 }
@@ -9,6 +9,7 @@
 #include "test-config.h"
 
 #include <assert.h>
+#include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -191,6 +192,87 @@ test_keymap(void)
     keyname = xkb_keymap_key_get_name(keymap, kc);
     assert(streq(keyname, "COMP"));
 
+    /* Bulk lookup */
+    const char * const keynames[] = { "AE09", "MENU", NULL, "XXXX", "COMP", "" };
+    xkb_keycode_t keycodes[ARRAY_SIZE(keynames)];
+    assert(xkb_keymap_keys_by_names(keymap, keynames, ARRAY_SIZE(keynames),
+                                    keycodes) == 3);
+    for (size_t k = 0; k < ARRAY_SIZE(keynames); k++) {
+        assert(keycodes[k] == (keynames[k]
+                               ? xkb_keymap_key_by_name(keymap, keynames[k])
+                               : XKB_KEYCODE_INVALID));
+    }
+    assert(keycodes[1] == keycodes[4]);
+
+    /* Keysym positions */
+    const struct xkb_keysym_position *positions = NULL;
+    int num_positions = xkb_keymap_keysym_get_positions(keymap, XKB_KEY_a,
+                                                        &positions);
+    assert(num_positions == 1);
+    assert(positions[0].keycode == xkb_keymap_key_by_name(keymap, "AC01"));
+    assert(positions[0].layout == 0 && positions[0].level == 0);
+    assert(positions[0].num_masks == 1 && positions[0].masks[0] == 0);
+    assert(positions[0].reserved[0] == 0 && positions[0].reserved[1] == 0);
+    num_positions = xkb_keymap_keysym_get_positions(keymap, XKB_KEY_Cyrillic_EF,
+                                                    &positions);
+    assert(num_positions == 1);
+    assert(positions[0].keycode == xkb_keymap_key_by_name(keymap, "AC01"));
+    assert(positions[0].layout == 1 && positions[0].level == 1);
+    assert(xkb_keymap_keysym_get_positions(keymap, XKB_KEY_NoSymbol,
+                                           &positions) == 0);
+    assert(positions == NULL);
+    assert(xkb_keymap_keysym_get_positions(keymap, XKB_KEY_ydiaeresis,
+                                           &positions) == 0);
+    assert(positions == NULL);
+    /* Consistency with the forward lookup */
+    for (kc = xkb_keymap_min_keycode(keymap);
+         kc <= xkb_keymap_max_keycode(keymap); kc++) {
+        const xkb_layout_index_t num_layouts =
+            xkb_keymap_num_layouts_for_key(keymap, kc);
+        for (xkb_layout_index_t layout = 0; layout < num_layouts; layout++) {
+            const xkb_level_index_t num_levels =
+                xkb_keymap_num_levels_for_key(keymap, kc, layout);
+            for (xkb_level_index_t level = 0; level < num_levels; level++) {
+                const xkb_keysym_t *syms = NULL;
+                if (xkb_keymap_key_get_syms_by_level(keymap, kc, layout, level,
+                                                     &syms) != 1)
+                    continue;
+                xkb_mod_mask_t masks[16];
+                const size_t num_masks = xkb_keymap_key_get_mods_for_level(
+                    keymap, kc, layout, level, masks, ARRAY_SIZE(masks)
+                );
+                num_positions =
+                    xkb_keymap_keysym_get_positions(keymap, syms[0], &positions);
+                bool found = false;
+                for (int p = 0; p < num_positions; p++) {
+                    if (p > 0) {
+                        /* Sorted by layout, level, keycode */
+                        assert(positions[p - 1].layout < positions[p].layout ||
+                               (positions[p - 1].layout == positions[p].layout &&
+                                (positions[p - 1].level < positions[p].level ||
+                                 (positions[p - 1].level == positions[p].level &&
+                                  positions[p - 1].keycode < positions[p].keycode))));
+                    }
+                    if (positions[p].keycode == kc &&
+                        positions[p].layout == layout &&
+                        positions[p].level == level) {
+                        assert(positions[p].num_masks == num_masks);
+                        assert(memcmp(positions[p].masks, masks,
+                                      num_masks * sizeof(*masks)) == 0);
+                        found = true;
+                    }
+                }
+                assert(found == (num_masks > 0));
+            }
+        }
+    }
+    for (kc = xkb_keymap_min_keycode(keymap);
+         kc <= xkb_keymap_max_keycode(keymap); kc++) {
+        keyname = xkb_keymap_key_get_name(keymap, kc);
+        if (keyname)
+            assert(xkb_keymap_key_by_name(keymap, keyname) == kc);
+    }
+
     kc = xkb_keymap_key_by_name(keymap, "AC01");
     assert(kc != XKB_KEYCODE_INVALID);
 
@@ -415,6 +497,138 @@ test_multiple_keysyms_per_level(void)
     xkb_context_unref(context);
 }
 
+/*
+ * Duplicate and chained aliases cannot be written in a keymap file, but may
+ * come from the X server: check they are resolved as with a linear scan.
+ */
+static void
+test_key_aliases_resolution(void)
+{
+    struct xkb_context *context = test_get_context(CONTEXT_NO_FLAG);
+    assert(context);
+
+    const char keymap_str[] =
+        "xkb_keymap {\n"
+        "  xkb_keycodes {\n"
+        "    <A> = 10;\n"
+        "    <B> = 11;\n"
+        "    <C> = 12;\n"
+        "  };\n"
+        "};";
+    struct xkb_keymap * const keymap =
+        test_compile_string(context, XKB_KEYMAP_FORMAT_TEXT_V1, keymap_str);
+    assert(keymap);
+
+#define atom(name) xkb_atom_intern_literal(context, name)
+    const struct xkb_key_alias aliases[] = {
+        { .alias = atom("X"), .real = atom("B") },
+        /* Duplicate: the first alias wins */
+        { .alias = atom("X"), .real = atom("C") },
+        /* Chain with a following alias */
+        { .alias = atom("Y"), .real = atom("Z") },
+        { .alias = atom("Z"), .real = atom("C") },
+        /* Alias shadowing a canonical name */
+        { .alias = atom("A"), .real = atom("B") },
+        /* No chain with a previous alias */
+        { .alias = atom("W"), .real = atom("A") },
+        { .alias = atom("U"), .real = atom("X") },
+    };
+#undef atom
+    free(keymap->key_aliases);
+    keymap->key_aliases = malloc(sizeof(aliases));
+    assert(keymap->key_aliases);
+    memcpy(keymap->key_aliases, aliases, sizeof(aliases));
+    keymap->num_key_aliases = ARRAY_SIZE(aliases);
+
+    static const struct {
+        const char *name;
+        xkb_keycode_t keycode;
+    } tests[] = {
+        { "A", 11 },
+        { "B", 11 },
+        { "C", 12 },
+        { "X", 11 },
+        { "Y", 12 },
+        { "Z", 12 },
+        { "W", 10 },
+        { "U", XKB_KEYCODE_INVALID },
+        { "V", XKB_KEYCODE_INVALID },
+    };
+    for (size_t t = 0; t < ARRAY_SIZE(tests); t++) {
+        fprintf(stderr, "------\n*** %s: #%zu: %s ***\n",
+                __func__, t, tests[t].name);
+        assert(xkb_keymap_key_by_name(keymap, tests[t].name) ==
+               tests[t].keycode);
+    }
+
+    xkb_keymap_unref(keymap);
+    xkb_context_unref(context);
+}
+
+static void
+test_frozen_storage(void)
+{
+    struct xkb_context *context = test_get_context(CONTEXT_NO_FLAG);
+    assert(context);
+
+    struct xkb_keymap *keymap =
+        test_compile_rules(context, XKB_KEYMAP_FORMAT_TEXT_V1, "evdev",
+                           "pc104", "awesome,us", NULL, NULL);
+    assert(keymap);
+    assert(keymap->frozen);
+
+    /* The key data is stored in key order, after the key types entries */
+    const char *prev = keymap->frozen;
+    for (darray_size_t t = 0; t < keymap->num_types; t++) {
+        const struct xkb_key_type * const type = &keymap->types[t];
+        if (!type->num_entries)
+            continue;
+        assert((const char *) type->entries >= prev);
+        prev = (const char *) (type->entries + type->num_entries);
+    }
+    bool has_multiple_keysyms = false;
+    const struct xkb_key *key;
+    xkb_keys_foreach(key, keymap) {
+        if (!key->num_groups)
+            continue;
+        assert((const char *) key->groups >= prev);
+        prev = (const char *) (key->groups + key->num_groups);
+        for (xkb_layout_index_t g = 0; g < key->num_groups; g++) {
+            const struct xkb_level * const levels = key->groups[g].levels;
+            assert((const char *) levels >= prev);
+            prev = (const char *) (levels + XkbKeyNumLevels(key, g));
+        }
+        for (xkb_layout_index_t g = 0; g < key->num_groups; g++) {
+            for (xkb_level_index_t l = 0; l < XkbKeyNumLevels(key, g); l++) {
+                const struct xkb_level * const leveli =
+                    &key->groups[g].levels[l];
+                if (leveli->num_syms > 1) {
+                    assert((const char *) leveli->s.syms >= prev);
+                    prev = (const char *) (leveli->s.syms + leveli->num_syms);
+                    has_multiple_keysyms = true;
+                }
+                if (leveli->num_actions > 1) {
+                    assert((const char *) leveli->a.actions >= prev);
+                    prev = (const char *) (leveli->a.actions +
+                                           leveli->num_actions);
+                }
+            }
+        }
+    }
+    assert(has_multiple_keysyms);
+
+    /* Lookups are unchanged */
+    const xkb_keysym_t *keysyms;
+    const xkb_keycode_t kc = xkb_keymap_key_by_name(keymap, "AD01");
+    assert(xkb_keymap_key_get_syms_by_level(keymap, kc, 0, 0, &keysyms) == 3);
+    assert(keysyms[0] == 'q' && keysyms[1] == 'a' && keysyms[2] == 'b');
+    assert(xkb_keymap_key_get_syms_by_level(keymap, kc, 1, 1, &keysyms) == 1);
+    assert(keysyms[0] == 'Q');
+
+    xkb_keymap_unref(keymap);
+    xkb_context_unref(context);
+}
+
 static void
 test_multiple_actions_per_level(void)
 {
@@ -651,14 +865,14 @@ test_keynames_atoms(void)
             .rules = "base",
             .max_keycode = 255,
             .num_aliases = 63,
-            .num_atoms = 484,
+            .num_atoms = 471,
             .num_key_names = 325,
         },
         {
             .rules = "evdev",
             .max_keycode = 569,
             .num_aliases = 33,
-            .num_atoms = 501,
+            .num_atoms = 461,
             .num_key_names = 305,
         },
     };
@@ -726,6 +940,50 @@ test_keynames_atoms(void)
     }
 }
 
+/*
+ * Aliases are serialized in definition order, whatever the order of interning
+ * of their names. The section `aliases(qwertz)` defines <LatZ> before <LatY>,
+ * while the default section `aliases(qwerty)` defines them the other way round.
+ */
+static void
+test_key_aliases_order(void)
+{
+    char *ref = NULL;
+    /* Whether to intern the qwerty aliases before compiling the keymap */
+    for (int intern_qwerty = 0; intern_qwerty <= 1; intern_qwerty++) {
+        struct xkb_context *context = test_get_context(CONTEXT_NO_FLAG);
+        assert(context);
+        struct xkb_keymap *keymap;
+
+        if (intern_qwerty) {
+            keymap = test_compile_rules(context, XKB_KEYMAP_FORMAT_TEXT_V1,
+                                        "evdev", "pc104", "us", NULL, NULL);
+            assert(keymap);
+            xkb_keymap_unref(keymap);
+        }
+
+        keymap = test_compile_rules(context, XKB_KEYMAP_FORMAT_TEXT_V1,
+                                    "evdev", "pc104", "de,us,de", NULL, NULL);
+        assert(keymap);
+        char * const got =
+            xkb_keymap_get_as_string(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT);
+        assert(got);
+        const char * const lat_z = strstr(got, "alias <LatZ> = <AD06>;");
+        const char * const lat_y = strstr(got, "alias <LatY> = <AB01>;");
+        assert(lat_z && lat_y && lat_z < lat_y);
+        if (ref) {
+            assert_streq_not_null("aliases order", ref, got);
+            free(got);
+        } else {
+            ref = got;
+        }
+
+        xkb_keymap_unref(keymap);
+        xkb_context_unref(context);
+    }
+    free(ref);
+}
+
 static void
 test_key_iterator(void)
 {
@@ -871,6 +1129,66 @@ test_key_iterator(void)
     xkb_context_unref(context);
 }
 
+/* Sparse high keycodes, looked up with the high keys hash table */
+static void
+test_high_keycodes(void)
+{
+    struct xkb_context *context = test_get_context(CONTEXT_NO_FLAG);
+    assert(context);
+
+    /* Sparse keycodes sharing their low bits, plus the maximum keycode */
+#define HIGH_KEYS_COUNT 256
+    xkb_keycode_t keycodes[HIGH_KEYS_COUNT];
+    for (xkb_keycode_t k = 0; k < HIGH_KEYS_COUNT - 1; k++)
+        keycodes[k] = (k << 20) + 0x1000;
+    keycodes[HIGH_KEYS_COUNT - 1] = XKB_KEYCODE_MAX;
+
+    char buf[HIGH_KEYS_COUNT * 64];
+    size_t len = 0;
+    len += snprintf(buf + len, sizeof(buf) - len,
+                    "xkb_keymap {\n  xkb_keycodes {\n    <1> = 1;\n");
+    for (size_t k = 0; k < HIGH_KEYS_COUNT; k++)
+        len += snprintf(buf + len, sizeof(buf) - len,
+                        "    <K%zu> = %"PRIu32";\n", k, keycodes[k]);
+    len += snprintf(buf + len, sizeof(buf) - len, "  };\n  xkb_symbols {\n");
+    for (size_t k = 0; k < HIGH_KEYS_COUNT; k++)
+        len += snprintf(buf + len, sizeof(buf) - len,
+                        "    key <K%zu> {[U%zx]};\n", k, 0x1000 + k);
+    len += snprintf(buf + len, sizeof(buf) - len, "  };\n};");
+    assert(len < sizeof(buf));
+
+    struct xkb_keymap * const keymap =
+        test_compile_string(context, XKB_KEYMAP_FORMAT_TEXT_V1, buf);
+    assert(keymap);
+    assert(keymap->num_keys_low == 2);
+    assert(keymap->num_keys == 2 + HIGH_KEYS_COUNT);
+    assert(keymap->high_keys);
+
+    /* Hits */
+    for (size_t k = 0; k < HIGH_KEYS_COUNT; k++) {
+        const struct xkb_key * const key = XkbKey(keymap, keycodes[k]);
+        assert(key);
+        assert(key->keycode == keycodes[k]);
+        const xkb_keysym_t *keysyms;
+        assert(xkb_keymap_key_get_syms_by_level(keymap, keycodes[k], 0, 0,
+                                                &keysyms) == 1);
+        assert(keysyms[0] == xkb_utf32_to_keysym(0x1000 + k));
+    }
+
+    /* Misses */
+    for (xkb_keycode_t k = 0; k < HIGH_KEYS_COUNT - 1; k++) {
+        assert(!XkbKey(keymap, keycodes[k] + 1));
+        assert(!XkbKey(keymap, keycodes[k] - 1));
+    }
+    assert(!XkbKey(keymap, (HIGH_KEYS_COUNT << 20) + 0x1000));
+    assert(!XkbKey(keymap, XKB_KEYCODE_MAX - 1));
+    assert(!XkbKey(keymap, XKB_KEYCODE_INVALID));
+#undef HIGH_KEYS_COUNT
+
+    xkb_keymap_unref(keymap);
+    xkb_context_unref(context);
+}
+
 /*
  * Github issue 934: commit b09aa7c6d8440e1690619239fe57e5f12374af0d introduced
  * a segfault while trying to optimize key aliases allocation.
@@ -1052,9 +1370,13 @@ main(int argc, char *argv[])
     test_no_extra_groups();
     test_numeric_keysyms();
     test_multiple_keysyms_per_level();
+    test_key_aliases_resolution();
+    test_frozen_storage();
     test_multiple_actions_per_level();
     test_keynames_atoms();
+    test_key_aliases_order();
     test_key_iterator();
+    test_high_keycodes();
     test_issue_934();
     test_serialize_layouts_subset(update_output_files);
 
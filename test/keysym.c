@@ -26,6 +26,8 @@
 #include "test/keysym.h"
 #include "utils.h"
 #include "utils-numbers.h"
+#include "utf8.h"
+#include "utf8-decoding.h"
 
 /* Explicit ordered list of modifier keysyms */
 static const xkb_keysym_t modifier_keysyms[] = {
@@ -162,6 +164,127 @@ test_keysym(xkb_keysym_t keysym, const char *expected)
     return streq(s, expected);
 }
 
+static void
+test_bulk_names(void)
+{
+    /* Names -> keysyms */
+    const char * const names[] = {
+        "a", "A", NULL, "xf86screensaver", "U1F600", "0x12345678", "invalid",
+        "Cyrillic_EM", "NoSymbol"
+    };
+    xkb_keysym_t keysyms[ARRAY_SIZE(names)];
+    for (int icase = 0; icase <= 1; icase++) {
+        const enum xkb_keysym_flags flags = (icase)
+            ? XKB_KEYSYM_CASE_INSENSITIVE
+            : XKB_KEYSYM_NO_FLAGS;
+        int expected_count = 0;
+        for (size_t k = 0; k < ARRAY_SIZE(names); k++) {
+            if (names[k] &&
+                xkb_keysym_from_name(names[k], flags) != XKB_KEY_NoSymbol)
+                expected_count++;
+        }
+        assert(xkb_keysyms_from_names(names, ARRAY_SIZE(names), flags,
+                                      keysyms) == expected_count);
+        for (size_t k = 0; k < ARRAY_SIZE(names); k++) {
+            assert(keysyms[k] == (names[k]
+                                  ? xkb_keysym_from_name(names[k], flags)
+                                  : XKB_KEY_NoSymbol));
+        }
+    }
+    assert(keysyms[3] == XKB_KEY_XF86Screensaver);
+    assert(keysyms[7] == XKB_KEY_Cyrillic_em);
+    assert(xkb_keysyms_from_names(names, ARRAY_SIZE(names), 0xff, keysyms) == -1);
+
+    /* Keysyms -> names */
+    const xkb_keysym_t keysyms2[] = {
+        XKB_KEY_a, 0x0101f600, 0xffffffff, 0x12345678, XKB_KEY_Cyrillic_em
+    };
+    const char *names2[ARRAY_SIZE(keysyms2)];
+    char arena[32];
+    const int required = (int) (sizeof("U1F600") + sizeof("0x12345678"));
+    assert(xkb_keysyms_get_names(keysyms2, ARRAY_SIZE(keysyms2), names2,
+                                 NULL, 0) == required);
+    assert(xkb_keysyms_get_names(keysyms2, ARRAY_SIZE(keysyms2), names2,
+                                 arena, sizeof(arena)) == required);
+    assert_streq_not_null("keysyms_get_names", "a", names2[0]);
+    assert_streq_not_null("keysyms_get_names", "U1F600", names2[1]);
+    assert(names2[2] == NULL);
+    assert_streq_not_null("keysyms_get_names", "0x12345678", names2[3]);
+    assert_streq_not_null("keysyms_get_names", "Cyrillic_em", names2[4]);
+    /* Names that do not fit */
+    assert(xkb_keysyms_get_names(keysyms2, ARRAY_SIZE(keysyms2), names2,
+                                 arena, sizeof("U1F600") + 1) == required);
+    assert_streq_not_null("keysyms_get_names", "U1F600", names2[1]);
+    assert(names2[3] == NULL);
+    assert_streq_not_null("keysyms_get_names", "Cyrillic_em", names2[4]);
+
+    /* Consistency with the single keysym functions */
+    struct xkb_keysym_iterator *iter = xkb_keysym_iterator_new(false);
+    while (xkb_keysym_iterator_next(iter)) {
+        const xkb_keysym_t ks = xkb_keysym_iterator_get_keysym(iter);
+        char name[XKB_KEYSYM_NAME_MAX_SIZE];
+        const char *name2 = NULL;
+        xkb_keysym_get_name(ks, name, sizeof(name));
+        assert(xkb_keysyms_get_names(&ks, 1, &name2, arena, sizeof(arena)) >= 0);
+        assert_streq_not_null("keysyms_get_names", name, name2);
+        /* Case-insensitive lookup always finds a match */
+        assert_printf(ks == XKB_KEY_NoSymbol ||
+                      xkb_keysym_from_name(name, XKB_KEYSYM_CASE_INSENSITIVE) !=
+                      XKB_KEY_NoSymbol, "%s\n", name);
+    }
+    iter = xkb_keysym_iterator_unref(iter);
+}
+
+static void
+test_keysyms_to_utf8(void)
+{
+    const xkb_keysym_t keysyms[] = {
+        XKB_KEY_a, XKB_KEY_Shift_L, XKB_KEY_Cyrillic_em, XKB_KEY_EuroSign,
+        XKB_KEY_NoSymbol, 0x0101f600 /* U+1F600 */, XKB_KEY_KP_Space
+    };
+    const char expected[] = "aм€\xf0\x9f\x98\x80 ";
+    char buffer[32];
+
+    /* Query the required size */
+    assert(xkb_keysyms_to_utf8(keysyms, ARRAY_SIZE(keysyms), NULL, 0) ==
+           (int) strlen(expected));
+    assert(xkb_keysyms_to_utf8(keysyms, 0, buffer, sizeof(buffer)) == 0);
+    assert(buffer[0] == '\0');
+    assert(xkb_keysyms_to_utf8(keysyms + 1, 1, buffer, sizeof(buffer)) == 0);
+    assert(buffer[0] == '\0');
+
+    /* Full conversion */
+    assert(xkb_keysyms_to_utf8(keysyms, ARRAY_SIZE(keysyms),
+                               buffer, sizeof(buffer)) ==
+           (int) strlen(expected));
+    assert_streq_not_null("xkb_keysyms_to_utf8", expected, buffer);
+
+    /* Consistent with xkb_keysym_to_utf8() for every keysym */
+    for (size_t k = 0; k < ARRAY_SIZE(keysyms); k++) {
+        char single[XKB_KEYSYM_UTF8_MAX_SIZE];
+        const int ret = xkb_keysym_to_utf8(keysyms[k], single, sizeof(single));
+        assert(xkb_keysyms_to_utf8(&keysyms[k], 1, buffer, sizeof(buffer)) ==
+               (ret > 0 ? ret - 1 : 0));
+        assert(ret <= 0 || streq(single, buffer));
+    }
+
+    /* Truncation never splits a UTF-8 sequence */
+    for (size_t size = 1; size <= strlen(expected) + 1; size++) {
+        memset(buffer, 0x7f, sizeof(buffer));
+        assert(xkb_keysyms_to_utf8(keysyms, ARRAY_SIZE(keysyms),
+                                   buffer, size) == (int) strlen(expected));
+        const size_t length = strlen(buffer);
+        assert(length < size);
+        assert(strncmp(buffer, expected, length) == 0);
+        assert(is_valid_utf8(buffer, length));
+        /* The next character did not fit */
+        if (length < strlen(expected)) {
+            const uint8_t next = utf8_sequence_length(expected + length);
+            assert(next > 0 && length + (size_t) next >= size);
+        }
+    }
+}
+
 static bool
 test_deprecated(xkb_keysym_t keysym, const char *name,
                 bool expected_deprecated, const char *expected_reference)
@@ -859,6 +982,9 @@ main(void)
     assert(xkb_utf8_to_keysym("1", 2) == XKB_KEY_1);
     assert(xkb_utf8_to_keysym("12", 2) == XKB_KEY_1); /* Only first codepoint */
 
+    test_bulk_names();
+    test_keysyms_to_utf8();
+
     /* Latin-1 keysyms (1:1 mapping in UTF-32) */
     assert(test_utf8(0x0020, "\x20"));
     assert(test_utf8(0x007e, "\x7e"));
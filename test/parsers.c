@@ -0,0 +1,257 @@
+/*
+ * Copyright © 2026 agent <agent@local>
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Check that the bison parser and the recursive descent parser accept the
+ * same language and produce the same keymaps.
+ */
+
+#include "config.h"
+#include "test-config.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "xkbcommon/xkbcommon.h"
+#include "context.h"
+#include "test.h"
+#include "utils.h"
+
+static char *
+compile_to_string(struct xkb_context *ctx, enum xkb_parser parser,
+                  enum xkb_keymap_format format, const char *string)
+{
+    xkb_context_set_parser(ctx, parser);
+    struct xkb_keymap * const keymap =
+        test_compile_string(ctx, format, string);
+    if (!keymap)
+        return NULL;
+    char * const dump =
+        xkb_keymap_get_as_string(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT);
+    assert(dump);
+    xkb_keymap_unref(keymap);
+    return dump;
+}
+
+/* Compile with both parsers; returns whether the compilation succeeded */
+static bool
+compare_parsers(struct xkb_context *ctx, enum xkb_keymap_format format,
+                const char *string)
+{
+    char * const bison =
+        compile_to_string(ctx, XKB_PARSER_BISON, format, string);
+    char * const descent =
+        compile_to_string(ctx, XKB_PARSER_DESCENT, format, string);
+    const bool ok = !!bison;
+    if (!bison != !descent || (bison && strcmp(bison, descent) != 0)) {
+        fprintf(stderr, "ERROR: parsers mismatch for:\n%s\n"
+                "bison:\n%s\ndescent:\n%s\n",
+                string, bison ? bison : "(failure)",
+                descent ? descent : "(failure)");
+        assert(!"parsers mismatch");
+    }
+    free(bison);
+    free(descent);
+    return ok;
+}
+
+static void
+test_keymap_files(struct xkb_context *ctx)
+{
+    static const char *files[] = {
+        "keymaps/basic.xkb",
+        "keymaps/comprehensive-plus-geom.xkb",
+        "keymaps/compat-interpret.xkb",
+        "keymaps/digits.xkb",
+        "keymaps/divide-by-zero.xkb",
+        "keymaps/empty-compound-statements.xkb",
+        "keymaps/empty-symbol-decl.xkb",
+        "keymaps/escape-sequences.xkb",
+        "keymaps/explicit-actions.xkb",
+        "keymaps/host.xkb",
+        "keymaps/integers.xkb",
+        "keymaps/integers-overflow.xkb",
+        "keymaps/invalid-escape-sequence.xkb",
+        "keymaps/level-index-names.xkb",
+        "keymaps/masks.xkb",
+        "keymaps/modmap-key+keysym-v1.xkb",
+        "keymaps/modmap-key+keysym-v2.xkb",
+        "keymaps/overlays-v2-1.xkb",
+        "keymaps/quartz.xkb",
+        "keymaps/string-as-keysyms.xkb",
+        "keymaps/stringcomp-v1.xkb",
+        "keymaps/stringcomp-v2.xkb",
+        "keymaps/symbols-modifier_map.xkb",
+        "keymaps/symbols-multi-actions.xkb",
+        "keymaps/symbols-multi-keysyms.xkb",
+        "keymaps/symbols-multi-keysyms-empty.xkb",
+        "keymaps/syntax-error.xkb",
+        "keymaps/syntax-error2.xkb",
+        "keymaps/unicode-keysyms.xkb",
+    };
+    for (size_t f = 0; f < ARRAY_SIZE(files); f++) {
+        char * const string = test_read_file(files[f]);
+        assert(string);
+        fprintf(stderr, "------\n*** %s: %s ***\n", __func__, files[f]);
+        compare_parsers(ctx, XKB_KEYMAP_FORMAT_TEXT_V1, string);
+        compare_parsers(ctx, XKB_KEYMAP_FORMAT_TEXT_V2, string);
+        free(string);
+    }
+}
+
+static void
+test_rules(struct xkb_context *ctx)
+{
+    /* Exercise the parsing of the files from the include path */
+    static const struct xkb_rule_names names[] = {
+        { .rules = "evdev", .model = "pc105", .layout = "us" },
+        {
+            .rules = "evdev", .model = "pc104",
+            .layout = "us,de,ru,il", .variant = ",,phonetic,",
+            .options = "grp:alt_shift_toggle,ctrl:nocaps,compose:ralt"
+        },
+    };
+    for (size_t n = 0; n < ARRAY_SIZE(names); n++) {
+        char *dumps[2] = { NULL, NULL };
+        const enum xkb_parser parsers[] = {
+            XKB_PARSER_BISON, XKB_PARSER_DESCENT
+        };
+        for (size_t p = 0; p < ARRAY_SIZE(parsers); p++) {
+            xkb_context_set_parser(ctx, parsers[p]);
+            struct xkb_keymap * const keymap =
+                xkb_keymap_new_from_names(ctx, &names[n],
+                                          XKB_KEYMAP_COMPILE_NO_FLAGS);
+            assert(keymap);
+            dumps[p] = xkb_keymap_get_as_string(keymap,
+                                                XKB_KEYMAP_USE_ORIGINAL_FORMAT);
+            assert(dumps[p]);
+            xkb_keymap_unref(keymap);
+        }
+        assert_streq_not_null("parsers", dumps[0], dumps[1]);
+        free(dumps[0]);
+        free(dumps[1]);
+    }
+}
+
+static void
+test_syntax(struct xkb_context *ctx)
+{
+    static const struct {
+        const char *keymap;
+        bool valid;
+    } tests[] = {
+        { "", false },
+        { "xkb_keymap {};", true },
+        { "xkb_keymap {}; xkb_keymap {};", false },
+        { "xkb_keymap {}", false },
+        { "default partial xkb_keymap \"x\" { xkb_keycodes {}; };", true },
+        { "xkb_keymap { xkb_keycodes { <a> = 9; alias <b> = <a>; }; };",
+          true },
+        { "xkb_keymap { xkb_keycodes { <a> = 9 }; };", false },
+        { "xkb_keymap { xkb_keycodes { <a> = -1; }; };", false },
+        /* Expressions precedence and associativity */
+        {
+            "xkb_keymap {\n"
+            "  xkb_keycodes { <a> = 9; <b> = 10; };\n"
+            "  xkb_types {\n"
+            "    virtual_modifiers A = 0x100 + 0x10 - 0x1, B = ~0x1 - 0xf0;\n"
+            "    type \"t\" {\n"
+            "      modifiers = Shift + Lock - Lock;\n"
+            "      map[Shift] = 16 / 2 / 2 - 1 - 1 * -(2 - 1) * 1 - 2;\n"
+            "      level_name[1] = \"1\"; level_name[2] = \"2\";\n"
+            "    };\n"
+            "  };\n"
+            "  xkb_compat {\n"
+            "    interpret.useModMapMods = AnyLevel;\n"
+            "    interpret a + AnyOf(all) { action = SetMods(mods=A); };\n"
+            "    interpret \"b\" { action = {}; };\n"
+            "    interpret 0x100 { action = { NoAction(), NoAction() }; };\n"
+            "    indicator \"x\" { !allowExplicit; modifiers = Shift; };\n"
+            "    group 2 = Mod5;\n"
+            "  };\n"
+            "  xkb_symbols {\n"
+            "    name[1] = \"x\";\n"
+            "    key <a> { [a, {b, c}, \"de\", {}], [SetMods(mods=A)] };\n"
+            "    key <b> { [{}, {SetMods(mods=B), NoAction()}], repeat = Yes };\n"
+            "    key <c> { symbols[2] = [section, 1, 0x61], repeat = No };\n"
+            "    key <d> { [{}, {}], [, x] };\n"
+            "    modifier_map Mod1 { <a>, b, \"c\" };\n"
+            "  };\n"
+            "};",
+            true
+        },
+        /* Leading comma in lists */
+        {
+            "xkb_keymap {\n"
+            "  xkb_compat { interpret a { action = SetMods(,mods=Shift); }; };\n"
+            "};",
+            true
+        },
+        /* Unknown statements: parsed, then rejected by the strict mode */
+        {
+            "xkb_keymap {\n"
+            "  xkb_keycodes { foo 1 = 2; bar { x = 1; }; baz \"x\" {}; };\n"
+            "};",
+            false
+        },
+        /* Geometry */
+        {
+            "xkb_keymap {\n"
+            "  xkb_geometry \"g\" {\n"
+            "    width = 1.5; description = \"x\";\n"
+            "    shape \"s\" { corner = 1, { [0, 0], [1.5, -2] } };\n"
+            "    shape \"t\" { [0, 0], [1, 1] };\n"
+            "    solid \"x\" { shape = \"s\"; };\n"
+            "    text \"t\" { text = \"x\"; };\n"
+            "    section \"s\" {\n"
+            "      top = 1;\n"
+            "      row { top = 1; keys { <a>, { <b>, \"s\", 1 } }; };\n"
+            "      overlay \"o\" { <a> = <b>, <c> = <d> };\n"
+            "      indicator \"i\" { onColor = \"red\"; };\n"
+            "    };\n"
+            "    indicator.onColor = \"green\";\n"
+            "    key.gap = 1;\n"
+            "  };\n"
+            "};",
+            true
+        },
+        { "xkb_keymap { xkb_geometry { width = 1,2; }; };", false },
+        { "xkb_keymap { xkb_geometry { shape \"s\" {}; }; };", false },
+        /* Invalid */
+        { "xkb_keymap { xkb_symbols { key <a> { [a] } }; };", false },
+        { "xkb_keymap { xkb_symbols { key <a> { [a, SetMods()] }; }; };",
+          false },
+        { "xkb_keymap { xkb_symbols { key <a> { [,] }; }; };", false },
+        { "xkb_keymap { xkb_compat { interpret { }; }; };", false },
+        { "xkb_keymap { xkb_types { type \"x\" { a = ; }; }; };", false },
+        { "xkb_keymap { xkb_types { type \"x\" { a = (1; }; }; };", false },
+        { "xkb_keymap { xkb_types { 1 = 2; }; };", false },
+        { "xkb_keymap { xkb_keycodes { <a> = 1; } ; ", false },
+    };
+
+    for (size_t k = 0; k < ARRAY_SIZE(tests); k++) {
+        fprintf(stderr, "------\n*** %s: #%zu ***\n", __func__, k);
+        assert(compare_parsers(ctx, XKB_KEYMAP_FORMAT_TEXT_V2,
+                               tests[k].keymap) == tests[k].valid);
+    }
+}
+
+int
+main(void)
+{
+    test_init();
+
+    struct xkb_context * const ctx = test_get_context(CONTEXT_NO_FLAG);
+    assert(ctx);
+
+    test_keymap_files(ctx);
+    test_rules(ctx);
+    test_syntax(ctx);
+
+    xkb_context_unref(ctx);
+    return EXIT_SUCCESS;
+}
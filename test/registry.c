@@ -248,6 +248,7 @@ test_remove_rules(char *basedir, const char *ruleset)
 
 static struct rxkb_context *
 test_setup_context_for(const char *ruleset,
+                       enum rxkb_context_flags flags,
                        struct test_model *system_models,
                        struct test_model *user_models,
                        struct test_layout *system_layouts,
@@ -264,7 +265,7 @@ test_setup_context_for(const char *ruleset,
         userdir = test_create_rules(ruleset, user_models, user_layouts,
                                     user_groups);
 
-    ctx = rxkb_context_new(RXKB_CONTEXT_NO_DEFAULT_INCLUDES);
+    ctx = rxkb_context_new(RXKB_CONTEXT_NO_DEFAULT_INCLUDES | flags);
     assert(ctx);
     if (userdir)
         assert(rxkb_context_include_path_append(ctx, userdir));
@@ -287,7 +288,7 @@ test_setup_context(struct test_model *system_models,
                    struct test_option_group *user_groups)
 {
     const char *ruleset = "xkbtests";
-    return test_setup_context_for(ruleset, system_models,
+    return test_setup_context_for(ruleset, RXKB_CONTEXT_NO_FLAGS, system_models,
                                   user_models, system_layouts,
                                   user_layouts, system_groups,
                                   user_groups);
@@ -1122,6 +1123,331 @@ test_xml_error_handler(void)
     xmlCleanupParser();
 }
 
+static bool
+cmp_layout_items(struct rxkb_layout *a, struct rxkb_layout *b)
+{
+    if (!streq(rxkb_layout_get_name(a), rxkb_layout_get_name(b)) ||
+        !streq_null(rxkb_layout_get_variant(a), rxkb_layout_get_variant(b)) ||
+        !streq_null(rxkb_layout_get_brief(a), rxkb_layout_get_brief(b)) ||
+        !streq_null(rxkb_layout_get_description(a),
+                    rxkb_layout_get_description(b)) ||
+        rxkb_layout_get_popularity(a) != rxkb_layout_get_popularity(b))
+        return false;
+
+    struct rxkb_iso639_code *la = rxkb_layout_get_iso639_first(a);
+    struct rxkb_iso639_code *lb = rxkb_layout_get_iso639_first(b);
+    for (; la && lb;
+         la = rxkb_iso639_code_next(la), lb = rxkb_iso639_code_next(lb)) {
+        if (!streq(rxkb_iso639_code_get_code(la), rxkb_iso639_code_get_code(lb)))
+            return false;
+    }
+    if (la || lb)
+        return false;
+
+    struct rxkb_iso3166_code *ca = rxkb_layout_get_iso3166_first(a);
+    struct rxkb_iso3166_code *cb = rxkb_layout_get_iso3166_first(b);
+    for (; ca && cb;
+         ca = rxkb_iso3166_code_next(ca), cb = rxkb_iso3166_code_next(cb)) {
+        if (!streq(rxkb_iso3166_code_get_code(ca),
+                   rxkb_iso3166_code_get_code(cb)))
+            return false;
+    }
+    return !ca && !cb;
+}
+
+/* Check that two contexts have the same items, with the same descriptions */
+static bool
+cmp_contexts(struct rxkb_context *eager, struct rxkb_context *lazy)
+{
+    struct rxkb_model *ma = rxkb_model_first(eager);
+    struct rxkb_model *mb = rxkb_model_first(lazy);
+    for (; ma && mb; ma = rxkb_model_next(ma), mb = rxkb_model_next(mb)) {
+        if (!streq(rxkb_model_get_name(ma), rxkb_model_get_name(mb)) ||
+            !streq_null(rxkb_model_get_vendor(ma), rxkb_model_get_vendor(mb)) ||
+            !streq_null(rxkb_model_get_description(ma),
+                        rxkb_model_get_description(mb)))
+            return false;
+    }
+    if (ma || mb)
+        return false;
+
+    struct rxkb_layout *la = rxkb_layout_first(eager);
+    struct rxkb_layout *lb = rxkb_layout_first(lazy);
+    for (; la && lb; la = rxkb_layout_next(la), lb = rxkb_layout_next(lb)) {
+        if (!cmp_layout_items(la, lb))
+            return false;
+    }
+    if (la || lb)
+        return false;
+
+    struct rxkb_option_group *ga = rxkb_option_group_first(eager);
+    struct rxkb_option_group *gb = rxkb_option_group_first(lazy);
+    for (; ga && gb;
+         ga = rxkb_option_group_next(ga), gb = rxkb_option_group_next(gb)) {
+        if (!streq(rxkb_option_group_get_name(ga),
+                   rxkb_option_group_get_name(gb)) ||
+            !streq_null(rxkb_option_group_get_description(ga),
+                        rxkb_option_group_get_description(gb)))
+            return false;
+
+        struct rxkb_option *oa = rxkb_option_first(ga);
+        struct rxkb_option *ob = rxkb_option_first(gb);
+        for (; oa && ob; oa = rxkb_option_next(oa), ob = rxkb_option_next(ob)) {
+            if (!streq(rxkb_option_get_name(oa), rxkb_option_get_name(ob)) ||
+                !streq_null(rxkb_option_get_description(oa),
+                            rxkb_option_get_description(ob)) ||
+                rxkb_option_is_layout_specific(oa) !=
+                rxkb_option_is_layout_specific(ob))
+                return false;
+        }
+        if (oa || ob)
+            return false;
+    }
+
+    return !ga && !gb;
+}
+
+/*
+ * Check that the real-world registry files parsed with the given flags give
+ * the same result as a plain parsing. The extra include path, if any, is
+ * appended only to the context with the flags.
+ */
+static void
+cmp_contexts_real_world(enum rxkb_context_flags flags,
+                        const char *extra_include_path)
+{
+    char *path = test_get_path("");
+    assert(path);
+    const enum rxkb_context_flags common = RXKB_CONTEXT_NO_DEFAULT_INCLUDES
+                                         | RXKB_CONTEXT_LOAD_EXOTIC_RULES;
+    struct rxkb_context * const ref = rxkb_context_new(common);
+    struct rxkb_context * const ctx = rxkb_context_new(common | flags);
+    assert(ref && ctx);
+    assert(rxkb_context_include_path_append(ref, path));
+    assert(rxkb_context_include_path_append(ctx, path));
+    if (extra_include_path)
+        assert(rxkb_context_include_path_append(ctx, extra_include_path));
+    assert(rxkb_context_parse(ref, "evdev"));
+    assert(rxkb_context_parse(ctx, "evdev"));
+    assert(cmp_contexts(ref, ctx));
+    rxkb_context_unref(ref);
+    rxkb_context_unref(ctx);
+    free(path);
+}
+
+/*
+ * Create a context with flags from a fixture of system and user files, with
+ * duplicates, variants, ISO codes and options.
+ */
+static struct rxkb_context *
+test_setup_merged_context(enum rxkb_context_flags flags)
+{
+    struct test_layout system_layouts[] =  {
+        {"l1", NO_VARIANT, "lbrief1", "ldesc1",
+            .iso639 = { "abc", "def" },
+            .iso3166 = { "uv", "wx" }},
+        {"l1", "v1", NULL, "vdesc1",
+            .iso639 = {"efg"}},
+        {"l2", NO_VARIANT, "lbrief2", "ldesc2 &amp; more",
+            .iso639 = { "hij", "klm" },
+            .iso3166 = { "op", "qr" }},
+        {NULL},
+    };
+    struct test_layout user_layouts[] =  {
+        {"l2", NO_VARIANT, "ubrief2", "udesc2"},
+        {"l2", "v2", NULL, "uvdesc2"},
+        {"l3", NO_VARIANT, "ubrief3", "udesc3"},
+        {NULL},
+    };
+    struct test_model system_models[] =  {
+        {"m1", "vendor1", "desc1"},
+        {NULL},
+    };
+    struct test_model user_models[] =  {
+        {"m1", "vendor2", "desc2"},
+        {"m2", "vendor2", "desc2"},
+        {NULL},
+    };
+    struct test_option_group system_groups[] = {
+        {"grp1", "gdesc1", true,
+          { {"grp1:1", "odesc11"}, {"grp1:2", "odesc12"} } },
+        { NULL },
+    };
+
+    return test_setup_context_for("xkbtests", flags,
+                                  system_models, user_models,
+                                  system_layouts, user_layouts,
+                                  system_groups, NULL);
+}
+
+static void
+test_lazy_descriptions(void)
+{
+    /* Merged files */
+    struct rxkb_context *eager =
+        test_setup_merged_context(RXKB_CONTEXT_NO_FLAGS);
+    struct rxkb_context *lazy =
+        test_setup_merged_context(RXKB_CONTEXT_LAZY_DESCRIPTIONS);
+
+    /* Resolve a variant before its parent layout */
+    struct rxkb_layout *l = fetch_layout(lazy, "l2", "v2");
+    assert(streq(rxkb_layout_get_brief(l), "lbrief2"));
+    assert(streq(rxkb_iso639_code_get_code(rxkb_layout_get_iso639_first(l)),
+                 "hij"));
+    rxkb_layout_unref(l);
+    l = fetch_layout(lazy, "l2", NO_VARIANT);
+    assert(streq(rxkb_layout_get_description(l), "ldesc2 & more"));
+    rxkb_layout_unref(l);
+
+    assert(cmp_contexts(eager, lazy));
+    rxkb_context_unref(eager);
+    rxkb_context_unref(lazy);
+
+    /* Items referenced past the context are resolved on its destruction */
+    lazy = test_setup_merged_context(RXKB_CONTEXT_LAZY_DESCRIPTIONS);
+    l = fetch_layout(lazy, "l1", "v1");
+    struct rxkb_model *m = fetch_model(lazy, "m2");
+    struct rxkb_option_group *g = fetch_option_group(lazy, "grp1");
+    rxkb_context_unref(lazy);
+    assert(streq(rxkb_layout_get_brief(l), "lbrief1"));
+    assert(streq(rxkb_layout_get_description(l), "vdesc1"));
+    assert(streq(rxkb_iso639_code_get_code(rxkb_layout_get_iso639_first(l)),
+                 "efg"));
+    assert(streq(rxkb_model_get_vendor(m), "vendor2"));
+    assert(streq(rxkb_option_group_get_description(g), "gdesc1"));
+    assert(streq(rxkb_option_get_description(rxkb_option_first(g)),
+                 "odesc11"));
+    rxkb_layout_unref(l);
+    rxkb_model_unref(m);
+    rxkb_option_group_unref(g);
+
+    /* Real-world files */
+    cmp_contexts_real_world(RXKB_CONTEXT_LAZY_DESCRIPTIONS, NULL);
+}
+
+static void
+test_parallel_parsing(void)
+{
+    /* Merged files */
+    struct rxkb_context *serial =
+        test_setup_merged_context(RXKB_CONTEXT_NO_FLAGS);
+    struct rxkb_context *parallel =
+        test_setup_merged_context(RXKB_CONTEXT_PARALLEL_PARSING);
+    /* Duplicates are skipped as with sequential parsing */
+    struct rxkb_layout *l = fetch_layout(parallel, "l2", NO_VARIANT);
+    assert(streq(rxkb_layout_get_description(l), "ldesc2 & more"));
+    rxkb_layout_unref(l);
+    assert(cmp_contexts(serial, parallel));
+    rxkb_context_unref(serial);
+    rxkb_context_unref(parallel);
+
+    /* Real-world files, with an include path without rules */
+    cmp_contexts_real_world(RXKB_CONTEXT_PARALLEL_PARSING |
+                            RXKB_CONTEXT_LAZY_DESCRIPTIONS, "/tmp");
+}
+
+static void
+test_find(void)
+{
+    char *path = test_get_path("");
+    assert(path);
+    struct rxkb_context *ctx =
+        rxkb_context_new(RXKB_CONTEXT_NO_DEFAULT_INCLUDES |
+                         RXKB_CONTEXT_LOAD_EXOTIC_RULES);
+    assert(ctx);
+
+    /* Not parsed yet */
+    assert(!rxkb_layout_find(ctx, "us", NO_VARIANT));
+    assert(rxkb_layout_find_prefix(ctx, "", NULL, 0) == 0);
+
+    assert(rxkb_context_include_path_append(ctx, path));
+    assert(rxkb_context_parse(ctx, "evdev"));
+    free(path);
+
+    /* Exact lookups match the iteration */
+    size_t models = 0;
+    for (struct rxkb_model *m = rxkb_model_first(ctx); m;
+         m = rxkb_model_next(m), models++)
+        assert(rxkb_model_find(ctx, rxkb_model_get_name(m)) == m);
+    size_t layouts = 0;
+    for (struct rxkb_layout *l = rxkb_layout_first(ctx); l;
+         l = rxkb_layout_next(l), layouts++) {
+        assert(rxkb_layout_find(ctx, rxkb_layout_get_name(l),
+                                rxkb_layout_get_variant(l)) == l);
+    }
+    size_t groups = 0;
+    size_t options = 0;
+    for (struct rxkb_option_group *g = rxkb_option_group_first(ctx); g;
+         g = rxkb_option_group_next(g), groups++) {
+        assert(rxkb_option_group_find(ctx, rxkb_option_group_get_name(g)) == g);
+        for (struct rxkb_option *o = rxkb_option_first(g); o;
+             o = rxkb_option_next(o), options++) {
+            struct rxkb_option *found =
+                rxkb_option_find(ctx, rxkb_option_get_name(o));
+            assert(found);
+            assert(streq(rxkb_option_get_name(found), rxkb_option_get_name(o)));
+        }
+    }
+
+    struct rxkb_layout *l = rxkb_layout_find(ctx, "us", "intl");
+    assert(l);
+    assert(streq(rxkb_layout_get_variant(l), "intl"));
+    assert(!rxkb_layout_find(ctx, "us", "xxx"));
+    assert(!rxkb_layout_find(ctx, "xxx", NO_VARIANT));
+    assert(!rxkb_layout_find(ctx, NULL, NO_VARIANT));
+    assert(!rxkb_model_find(ctx, "xxx"));
+    assert(rxkb_option_find(ctx, "grp:alt_shift_toggle"));
+    assert(!rxkb_option_find(ctx, "grp"));
+    assert(!rxkb_option_group_find(ctx, "xxx"));
+
+    /* Prefix lookups */
+    assert(rxkb_model_find_prefix(ctx, "", NULL, 0) == models);
+    assert(rxkb_layout_find_prefix(ctx, "", NULL, 0) == layouts);
+    assert(rxkb_option_group_find_prefix(ctx, "", NULL, 0) <= groups);
+    assert(rxkb_option_find_prefix(ctx, NULL, NULL, 0) <= options);
+    assert(rxkb_layout_find_prefix(ctx, "xxx", NULL, 0) == 0);
+
+    size_t expected = 0;
+    for (l = rxkb_layout_first(ctx); l; l = rxkb_layout_next(l)) {
+        if (strncmp(rxkb_layout_get_name(l), "us", 2) == 0)
+            expected++;
+    }
+    struct rxkb_layout *found[1000];
+    const size_t count = rxkb_layout_find_prefix(ctx, "us", found,
+                                                 ARRAY_SIZE(found));
+    assert(count == expected);
+    assert(count > 1 && count <= ARRAY_SIZE(found));
+    assert(streq(rxkb_layout_get_name(found[0]), "us"));
+    assert(rxkb_layout_get_variant(found[0]) == NULL);
+    for (size_t k = 1; k < count; k++) {
+        const int cmp = strcmp(rxkb_layout_get_name(found[k - 1]),
+                               rxkb_layout_get_name(found[k]));
+        assert(cmp < 0 || (cmp == 0 && rxkb_layout_get_variant(found[k])));
+    }
+    /* Truncated */
+    assert(rxkb_layout_find_prefix(ctx, "us", found, 1) == count);
+
+    struct rxkb_option *grp[100];
+    const size_t grp_count = rxkb_option_find_prefix(ctx, "grp:", grp,
+                                                     ARRAY_SIZE(grp));
+    assert(grp_count > 0 && grp_count <= ARRAY_SIZE(grp));
+    for (size_t k = 0; k < grp_count; k++)
+        assert(strncmp(rxkb_option_get_name(grp[k]), "grp:", 4) == 0);
+
+    struct rxkb_option_group *grp_groups[10];
+    const size_t grp_groups_count =
+        rxkb_option_group_find_prefix(ctx, "grp", grp_groups,
+                                      ARRAY_SIZE(grp_groups));
+    assert(grp_groups_count > 0 && grp_groups_count <= ARRAY_SIZE(grp_groups));
+    assert(streq(rxkb_option_group_get_name(grp_groups[0]), "grp"));
+    for (size_t k = 0; k < grp_groups_count; k++) {
+        assert(strncmp(rxkb_option_group_get_name(grp_groups[k]),
+                       "grp", 3) == 0);
+    }
+
+    rxkb_context_unref(ctx);
+}
+
 int
 main(void)
 {
@@ -1141,6 +1467,9 @@ main(void)
     test_load_languages();
     test_load_invalid_languages();
     test_popularity();
+    test_lazy_descriptions();
+    test_parallel_parsing();
+    test_find();
 
     return 0;
 }
@@ -10,6 +10,11 @@
 #include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
+#if HAVE_MEMFD_CREATE
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+#endif
 
 #include "xkbcommon/xkbcommon.h"
 #include "test.h"
@@ -132,6 +137,331 @@ test_explicit_actions(struct xkb_context *ctx)
     free(expected);
 }
 
+struct stream_sink {
+    char *data;
+    size_t length;
+    size_t max_chunk;
+    size_t chunks;
+    size_t fail_after;
+};
+
+static bool
+stream_write(void *user_data, const char *data, size_t length)
+{
+    struct stream_sink * const sink = user_data;
+    if (sink->chunks++ >= sink->fail_after)
+        return false;
+    char * const new = realloc(sink->data, sink->length + length);
+    assert(new);
+    memcpy(new + sink->length, data, length);
+    sink->data = new;
+    sink->length += length;
+    if (length > sink->max_chunk)
+        sink->max_chunk = length;
+    return true;
+}
+
+static char *
+read_stream(FILE *file, size_t length)
+{
+    char * const data = calloc(length + 1, 1);
+    assert(data);
+    rewind(file);
+    assert(fread(data, 1, length + 1, file) == length);
+    return data;
+}
+
+static void
+test_serialize_stream(struct xkb_context *ctx)
+{
+    struct xkb_keymap * const keymap =
+        test_compile_rules(ctx, XKB_KEYMAP_FORMAT_TEXT_V2, NULL, NULL,
+                           "ru,ca,de,us", ",multix,neo,intl", NULL);
+    assert(keymap);
+
+    const enum xkb_keymap_serialize_flags flags[] = {
+        XKB_KEYMAP_SERIALIZE_NO_FLAGS,
+        TEST_KEYMAP_SERIALIZE_FLAGS,
+        TEST_KEYMAP_SERIALIZE_FLAGS | TEST_KEYMAP_SERIALIZE_EXPLICIT,
+    };
+    const enum xkb_keymap_format formats[] = {
+        XKB_KEYMAP_FORMAT_TEXT_V1, XKB_KEYMAP_FORMAT_TEXT_V2
+    };
+    for (size_t f = 0; f < ARRAY_SIZE(formats); f++) {
+        for (size_t k = 0; k < ARRAY_SIZE(flags); k++) {
+            const struct xkb_keymap_serialize_config config = {
+                .size = sizeof(config),
+                .flags = flags[k],
+                .format = formats[f],
+            };
+            struct xkb_keymap_serialize_result expected = {
+                .size = sizeof(expected)
+            };
+            assert(xkb_keymap_serialize(keymap, &config, &expected) ==
+                   XKB_SUCCESS);
+
+            /* Callback */
+            struct stream_sink sink = { .fail_after = SIZE_MAX };
+            struct xkb_keymap_serialize_result result = {
+                .size = sizeof(result)
+            };
+            assert(xkb_keymap_serialize_to_callback(keymap, &config,
+                                                    stream_write, &sink,
+                                                    &result) == XKB_SUCCESS);
+            assert(result.serialized == NULL);
+            assert(result.length == expected.length - 1);
+            assert(result.layouts == expected.layouts);
+            assert(sink.length == result.length);
+            assert(memcmp(sink.data, expected.serialized, sink.length) == 0);
+            /* The internal buffer is bounded */
+            assert(sink.chunks > 1);
+            assert(sink.max_chunk <= 2 * 4096);
+            free(sink.data);
+
+            /* Callback failure */
+            sink = (struct stream_sink) { .fail_after = 1 };
+            result = (struct xkb_keymap_serialize_result) {
+                .size = sizeof(result)
+            };
+            assert(xkb_keymap_serialize_to_callback(keymap, &config,
+                                                    stream_write, &sink,
+                                                    &result) ==
+                   XKB_ERROR_KEYMAP_SERIALIZATION_WRITE_FAILURE);
+            assert(result.serialized == NULL);
+            free(sink.data);
+
+            /* FILE */
+            FILE * const file = tmpfile();
+            assert(file);
+            result = (struct xkb_keymap_serialize_result) {
+                .size = sizeof(result)
+            };
+            assert(xkb_keymap_serialize_to_file(keymap, &config, file,
+                                                &result) == XKB_SUCCESS);
+            assert(result.length == expected.length - 1);
+            char *got = read_stream(file, result.length);
+            assert_streq_not_null("FILE stream", expected.serialized, got);
+            free(got);
+            fclose(file);
+
+            /* File descriptor */
+            FILE * const fd_file = tmpfile();
+            assert(fd_file);
+            result = (struct xkb_keymap_serialize_result) {
+                .size = sizeof(result)
+            };
+            assert(xkb_keymap_serialize_to_fd(keymap, &config,
+                                              fileno(fd_file),
+                                              &result) == XKB_SUCCESS);
+            assert(result.length == expected.length - 1);
+            got = read_stream(fd_file, result.length);
+            assert_streq_not_null("fd stream", expected.serialized, got);
+            free(got);
+            fclose(fd_file);
+
+            free(expected.serialized);
+        }
+    }
+
+    /* Invalid sinks */
+    const struct xkb_keymap_serialize_config config = {
+        .size = sizeof(config),
+        .format = XKB_KEYMAP_USE_ORIGINAL_FORMAT,
+    };
+    struct xkb_keymap_serialize_result result = { .size = sizeof(result) };
+    assert(xkb_keymap_serialize_to_callback(keymap, &config, NULL, NULL,
+                                            &result) ==
+           XKB_ERROR_KEYMAP_SERIALIZATION_WRITE_FAILURE);
+    assert(xkb_keymap_serialize_to_file(keymap, &config, NULL, &result) ==
+           XKB_ERROR_KEYMAP_SERIALIZATION_WRITE_FAILURE);
+    assert(xkb_keymap_serialize_to_fd(keymap, &config, -1, &result) ==
+           XKB_ERROR_KEYMAP_SERIALIZATION_WRITE_FAILURE);
+
+    xkb_keymap_unref(keymap);
+}
+
+/* Check that a compact serialization round-trips */
+static void
+check_compact_serialization(struct xkb_context *ctx, struct xkb_keymap *keymap,
+                            enum xkb_keymap_format format)
+{
+    char * const expected =
+        xkb_keymap_get_as_string2(keymap, format, XKB_KEYMAP_SERIALIZE_NO_FLAGS);
+    assert(expected);
+    char * const compact =
+        xkb_keymap_get_as_string2(keymap, format, XKB_KEYMAP_SERIALIZE_COMPACT);
+    assert(compact);
+    assert(strlen(compact) < strlen(expected));
+
+    /* Pretty-printing is ignored */
+    char * const compact_pretty = xkb_keymap_get_as_string2(
+        keymap, format,
+        XKB_KEYMAP_SERIALIZE_COMPACT | XKB_KEYMAP_SERIALIZE_PRETTY
+    );
+    assert_streq_not_null("compact pretty", compact, compact_pretty);
+    free(compact_pretty);
+
+    /* Streaming: the whitespace is stripped across the chunks boundaries */
+    const struct xkb_keymap_serialize_config config = {
+        .size = sizeof(config),
+        .flags = XKB_KEYMAP_SERIALIZE_COMPACT,
+        .format = format,
+    };
+    struct xkb_keymap_serialize_result result = { .size = sizeof(result) };
+    struct stream_sink sink = { .fail_after = SIZE_MAX };
+    assert(xkb_keymap_serialize_to_callback(keymap, &config, stream_write,
+                                            &sink, &result) == XKB_SUCCESS);
+    assert(result.length == strlen(compact));
+    assert(memcmp(sink.data, compact, sink.length) == 0);
+    free(sink.data);
+
+    /* Round-trip */
+    struct xkb_keymap * const keymap2 =
+        test_compile_string(ctx, format, compact);
+    assert(keymap2);
+    assert(xkb_keymap_compare(ctx, keymap, keymap2,
+                              (XKB_KEYMAP_CMP_ALL &
+                               ~(XKB_KEYMAP_CMP_POSSIBLY_DROPPED))));
+
+    /* Same result as the round-trip of the default serialization */
+    struct xkb_keymap * const keymap3 =
+        test_compile_string(ctx, format, expected);
+    assert(keymap3);
+    char * const expected2 =
+        xkb_keymap_get_as_string2(keymap3, format, XKB_KEYMAP_SERIALIZE_NO_FLAGS);
+    char * const got =
+        xkb_keymap_get_as_string2(keymap2, format, XKB_KEYMAP_SERIALIZE_NO_FLAGS);
+    assert_streq_not_null("compact round-trip", expected2, got);
+    free(got);
+    free(expected2);
+    xkb_keymap_unref(keymap3);
+    xkb_keymap_unref(keymap2);
+
+    free(compact);
+    free(expected);
+}
+
+static void
+test_compact_serialization(struct xkb_context *ctx)
+{
+    const enum xkb_keymap_format formats[] = {
+        XKB_KEYMAP_FORMAT_TEXT_V1, XKB_KEYMAP_FORMAT_TEXT_V2
+    };
+    for (size_t f = 0; f < ARRAY_SIZE(formats); f++) {
+        struct xkb_keymap * const keymap =
+            test_compile_rules(ctx, formats[f], NULL, NULL,
+                               "ru,ca,de,us", ",multix,neo,intl", NULL);
+        assert(keymap);
+        check_compact_serialization(ctx, keymap, formats[f]);
+        xkb_keymap_unref(keymap);
+    }
+
+    static const struct {
+        const char *path;
+        enum xkb_keymap_format format;
+    } files[] = {
+        { "keymaps/stringcomp-v1.xkb", XKB_KEYMAP_FORMAT_TEXT_V1 },
+        { "keymaps/stringcomp-v2.xkb", XKB_KEYMAP_FORMAT_TEXT_V2 },
+        { "keymaps/escape-sequences.xkb", XKB_KEYMAP_FORMAT_TEXT_V2 },
+        { "keymaps/explicit-actions.xkb", XKB_KEYMAP_FORMAT_TEXT_V2 },
+        { "keymaps/overlays-v2-1.xkb", XKB_KEYMAP_FORMAT_TEXT_V2 },
+        { "keymaps/keycodes-long-names-1-v1.xkb", XKB_KEYMAP_FORMAT_TEXT_V1 },
+    };
+    for (size_t k = 0; k < ARRAY_SIZE(files); k++) {
+        fprintf(stderr, "------\n*** %s: %s ***\n", __func__, files[k].path);
+        char * const string = test_read_file(files[k].path);
+        assert(string);
+        struct xkb_keymap * const keymap =
+            test_compile_string(ctx, files[k].format, string);
+        free(string);
+        assert(keymap);
+        check_compact_serialization(ctx, keymap, files[k].format);
+        xkb_keymap_unref(keymap);
+    }
+}
+
+static void
+test_shared_serialization(struct xkb_context *ctx)
+{
+    struct xkb_keymap * const keymap =
+        test_compile_rules(ctx, XKB_KEYMAP_FORMAT_TEXT_V2, NULL, NULL,
+                           "us,de", NULL, NULL);
+    assert(keymap);
+
+    const enum xkb_keymap_serialize_flags flags[] = {
+        XKB_KEYMAP_SERIALIZE_NO_FLAGS,
+        TEST_KEYMAP_SERIALIZE_FLAGS,
+    };
+    const char *shared[ARRAY_SIZE(flags)] = { NULL };
+    for (size_t k = 0; k < ARRAY_SIZE(flags); k++) {
+        char * const expected =
+            xkb_keymap_get_as_string2(keymap, XKB_KEYMAP_FORMAT_TEXT_V1,
+                                      flags[k]);
+        assert(expected);
+
+        size_t length = 0;
+        shared[k] = xkb_keymap_get_as_shared_string(
+            keymap, XKB_KEYMAP_FORMAT_TEXT_V1, flags[k], &length
+        );
+        assert_streq_not_null("shared string", expected, shared[k]);
+        assert(length == strlen(expected) + 1);
+        /* Cached */
+        assert(xkb_keymap_get_as_shared_string(keymap,
+                                               XKB_KEYMAP_FORMAT_TEXT_V1,
+                                               flags[k], NULL) == shared[k]);
+        /* Different cache key */
+        const char * const v2 = xkb_keymap_get_as_shared_string(
+            keymap, XKB_KEYMAP_FORMAT_TEXT_V2, flags[k], NULL
+        );
+        assert(v2 && v2 != shared[k]);
+        assert(xkb_keymap_get_as_shared_string(keymap,
+                                               XKB_KEYMAP_USE_ORIGINAL_FORMAT,
+                                               flags[k], NULL) == v2);
+
+#if HAVE_MEMFD_CREATE
+        size_t size = 0;
+        const int fd = xkb_keymap_get_as_sealed_fd(
+            keymap, XKB_KEYMAP_FORMAT_TEXT_V1, flags[k], &size
+        );
+        assert(fd >= 0);
+        assert(size == length);
+        assert(xkb_keymap_get_as_sealed_fd(keymap, XKB_KEYMAP_FORMAT_TEXT_V1,
+                                           flags[k], NULL) == fd);
+        struct stat st;
+        assert(fstat(fd, &st) == 0);
+        assert((size_t) st.st_size == size);
+        const char * const map = mmap(NULL, size, PROT_READ, MAP_PRIVATE,
+                                      fd, 0);
+        assert(map != MAP_FAILED);
+        assert(map[size - 1] == '\0');
+        assert_streq_not_null("sealed fd", expected, map);
+        munmap((void *) map, size);
+#ifdef F_GET_SEALS
+        const int seals = fcntl(fd, F_GET_SEALS);
+        assert(seals >= 0);
+        assert(seals & F_SEAL_WRITE);
+        assert(seals & F_SEAL_SHRINK);
+        assert(seals & F_SEAL_GROW);
+        assert(pwrite(fd, "x", 1, 0) < 0);
+        assert(ftruncate(fd, 0) < 0);
+        assert(mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                    fd, 0) == MAP_FAILED);
+#endif
+#endif
+
+        free(expected);
+    }
+    assert(shared[0] != shared[1]);
+
+    /* Invalid flags */
+    assert(!xkb_keymap_get_as_shared_string(keymap,
+                                            XKB_KEYMAP_FORMAT_TEXT_V1,
+                                            (enum xkb_keymap_serialize_flags)
+                                            0x80000000, NULL));
+
+    xkb_keymap_unref(keymap);
+}
+
 static struct xkb_keymap*
 compile_string(struct xkb_context *context, enum xkb_keymap_format format,
                const char *buf, size_t len, void *private)
@@ -323,6 +653,9 @@ main(int argc, char *argv[])
 
     test_keymap_comparison(ctx);
     test_explicit_actions(ctx);
+    test_serialize_stream(ctx);
+    test_compact_serialization(ctx);
+    test_shared_serialization(ctx);
 
     xkb_context_unref(ctx);
 
@@ -405,6 +405,7 @@ class TestXkbcli(unittest.TestCase):
             ["--strict", "-h"],
             ["--no-pretty", "-h"],
             ["--drop-unused", "-h"],
+            ["--compact", "-h"],
             ["--explicit-defaults", "-h"],
             ["--explicit-vmods", "-h"],
             ["--explicit-keys", "-h"],
@@ -18,6 +18,7 @@
 #include "utils-numbers.h"
 #include "utils-paths.h"
 #include "utils-random.h"
+#include "scanner-utils.h"
 #include "test/utils-text.h"
 
 static void
@@ -460,6 +461,74 @@ test_number_parsers(void)
 }
 /* NOLINTEND(google-readability-function-size) */
 
+static size_t
+scanner_span_scalar(const char *str, size_t len, enum scanner_chars chars)
+{
+    size_t i = 0;
+    while (i < len && scanner_chars_match(chars, str[i]))
+        i++;
+    return i;
+}
+
+static void
+test_scanner_span(void)
+{
+    static const enum scanner_chars classes[] = {
+        SCANNER_CHARS_SPACE,
+        SCANNER_CHARS_SPACE_NO_EOL,
+        SCANNER_CHARS_SPACE_TAB_CR,
+        SCANNER_CHARS_IDENT,
+        SCANNER_CHARS_GRAPH_NO_BACKSLASH,
+        SCANNER_CHARS_STRING,
+        SCANNER_CHARS_ANGLE_LITERAL,
+        SCANNER_CHARS_BLOCK,
+    };
+    char buffer[80];
+
+    for (size_t c = 0; c < ARRAY_SIZE(classes); c++) {
+        const enum scanner_chars chars = classes[c];
+
+        /* Every byte value, at every position of a SIMD block */
+        for (unsigned int b = 0; b < 256; b++) {
+            for (size_t pos = 0; pos < 40; pos++) {
+                /* Fill with a byte of the class */
+                for (size_t k = 0; k < sizeof(buffer); k++) {
+                    for (unsigned int f = 0; f < 256; f++) {
+                        if (scanner_chars_match(chars, (char) f)) {
+                            buffer[k] = (char) f;
+                            break;
+                        }
+                    }
+                }
+                buffer[pos] = (char) b;
+                const size_t expected =
+                    scanner_span_scalar(buffer, sizeof(buffer), chars);
+                assert(expected == (scanner_chars_match(chars, (char) b)
+                                    ? sizeof(buffer) : pos));
+                assert(scanner_span(buffer, sizeof(buffer), chars) ==
+                       expected);
+            }
+        }
+
+        /* Random strings */
+        static const char alphabet[] =
+            " \t\n\v\f\raZ09_-<>\"\\#!~{}/\x7f\x80\xe2\xff";
+        for (int r = 0; r < 2000; r++) {
+            const size_t len = (size_t) random() % sizeof(buffer);
+            const size_t run = (size_t) random() % (len + 1);
+            for (size_t k = 0; k < len; k++) {
+                /* Favor long runs of characters of the class */
+                do {
+                    buffer[k] = alphabet[(size_t) random() %
+                                         (sizeof(alphabet) - 1)];
+                } while (k < run && !scanner_chars_match(chars, buffer[k]));
+            }
+            assert(scanner_span(buffer, len, chars) ==
+                   scanner_span_scalar(buffer, len, chars));
+        }
+    }
+}
+
 /* CLI positional arguments:
  * 1. Seed for the pseudo-random generator:
  *    - Leave it unset or set it to “-” to use current time.
@@ -490,6 +559,7 @@ main(int argc, char *argv[])
     test_string_functions();
     test_path_functions();
     test_number_parsers();
+    test_scanner_span();
 
     return EXIT_SUCCESS;
 }
@@ -6,10 +6,15 @@
 #include "config.h"
 #include "test-config.h"
 
+#include <poll.h>
 #include <stdlib.h>
+#include <string.h>
+
+#include <xcb/xkb.h>
 
 #include "test.h"
 #include "xvfb-wrapper.h"
+#include "xkbcommon/xkbcommon-keysyms.h"
 #include "xkbcommon/xkbcommon-x11.h"
 
 X11_TEST(test_basic)
@@ -80,6 +85,288 @@ err_conn:
     return exit_code;
 }
 
+X11_TEST(test_async_keymap)
+{
+    struct xkb_context *ctx = test_get_context(CONTEXT_NO_FLAG);
+    int exit_code = EXIT_SUCCESS;
+
+    xcb_connection_t *conn = xcb_connect(display, NULL);
+    if (!conn || xcb_connection_has_error(conn) ||
+        !xkb_x11_setup_xkb_extension(conn,
+                                     XKB_X11_MIN_MAJOR_XKB_VERSION,
+                                     XKB_X11_MIN_MINOR_XKB_VERSION,
+                                     XKB_X11_SETUP_XKB_EXTENSION_NO_FLAGS,
+                                     NULL, NULL, NULL, NULL)) {
+        exit_code = TEST_SETUP_FAILURE;
+        goto err_conn;
+    }
+
+    const int32_t device_id = xkb_x11_get_core_keyboard_device_id(conn);
+    assert(device_id != -1);
+
+    /* Invalid device */
+    assert(!xkb_x11_keymap_request_new(ctx, conn, 128,
+                                       TEST_KEYMAP_COMPILE_FLAGS));
+
+    /* Cancel a pending request */
+    struct xkb_x11_keymap_request *request =
+        xkb_x11_keymap_request_new(ctx, conn, device_id,
+                                   TEST_KEYMAP_COMPILE_FLAGS);
+    assert(request);
+    xkb_x11_keymap_request_destroy(request);
+    xkb_x11_keymap_request_destroy(NULL);
+
+    /* Finish without polling */
+    request = xkb_x11_keymap_request_new(ctx, conn, device_id,
+                                         TEST_KEYMAP_COMPILE_FLAGS);
+    assert(request);
+    struct xkb_keymap *keymap = xkb_x11_keymap_request_finish(request);
+    assert(keymap);
+    char * const expected =
+        xkb_keymap_get_as_string(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT);
+    assert(expected);
+    xkb_keymap_unref(keymap);
+
+    /* Poll from an event loop */
+    request = xkb_x11_keymap_request_new(ctx, conn, device_id,
+                                         TEST_KEYMAP_COMPILE_FLAGS);
+    assert(request);
+    int ret;
+    while ((ret = xkb_x11_keymap_request_poll(request)) == 0) {
+        struct pollfd pfd = {
+            .fd = xcb_get_file_descriptor(conn),
+            .events = POLLIN,
+        };
+        assert(poll(&pfd, 1, 5000) > 0);
+    }
+    assert(ret == 1);
+    /* Does not change once completed */
+    assert(xkb_x11_keymap_request_poll(request) == 1);
+    keymap = xkb_x11_keymap_request_finish(request);
+    assert(keymap);
+    char * const got =
+        xkb_keymap_get_as_string(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT);
+    assert_streq_not_null("async keymap", expected, got);
+    free(got);
+    xkb_keymap_unref(keymap);
+
+    /* Same as the synchronous API */
+    keymap = xkb_x11_keymap_new_from_device(ctx, conn, device_id,
+                                            TEST_KEYMAP_COMPILE_FLAGS);
+    assert(keymap);
+    char * const sync =
+        xkb_keymap_get_as_string(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT);
+    assert_streq_not_null("sync keymap", expected, sync);
+    free(sync);
+    xkb_keymap_unref(keymap);
+
+    free(expected);
+err_conn:
+    xcb_disconnect(conn);
+    xkb_context_unref(ctx);
+
+    return exit_code;
+}
+
+X11_TEST(test_map_notify)
+{
+    struct xkb_context *ctx = test_get_context(CONTEXT_NO_FLAG);
+    int exit_code = EXIT_SUCCESS;
+    uint8_t base_event = 0;
+
+    xcb_connection_t *conn = xcb_connect(display, NULL);
+    if (!conn || xcb_connection_has_error(conn) ||
+        !xkb_x11_setup_xkb_extension(conn,
+                                     XKB_X11_MIN_MAJOR_XKB_VERSION,
+                                     XKB_X11_MIN_MINOR_XKB_VERSION,
+                                     XKB_X11_SETUP_XKB_EXTENSION_NO_FLAGS,
+                                     NULL, NULL, &base_event, NULL)) {
+        exit_code = TEST_SETUP_FAILURE;
+        goto err_conn;
+    }
+
+    const int32_t device_id = xkb_x11_get_core_keyboard_device_id(conn);
+    assert(device_id != -1);
+
+    static const xcb_xkb_select_events_details_t details = { 0 };
+    xcb_generic_error_t *error = xcb_request_check(conn,
+        xcb_xkb_select_events_aux_checked(conn, device_id,
+                                          XCB_XKB_EVENT_TYPE_MAP_NOTIFY, 0, 0,
+                                          0xff, 0xff, &details));
+    assert(!error);
+
+    struct xkb_keymap *keymap =
+        xkb_x11_keymap_new_from_device(ctx, conn, device_id,
+                                       TEST_KEYMAP_COMPILE_FLAGS);
+    assert(keymap);
+    char * const original =
+        xkb_keymap_get_as_string(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT);
+    assert(original);
+
+    /* Remap a single key */
+    const xcb_keycode_t keycode = 38;
+    static const xcb_keysym_t keysyms[] = { XKB_KEY_Greek_alpha, XKB_KEY_Greek_ALPHA };
+    error = xcb_request_check(conn,
+        xcb_change_keyboard_mapping_checked(conn, 1, keycode,
+                                            (uint8_t) ARRAY_SIZE(keysyms),
+                                            keysyms));
+    assert(!error);
+
+    /* The request check above ensures that the events are in the queue */
+    unsigned int notifications = 0;
+    xcb_generic_event_t *event;
+    while ((event = xcb_poll_for_queued_event(conn))) {
+        const xcb_xkb_map_notify_event_t * const notify = (void *) event;
+        if ((event->response_type & ~0x80) == base_event &&
+            notify->xkbType == XCB_XKB_MAP_NOTIFY) {
+            struct xkb_keymap * const updated =
+                xkb_x11_keymap_new_from_map_notify(keymap, conn, notify);
+            assert(updated);
+            xkb_keymap_unref(keymap);
+            keymap = updated;
+            notifications++;
+        }
+        free(event);
+    }
+    assert(notifications > 0);
+
+    const xkb_keysym_t *syms;
+    assert(xkb_keymap_key_get_syms_by_level(keymap, keycode, 0, 0, &syms) == 1);
+    assert(syms[0] == XKB_KEY_Greek_alpha);
+
+    /* Same as fetching the whole keymap */
+    char * const got =
+        xkb_keymap_get_as_string(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT);
+    assert(got);
+    assert(strcmp(original, got) != 0);
+    struct xkb_keymap * const expected_keymap =
+        xkb_x11_keymap_new_from_device(ctx, conn, device_id,
+                                       TEST_KEYMAP_COMPILE_FLAGS);
+    assert(expected_keymap);
+    char * const expected =
+        xkb_keymap_get_as_string(expected_keymap,
+                                 XKB_KEYMAP_USE_ORIGINAL_FORMAT);
+    assert_streq_not_null("updated keymap", expected, got);
+
+    free(expected);
+    free(got);
+    free(original);
+    xkb_keymap_unref(expected_keymap);
+    xkb_keymap_unref(keymap);
+err_conn:
+    xcb_disconnect(conn);
+    xkb_context_unref(ctx);
+
+    return exit_code;
+}
+
+X11_TEST(test_state_notify)
+{
+    struct xkb_context *ctx = test_get_context(CONTEXT_NO_FLAG);
+    int exit_code = EXIT_SUCCESS;
+    uint8_t base_event = 0;
+
+    xcb_connection_t *conn = xcb_connect(display, NULL);
+    if (!conn || xcb_connection_has_error(conn) ||
+        !xkb_x11_setup_xkb_extension(conn,
+                                     XKB_X11_MIN_MAJOR_XKB_VERSION,
+                                     XKB_X11_MIN_MINOR_XKB_VERSION,
+                                     XKB_X11_SETUP_XKB_EXTENSION_NO_FLAGS,
+                                     NULL, NULL, &base_event, NULL)) {
+        exit_code = TEST_SETUP_FAILURE;
+        goto err_conn;
+    }
+
+    const int32_t device_id = xkb_x11_get_core_keyboard_device_id(conn);
+    assert(device_id != -1);
+
+    static const xcb_xkb_select_events_details_t details = {
+        .affectState = XCB_XKB_STATE_PART_MODIFIER_LOCK,
+        .stateDetails = XCB_XKB_STATE_PART_MODIFIER_LOCK,
+    };
+    xcb_generic_error_t *error = xcb_request_check(conn,
+        xcb_xkb_select_events_aux_checked(conn, device_id,
+                                          XCB_XKB_EVENT_TYPE_STATE_NOTIFY,
+                                          0, 0, 0, 0, &details));
+    assert(!error);
+
+    struct xkb_keymap * const keymap =
+        xkb_x11_keymap_new_from_device(ctx, conn, device_id,
+                                       TEST_KEYMAP_COMPILE_FLAGS);
+    assert(keymap);
+    struct xkb_state * const state1 =
+        xkb_x11_state_new_from_device(keymap, conn, device_id);
+    struct xkb_state * const state2 =
+        xkb_x11_state_new_from_device(keymap, conn, device_id);
+    assert(state1 && state2);
+    const xkb_mod_index_t lock = xkb_keymap_mod_get_index(keymap, XKB_MOD_NAME_CAPS);
+    assert(!xkb_state_mod_index_is_active(state1, lock, XKB_STATE_MODS_LOCKED));
+
+    /* Lock then unlock then lock Caps Lock */
+    for (unsigned int k = 0; k < 3; k++) {
+        error = xcb_request_check(conn,
+            xcb_xkb_latch_lock_state_checked(conn, device_id,
+                                             XCB_MOD_MASK_LOCK,
+                                             (k % 2) ? 0 : XCB_MOD_MASK_LOCK,
+                                             0, 0, 0, 0, 0));
+        assert(!error);
+    }
+
+    /* The request checks above ensure that the events are in the queue */
+    xcb_generic_event_t *events[16];
+    size_t count = 0;
+    while (count < ARRAY_SIZE(events) &&
+           (events[count] = xcb_poll_for_queued_event(conn)))
+        count++;
+    assert(count >= 3);
+
+    /* One by one */
+    for (size_t e = 0; e < count; e++) {
+        const xcb_xkb_state_notify_event_t * const notify = (void *) events[e];
+        if ((events[e]->response_type & ~0x80) == base_event &&
+            notify->xkbType == XCB_XKB_STATE_NOTIFY)
+            xkb_x11_state_update_from_state_notify(state1, notify);
+    }
+    assert(xkb_state_mod_index_is_active(state1, lock, XKB_STATE_MODS_LOCKED));
+
+    /* Coalesced */
+    assert(xkb_x11_state_update_from_events(state2, device_id, base_event,
+                                            (const xcb_generic_event_t * const *)
+                                                events, count) &
+           XKB_STATE_MODS_LOCKED);
+    assert(xkb_state_mod_index_is_active(state2, lock, XKB_STATE_MODS_LOCKED));
+    assert(xkb_state_serialize_mods(state1, XKB_STATE_MODS_EFFECTIVE) ==
+           xkb_state_serialize_mods(state2, XKB_STATE_MODS_EFFECTIVE));
+    /* Idempotent */
+    assert(xkb_x11_state_update_from_events(state2, device_id, base_event,
+                                            (const xcb_generic_event_t * const *)
+                                                events, count) == 0);
+
+    /* Controls */
+    const xcb_xkb_controls_notify_event_t controls_notify = {
+        .response_type = base_event,
+        .xkbType = XCB_XKB_CONTROLS_NOTIFY,
+        .deviceID = (uint8_t) device_id,
+        .enabledControls = XCB_XKB_BOOL_CTRL_STICKY_KEYS,
+        .enabledControlChanges = XCB_XKB_BOOL_CTRL_STICKY_KEYS,
+    };
+    assert(xkb_x11_state_update_from_controls_notify(state1, &controls_notify) &
+           XKB_STATE_CONTROLS);
+    assert(xkb_state_serialize_enabled_controls(state1, XKB_STATE_CONTROLS) &
+           XKB_KEYBOARD_CONTROL_A11Y_STICKY_KEYS);
+
+    for (size_t e = 0; e < count; e++)
+        free(events[e]);
+    xkb_state_unref(state1);
+    xkb_state_unref(state2);
+    xkb_keymap_unref(keymap);
+err_conn:
+    xcb_disconnect(conn);
+    xkb_context_unref(ctx);
+
+    return exit_code;
+}
+
 int main(void) {
     test_init();
 
@@ -110,6 +110,9 @@ usage(FILE *file, const char *progname)
            "    Do not pretty-print when serializing a keymap\n"
            " --drop-unused\n"
            "    Disable unused bits serialization\n"
+           " --compact\n"
+           "    Serialize to a compact form, suitable for wire transfer.\n"
+           "    Combine with --drop-unused for the smallest output.\n"
            " --explicit-defaults\n"
            "    Force serializing default values\n"
            " --explicit-vmods\n"
@@ -186,6 +189,7 @@ parse_options(int argc, char **argv,
         OPT_KEYMAP_OUTPUT_STRICT,
         OPT_KEYMAP_NO_PRETTY,
         OPT_KEYMAP_DROP_UNUSED,
+        OPT_KEYMAP_COMPACT,
         OPT_KEYMAP_EXPLICIT_DEFAULTS,
         OPT_KEYMAP_EXPLICIT_VMODS,
         OPT_KEYMAP_EXPLICIT_KEYS,
@@ -229,6 +233,7 @@ parse_options(int argc, char **argv,
         {"output-strict",    no_argument,            0, OPT_KEYMAP_OUTPUT_STRICT},
         {"no-pretty",        no_argument,            0, OPT_KEYMAP_NO_PRETTY},
         {"drop-unused",      no_argument,            0, OPT_KEYMAP_DROP_UNUSED},
+        {"compact",          no_argument,            0, OPT_KEYMAP_COMPACT},
         {"explicit-defaults",no_argument,            0, OPT_KEYMAP_EXPLICIT_DEFAULTS},
         {"explicit-vmods",   no_argument,            0, OPT_KEYMAP_EXPLICIT_VMODS},
         {"explicit-keys",    no_argument,            0, OPT_KEYMAP_EXPLICIT_KEYS},
@@ -339,6 +344,9 @@ parse_options(int argc, char **argv,
         case OPT_KEYMAP_DROP_UNUSED:
             *serialize_flags &= ~XKB_KEYMAP_SERIALIZE_KEEP_UNUSED;
             break;
+        case OPT_KEYMAP_COMPACT:
+            *serialize_flags |= XKB_KEYMAP_SERIALIZE_COMPACT;
+            break;
         case OPT_KEYMAP_EXPLICIT_DEFAULTS:
             *serialize_flags |= XKB_KEYMAP_SERIALIZE_EXPLICIT_DEFAULT_VALUES;
             break;
@@ -465,31 +465,19 @@ lookup_keysym_entries(darray_keysym_entries *entries, xkb_keysym_t keysym,
 #define LOCK_MASK  UINT32_C(0x2)
 #define SHIFT_LOCK_MASK (SHIFT_MASK | LOCK_MASK)
 
-/**
- * Given a keysym, add its position in the keymap if it is used in a
- * Compose sequence
- */
-static bool
-add_compose_keysym_entry(struct xkb_keymap *keymap,
-                         darray_keysym_entries *entries, xkb_keysym_t keysym,
-                         xkb_keycode_t keycode, xkb_layout_index_t layout,
-                         xkb_level_index_t level)
+/** Add the position in the keymap of a keysym used in a Compose sequence */
+static void
+add_compose_keysym_entry(struct keysym_entries *entry,
+                         const struct xkb_keysym_position *position)
 {
-    struct keysym_entries * const entry =
-        lookup_keysym_entries(entries, keysym, false);
-    if (!entry)
-        return false;
-
     /*
      * The keysym position may be reached by multiple modifiers combinations:
      * append an entry for all but combo including another one, so that we
      * avoid combinatorial explosion.
      */
-    xkb_mod_mask_t masks[MAX_TYPE_MAP_ENTRIES];
+    const xkb_mod_mask_t * const masks = position->masks;
     bool skip[MAX_TYPE_MAP_ENTRIES] = {0};
-    const size_t num_masks = xkb_keymap_key_get_mods_for_level(
-        keymap, keycode, layout, level, masks, ARRAY_SIZE(masks)
-    );
+    const size_t num_masks = MIN(position->num_masks, ARRAY_SIZE(skip));
     for (size_t j = 0; j < num_masks; j++) {
         for (size_t k = j + 1; k < num_masks; k++) {
             /* skip “shift cancel lock” */
@@ -514,14 +502,13 @@ add_compose_keysym_entry(struct xkb_keymap *keymap,
         if (skip[j])
             continue;
         const struct keysym_entry new = {
-            .keycode = keycode,
-            .layout = layout,
-            .level = level,
+            .keycode = position->keycode,
+            .layout = position->layout,
+            .level = position->level,
             .mask = masks[j]
         };
         darray_append(entry->entries, new);
     }
-    return true;
 }
 
 static void
@@ -633,81 +620,68 @@ main(int argc, char *argv[])
     printf("%-8s %-9s %-8s %-20s %-7s %-s\n",
            "KEYCODE", "KEY NAME", "LAYOUT", "LAYOUT NAME", "LEVEL#", "MODIFIERS");
 
-    /* Iterate over all the positions in the keymap */
-    const xkb_keycode_t min_keycode = xkb_keymap_min_keycode(keymap);
-    const xkb_keycode_t max_keycode = xkb_keymap_max_keycode(keymap);
+    /* Iterate over all the positions of the keysym in the keymap */
     const xkb_mod_index_t num_mods = xkb_keymap_num_mods(keymap);
-    darray(xkb_keysym_t) key_compose_keysyms = darray_new();
-    for (xkb_keycode_t keycode = min_keycode; keycode <= max_keycode; keycode++) {
-        const char* const key_name = xkb_keymap_key_get_name(keymap, keycode);
+    const struct xkb_keysym_position *positions = NULL;
+    const int num_positions =
+        xkb_keymap_keysym_get_positions(keymap, keysym, &positions);
+    if (num_positions < 0) {
+        fprintf(stderr, "ERROR: Failed to look up keysym positions\n");
+        goto err_compose;
+    }
+    for (int p = 0; p < num_positions; p++) {
+        const struct xkb_keysym_position * const position = &positions[p];
+        const char* const key_name =
+            xkb_keymap_key_get_name(keymap, position->keycode);
         if (!key_name) {
             continue;
         }
+        const char *layout_name =
+            xkb_keymap_layout_get_name(keymap, position->layout);
+        if (!layout_name) {
+            layout_name = "?";
+        }
 
-        const xkb_layout_index_t num_layouts =
-            xkb_keymap_num_layouts_for_key(keymap, keycode);
-        for (xkb_layout_index_t layout = 0; layout < num_layouts; layout++) {
-            const char *layout_name = xkb_keymap_layout_get_name(keymap, layout);
-            if (!layout_name) {
-                layout_name = "?";
-            }
-
-            const xkb_level_index_t num_levels =
-                xkb_keymap_num_levels_for_key(keymap, keycode, layout);
-            darray_resize(key_compose_keysyms, 0);
-            for (xkb_level_index_t level = 0; level < num_levels; level++) {
-                const xkb_keysym_t *syms;
-                const int num_syms = xkb_keymap_key_get_syms_by_level(
-                    keymap, keycode, layout, level, &syms
-                );
-                if (num_syms != 1) {
-                    /* We only deal with levels with exactly one keysym */
-                    continue;
-                }
-                if (syms[0] != keysym) {
-                    /*
-                     * If it is not the keysym we look for, then check if it is
-                     * a keysym that contribute to a Compose sequence that
-                     * produce it. For our use case there is no point to list
-                     * Compose sequences producing a keysym that is also in the
-                     * the sequence producing it.
-                     *
-                     * Keep only the lowest level, so that we avoid combinatorial
-                     * explosion.
-                     */
-                    /* Look for the current keysym in previous levels */
-                    for (darray_size_t k = 0;
-                         k < darray_size(key_compose_keysyms);
-                         k++) {
-                        if (darray_item(key_compose_keysyms, k) == syms[0]) {
-                            /* Found it: skip this level */
-                            goto next_level;
-                        }
-                    }
-                    /* First occurrence of the keysym on the layout/key */
-                    darray_append(key_compose_keysyms, syms[0]);
-                    /* Add the keysym position if in a Compose sequence */
-                    add_compose_keysym_entry(
-                        keymap, &keysym_entries, syms[0],
-                        keycode, layout, level
-                    );
-next_level:
-                    continue;
-                }
+        /* Found our keysym: print the combo that generates it */
+        for (uint32_t i = 0; i < position->num_masks; i++) {
+            print_combo(keymap, num_mods, position->keycode, key_name,
+                        position->layout, layout_name, position->level,
+                        position->masks[i]);
+        }
+    }
 
-                /* Found our keysym: print the combo that generates it */
-                xkb_mod_mask_t masks[MAX_TYPE_MAP_ENTRIES];
-                const size_t num_masks = xkb_keymap_key_get_mods_for_level(
-                    keymap, keycode, layout, level, masks, ARRAY_SIZE(masks)
-                );
-                for (size_t i = 0; i < num_masks; i++) {
-                    print_combo(keymap, num_mods, keycode, key_name,
-                                layout, layout_name, level, masks[i]);
+    /*
+     * Get the positions of the keysyms that contribute to a Compose sequence
+     * that produce our keysym. For our use case there is no point to list
+     * Compose sequences producing a keysym that is also in the the sequence
+     * producing it.
+     */
+    struct keysym_entries *keysym_entry;
+    darray_foreach(keysym_entry, keysym_entries) {
+        if (keysym_entry->keysym == keysym)
+            continue;
+        const int count = xkb_keymap_keysym_get_positions(
+            keymap, keysym_entry->keysym, &positions
+        );
+        for (int p = 0; p < count; p++) {
+            /*
+             * Keep only the lowest level of a key/layout, so that we avoid
+             * combinatorial explosion. Positions are sorted by layout, level
+             * and keycode.
+             */
+            for (int q = 0; q < p; q++) {
+                if (positions[q].keycode == positions[p].keycode &&
+                    positions[q].layout == positions[p].layout) {
+                    /* Found it: skip this level */
+                    goto next_position;
                 }
             }
+            if (xkb_keymap_key_get_name(keymap, positions[p].keycode))
+                add_compose_keysym_entry(keysym_entry, &positions[p]);
+next_position:
+            continue;
         }
     }
-    darray_free(key_compose_keysyms);
 
     /* Compose sequences */
     if (use_compose) {
@@ -828,6 +802,7 @@ skip:
 
     ret = EXIT_SUCCESS;
 
+err_compose:
     darray_free(compose_entries);
     darray_keysym_entries_free(&keysym_entries);
 